@@ -0,0 +1,146 @@
+/*******************************************************************************
+ * CGoGN: Combinatorial and Geometric modeling with Generic N-dimensional Maps  *
+ * version 0.1                                                                  *
+ * Copyright (C) 2009-2012, IGG Team, LSIIT, University of Strasbourg           *
+ *                                                                              *
+ * This library is free software; you can redistribute it and/or modify it      *
+ * under the terms of the GNU Lesser General Public License as published by the *
+ * Free Software Foundation; either version 2.1 of the License, or (at your     *
+ * option) any later version.                                                   *
+ *                                                                              *
+ * This library is distributed in the hope that it will be useful, but WITHOUT  *
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or        *
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License  *
+ * for more details.                                                            *
+ *                                                                              *
+ * You should have received a copy of the GNU Lesser General Public License     *
+ * along with this library; if not, write to the Free Software Foundation,      *
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301 USA.           *
+ *                                                                              *
+ * Web site: http://cgogn.unistra.fr/                                           *
+ * Contact information: cgogn@unistra.fr                                        *
+ *                                                                              *
+ *******************************************************************************/
+
+
+#include "Topology/generic/parameters.h"
+#include "Topology/map/embeddedMap2.h"
+#include "Algo/Tiling/Surface/triangular.h"
+#include "Algo/Deformation/asRigidAsPossible.h"
+#include "Algo/Topo/basic.h"
+#include "Utils/benchmark.h"
+
+#include <sstream>
+#include <cstdlib>
+#include <cstring>
+
+
+using namespace CGoGN ;
+
+/**
+ * As-rigid-as-possible iterations per second versus the size of the mesh.
+ * For each size n, a triangulated tore of 2*n*n vertices is deformed: the vertices
+ * with x > 9 are moved (handle), those with x < -9 are fixed, the others are free.
+ * The factorization, the local step (rotations), the global step (solve) and the
+ * whole iteration are measured.
+ *
+ * usage: bench_arap [-w nbWarmups] [-i nbIterations] [-t nbThreads] [-n 50,100,200]
+ *                   [-o results.json|results.csv]
+ */
+struct PFP: public PFP_STANDARD
+{
+	// definition of the type of the map
+	typedef EmbeddedMap2 MAP;
+};
+
+typedef PFP::MAP MAP;
+typedef PFP::VEC3 VEC3;
+
+void benchARAP(Utils::Benchmark& bench, unsigned int n, unsigned int nbth)
+{
+	MAP myMap;
+	VertexAttribute<VEC3, MAP> position = myMap.addAttribute<VEC3, VERTEX, MAP>("position");
+	Algo::Surface::Tilings::Triangular::Tore<PFP> tore(myMap, 2*n, n);
+	tore.embedIntoTore(position, 10.0f, 3.0f);
+
+	VertexAttribute<VEC3, MAP> positionInit = myMap.addAttribute<VEC3, VERTEX, MAP>("positionInit");
+	myMap.copyAttribute(positionInit, position);
+
+	CellMarker<MAP, VERTEX> freeMarker(myMap);
+	foreach_cell<VERTEX>(myMap, [&] (Vertex v)
+	{
+		const VEC3& p = position[v];
+		if (p[0] > 9.0f)
+			position[v] += VEC3(2.0f, 0.0f, 4.0f);
+		else if (p[0] > -9.0f)
+			freeMarker.mark(v);
+	});
+
+	unsigned int nbVertices = Algo::Topo::getNbOrbits<VERTEX>(myMap);
+	std::stringstream ss;
+	ss << "arap/" << nbVertices;
+	std::string prefix = ss.str();
+
+	Algo::Surface::Deformation::AsRigidAsPossible<PFP> arap(myMap, position, positionInit, nbth);
+
+	bench.run(prefix + "/factorization", [&] ()
+	{
+		arap.resetConstraints();
+		arap.setConstraints(freeMarker);
+	}, nbVertices);
+
+	arap.matchDiffCoord();
+
+	bench.run(prefix + "/local_step", [&] ()
+	{
+		arap.computeRotations();
+	}, nbVertices);
+
+	bench.run(prefix + "/global_step", [&] ()
+	{
+		arap.computePositions();
+	}, nbVertices);
+
+	const Utils::Benchmark::Result& r = bench.run(prefix + "/iteration", [&] ()
+	{
+		arap.iterate();
+	}, nbVertices);
+
+	if (r.median > 0)
+		CGoGNout << prefix << ": " << (1000.0 / r.median) << " iterations/s" << CGoGNendl;
+}
+
+int main(int argc, char **argv)
+{
+	unsigned int nbWarmups = 1;
+	unsigned int nbIterations = 5;
+	unsigned int nbth = Parallel::NumberOfThreads;
+	std::string sizes("50,100,200");
+	std::string output;
+
+	for (int i = 1; i < argc; ++i)
+	{
+		if (!strcmp(argv[i], "-w") && (i + 1 < argc))
+			nbWarmups = atoi(argv[++i]);
+		else if (!strcmp(argv[i], "-i") && (i + 1 < argc))
+			nbIterations = atoi(argv[++i]);
+		else if (!strcmp(argv[i], "-t") && (i + 1 < argc))
+			nbth = atoi(argv[++i]);
+		else if (!strcmp(argv[i], "-n") && (i + 1 < argc))
+			sizes = argv[++i];
+		else if (!strcmp(argv[i], "-o") && (i + 1 < argc))
+			output = argv[++i];
+	}
+
+	Utils::Benchmark bench("arap", nbWarmups, nbIterations);
+
+	std::stringstream ss(sizes);
+	std::string size;
+	while (std::getline(ss, size, ','))
+		benchARAP(bench, atoi(size.c_str()), nbth);
+
+	if (!output.empty() && !bench.save(output))
+		return 1;
+
+	return 0;
+}
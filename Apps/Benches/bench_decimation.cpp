@@ -0,0 +1,104 @@
+/*******************************************************************************
+ * CGoGN: Combinatorial and Geometric modeling with Generic N-dimensional Maps  *
+ * version 0.1                                                                  *
+ * Copyright (C) 2009-2012, IGG Team, LSIIT, University of Strasbourg           *
+ *                                                                              *
+ * This library is free software; you can redistribute it and/or modify it      *
+ * under the terms of the GNU Lesser General Public License as published by the *
+ * Free Software Foundation; either version 2.1 of the License, or (at your     *
+ * option) any later version.                                                   *
+ *                                                                              *
+ * This library is distributed in the hope that it will be useful, but WITHOUT  *
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or        *
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License  *
+ * for more details.                                                            *
+ *                                                                              *
+ * You should have received a copy of the GNU Lesser General Public License     *
+ * along with this library; if not, write to the Free Software Foundation,      *
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301 USA.           *
+ *                                                                              *
+ * Web site: http://cgogn.unistra.fr/                                           *
+ * Contact information: cgogn@unistra.fr                                        *
+ *                                                                              *
+ *******************************************************************************/
+
+
+
+#include "Topology/generic/parameters.h"
+#include "Topology/map/embeddedMap2.h"
+#include "Algo/Tiling/Surface/triangular.h"
+#include "Algo/Decimation/decimation.h"
+#include "Algo/Topo/basic.h"
+#include "Utils/chrono.h"
+
+
+using namespace CGoGN ;
+
+/**
+ * Throughput of the edge collapse decimation (collapses per second)
+ * on a triangulated tore of 2*n*m faces (5M faces by default)
+ */
+struct PFP: public PFP_STANDARD
+{
+	// definition of the type of the map
+	typedef EmbeddedMap2 MAP;
+};
+
+typedef PFP::MAP MAP;
+typedef PFP::VEC3 VEC3;
+
+int main(int argc, char **argv)
+{
+	unsigned int n = 2500;
+	unsigned int m = 1000;
+	if (argc > 2)
+	{
+		n = atoi(argv[1]);
+		m = atoi(argv[2]);
+	}
+
+	MAP myMap;
+	VertexAttribute<VEC3, MAP> position = myMap.addAttribute<VEC3, VERTEX, MAP>("position");
+
+	Utils::Chrono ch;
+	ch.start();
+	Algo::Surface::Tilings::Triangular::Tore<PFP> tore(myMap, n, m);
+	tore.embedIntoTore(position, 10.0f, 3.0f);
+	CGoGNout << "construct tore of " << 2*n*m << " faces in " << ch.elapsed() << " ms" << CGoGNendl;
+
+	const Algo::Surface::Decimation::SelectorType selectors[4] = {
+		Algo::Surface::Decimation::S_EdgeLength,
+		Algo::Surface::Decimation::S_QEM,
+		Algo::Surface::Decimation::S_QEMml,
+		Algo::Surface::Decimation::S_hQEMml
+	};
+	const Algo::Surface::Decimation::ApproximatorType approximators[4] = {
+		Algo::Surface::Decimation::A_QEM,
+		Algo::Surface::Decimation::A_QEM,
+		Algo::Surface::Decimation::A_QEM,
+		Algo::Surface::Decimation::A_hQEM
+	};
+	const char* names[4] = { "EdgeLength", "QEM", "QEMml", "hQEMml" };
+
+	for (unsigned int i = 0; i < 4; ++i)
+	{
+		MAP decMap;
+		decMap.copyFrom(myMap);
+		VertexAttribute<VEC3, MAP> pos = decMap.getAttribute<VEC3, VERTEX, MAP>("position");
+		std::vector<VertexAttribute<VEC3, MAP> > decAttr;
+		decAttr.push_back(pos);
+
+		unsigned int nbVertices = Algo::Topo::getNbOrbits<VERTEX>(decMap);
+		ch.start();
+		Algo::Surface::Decimation::decimate<PFP>(decMap, selectors[i], approximators[i], decAttr, nbVertices / 10);
+		int t = ch.elapsed();
+		unsigned int nbCollapses = nbVertices - Algo::Topo::getNbOrbits<VERTEX>(decMap);
+
+		CGoGNout << names[i] << ": " << nbCollapses << " collapses in " << t << " ms";
+		if (t > 0)
+			CGoGNout << " (" << (1000.0 * nbCollapses / t) << " collapses/s)";
+		CGoGNout << CGoGNendl;
+	}
+
+	return 0;
+}
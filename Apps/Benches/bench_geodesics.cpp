@@ -0,0 +1,170 @@
+/*******************************************************************************
+ * CGoGN: Combinatorial and Geometric modeling with Generic N-dimensional Maps  *
+ * version 0.1                                                                  *
+ * Copyright (C) 2009-2012, IGG Team, LSIIT, University of Strasbourg           *
+ *                                                                              *
+ * This library is free software; you can redistribute it and/or modify it      *
+ * under the terms of the GNU Lesser General Public License as published by the *
+ * Free Software Foundation; either version 2.1 of the License, or (at your     *
+ * option) any later version.                                                   *
+ *                                                                              *
+ * This library is distributed in the hope that it will be useful, but WITHOUT  *
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or        *
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License  *
+ * for more details.                                                            *
+ *                                                                              *
+ * You should have received a copy of the GNU Lesser General Public License     *
+ * along with this library; if not, write to the Free Software Foundation,      *
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301 USA.           *
+ *                                                                              *
+ * Web site: http://cgogn.unistra.fr/                                           *
+ * Contact information: cgogn@unistra.fr                                        *
+ *                                                                              *
+ *******************************************************************************/
+
+
+#include "Topology/generic/parameters.h"
+#include "Topology/map/embeddedMap2.h"
+#include "Algo/Tiling/Surface/triangular.h"
+#include "Algo/Geometry/geodesics.h"
+#include "Algo/Geometry/voronoiDiagrams.h"
+#include "Algo/Topo/basic.h"
+#include "Utils/benchmark.h"
+
+#include <sstream>
+#include <cstdlib>
+#include <cstring>
+
+
+using namespace CGoGN ;
+
+/**
+ * Geodesic fronts versus the size of the mesh and the number of seeds.
+ * For each size n, seeds are spread on a triangulated tore of 2*n*n vertices:
+ * multi-source Dijkstra and fast marching, the runs in the regions of all the
+ * seeds, the Voronoi diagram and one step of the centroidal Voronoi diagram
+ * (energy and gradients, move of the seeds along one edge, new diagram) are measured.
+ *
+ * usage: bench_geodesics [-w nbWarmups] [-i nbIterations] [-t nbThreads] [-n 50,100,200]
+ *                        [-s nbSeeds] [-o results.json|results.csv]
+ */
+struct PFP: public PFP_STANDARD
+{
+	// definition of the type of the map
+	typedef EmbeddedMap2 MAP;
+};
+
+typedef PFP::MAP MAP;
+typedef PFP::VEC3 VEC3;
+typedef PFP::REAL REAL;
+
+void benchGeodesics(Utils::Benchmark& bench, unsigned int n, unsigned int nbSeeds, unsigned int nbth)
+{
+	MAP myMap;
+	VertexAttribute<VEC3, MAP> position = myMap.addAttribute<VEC3, VERTEX, MAP>("position");
+	Algo::Surface::Tilings::Triangular::Tore<PFP> tore(myMap, 2*n, n);
+	tore.embedIntoTore(position, 10.0f, 3.0f);
+
+	EdgeAttribute<REAL, MAP> edgeLength = myMap.addAttribute<REAL, EDGE, MAP>("edgeLength");
+	foreach_cell<EDGE>(myMap, [&] (Edge e)
+	{
+		edgeLength[e] = (position[myMap.phi1(e.dart)] - position[e.dart]).norm();
+	});
+	VertexAttribute<REAL, MAP> area = myMap.addAttribute<REAL, VERTEX, MAP>("area");
+	area.setAllValues(1.0f);
+
+	VertexAttribute<REAL, MAP> distance = myMap.addAttribute<REAL, VERTEX, MAP>("distance");
+	VertexAttribute<unsigned int, MAP> region = myMap.addAttribute<unsigned int, VERTEX, MAP>("region");
+	VertexAttribute<Dart, MAP> pathOrigin = myMap.addAttribute<Dart, VERTEX, MAP>("pathOrigin");
+
+	unsigned int nbVertices = Algo::Topo::getNbOrbits<VERTEX>(myMap);
+	if (nbSeeds > nbVertices)
+		nbSeeds = nbVertices;
+
+	// seeds spread regularly in the traversal
+	std::vector<Dart> seeds;
+	unsigned int i = 0;
+	TraversorV<MAP> tv(myMap);
+	for (Dart d = tv.begin(); (d != tv.end()) && (seeds.size() < nbSeeds); d = tv.next(), ++i)
+	{
+		if (i % (nbVertices / nbSeeds) == 0)
+			seeds.push_back(d);
+	}
+
+	std::stringstream ss;
+	ss << "geodesics/" << nbVertices << "/" << seeds.size();
+	std::string prefix = ss.str();
+
+	Algo::Surface::Geometry::GeodesicDistance<PFP> geodesics(myMap, position, nbth);
+
+	bench.run(prefix + "/dijkstra", [&] ()
+	{
+		geodesics.computeDijkstra(seeds, distance, region, &pathOrigin);
+	}, nbVertices);
+
+	bench.run(prefix + "/fast_marching", [&] ()
+	{
+		geodesics.computeFastMarching(seeds, distance, region, &pathOrigin);
+	}, nbVertices);
+
+	bench.run(prefix + "/fast_marching_in_regions", [&] ()
+	{
+		geodesics.computeFastMarchingInRegions(seeds, region, distance, &pathOrigin);
+	}, nbVertices);
+
+	Algo::Surface::Geometry::CentroidalVoronoiDiagram<PFP> cvd(myMap, edgeLength, region, distance, pathOrigin, area, nbth);
+	cvd.setSeeds_fromVector(seeds);
+
+	bench.run(prefix + "/voronoi_diagram", [&] ()
+	{
+		cvd.computeDiagram();
+	}, nbVertices);
+
+	const Utils::Benchmark::Result& r = bench.run(prefix + "/cvd_step", [&] ()
+	{
+		cvd.cumulateEnergyAndGradients();
+		cvd.moveSeedsOneEdgeCheck();
+		cvd.computeDiagram();
+	}, nbVertices);
+
+	if (r.median > 0)
+		CGoGNout << prefix << ": " << (1000.0 / r.median) << " CVD steps/s" << CGoGNendl;
+}
+
+int main(int argc, char **argv)
+{
+	unsigned int nbWarmups = 1;
+	unsigned int nbIterations = 5;
+	unsigned int nbth = Parallel::NumberOfThreads;
+	unsigned int nbSeeds = 1000;
+	std::string sizes("50,100,200");
+	std::string output;
+
+	for (int i = 1; i < argc; ++i)
+	{
+		if (!strcmp(argv[i], "-w") && (i + 1 < argc))
+			nbWarmups = atoi(argv[++i]);
+		else if (!strcmp(argv[i], "-i") && (i + 1 < argc))
+			nbIterations = atoi(argv[++i]);
+		else if (!strcmp(argv[i], "-t") && (i + 1 < argc))
+			nbth = atoi(argv[++i]);
+		else if (!strcmp(argv[i], "-n") && (i + 1 < argc))
+			sizes = argv[++i];
+		else if (!strcmp(argv[i], "-s") && (i + 1 < argc))
+			nbSeeds = atoi(argv[++i]);
+		else if (!strcmp(argv[i], "-o") && (i + 1 < argc))
+			output = argv[++i];
+	}
+
+	Utils::Benchmark bench("geodesics", nbWarmups, nbIterations);
+
+	std::stringstream ss(sizes);
+	std::string size;
+	while (std::getline(ss, size, ','))
+		benchGeodesics(bench, atoi(size.c_str()), nbSeeds, nbth);
+
+	if (!output.empty() && !bench.save(output))
+		return 1;
+
+	return 0;
+}
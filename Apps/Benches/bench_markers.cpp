@@ -0,0 +1,160 @@
+/*******************************************************************************
+ * CGoGN: Combinatorial and Geometric modeling with Generic N-dimensional Maps  *
+ * version 0.1                                                                  *
+ * Copyright (C) 2009-2012, IGG Team, LSIIT, University of Strasbourg           *
+ *                                                                              *
+ * This library is free software; you can redistribute it and/or modify it      *
+ * under the terms of the GNU Lesser General Public License as published by the *
+ * Free Software Foundation; either version 2.1 of the License, or (at your     *
+ * option) any later version.                                                   *
+ *                                                                              *
+ * This library is distributed in the hope that it will be useful, but WITHOUT  *
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or        *
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License  *
+ * for more details.                                                            *
+ *                                                                              *
+ * You should have received a copy of the GNU Lesser General Public License     *
+ * along with this library; if not, write to the Free Software Foundation,      *
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301 USA.           *
+ *                                                                              *
+ * Web site: http://cgogn.unistra.fr/                                           *
+ * Contact information: cgogn@unistra.fr                                        *
+ *                                                                              *
+ *******************************************************************************/
+
+
+#include "Topology/generic/parameters.h"
+#include "Topology/map/embeddedMap2.h"
+#include "Topology/generic/dartmarker.h"
+#include "Topology/generic/cellmarker.h"
+#include "Algo/Tiling/Surface/triangular.h"
+#include "Utils/threadPool.h"
+#include "Utils/benchmark.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+
+
+using namespace CGoGN ;
+
+/**
+ * Creation / destruction of markers and buffers under contention:
+ * each thread of a pool registered on the map repeatedly asks and releases
+ * dart markers (bits and epochs), cell markers and dart buffers (the cost is dominated by
+ * the lookup of the thread slot). Threads counts go from 1 to maxThreads,
+ * which may be larger than the number of cores.
+ *
+ * usage: bench_markers [-t maxThreads] [-n nbPerThread] [-i nbIterations] [-o results.json|results.csv]
+ */
+struct PFP: public PFP_STANDARD
+{
+	// definition of the type of the map
+	typedef EmbeddedMap2 MAP;
+};
+
+typedef PFP::MAP MAP;
+typedef PFP::VEC3 VEC3;
+
+std::atomic<unsigned int> sink(0);
+
+template <typename FUNC>
+void benchThreads(Utils::Benchmark& bench, const std::string& name, Utils::ThreadPool& pool, unsigned int nbth, unsigned int nbPerThread, FUNC f)
+{
+	bench.run(name + "/" + std::to_string(nbth), [&] ()
+	{
+		pool.parallelFor(nbth, 1, [&] (unsigned int, unsigned int, unsigned int)
+		{
+			unsigned int s = 0;
+			for (unsigned int i = 0; i < nbPerThread; ++i)
+				s += f();
+			sink += s;
+		});
+	}, double(nbth) * nbPerThread);
+}
+
+int main(int argc, char **argv)
+{
+	unsigned int maxThreads = 32;
+	unsigned int nbPerThread = 100000;
+	unsigned int nbIterations = 5;
+	std::string output;
+
+	for (int i = 1; i < argc; ++i)
+	{
+		if (!strcmp(argv[i], "-t") && (i + 1 < argc))
+			maxThreads = atoi(argv[++i]);
+		else if (!strcmp(argv[i], "-n") && (i + 1 < argc))
+			nbPerThread = atoi(argv[++i]);
+		else if (!strcmp(argv[i], "-i") && (i + 1 < argc))
+			nbIterations = atoi(argv[++i]);
+		else if (!strcmp(argv[i], "-o") && (i + 1 < argc))
+			output = argv[++i];
+	}
+
+	// small map: the unmarking of the Store markers is negligible
+	MAP myMap;
+	VertexAttribute<VEC3, MAP> position = myMap.addAttribute<VEC3, VERTEX, MAP>("position");
+	Algo::Surface::Tilings::Triangular::Grid<PFP> grid(myMap, 4, 4, true);
+	grid.embedIntoGrid(position, 1.0f, 1.0f);
+	Dart d0 = myMap.begin();
+
+	Utils::Benchmark bench("markers", 1, nbIterations);
+
+	bench.run("thread_index/main", [&] ()
+	{
+		unsigned int s = 0;
+		for (unsigned int i = 0; i < nbPerThread; ++i)
+			s += myMap.getCurrentThreadIndex();
+		sink += s;
+	}, nbPerThread);
+
+	for (unsigned int nbth = 1; nbth <= maxThreads; nbth *= 2)
+	{
+		Utils::ThreadPool pool(nbth);
+		for (unsigned int i = 0; i < nbth; ++i)
+			myMap.addEmptyThreadId() = pool.threadId(i);
+
+		benchThreads(bench, "thread_index", pool, nbth, nbPerThread, [&] ()
+		{
+			return myMap.getCurrentThreadIndex();
+		});
+
+		benchThreads(bench, "dart_marker", pool, nbth, nbPerThread, [&] ()
+		{
+			DartMarkerStore<MAP> dm(myMap);
+			dm.mark(d0);
+			return 1u;
+		});
+
+		benchThreads(bench, "dart_marker_epoch", pool, nbth, nbPerThread, [&] ()
+		{
+			DartMarkerEpoch<MAP> dm(myMap);
+			dm.mark(d0);
+			return 1u;
+		});
+
+		benchThreads(bench, "vertex_marker", pool, nbth, nbPerThread, [&] ()
+		{
+			CellMarkerStore<MAP, VERTEX> cm(myMap);
+			cm.mark(Vertex(d0));
+			return 1u;
+		});
+
+		benchThreads(bench, "dart_buffer", pool, nbth, nbPerThread, [&] ()
+		{
+			std::vector<Dart>* vd = myMap.askDartBuffer();
+			vd->push_back(d0);
+			myMap.releaseDartBuffer(vd);
+			return 1u;
+		});
+
+		for (unsigned int i = 0; i < nbth; ++i)
+			myMap.removeThreadId(pool.threadId(i));
+	}
+
+	if (!output.empty() && !bench.save(output))
+		return 1;
+
+	return 0;
+}
@@ -0,0 +1,94 @@
+/*******************************************************************************
+* CGoGN: Combinatorial and Geometric modeling with Generic N-dimensional Maps  *
+* version 0.1                                                                  *
+* Copyright (C) 2009-2012, IGG Team, LSIIT, University of Strasbourg           *
+*                                                                              *
+* This library is free software; you can redistribute it and/or modify it      *
+* under the terms of the GNU Lesser General Public License as published by the *
+* Free Software Foundation; either version 2.1 of the License, or (at your     *
+* option) any later version.                                                   *
+*                                                                              *
+* This library is distributed in the hope that it will be useful, but WITHOUT  *
+* ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or        *
+* FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License  *
+* for more details.                                                            *
+*                                                                              *
+* You should have received a copy of the GNU Lesser General Public License     *
+* along with this library; if not, write to the Free Software Foundation,      *
+* Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301 USA.           *
+*                                                                              *
+* Web site: http://cgogn.unistra.fr/                                           *
+* Contact information: cgogn@unistra.fr                                        *
+*                                                                              *
+*******************************************************************************/
+
+
+#include "Topology/generic/parameters.h"
+#include "Topology/map/embeddedMap2.h"
+#include "Algo/Tiling/Surface/square.h"
+#include "Algo/Geometry/area.h"
+#include "Utils/threadPool.h"
+#include "Utils/chrono.h"
+
+
+using namespace CGoGN ;
+
+/**
+ * Scaling of Parallel::foreach_cell with the pool of threads (1 to N cores)
+ * compared to the serial traversal and to the traversal/buffers version
+ */
+struct PFP: public PFP_STANDARD
+{
+	// definition of the type of the map
+	typedef EmbeddedMap2 MAP;
+};
+
+typedef PFP::MAP MAP;
+typedef PFP::VEC3 VEC3;
+
+int main(int argc, char **argv)
+{
+	unsigned int nb = 2000;
+	if (argc > 1)
+		nb = atoi(argv[1]);
+
+	MAP myMap;
+	VertexAttribute<VEC3, MAP> position = myMap.addAttribute<VEC3, VERTEX, MAP>("position");
+	FaceAttribute<float, MAP> area = myMap.addAttribute<float, FACE, MAP>("area");
+
+	Utils::Chrono ch;
+	ch.start();
+	Algo::Surface::Tilings::Square::Grid<PFP> grid(myMap, nb, nb, true);
+	grid.embedIntoGrid(position, 1.0f, 1.0f);
+	CGoGNout << "construct grid of " << 2*nb*nb << " faces in " << ch.elapsed() << " ms" << CGoGNendl;
+
+	ch.start();
+	foreach_cell<FACE>(myMap, [&] (Face f)
+	{
+		area[f] = Algo::Surface::Geometry::convexFaceArea<PFP>(myMap, f, position);
+	});
+	CGoGNout << "serial: " << ch.elapsed() << " ms" << CGoGNendl;
+
+	unsigned int nbCores = Parallel::getSystemNumberOfCores();
+	for (unsigned int nbth = 1; nbth <= nbCores; ++nbth)
+	{
+		Utils::ThreadPool pool(nbth);
+		ch.start();
+		Parallel::foreach_cell<FACE>(myMap, [&] (Face f, unsigned int)
+		{
+			area[f] = Algo::Surface::Geometry::convexFaceArea<PFP>(myMap, f, position);
+		}, pool);
+		int tp = ch.elapsed();
+
+		ch.start();
+		Parallel::foreach_cell_tmpl<AUTO, FACE>(myMap, [&] (Face f, unsigned int)
+		{
+			area[f] = Algo::Surface::Geometry::convexFaceArea<PFP>(myMap, f, position);
+		}, nbth);
+		int tb = ch.elapsed();
+
+		CGoGNout << nbth << " threads: pool " << tp << " ms / buffers " << tb << " ms" << CGoGNendl;
+	}
+
+	return 0;
+}
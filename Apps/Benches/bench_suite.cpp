@@ -0,0 +1,267 @@
+/*******************************************************************************
+ * CGoGN: Combinatorial and Geometric modeling with Generic N-dimensional Maps  *
+ * version 0.1                                                                  *
+ * Copyright (C) 2009-2012, IGG Team, LSIIT, University of Strasbourg           *
+ *                                                                              *
+ * This library is free software; you can redistribute it and/or modify it      *
+ * under the terms of the GNU Lesser General Public License as published by the *
+ * Free Software Foundation; either version 2.1 of the License, or (at your     *
+ * option) any later version.                                                   *
+ *                                                                              *
+ * This library is distributed in the hope that it will be useful, but WITHOUT  *
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or        *
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License  *
+ * for more details.                                                            *
+ *                                                                              *
+ * You should have received a copy of the GNU Lesser General Public License     *
+ * along with this library; if not, write to the Free Software Foundation,      *
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301 USA.           *
+ *                                                                              *
+ * Web site: http://cgogn.unistra.fr/                                           *
+ * Contact information: cgogn@unistra.fr                                        *
+ *                                                                              *
+ *******************************************************************************/
+
+
+#include "Topology/generic/parameters.h"
+#include "Topology/map/embeddedMap2.h"
+#include "Algo/Tiling/Surface/triangular.h"
+#include "Algo/Import/import.h"
+#include "Algo/Export/export.h"
+#include "Algo/Decimation/decimation.h"
+#include "Algo/Modelisation/subdivision.h"
+#include "Algo/Geometry/normal.h"
+#include "Algo/Topo/basic.h"
+#include "Utils/benchmark.h"
+
+#include <sstream>
+#include <cstdlib>
+#include <cstring>
+
+
+using namespace CGoGN ;
+
+/**
+ * Benchmark suite of the hot paths of the library:
+ * cell traversals (for each TraversalOptim), attribute access, import,
+ * decimation, Loop subdivision, vertex normals and compact.
+ * The fixtures are triangulated tores of several sizes (also exported
+ * in OFF and PLY for the import) and the meshes given on the command line.
+ * The results are printed, and saved in JSON or CSV with -o.
+ *
+ * usage: bench_suite [-w nbWarmups] [-i nbIterations] [-s small,medium,large]
+ *                    [-o results.json|results.csv] [mesh files...]
+ */
+struct PFP: public PFP_STANDARD
+{
+	// definition of the type of the map
+	typedef EmbeddedMap2 MAP;
+};
+
+typedef PFP::MAP MAP;
+typedef PFP::VEC3 VEC3;
+
+struct FixtureSize
+{
+	const char* name;
+	unsigned int n;
+	unsigned int m;
+};
+
+const FixtureSize fixtureSizes[3] = {
+	{ "small", 100, 100 },		// 20K faces
+	{ "medium", 400, 400 },		// 320K faces
+	{ "large", 1000, 1000 }		// 2M faces
+};
+
+// results of the read-only benchmarks are stored here so that they are not optimized out
+volatile float sink = 0.0f;
+
+const TraversalOptim traversalOptims[4] = { AUTO, FORCE_DART_MARKING, FORCE_CELL_MARKING, FORCE_QUICK_TRAVERSAL };
+const char* traversalOptimNames[4] = { "auto", "dart_marking", "cell_marking", "quick" };
+
+template <unsigned int ORBIT>
+void benchTraversal(Utils::Benchmark& bench, const std::string& prefix, MAP& map, const VertexAttribute<VEC3, MAP>& position)
+{
+	unsigned int nbCells = Algo::Topo::getNbOrbits<ORBIT>(map);
+	map.enableQuickTraversal<MAP, ORBIT>();
+
+	for (unsigned int i = 0; i < 4; ++i)
+	{
+		TraversalOptim opt = traversalOptims[i];
+		VEC3 sum(0);
+		bench.run(prefix + "/traversal/" + orbitName(ORBIT) + "/" + traversalOptimNames[i], [&] ()
+		{
+			foreach_cell<ORBIT>(map, [&] (Cell<ORBIT> c)
+			{
+				sum += position[c.dart];
+			}, opt);
+			sink = sum[0];
+		}, nbCells);
+	}
+
+	map.disableQuickTraversal<ORBIT>();
+}
+
+void benchMesh(Utils::Benchmark& bench, const std::string& prefix, MAP& myMap, VertexAttribute<VEC3, MAP>& position)
+{
+	unsigned int nbVertices = Algo::Topo::getNbOrbits<VERTEX>(myMap);
+	unsigned int nbFaces = Algo::Topo::getNbOrbits<FACE>(myMap);
+
+	// traversals
+	benchTraversal<VERTEX>(bench, prefix, myMap, position);
+	benchTraversal<EDGE>(bench, prefix, myMap, position);
+	benchTraversal<FACE>(bench, prefix, myMap, position);
+
+	// attribute access: by lines of the container and through the darts
+	VEC3 sum(0);
+	bench.run(prefix + "/attribute/read_lines", [&] ()
+	{
+		for (unsigned int i = position.begin(); i != position.end(); position.next(i))
+			sum += position[i];
+		sink = sum[0];
+	}, nbVertices);
+
+	bench.run(prefix + "/attribute/write_lines", [&] ()
+	{
+		for (unsigned int i = position.begin(); i != position.end(); position.next(i))
+			position[i] *= 1.0f;
+	}, nbVertices);
+
+	bench.run(prefix + "/attribute/read_darts", [&] ()
+	{
+		for (Dart d = myMap.begin(); d != myMap.end(); myMap.next(d))
+			sum += position[d];
+		sink = sum[0];
+	}, myMap.getNbDarts());
+
+	// vertex normals
+	VertexAttribute<VEC3, MAP> normal = myMap.getAttribute<VEC3, VERTEX, MAP>("normal");
+	if (!normal.isValid())
+		normal = myMap.addAttribute<VEC3, VERTEX, MAP>("normal");
+	bench.run(prefix + "/computeNormalVertices", [&] ()
+	{
+		Algo::Surface::Geometry::computeNormalVertices<PFP>(myMap, position, normal);
+	}, nbVertices);
+	myMap.removeAttribute(normal);
+
+	// modifications on a copy of the mesh (copy not measured)
+	MAP copyMap;
+	VertexAttribute<VEC3, MAP> copyPosition;
+	auto copyMesh = [&] ()
+	{
+		copyMap.copyFrom(myMap);
+		copyPosition = copyMap.getAttribute<VEC3, VERTEX, MAP>(position.name());
+	};
+
+	bench.runWithSetup(prefix + "/LoopSubdivision", copyMesh, [&] ()
+	{
+		Algo::Surface::Modelisation::LoopSubdivision<PFP>(copyMap, copyPosition);
+	}, nbFaces);
+
+	bench.runWithSetup(prefix + "/decimate/QEM_10%", copyMesh, [&] ()
+	{
+		std::vector<VertexAttribute<VEC3, MAP> > attribs;
+		attribs.push_back(copyPosition);
+		Algo::Surface::Decimation::decimate<PFP>(copyMap, Algo::Surface::Decimation::S_QEM, Algo::Surface::Decimation::A_QEM, attribs, nbVertices / 10);
+	}, nbVertices - nbVertices / 10);
+
+	// compact a decimated (fragmented) copy
+	MAP decMap;
+	decMap.copyFrom(myMap);
+	{
+		std::vector<VertexAttribute<VEC3, MAP> > attribs;
+		attribs.push_back(decMap.getAttribute<VEC3, VERTEX, MAP>(position.name()));
+		Algo::Surface::Decimation::decimate<PFP>(decMap, Algo::Surface::Decimation::S_EdgeLength, Algo::Surface::Decimation::A_MidEdge, attribs, nbVertices / 2);
+	}
+	bench.runWithSetup(prefix + "/compact", [&] () { copyMap.copyFrom(decMap); }, [&] ()
+	{
+		copyMap.compact();
+	}, decMap.getNbDarts());
+}
+
+void benchImport(Utils::Benchmark& bench, const std::string& prefix, const std::string& filename)
+{
+	bench.run(prefix + "/importMesh", [&] ()
+	{
+		MAP myMap;
+		std::vector<std::string> attrNames;
+		if (!Algo::Surface::Import::importMesh<PFP>(myMap, filename, attrNames))
+			CGoGNerr << "could not import " << filename << CGoGNendl;
+	});
+}
+
+int main(int argc, char **argv)
+{
+	unsigned int nbWarmups = 1;
+	unsigned int nbIterations = 5;
+	std::string sizes("small,medium");
+	std::string output;
+	std::vector<std::string> meshes;
+
+	for (int i = 1; i < argc; ++i)
+	{
+		if (!strcmp(argv[i], "-w") && (i + 1 < argc))
+			nbWarmups = atoi(argv[++i]);
+		else if (!strcmp(argv[i], "-i") && (i + 1 < argc))
+			nbIterations = atoi(argv[++i]);
+		else if (!strcmp(argv[i], "-s") && (i + 1 < argc))
+			sizes = argv[++i];
+		else if (!strcmp(argv[i], "-o") && (i + 1 < argc))
+			output = argv[++i];
+		else
+			meshes.push_back(argv[i]);
+	}
+
+	Utils::Benchmark bench("cgogn", nbWarmups, nbIterations);
+
+	// generated fixtures
+	for (unsigned int s = 0; s < 3; ++s)
+	{
+		const FixtureSize& fs = fixtureSizes[s];
+		if (("," + sizes + ",").find(std::string(",") + fs.name + ",") == std::string::npos)
+			continue;
+
+		std::stringstream ss;
+		ss << "tore_" << fs.name;
+		std::string prefix = ss.str();
+
+		MAP myMap;
+		VertexAttribute<VEC3, MAP> position = myMap.addAttribute<VEC3, VERTEX, MAP>("position");
+		Algo::Surface::Tilings::Triangular::Tore<PFP> tore(myMap, fs.n, fs.m);
+		tore.embedIntoTore(position, 10.0f, 3.0f);
+
+		benchMesh(bench, prefix, myMap, position);
+
+		std::string offName = "bench_" + prefix + ".off";
+		std::string plyName = "bench_" + prefix + ".ply";
+		Algo::Surface::Export::exportOFF<PFP>(myMap, position, offName.c_str());
+		Algo::Surface::Export::exportPLY<PFP>(myMap, position, plyName.c_str(), true);
+		benchImport(bench, prefix + "/off", offName);
+		benchImport(bench, prefix + "/ply", plyName);
+		remove(offName.c_str());
+		remove(plyName.c_str());
+	}
+
+	// on-disk meshes
+	for (unsigned int i = 0; i < meshes.size(); ++i)
+	{
+		std::string prefix = meshes[i].substr(meshes[i].find_last_of("/\\") + 1);
+		benchImport(bench, prefix, meshes[i]);
+
+		MAP myMap;
+		std::vector<std::string> attrNames;
+		if (!Algo::Surface::Import::importMesh<PFP>(myMap, meshes[i], attrNames))
+		{
+			CGoGNerr << "could not import " << meshes[i] << CGoGNendl;
+			continue;
+		}
+		VertexAttribute<VEC3, MAP> position = myMap.getAttribute<VEC3, VERTEX, MAP>(attrNames[0]);
+		benchMesh(bench, prefix, myMap, position);
+	}
+
+	if (!output.empty() && !bench.save(output))
+		return 1;
+
+	return 0;
+}
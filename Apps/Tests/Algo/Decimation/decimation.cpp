@@ -73,6 +73,34 @@ template int Algo::Surface::Decimation::decimate<PFP2, Geom::Vec3d>(
 //	);
 
 
+template int Algo::Surface::Decimation::decimateParallel<PFP1>(
+	PFP1::MAP& map,
+	VertexAttribute<PFP1::VEC3, PFP1::MAP>& position,
+	std::vector<ApproximatorGen<PFP1>*>& a,
+	unsigned int nbWantedVertices,
+	float batchRatio,
+	unsigned int nbth,
+	void(*callback_wrapper)(void*, const void*),
+	void* callback_object
+	);
+
+template int Algo::Surface::Decimation::decimateParallel<PFP1>(
+	PFP1::MAP& map,
+	VertexAttribute<PFP1::VEC3, PFP1::MAP>& position,
+	unsigned int nbWantedVertices,
+	float batchRatio,
+	unsigned int nbth
+	);
+
+template int Algo::Surface::Decimation::decimateParallel<PFP2>(
+	PFP2::MAP& map,
+	VertexAttribute<PFP2::VEC3, PFP2::MAP>& position,
+	unsigned int nbWantedVertices,
+	float batchRatio,
+	unsigned int nbth
+	);
+
+
 
 int test_decimation()
 {
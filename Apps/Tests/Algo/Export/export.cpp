@@ -16,6 +16,7 @@ struct PFP1 : public PFP_STANDARD
 template bool Algo::Surface::Export::exportPLY<PFP1>(PFP1::MAP& map, const VertexAttribute<PFP1::VEC3, PFP1::MAP>& position, const char* filename, const bool binary);
 template bool Algo::Surface::Export::exportPLYnew<PFP1>(PFP1::MAP& map, const std::vector<VertexAttribute<PFP1::VEC3, PFP1::MAP>* >& attributeHandlers, const char* filename, const bool binary);
 template bool Algo::Surface::Export::exportOFF<PFP1>(PFP1::MAP& map, const VertexAttribute<PFP1::VEC3, PFP1::MAP>& position, const char* filename);
+template bool Algo::Surface::Export::exportOFFStreamed<PFP1>(PFP1::MAP& map, const VertexAttribute<PFP1::VEC3, PFP1::MAP>& position, const char* filename, unsigned int nbBlocks);
 template bool Algo::Surface::Export::exportOBJ<PFP1>(PFP1::MAP& map, const VertexAttribute<PFP1::VEC3, PFP1::MAP>& position, const char* filename);
 template bool Algo::Surface::Export::exportChoupi<PFP1>(PFP1::MAP& map, const VertexAttribute<PFP1::VEC3, PFP1::MAP>& position, const char* filename);
 
@@ -28,6 +29,7 @@ struct PFP2 : public PFP_DOUBLE
 template bool Algo::Surface::Export::exportPLY<PFP2>(PFP2::MAP& map, const VertexAttribute<PFP2::VEC3, PFP2::MAP>& position, const char* filename, const bool binary);
 template bool Algo::Surface::Export::exportPLYnew<PFP2>(PFP2::MAP& map, const std::vector<VertexAttribute<PFP2::VEC3, PFP2::MAP>* >& attributeHandlers, const char* filename, const bool binary);
 template bool Algo::Surface::Export::exportOFF<PFP2>(PFP2::MAP& map, const VertexAttribute<PFP2::VEC3, PFP2::MAP>& position, const char* filename);
+template bool Algo::Surface::Export::exportOFFStreamed<PFP2>(PFP2::MAP& map, const VertexAttribute<PFP2::VEC3, PFP2::MAP>& position, const char* filename, unsigned int nbBlocks);
 template bool Algo::Surface::Export::exportOBJ<PFP2>(PFP2::MAP& map, const VertexAttribute<PFP2::VEC3, PFP2::MAP>& position, const char* filename);
 template bool Algo::Surface::Export::exportChoupi<PFP2>(PFP2::MAP& map, const VertexAttribute<PFP2::VEC3, PFP2::MAP>& position, const char* filename);
 
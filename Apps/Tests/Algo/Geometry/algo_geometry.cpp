@@ -7,6 +7,8 @@ extern int test_basic();
 extern int test_convexity();
 extern int test_curvature();
 extern int test_distances();
+extern int test_geodesics();
+extern int test_hausdorff();
 
 
 int main()
@@ -18,6 +20,8 @@ int main()
 	test_convexity();
 	test_curvature();
 	test_distances();
+	test_geodesics();
+	test_hausdorff();
 
 	return 0;
 }
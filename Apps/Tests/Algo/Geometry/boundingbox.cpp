@@ -35,6 +35,10 @@ template Geom::BoundingBox<PFP1::VEC3> Algo::Geometry::computeBoundingBox<PFP1>(
 template Geom::BoundingBox<PFP2::VEC3> Algo::Geometry::computeBoundingBox<PFP2>(PFP2::MAP& map, const VertexAttribute<PFP2::VEC3, PFP2::MAP>& position);
 template Geom::BoundingBox<PFP3::VEC3> Algo::Geometry::computeBoundingBox<PFP3>(PFP3::MAP& map, const VertexAttribute<PFP3::VEC3, PFP3::MAP>& position);
 
+template Geom::BoundingBox<PFP1::VEC3> Algo::Geometry::Parallel::computeBoundingBox<PFP1>(PFP1::MAP& map, const VertexAttribute<PFP1::VEC3, PFP1::MAP>& position);
+template Geom::BoundingBox<PFP2::VEC3> Algo::Geometry::Parallel::computeBoundingBox<PFP2>(PFP2::MAP& map, const VertexAttribute<PFP2::VEC3, PFP2::MAP>& position);
+template Geom::BoundingBox<PFP3::VEC3> Algo::Geometry::Parallel::computeBoundingBox<PFP3>(PFP3::MAP& map, const VertexAttribute<PFP3::VEC3, PFP3::MAP>& position);
+
 
 int test_boundingbox()
 {
@@ -41,10 +41,12 @@ template VATT1::DATA_TYPE Algo::Surface::Geometry::vertexNeighborhoodCentroid<PF
 template void Algo::Surface::Geometry::computeCentroidFaces<PFP1, VATT1, FATT1>(PFP1::MAP& map, const VATT1& position, FATT1& face_centroid);
 template void Algo::Surface::Geometry::computeCentroidELWFaces<PFP1, VATT1, FATT1>(PFP1::MAP& map, const VATT1& position, FATT1& face_centroid);
 template void Algo::Surface::Geometry::computeNeighborhoodCentroidVertices<PFP1, VATT1>(PFP1::MAP& map, const VATT1& position, VATT1& vertex_centroid);
+template VATT1::DATA_TYPE Algo::Surface::Geometry::computeCentroid<PFP1, VATT1>(PFP1::MAP& map, const VATT1& position);
 
 template void Algo::Surface::Geometry::Parallel::computeCentroidFaces<PFP1, VATT1, FATT1>(PFP1::MAP& map, const VATT1& position, FATT1& face_centroid);
 template void Algo::Surface::Geometry::Parallel::computeCentroidELWFaces<PFP1, VATT1, FATT1>(PFP1::MAP& map, const VATT1& position, FATT1& face_centroid);
 template void Algo::Surface::Geometry::Parallel::computeNeighborhoodCentroidVertices<PFP1, VATT1>(PFP1::MAP& map, const VATT1& position, VATT1& vertex_centroid);
+template VATT1::DATA_TYPE Algo::Surface::Geometry::Parallel::computeCentroid<PFP1, VATT1>(PFP1::MAP& map, const VATT1& position);
 
 template VATT1::DATA_TYPE Algo::Volume::Geometry::vertexNeighborhoodCentroid<PFP1, VATT1>(PFP1::MAP& map, Vertex d, const VATT1& attributs);
 template void Algo::Volume::Geometry::computeCentroidVolumes<PFP1, VATT1, WATT1>(PFP1::MAP& map, const VATT1& position, WATT1& vol_centroid);
@@ -63,10 +65,12 @@ template VATT2::DATA_TYPE Algo::Surface::Geometry::vertexNeighborhoodCentroid<PF
 template void Algo::Surface::Geometry::computeCentroidFaces<PFP2, VATT2, FATT2>(PFP2::MAP& map, const VATT2& position, FATT2& face_centroid);
 template void Algo::Surface::Geometry::computeCentroidELWFaces<PFP2, VATT2, FATT2>(PFP2::MAP& map, const VATT2& position, FATT2& face_centroid);
 template void Algo::Surface::Geometry::computeNeighborhoodCentroidVertices<PFP2, VATT2>(PFP2::MAP& map, const VATT2& position, VATT2& vertex_centroid);
+template VATT2::DATA_TYPE Algo::Surface::Geometry::computeCentroid<PFP2, VATT2>(PFP2::MAP& map, const VATT2& position);
 
 template void Algo::Surface::Geometry::Parallel::computeCentroidFaces<PFP2, VATT2, FATT2>(PFP2::MAP& map, const VATT2& position, FATT2& face_centroid);
 template void Algo::Surface::Geometry::Parallel::computeCentroidELWFaces<PFP2, VATT2, FATT2>(PFP2::MAP& map, const VATT2& position, FATT2& face_centroid);
 template void Algo::Surface::Geometry::Parallel::computeNeighborhoodCentroidVertices<PFP2, VATT2>(PFP2::MAP& map, const VATT2& position, VATT2& vertex_centroid);
+template VATT2::DATA_TYPE Algo::Surface::Geometry::Parallel::computeCentroid<PFP2, VATT2>(PFP2::MAP& map, const VATT2& position);
 
 template VATT2::DATA_TYPE Algo::Volume::Geometry::vertexNeighborhoodCentroid<PFP2, VATT2>(PFP2::MAP& map, Vertex d, const VATT2& attributs);
 template void Algo::Volume::Geometry::computeCentroidVolumes<PFP2, VATT2, WATT2>(PFP2::MAP& map, const VATT2& position, WATT2& vol_centroid);
@@ -85,10 +89,12 @@ template VATT3::DATA_TYPE Algo::Surface::Geometry::vertexNeighborhoodCentroid<PF
 template void Algo::Surface::Geometry::computeCentroidFaces<PFP3, VATT3, FATT3>(PFP3::MAP& map, const VATT3& position, FATT3& face_centroid);
 template void Algo::Surface::Geometry::computeCentroidELWFaces<PFP3, VATT3, FATT3>(PFP3::MAP& map, const VATT3& position, FATT3& face_centroid);
 template void Algo::Surface::Geometry::computeNeighborhoodCentroidVertices<PFP3, VATT3>(PFP3::MAP& map, const VATT3& position, VATT3& vertex_centroid);
+template VATT3::DATA_TYPE Algo::Surface::Geometry::computeCentroid<PFP3, VATT3>(PFP3::MAP& map, const VATT3& position);
 
 template void Algo::Surface::Geometry::Parallel::computeCentroidFaces<PFP3, VATT3, FATT3>(PFP3::MAP& map, const VATT3& position, FATT3& face_centroid);
 template void Algo::Surface::Geometry::Parallel::computeCentroidELWFaces<PFP3, VATT3, FATT3>(PFP3::MAP& map, const VATT3& position, FATT3& face_centroid);
 template void Algo::Surface::Geometry::Parallel::computeNeighborhoodCentroidVertices<PFP3, VATT3>(PFP3::MAP& map, const VATT3& position, VATT3& vertex_centroid);
+template VATT3::DATA_TYPE Algo::Surface::Geometry::Parallel::computeCentroid<PFP3, VATT3>(PFP3::MAP& map, const VATT3& position);
 
 template VATT3::DATA_TYPE Algo::Volume::Geometry::vertexNeighborhoodCentroid<PFP3, VATT3>(PFP3::MAP& map, Vertex d, const VATT3& attributs);
 template void Algo::Volume::Geometry::computeCentroidVolumes<PFP3, VATT3, WATT3>(PFP3::MAP& map, const VATT3& position, WATT3& vol_centroid);
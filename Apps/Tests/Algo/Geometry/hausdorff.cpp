@@ -0,0 +1,57 @@
+#include <iostream>
+#include "Topology/generic/parameters.h"
+#include "Topology/map/embeddedMap2.h"
+#include "Topology/map/embeddedMap3.h"
+
+#include "Algo/Geometry/hausdorff.h"
+
+using namespace CGoGN;
+
+struct PFP1 : public PFP_STANDARD
+{
+	typedef EmbeddedMap2 MAP;
+};
+
+struct PFP2 : public PFP_DOUBLE
+{
+	typedef EmbeddedMap2 MAP;
+};
+
+struct PFP3 : public PFP_STANDARD
+{
+	typedef EmbeddedMap3 MAP;
+};
+
+
+
+template Algo::Geometry::MeshDistance<PFP1::REAL> Algo::Geometry::computeDistance<PFP1>(PFP1::MAP& map, const VertexAttribute<PFP1::VEC3, PFP1::MAP>& position,
+	const Algo::Selection::FaceBVH<PFP1>& target, VertexAttribute<PFP1::REAL, PFP1::MAP>& distance, PFP1::REAL samplingStep, unsigned int nbth);
+template Algo::Geometry::MeshDistance<PFP1::REAL> Algo::Geometry::computeDistance<PFP1>(PFP1::MAP& map, const VertexAttribute<PFP1::VEC3, PFP1::MAP>& position,
+	const Algo::Selection::FaceBVH<PFP1>& target, PFP1::REAL samplingStep, unsigned int nbth);
+template Algo::Geometry::MeshDistance<PFP1::REAL> Algo::Geometry::computeDistance<PFP1>(PFP1::MAP& map1, const VertexAttribute<PFP1::VEC3, PFP1::MAP>& position1, VertexAttribute<PFP1::REAL, PFP1::MAP>& distance1,
+	PFP1::MAP& map2, const VertexAttribute<PFP1::VEC3, PFP1::MAP>& position2, PFP1::REAL samplingStep, unsigned int nbth);
+template Algo::Geometry::MeshDistance<PFP1::REAL> Algo::Geometry::hausdorffDistance<PFP1>(
+	PFP1::MAP& map1, const VertexAttribute<PFP1::VEC3, PFP1::MAP>& position1, VertexAttribute<PFP1::REAL, PFP1::MAP>& distance1,
+	PFP1::MAP& map2, const VertexAttribute<PFP1::VEC3, PFP1::MAP>& position2, VertexAttribute<PFP1::REAL, PFP1::MAP>& distance2, PFP1::REAL samplingStep, unsigned int nbth);
+template Algo::Geometry::MeshDistance<PFP1::REAL> Algo::Geometry::hausdorffDistance<PFP1>(
+	PFP1::MAP& map1, const VertexAttribute<PFP1::VEC3, PFP1::MAP>& position1,
+	PFP1::MAP& map2, const VertexAttribute<PFP1::VEC3, PFP1::MAP>& position2, PFP1::REAL samplingStep, unsigned int nbth);
+
+template Algo::Geometry::MeshDistance<PFP2::REAL> Algo::Geometry::computeDistance<PFP2>(PFP2::MAP& map, const VertexAttribute<PFP2::VEC3, PFP2::MAP>& position,
+	const Algo::Selection::FaceBVH<PFP2>& target, VertexAttribute<PFP2::REAL, PFP2::MAP>& distance, PFP2::REAL samplingStep, unsigned int nbth);
+template Algo::Geometry::MeshDistance<PFP2::REAL> Algo::Geometry::hausdorffDistance<PFP2>(
+	PFP2::MAP& map1, const VertexAttribute<PFP2::VEC3, PFP2::MAP>& position1, VertexAttribute<PFP2::REAL, PFP2::MAP>& distance1,
+	PFP2::MAP& map2, const VertexAttribute<PFP2::VEC3, PFP2::MAP>& position2, VertexAttribute<PFP2::REAL, PFP2::MAP>& distance2, PFP2::REAL samplingStep, unsigned int nbth);
+
+template Algo::Geometry::MeshDistance<PFP3::REAL> Algo::Geometry::computeDistance<PFP3>(PFP3::MAP& map, const VertexAttribute<PFP3::VEC3, PFP3::MAP>& position,
+	const Algo::Selection::FaceBVH<PFP3>& target, VertexAttribute<PFP3::REAL, PFP3::MAP>& distance, PFP3::REAL samplingStep, unsigned int nbth);
+template Algo::Geometry::MeshDistance<PFP3::REAL> Algo::Geometry::hausdorffDistance<PFP3>(
+	PFP3::MAP& map1, const VertexAttribute<PFP3::VEC3, PFP3::MAP>& position1,
+	PFP3::MAP& map2, const VertexAttribute<PFP3::VEC3, PFP3::MAP>& position2, PFP3::REAL samplingStep, unsigned int nbth);
+
+
+
+int test_hausdorff()
+{
+	return 0;
+}
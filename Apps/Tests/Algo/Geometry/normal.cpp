@@ -20,6 +20,9 @@ template VATT1::DATA_TYPE Algo::Surface::Geometry::triangleNormal<PFP1, VATT1>(P
 template VATT1::DATA_TYPE Algo::Surface::Geometry::newellNormal<PFP1, VATT1>(PFP1::MAP& map, Face f, const VATT1& position);
 template VATT1::DATA_TYPE Algo::Surface::Geometry::faceNormal<PFP1, VATT1>(PFP1::MAP& map, Face f, const VATT1& position);
 template VATT1::DATA_TYPE Algo::Surface::Geometry::vertexNormal<PFP1, VATT1>(PFP1::MAP& map, Vertex v, const VATT1& position);
+template VATT1::DATA_TYPE Algo::Surface::Geometry::newellNormalDirection<PFP1, VATT1>(PFP1::MAP& map, Face f, const VATT1& position);
+template VATT1::DATA_TYPE Algo::Surface::Geometry::faceNormalDirection<PFP1, VATT1>(PFP1::MAP& map, Face f, const VATT1& position);
+template VATT1::DATA_TYPE Algo::Surface::Geometry::vertexNormalDirection<PFP1, VATT1>(PFP1::MAP& map, Vertex v, const VATT1& position);
 template void Algo::Surface::Geometry::computeNormalFaces<PFP1, VATT1, FATT1>(PFP1::MAP& map, const VATT1& position, FATT1& face_normal);
 template void Algo::Surface::Geometry::computeNormalVertices<PFP1, VATT1>(PFP1::MAP& map, const VATT1& position, VATT1& normal);
 template PFP1::REAL Algo::Surface::Geometry::computeAngleBetweenNormalsOnEdge<PFP1, VATT1>(PFP1::MAP& map, Edge d, const VATT1& position);
@@ -53,6 +56,9 @@ template VATT2::DATA_TYPE Algo::Surface::Geometry::triangleNormal<PFP2, VATT2>(P
 template VATT2::DATA_TYPE Algo::Surface::Geometry::newellNormal<PFP2, VATT2>(PFP2::MAP& map, Face f, const VATT2& position);
 template VATT2::DATA_TYPE Algo::Surface::Geometry::faceNormal<PFP2, VATT2>(PFP2::MAP& map, Face f, const VATT2& position);
 template VATT2::DATA_TYPE Algo::Surface::Geometry::vertexNormal<PFP2, VATT2>(PFP2::MAP& map, Vertex v, const VATT2& position);
+template VATT2::DATA_TYPE Algo::Surface::Geometry::newellNormalDirection<PFP2, VATT2>(PFP2::MAP& map, Face f, const VATT2& position);
+template VATT2::DATA_TYPE Algo::Surface::Geometry::faceNormalDirection<PFP2, VATT2>(PFP2::MAP& map, Face f, const VATT2& position);
+template VATT2::DATA_TYPE Algo::Surface::Geometry::vertexNormalDirection<PFP2, VATT2>(PFP2::MAP& map, Vertex v, const VATT2& position);
 //TODO VOLUME INSTANTIATION
 //	template VATT2::DATA_TYPE Algo::Surface::Geometry::vertexBorderNormal<PFP2, VATT2>(PFP2::MAP& map, Vertex v, const VATT2& position);
 template void Algo::Surface::Geometry::computeNormalFaces<PFP2, VATT2, FATT2>(PFP2::MAP& map, const VATT2& position, FATT2& face_normal);
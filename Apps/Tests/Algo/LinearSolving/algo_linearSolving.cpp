@@ -1,10 +1,12 @@
 #include <iostream>
 
 extern int test_basic();
+extern int test_laplacianSolver();
 
 int main()
 {
 	test_basic();
+	test_laplacianSolver();
 
 
 	return 0;
@@ -0,0 +1,28 @@
+#include "Topology/generic/parameters.h"
+#include "Topology/map/embeddedMap2.h"
+#include "Topology/gmap/embeddedGMap2.h"
+
+#include "Algo/LinearSolving/laplacianSolver.h"
+
+using namespace CGoGN;
+
+struct PFP1 : public PFP_STANDARD
+{
+	typedef EmbeddedMap2 MAP;
+};
+
+template class Algo::LinearSolving::LaplacianSolver<PFP1>;
+
+struct PFP2 : public PFP_DOUBLE
+{
+	typedef EmbeddedGMap2 MAP;
+};
+
+template class Algo::LinearSolving::LaplacianSolver<PFP2>;
+
+
+int test_laplacianSolver()
+{
+
+	return 0;
+}
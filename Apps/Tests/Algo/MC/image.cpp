@@ -1,5 +1,6 @@
 
 #include "Algo/MC/image.h"
+#include "Algo/MC/windowing.h"
 
 using namespace CGoGN;
 
@@ -16,6 +17,10 @@ template class Algo::Surface::MC::Image<long long>;
 template class Algo::Surface::MC::Image<float>;
 template class Algo::Surface::MC::Image<double>;
 
+template unsigned int Algo::Surface::MC::Image<unsigned char>::activeBlocks(const Algo::Surface::MC::WindowingGreater<unsigned char>& wind, std::vector<unsigned char>& active) const;
+template unsigned int Algo::Surface::MC::Image<short>::activeBlocks(const Algo::Surface::MC::WindowingInterval<short>& wind, std::vector<unsigned char>& active) const;
+template unsigned int Algo::Surface::MC::Image<float>::activeBlocks(const Algo::Surface::MC::WindowingEqual<float>& wind, std::vector<unsigned char>& active) const;
+
 int test_image()
 {
 	return 0;
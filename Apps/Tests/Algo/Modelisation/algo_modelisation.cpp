@@ -5,20 +5,24 @@ extern int test_planeCutting();
 extern int test_polyhedron();
 extern int test_subdivision();
 extern int test_subdivision3();
+extern int test_subdivisionFlat();
 extern int test_tetrahedralization();
 extern int test_triangulation();
 extern int test_voxellisation();
 
 int main()
 {
+	int nbErrors = 0;
+
 	test_extrusion();
 	test_planeCutting();
 	test_polyhedron();
 	test_subdivision();
 	test_subdivision3();
+	nbErrors += test_subdivisionFlat();
 	test_tetrahedralization();
 	test_triangulation();
 	test_voxellisation();
 
-	return 0;
+	return nbErrors;
 }
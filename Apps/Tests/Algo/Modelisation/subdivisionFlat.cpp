@@ -0,0 +1,126 @@
+#include "Topology/generic/parameters.h"
+#include "Topology/map/embeddedMap2.h"
+
+#include "Algo/Modelisation/subdivision.h"
+#include "Algo/Modelisation/subdivisionFlat.h"
+#include "Algo/Tiling/Surface/square.h"
+#include "Algo/Tiling/Surface/triangular.h"
+
+#include <cmath>
+#include <iostream>
+
+using namespace CGoGN;
+
+struct PFP1 : public PFP_STANDARD
+{
+	typedef EmbeddedMap2 MAP;
+};
+
+typedef VertexAttribute<PFP1::VEC3, PFP1::MAP> VPOS1;
+
+template class Algo::Surface::Modelisation::FaceHalfEdges<PFP1::MAP>;
+template void Algo::Surface::Modelisation::LoopSubdivisionFlat<PFP1, VPOS1>(PFP1::MAP& map, VPOS1& attributs, unsigned int nbth);
+template void Algo::Surface::Modelisation::CatmullClarkSubdivisionFlat<PFP1, VPOS1>(PFP1::MAP& map, VPOS1& attributs, unsigned int nbth);
+
+
+struct PFP2 : public PFP_DOUBLE
+{
+	typedef EmbeddedMap2 MAP;
+};
+
+typedef VertexAttribute<PFP2::VEC3, PFP2::MAP> VPOS2;
+
+template void Algo::Surface::Modelisation::LoopSubdivisionFlat<PFP2, VPOS2>(PFP2::MAP& map, VPOS2& attributs, unsigned int nbth);
+template void Algo::Surface::Modelisation::CatmullClarkSubdivisionFlat<PFP2, VPOS2>(PFP2::MAP& map, VPOS2& attributs, unsigned int nbth);
+
+
+enum Mesh { TRI_GRID, TRI_TORE, QUAD_GRID, QUAD_TORE };
+
+// small open or closed mesh with a bumpy embedding
+static void buildMesh(PFP2::MAP& map, VPOS2& position, Mesh mesh)
+{
+	switch (mesh)
+	{
+		case TRI_GRID: { Algo::Surface::Tilings::Triangular::Grid<PFP2> g(map, 5, 4); g.embedIntoGrid(position, 1.0f, 1.0f); break; }
+		case TRI_TORE: { Algo::Surface::Tilings::Triangular::Tore<PFP2> g(map, 6, 5); g.embedIntoTore(position, 1.0f, 0.4f); break; }
+		case QUAD_GRID: { Algo::Surface::Tilings::Square::Grid<PFP2> g(map, 5, 4); g.embedIntoGrid(position, 1.0f, 1.0f); break; }
+		case QUAD_TORE: { Algo::Surface::Tilings::Square::Tore<PFP2> g(map, 6, 5); g.embedIntoTore(position, 1.0f, 0.4f); break; }
+	}
+	foreach_cell<VERTEX>(map, [&] (Vertex v)
+	{
+		PFP2::VEC3& P = position[v];
+		P[2] += 0.1 * std::sin(7.0 * P[0]) * std::cos(5.0 * P[1]);
+	});
+}
+
+// subdivide the same mesh with the incremental and the flat versions (two levels),
+// the numbers of darts, vertices and faces and the positions must be the same
+static int compareSubdivisions(Mesh mesh, bool loop, const char* what)
+{
+	PFP2::MAP map1, map2;
+	VPOS2 pos1 = map1.addAttribute<PFP2::VEC3, VERTEX, PFP2::MAP>("position");
+	VPOS2 pos2 = map2.addAttribute<PFP2::VEC3, VERTEX, PFP2::MAP>("position");
+	buildMesh(map1, pos1, mesh);
+	buildMesh(map2, pos2, mesh);
+
+	for (unsigned int level = 0; level < 2; ++level)
+	{
+		if (loop)
+		{
+			Algo::Surface::Modelisation::LoopSubdivision<PFP2>(map1, pos1);
+			Algo::Surface::Modelisation::LoopSubdivisionFlat<PFP2>(map2, pos2, 2);
+		}
+		else
+		{
+			Algo::Surface::Modelisation::CatmullClarkSubdivision<PFP2>(map1, pos1);
+			Algo::Surface::Modelisation::CatmullClarkSubdivisionFlat<PFP2>(map2, pos2, 2);
+		}
+	}
+
+	int nbErrors = 0;
+	if (map1.getNbDarts() != map2.getNbDarts()
+		|| Algo::Topo::getNbOrbits<VERTEX>(map1) != Algo::Topo::getNbOrbits<VERTEX>(map2)
+		|| Algo::Topo::getNbOrbits<FACE>(map1) != Algo::Topo::getNbOrbits<FACE>(map2))
+	{
+		std::cerr << "test_subdivisionFlat: " << what << ": "
+			<< map1.getNbDarts() << "/" << map2.getNbDarts() << " darts, "
+			<< Algo::Topo::getNbOrbits<VERTEX>(map1) << "/" << Algo::Topo::getNbOrbits<VERTEX>(map2) << " vertices, "
+			<< Algo::Topo::getNbOrbits<FACE>(map1) << "/" << Algo::Topo::getNbOrbits<FACE>(map2) << " faces" << std::endl;
+		++nbErrors;
+	}
+	if (!map2.check())
+		++nbErrors;
+
+	// the vertices are not created in the same order: each position must have a match
+	std::vector<PFP2::VEC3> P1, P2;
+	foreach_cell<VERTEX>(map1, [&] (Vertex v) { P1.push_back(pos1[v]); });
+	foreach_cell<VERTEX>(map2, [&] (Vertex v) { P2.push_back(pos2[v]); });
+	unsigned int nbFar = 0;
+	for (unsigned int i = 0; i < P2.size(); ++i)
+	{
+		double dmin = 1.0;
+		for (unsigned int j = 0; j < P1.size(); ++j)
+			dmin = std::min(dmin, (P2[i] - P1[j]).norm2());
+		if (dmin > 1e-20)
+			++nbFar;
+	}
+	if (nbFar > 0)
+	{
+		std::cerr << "test_subdivisionFlat: " << what << ": " << nbFar << " positions differ" << std::endl;
+		++nbErrors;
+	}
+
+	return nbErrors;
+}
+
+int test_subdivisionFlat()
+{
+	int nbErrors = 0;
+
+	nbErrors += compareSubdivisions(TRI_GRID, true, "Loop, open grid");
+	nbErrors += compareSubdivisions(TRI_TORE, true, "Loop, tore");
+	nbErrors += compareSubdivisions(QUAD_GRID, false, "Catmull-Clark, open grid");
+	nbErrors += compareSubdivisions(QUAD_TORE, false, "Catmull-Clark, tore");
+
+	return nbErrors;
+}
@@ -1,11 +1,13 @@
 #include <iostream>
 
 extern int test_collector();
+extern int test_faceBVH();
 extern int test_raySelector();
 
 int main()
 {
 	test_collector();
+	test_faceBVH();
 	test_raySelector();
 
 	return 0;
@@ -0,0 +1,89 @@
+#include "Topology/generic/parameters.h"
+#include "Topology/map/embeddedMap2.h"
+#include "Topology/map/embeddedMap3.h"
+#include "Topology/gmap/embeddedGMap2.h"
+
+
+#include "Algo/Selection/raySelector.h"
+
+using namespace CGoGN;
+
+struct PFP1 : public PFP_STANDARD
+{
+	typedef EmbeddedMap2 MAP;
+};
+
+struct PFP2 : public PFP_DOUBLE
+{
+	typedef EmbeddedMap2 MAP;
+};
+
+struct PFP3 : public PFP_DOUBLE
+{
+	typedef EmbeddedGMap2 MAP;
+};
+
+struct PFP4 : public PFP_DOUBLE
+{
+	typedef EmbeddedMap3 MAP;
+};
+
+
+template class Algo::Selection::FaceBVH<PFP1>;
+template class Algo::Selection::FaceBVH<PFP2>;
+template class Algo::Selection::FaceBVH<PFP3>;
+template class Algo::Selection::FaceBVH<PFP4>;
+
+
+template void Algo::Selection::facesRaySelection<PFP1>(const Algo::Selection::FaceBVH<PFP1>& bvh,
+	const PFP1::VEC3& rayA, const PFP1::VEC3& rayAB, std::vector<Face>& vecFaces, std::vector<PFP1::VEC3>& iPoints);
+
+template void Algo::Selection::facesRaySelection<PFP1>(const Algo::Selection::FaceBVH<PFP1>& bvh,
+	const PFP1::VEC3& rayA, const PFP1::VEC3& rayAB, std::vector<Face>& vecFaces);
+
+template void Algo::Selection::faceRaySelection<PFP1>(const Algo::Selection::FaceBVH<PFP1>& bvh,
+	const PFP1::VEC3& rayA, const PFP1::VEC3& rayAB, Face& face);
+
+template void Algo::Selection::edgesRaySelection<PFP1>(const Algo::Selection::FaceBVH<PFP1>& bvh,
+	const PFP1::VEC3& rayA, const PFP1::VEC3& rayAB, std::vector<Edge>& vecEdges, float distMax);
+
+template void Algo::Selection::edgeRaySelection<PFP1>(const Algo::Selection::FaceBVH<PFP1>& bvh,
+	const PFP1::VEC3& rayA, const PFP1::VEC3& rayAB, Edge& edge);
+
+template void Algo::Selection::verticesRaySelection<PFP1>(const Algo::Selection::FaceBVH<PFP1>& bvh,
+	const PFP1::VEC3& rayA, const PFP1::VEC3& rayAB, std::vector<Vertex>& vecVertices, float dist);
+
+template void Algo::Selection::vertexRaySelection<PFP1>(const Algo::Selection::FaceBVH<PFP1>& bvh,
+	const PFP1::VEC3& rayA, const PFP1::VEC3& rayAB, Vertex& vertex);
+
+template void Algo::Selection::facesPlanSelection<PFP1>(const Algo::Selection::FaceBVH<PFP1>& bvh,
+	const Geom::Plane3D<PFP1::VEC3::DATA_TYPE>& plan, std::vector<Face>& vecFaces);
+
+template void Algo::Selection::verticesConeSelection<PFP1>(const Algo::Selection::FaceBVH<PFP1>& bvh,
+	const PFP1::VEC3& rayA, const PFP1::VEC3& rayAB, float angle, std::vector<Vertex>& vecVertices);
+
+
+template void Algo::Selection::facesRaySelection<PFP4>(const Algo::Selection::FaceBVH<PFP4>& bvh,
+	const PFP4::VEC3& rayA, const PFP4::VEC3& rayAB, std::vector<Face>& vecFaces, std::vector<PFP4::VEC3>& iPoints);
+
+template void Algo::Selection::faceRaySelection<PFP4>(const Algo::Selection::FaceBVH<PFP4>& bvh,
+	const PFP4::VEC3& rayA, const PFP4::VEC3& rayAB, Face& face);
+
+template void Algo::Selection::edgesRaySelection<PFP4>(const Algo::Selection::FaceBVH<PFP4>& bvh,
+	const PFP4::VEC3& rayA, const PFP4::VEC3& rayAB, std::vector<Edge>& vecEdges, float distMax);
+
+template void Algo::Selection::verticesRaySelection<PFP4>(const Algo::Selection::FaceBVH<PFP4>& bvh,
+	const PFP4::VEC3& rayA, const PFP4::VEC3& rayAB, std::vector<Vertex>& vecVertices, float dist);
+
+template void Algo::Selection::facesPlanSelection<PFP4>(const Algo::Selection::FaceBVH<PFP4>& bvh,
+	const Geom::Plane3D<PFP4::VEC3::DATA_TYPE>& plan, std::vector<Face>& vecFaces);
+
+template void Algo::Selection::verticesConeSelection<PFP4>(const Algo::Selection::FaceBVH<PFP4>& bvh,
+	const PFP4::VEC3& rayA, const PFP4::VEC3& rayAB, float angle, std::vector<Vertex>& vecVertices);
+
+
+
+int test_faceBVH()
+{
+	return 0;
+}
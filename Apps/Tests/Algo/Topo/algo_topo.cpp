@@ -2,14 +2,18 @@
 
 extern int test_basic();
 extern int test_embedding();
+extern int test_reorder();
 extern int test_simplex();
+extern int test_streaming();
 extern int test_uniformOrientation();
 
 int main()
 {
 	test_basic();
 	test_embedding();
+	test_reorder();
 	test_simplex();
+	test_streaming();
 	test_uniformOrientation();
 
 
@@ -0,0 +1,41 @@
+#include "Topology/generic/parameters.h"
+#include "Topology/map/embeddedMap2.h"
+#include "Topology/gmap/embeddedGMap2.h"
+#include "Topology/map/embeddedMap3.h"
+
+#include "Algo/Topo/reorder.h"
+
+using namespace CGoGN;
+
+struct PFP1 : public PFP_STANDARD
+{
+	typedef EmbeddedMap2 MAP;
+};
+
+struct PFP2 : public PFP_STANDARD
+{
+	typedef EmbeddedGMap2 MAP;
+};
+
+struct PFP3 : public PFP_STANDARD
+{
+	typedef EmbeddedMap3 MAP;
+};
+
+template bool Algo::Topo::reorderByVertices<EmbeddedMap2>(EmbeddedMap2& map, const std::vector<Dart>& vertices);
+template bool Algo::Topo::reorderByVertices<EmbeddedGMap2>(EmbeddedGMap2& map, const std::vector<Dart>& vertices);
+template bool Algo::Topo::reorderByVertices<EmbeddedMap3>(EmbeddedMap3& map, const std::vector<Dart>& vertices);
+
+template bool Algo::Topo::reorderBFS<EmbeddedMap2>(EmbeddedMap2& map);
+template bool Algo::Topo::reorderBFS<EmbeddedGMap2>(EmbeddedGMap2& map);
+template bool Algo::Topo::reorderBFS<EmbeddedMap3>(EmbeddedMap3& map);
+
+template bool Algo::Topo::reorderHilbert<PFP1>(EmbeddedMap2& map, const VertexAttribute<PFP1::VEC3, EmbeddedMap2>& position);
+template bool Algo::Topo::reorderHilbert<PFP2>(EmbeddedGMap2& map, const VertexAttribute<PFP2::VEC3, EmbeddedGMap2>& position);
+template bool Algo::Topo::reorderHilbert<PFP3>(EmbeddedMap3& map, const VertexAttribute<PFP3::VEC3, EmbeddedMap3>& position);
+
+
+int test_reorder()
+{
+	return 0;
+}
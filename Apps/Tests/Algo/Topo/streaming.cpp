@@ -0,0 +1,20 @@
+#include "Topology/generic/parameters.h"
+#include "Topology/map/embeddedMap2.h"
+#include "Topology/gmap/embeddedGMap2.h"
+#include "Topology/map/embeddedMap3.h"
+
+#include "Algo/Topo/streaming.h"
+
+using namespace CGoGN;
+
+typedef void (*DartFunc)(Dart);
+
+template void Algo::Topo::foreachDartChunk<EmbeddedMap2, DartFunc>(EmbeddedMap2& map, DartFunc f, unsigned int nbBlocks);
+template void Algo::Topo::foreachDartChunk<EmbeddedGMap2, DartFunc>(EmbeddedGMap2& map, DartFunc f, unsigned int nbBlocks);
+template void Algo::Topo::foreachDartChunk<EmbeddedMap3, DartFunc>(EmbeddedMap3& map, DartFunc f, unsigned int nbBlocks);
+
+
+int test_streaming()
+{
+	return 0;
+}
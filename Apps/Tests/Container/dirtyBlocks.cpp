@@ -0,0 +1,108 @@
+#include "Container/attributeMultiVector.h"
+
+#include <iostream>
+
+
+using namespace CGoGN;
+
+typedef std::vector<std::pair<unsigned int, unsigned int> > Ranges;
+
+static int checkRanges(const char* what, const Ranges& ranges, const Ranges& expected)
+{
+	if (ranges == expected)
+		return 0;
+	std::cerr << "test_dirtyBlocks: " << what << ": got";
+	for (unsigned int i = 0; i < ranges.size(); ++i)
+		std::cerr << " [" << ranges[i].first << "," << ranges[i].second << "[";
+	std::cerr << std::endl;
+	return 1;
+}
+
+static Ranges blocks(unsigned int b, unsigned int e)
+{
+	return Ranges(1, std::make_pair(b * _BLOCKSIZE_, e * _BLOCKSIZE_));
+}
+
+static Ranges blocks(unsigned int b1, unsigned int e1, unsigned int b2, unsigned int e2)
+{
+	Ranges r = blocks(b1, e1);
+	r.push_back(std::make_pair(b2 * _BLOCKSIZE_, e2 * _BLOCKSIZE_));
+	return r;
+}
+
+int test_dirtyBlocks()
+{
+	int nbErrors = 0;
+	Ranges ranges;
+
+	AttributeMultiVector<float> amv("dirty", "float");
+	for (unsigned int b = 0; b < 6; ++b)
+		amv.addBlock();
+
+	// first synchronization: all the blocks
+	unsigned int v = amv.getDirtyRanges(0, ranges);
+	nbErrors += checkRanges("initial", ranges, blocks(0, 6));
+	v = amv.getDirtyRanges(v, ranges);
+	nbErrors += checkRanges("nothing modified", ranges, Ranges());
+
+	// setDirty / setDirtyRange, contiguous blocks are merged
+	amv.setDirty(1 * _BLOCKSIZE_ + 3);
+	amv.setDirtyRange(2 * _BLOCKSIZE_, 3 * _BLOCKSIZE_ + 1);
+	amv.setDirty(5 * _BLOCKSIZE_);
+	v = amv.getDirtyRanges(v, ranges);
+	nbErrors += checkRanges("setDirty / setDirtyRange", ranges, blocks(1, 4, 5, 6));
+
+	// an empty range and elements beyond the end do not modify anything
+	amv.setDirtyRange(4 * _BLOCKSIZE_, 4 * _BLOCKSIZE_);
+	amv.setDirty(6 * _BLOCKSIZE_);
+	v = amv.getDirtyRanges(v, ranges);
+	nbErrors += checkRanges("empty range", ranges, Ranges());
+
+	// two consumers synchronized at different versions
+	unsigned int v1 = v;
+	amv.setDirty(0);
+	unsigned int v2 = amv.synchronize();
+	amv.setDirty(4 * _BLOCKSIZE_);
+	v2 = amv.getDirtyRanges(v2, ranges);
+	nbErrors += checkRanges("second consumer", ranges, blocks(4, 5));
+	v1 = amv.getDirtyRanges(v1, ranges);
+	nbErrors += checkRanges("first consumer", ranges, blocks(0, 1, 4, 5));
+	v2 = amv.getDirtyRanges(v2, ranges);
+	nbErrors += checkRanges("second consumer again", ranges, Ranges());
+
+	// a version given by another attribute (not reached by this one): all the blocks
+	AttributeMultiVector<float> other("other", "float");
+	other.addBlock();
+	unsigned int vo = 0;
+	for (unsigned int i = 0; i < 20; ++i)
+		vo = other.synchronize();
+	amv.getDirtyRanges(vo, ranges);
+	nbErrors += checkRanges("version of another attribute", ranges, blocks(0, 6));
+	v = amv.synchronize();
+
+	// new blocks are modified
+	amv.addBlock();
+	v = amv.getDirtyRanges(v, ranges);
+	nbErrors += checkRanges("addBlock", ranges, blocks(6, 7));
+
+	// copy, clear and setAllDirty modify all the blocks
+	AttributeMultiVector<float> copied("copied", "float");
+	for (unsigned int b = 0; b < 7; ++b)
+		copied.addBlock();
+	unsigned int vc = copied.synchronize();
+	copied.copy(&amv);
+	copied.getDirtyRanges(vc, ranges);
+	nbErrors += checkRanges("copy", ranges, blocks(0, 7));
+
+	amv.setAllDirty();
+	v = amv.getDirtyRanges(v, ranges);
+	nbErrors += checkRanges("setAllDirty", ranges, blocks(0, 7));
+
+	amv.clear();
+	for (unsigned int b = 0; b < 2; ++b)
+		amv.addBlock();
+	v = amv.getDirtyRanges(v, ranges);
+	nbErrors += checkRanges("clear", ranges, blocks(0, 2));
+
+	return nbErrors;
+}
@@ -5,6 +5,7 @@
 extern int test_attributeContainer();
 extern int test_attributeMultiVector();
 extern int test_containerBrowser();
+extern int test_dirtyBlocks();
 
 
 int main()
@@ -13,5 +14,5 @@ int main()
 	test_attributeMultiVector();
 	test_containerBrowser();
 
-	return 0;
+	return test_dirtyBlocks();
 }
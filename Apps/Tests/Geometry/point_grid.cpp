@@ -0,0 +1,24 @@
+#include <iostream>
+#include <Geometry/vector_gen.h>
+#include <Geometry/point_grid.h>
+
+using namespace CGoGN;
+
+
+/*****************************************
+*		POINT GRID INSTANTIATION
+*****************************************/
+
+template class Geom::PointGrid< Geom::Vector<3, float> >;
+template class Geom::PointGrid< Geom::Vector<3, double> >;
+
+template class Geom::PointGrid< Geom::Vector<2, float> >;
+template class Geom::PointGrid< Geom::Vector<2, double> >;
+
+
+
+int test_point_grid()
+{
+
+	return 0;
+}
@@ -13,6 +13,8 @@ extern int test_transfo();
 extern int test_plane3d();
 extern int test_frame();
 extern int test_distances();
+extern int test_point_grid();
+extern int test_vector_batch();
 
 
 
@@ -29,6 +31,8 @@ int main()
 	test_plane3d();
 	test_frame();
 	test_distances();
+	test_point_grid();
+	test_vector_batch();
 
 	return 0;
 }
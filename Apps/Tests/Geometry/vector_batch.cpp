@@ -0,0 +1,40 @@
+#include <iostream>
+
+#include "Geometry/vector_batch.h"
+
+using namespace CGoGN;
+
+template void Geom::batchDot<double>(const Geom::Vec3d* a, const Geom::Vec3d* b, double* res, unsigned int nb);
+template void Geom::batchCross<double>(const Geom::Vec3d* a, const Geom::Vec3d* b, Geom::Vec3d* res, unsigned int nb);
+template void Geom::batchNormalize<double>(Geom::Vec3d* v, unsigned int nb);
+template void Geom::batchTransform<double>(const Geom::Matrix44d& mat, Geom::Vec3d* v, unsigned int nb);
+template void Geom::batchFitRotation<double>(const Geom::Matrix33d* a, Geom::Vec4d* q, Geom::Matrix33d* r, unsigned int nb, unsigned int nbIterations);
+
+
+int test_vector_batch()
+{
+	Geom::Vec3f v[5] = { Geom::Vec3f(3.0f,4.0f,5.0f), Geom::Vec3f(1.0f,0.0f,0.0f), Geom::Vec3f(0.0f), Geom::Vec3f(-2.0f,1.0f,7.0f), Geom::Vec3f(1.0f,2.0f,3.0f) };
+	Geom::Vec3f c[5];
+	float d[5];
+
+	Geom::batchDot(v, v, d, 5);
+	Geom::batchCross(v, v + 1, c, 4);
+	Geom::batchNormalize(v, 5);
+
+	Geom::Matrix44f m;
+	m.identity();
+	Geom::translate(1.0f, 2.0f, 3.0f, m);
+	Geom::batchTransform(m, v, 5);
+
+	Geom::Matrix33f a[5];
+	Geom::Vec4f q[5];
+	Geom::Matrix33f r[5];
+	for (unsigned int i = 0; i < 5; ++i)
+	{
+		a[i].identity();
+		q[i] = Geom::Vec4f(0.0f, 0.0f, 0.0f, 1.0f);
+	}
+	Geom::batchFitRotation(a, q, r, 5);
+
+	return 0;
+}
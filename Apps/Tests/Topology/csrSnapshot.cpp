@@ -0,0 +1,84 @@
+
+#include "Topology/map/embeddedMap2.h"
+#include "Topology/map/embeddedMap3.h"
+#include "Topology/generic/parameters.h"
+#include "Topology/generic/traversor/traversor2.h"
+#include "Algo/Tiling/Surface/square.h"
+
+
+#include "Topology/generic/csrSnapshot.h"
+
+#include <iostream>
+
+namespace CGoGN
+{
+
+
+template void buildCSRRelation<VERTEX, FACE, EmbeddedMap2>(EmbeddedMap2& map, CSRRelation& csr, bool adjacent, unsigned int nbth);
+template void buildCSRRelation<VERTEX, EDGE, EmbeddedMap3>(EmbeddedMap3& map, CSRRelation& csr, bool adjacent, unsigned int nbth);
+template void buildCSRRelation<VOLUME, VERTEX, EmbeddedMap3>(EmbeddedMap3& map, CSRRelation& csr, bool adjacent, unsigned int nbth);
+
+
+template class CSRSnapshot<EmbeddedMap2>;
+template class CSRSnapshot<EmbeddedMap3>;
+
+}
+
+using namespace CGoGN;
+
+struct PFP2: public PFP_STANDARD
+{
+	typedef EmbeddedMap2 MAP;
+};
+
+// compare the darts and the indices of the rows of the vertex-vertex relation with Traversor2VVaE
+static int checkVertexVertices(EmbeddedMap2& map, const CSRRelation& csr, const char* what)
+{
+	int nbErrors = 0;
+	foreach_cell<VERTEX>(map, [&] (Vertex v)
+	{
+		unsigned int emb = map.getEmbedding(v);
+		const Dart* row = csr.row(emb);
+		const unsigned int* idx = csr.indicesBegin(emb);
+		unsigned int n = 0;
+		Traversor2VVaE<EmbeddedMap2> t(map, v);
+		for (Vertex w = t.begin(); w.dart != t.end().dart; w = t.next(), ++n)
+		{
+			if (n >= csr.degree(emb) || row[n] != w.dart || idx[n] != map.getEmbedding(w))
+				++nbErrors;
+		}
+		if (n != csr.degree(emb) || csr.indicesEnd(emb) != idx + n)
+			++nbErrors;
+	});
+	if (nbErrors > 0)
+		std::cerr << "test_csrSnapshot: " << what << ": " << nbErrors << " errors" << std::endl;
+	return nbErrors;
+}
+
+int test_csrSnapshot()
+{
+	int nbErrors = 0;
+
+	EmbeddedMap2 map;
+	Algo::Surface::Tilings::Square::Grid<PFP2> grid(map, 4, 3);
+
+	// V-V rows must give the embeddings of the adjacent vertices, not of the edges
+	CSRRelation vv;
+	buildCSRRelation<VERTEX, EDGE>(map, vv, true);
+	nbErrors += checkVertexVertices(map, vv, "buildCSRRelation");
+	if (map.isOrbitEmbedded<EDGE>())
+	{
+		std::cerr << "test_csrSnapshot: edges embedded by an adjacency relation" << std::endl;
+		++nbErrors;
+	}
+
+	// same rows with the snapshot, built with several threads and attached
+	CSRSnapshot<EmbeddedMap2> snapshot(map);
+	snapshot.build(3);
+	nbErrors += checkVertexVertices(map, snapshot.vertexVertices(), "CSRSnapshot");
+	snapshot.attach();
+	nbErrors += checkVertexVertices(map, snapshot.vertexVertices(), "CSRSnapshot attached");
+	snapshot.detach();
+
+	return nbErrors;
+}
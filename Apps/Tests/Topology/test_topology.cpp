@@ -0,0 +1,11 @@
+#include <iostream>
+
+
+// no header files test function names from cpp files
+extern int test_csrSnapshot();
+
+
+int main()
+{
+	return test_csrSnapshot();
+}
@@ -0,0 +1,14 @@
+#include "Utils/indexedHeap.h"
+#include "Topology/generic/dart.h"
+
+
+template class CGoGN::Utils::IndexedHeap<float, unsigned int>;
+template class CGoGN::Utils::IndexedHeap<double, CGoGN::Dart>;
+template class CGoGN::Utils::IndexedHeap<double, unsigned int, 4>;
+
+
+int test_indexedHeap()
+{
+
+	return 0;
+}
@@ -4,6 +4,7 @@
 // no header files test function names from cpp files
 //extern int test_colorMaps();
 extern int test_colourConverter();
+extern int test_indexedHeap();
 extern int test_qem();
 extern int test_quadricRGBfunctions();
 extern int test_quantization();
@@ -16,6 +17,7 @@ int main()
 {
 	//test_colorMaps();
 	test_colourConverter();
+	test_indexedHeap();
 	test_qem();
 	test_quadricRGBfunctions();
 	test_quantization();
@@ -0,0 +1,179 @@
+/*******************************************************************************
+* CGoGN: Combinatorial and Geometric modeling with Generic N-dimensional Maps  *
+* version 0.1                                                                  *
+* Copyright (C) 2009-2012, IGG Team, LSIIT, University of Strasbourg           *
+*                                                                              *
+* This library is free software; you can redistribute it and/or modify it      *
+* under the terms of the GNU Lesser General Public License as published by the *
+* Free Software Foundation; either version 2.1 of the License, or (at your     *
+* option) any later version.                                                   *
+*                                                                              *
+* This library is distributed in the hope that it will be useful, but WITHOUT  *
+* ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or        *
+* FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License  *
+* for more details.                                                            *
+*                                                                              *
+* You should have received a copy of the GNU Lesser General Public License     *
+* along with this library; if not, write to the Free Software Foundation,      *
+* Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301 USA.           *
+*                                                                              *
+* Web site: http://cgogn.unistra.fr/                                           *
+* Contact information: cgogn@unistra.fr                                        *
+*                                                                              *
+*******************************************************************************/
+
+
+#include "Topology/generic/parameters.h"
+#include "Topology/map/embeddedMap3.h"
+#include "Algo/Tiling/Volume/cubic.h"
+
+
+using namespace CGoGN ;
+
+/**
+ * Struct that contains some informations about the types of the manipulated objects
+ * Mainly here to be used by the algorithms that are parameterized by it
+ */
+struct PFP: public PFP_STANDARD
+{
+	// definition of the type of the map
+	typedef EmbeddedMap3 MAP;
+	typedef double REAL;
+	typedef Geom::Vector<3,REAL> VEC3;
+};
+
+typedef PFP::MAP MAP;
+typedef PFP::VEC3 VEC3;
+
+/**
+ * compare the darts, the topological relations, the embeddings and the
+ * attributes position (vertices) and color (volumes) of two maps
+ * @return the number of differences
+ */
+unsigned int compareMaps(MAP& m1, MAP& m2, const std::string& what)
+{
+	unsigned int nbDiff = 0;
+
+	if (m1.getNbDarts() != m2.getNbDarts())
+		++nbDiff;
+
+	VertexAttribute<VEC3, MAP> position1 = m1.getAttribute<VEC3, VERTEX, MAP>("position");
+	VertexAttribute<VEC3, MAP> position2 = m2.getAttribute<VEC3, VERTEX, MAP>("position");
+	VolumeAttribute<VEC3, MAP> color1 = m1.getAttribute<VEC3, VOLUME, MAP>("color");
+	VolumeAttribute<VEC3, MAP> color2 = m2.getAttribute<VEC3, VOLUME, MAP>("color");
+	if (!position2.isValid() || !color2.isValid())
+	{
+		std::cout << what << ": attributes not loaded" << std::endl;
+		return nbDiff + 1;
+	}
+
+	Dart d2 = m2.begin();
+	for (Dart d1 = m1.begin(); d1 != m1.end(); m1.next(d1), m2.next(d2))
+	{
+		if (d2 == m2.end())
+		{
+			++nbDiff;
+			break;
+		}
+		if ((d1 != d2) || (m1.phi1(d1) != m2.phi1(d2)) || (m1.phi2(d1) != m2.phi2(d2)) || (m1.phi3(d1) != m2.phi3(d2)))
+			++nbDiff;
+		else
+		{
+			// attributes read by index: the handlers would embed the cells that are not (read only maps)
+			unsigned int v = m1.getEmbedding<VERTEX>(d1);
+			unsigned int w = m1.getEmbedding<VOLUME>(d1);
+			if ((v != m2.getEmbedding<VERTEX>(d2)) || (w != m2.getEmbedding<VOLUME>(d2)))
+				++nbDiff;
+			else if (((v != EMBNULL) && (position1[v] != position2[v])) || ((w != EMBNULL) && (color1[w] != color2[w])))
+				++nbDiff;
+		}
+	}
+
+	std::cout << what << ": " << nbDiff << " differences" << std::endl;
+	return nbDiff;
+}
+
+int main()
+{
+	// declare a map to handle the mesh
+	MAP myMap;
+
+	// add position attribute on vertices and get handler on it
+	VertexAttribute<VEC3, MAP> position = myMap.addAttribute<VEC3, VERTEX, MAP>("position");
+	const int nb = 6;
+	Algo::Volume::Tilings::Cubic::Grid<PFP> cubic(myMap, nb, nb, nb);
+	cubic.embedIntoGrid(position, 10.0f, 10.0f, 10.0f);
+
+	VolumeAttribute<VEC3, MAP> color = myMap.addAttribute<VEC3, VOLUME, MAP>("color");
+	foreach_cell<VOLUME>(myMap, [&](Vol w)
+	{
+		color[w] = position[w.dart] + VEC3(0.5, 0.5, 0.5);
+	});
+
+	// holes in the containers
+	unsigned int k = 0;
+	for (Dart d = myMap.begin(); d != myMap.end(); myMap.next(d))
+		if (++k % 17 == 0)
+			myMap.cutEdge(d);
+
+	unsigned int nbDiff = 0;
+
+	if (!myMap.saveMapMappable("mls_map.map"))
+	{
+		std::cout << "saveMapMappable failed" << std::endl;
+		return 1;
+	}
+
+	// read-only mapping
+	{
+		MAP mapped;
+		if (!mapped.loadMapMapped("mls_map.map", true))
+			++nbDiff;
+		nbDiff += compareMaps(myMap, mapped, "loadMapMapped (read only)");
+	}
+
+	// copy-on-write mapping: the modifications never reach the file
+	{
+		MAP mapped;
+		if (!mapped.loadMapMapped("mls_map.map"))
+			++nbDiff;
+		nbDiff += compareMaps(myMap, mapped, "loadMapMapped (copy on write)");
+
+		VertexAttribute<VEC3, MAP> position2 = mapped.getAttribute<VEC3, VERTEX, MAP>("position");
+		foreach_cell<VERTEX>(mapped, [&](Vertex v)
+		{
+			position2[v] += VEC3(1, 1, 1);
+		});
+		mapped.cutEdge(mapped.begin());
+	}
+	{
+		MAP mapped;
+		mapped.loadMapMapped("mls_map.map", true);
+		nbDiff += compareMaps(myMap, mapped, "file unchanged after copy on write");
+	}
+
+	// loadMapBin recognizes the mappable files
+	{
+		MAP loaded;
+		if (!loaded.loadMapBin("mls_map.map"))
+			++nbDiff;
+		nbDiff += compareMaps(myMap, loaded, "loadMapBin of a mappable file");
+	}
+
+	// the compressed format is unchanged
+	{
+		myMap.saveMapBin("mls_map.bin");
+		MAP loaded;
+		if (!loaded.loadMapBin("mls_map.bin"))
+			++nbDiff;
+		nbDiff += compareMaps(myMap, loaded, "saveMapBin / loadMapBin");
+
+		// and a map loaded from it saves the same mappable file
+		loaded.saveMapMappable("mls_map2.map");
+		MAP mapped;
+		mapped.loadMapMapped("mls_map2.map", true);
+		nbDiff += compareMaps(myMap, mapped, "saveMapBin / loadMapBin / saveMapMappable / loadMapMapped");
+	}
+
+	return nbDiff == 0 ? 0 : 1;
+}
@@ -28,6 +28,7 @@
 #include "Geometry/basic.h"
 #include "Geometry/inclusion.h"
 #include "Geometry/orientation.h"
+#include "Geometry/point_grid.h"
 
 namespace CGoGN
 {
@@ -47,6 +48,10 @@ bool isBetween(typename PFP::MAP& map, const VertexAttribute<typename PFP::VEC3,
 template <typename PFP>
 void mergeVertex(typename PFP::MAP& map, VertexAttribute<typename PFP::VEC3, typename PFP::MAP>& positions, Dart d, Dart e, int precision);
 
+/**
+ * merge the vertices that are near within precision (see Geom::Vector::isNear)
+ * the close vertices are searched in a grid of cells of the size of the precision
+ */
 template <typename PFP>
 void mergeVertices(typename PFP::MAP& map, VertexAttribute<typename PFP::VEC3, typename PFP::MAP>& positions, int precision);
 
@@ -75,32 +75,65 @@ void mergeVertex(typename PFP::MAP& map, VertexAttribute<typename PFP::VEC3, typ
 	} while (notempty) ;
 }
 
+template <typename REAL>
+REAL precisionDistance(int precision)
+{
+	// distance under which Vector::isNear(v, precision) may be true
+	if (precision == 0)
+		return REAL(0) ;
+	if (precision > 0)
+		return REAL(precision) ;
+	return REAL(1) / REAL(-precision) ;
+}
+
 template <typename PFP>
 void mergeVertices(typename PFP::MAP& map, VertexAttribute<typename PFP::VEC3, typename PFP::MAP>& positions, int precision)
 {
-	// TODO optimiser en triant les sommets
-	// map.template enableQuickTraversal<VERTEX>();
-	TraversorV<typename PFP::MAP> travV1(map) ;
-	CellMarker<typename PFP::MAP, VERTEX> vM(map);
-	for(Dart d1 = travV1.begin() ; d1 != travV1.end() ; d1 = travV1.next())
+	typedef typename PFP::REAL REAL ;
+
+	// one dart per vertex, in the order of the vertices traversal
+	std::vector<Dart> vertices ;
+	vertices.reserve(map.template getAttributeContainer<VERTEX>().size()) ;
+	TraversorV<typename PFP::MAP> travV(map) ;
+	for (Dart d = travV.begin() ; d != travV.end() ; d = travV.next())
+		vertices.push_back(d) ;
+
+	// grid of cells of the size of the precision: close vertices are in neighboring cells
+	Geom::PointGrid<typename PFP::VEC3> grid(precisionDistance<REAL>(precision)) ;
+	grid.reserve(uint32(vertices.size())) ;
+	for (unsigned int i = 0 ; i < vertices.size() ; ++i)
+		grid.addPoint(positions[vertices[i]], i) ;
+	grid.build() ;
+
+	// a vertex is done when it has been treated or merged in another one
+	std::vector<bool> done(vertices.size(), false) ;
+	std::vector<unsigned int> near ;
+	for (unsigned int i = 0 ; i < vertices.size() ; ++i)
 	{
-		vM.mark(d1);
-		TraversorV<typename PFP::MAP> travV2(map) ;
-		for(Dart d2 = travV2.begin() ; d2 != travV2.end() ; d2 = travV2.next())
+		if (done[i])
+			continue ;
+		done[i] = true ;
+
+		Dart d1 = vertices[i] ;
+		near.clear() ;
+		grid.foreach_neighbor(positions[d1], [&] (unsigned int j)
+		{
+			if (!done[j] && positions[d1].isNear(positions[vertices[j]], precision))
+				near.push_back(j) ;
+		}) ;
+		// keep the order of the exhaustive search
+		std::sort(near.begin(), near.end()) ;
+
+		for (std::vector<unsigned int>::iterator it = near.begin() ; it != near.end() ; ++it)
 		{
-			if(!vM.isMarked(d2))
-			{
-				if(positions[d1].isNear(positions[d2], precision))
-				{
-					if (map.sameVertex(d1,d2))
-						std::cout << "fusion: sameVertex" << std::endl ;
-					if (!map.sameVertex(d1,d2))
-						mergeVertex<PFP>(map,positions,d1,d2,precision);
-				}
-			}
+			Dart d2 = vertices[*it] ;
+			done[*it] = true ;
+			if (map.sameVertex(d1, d2))
+				std::cout << "fusion: sameVertex" << std::endl ;
+			else
+				mergeVertex<PFP>(map, positions, d1, d2, precision) ;
 		}
 	}
-	//	map.template disableQuickTraversal<VERTEX>();
 }
 
 }
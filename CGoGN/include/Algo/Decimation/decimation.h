@@ -29,6 +29,12 @@
 #include "Algo/Decimation/halfEdgeSelector.h"
 #include "Algo/Decimation/geometryApproximator.h"
 #include "Algo/Decimation/colorPerVertexApproximator.h"
+#include "Utils/threadPool.h"
+
+#include <atomic>
+#include <limits>
+#include <cstring>
+#include <cmath>
 
 namespace CGoGN
 {
@@ -99,6 +105,57 @@ int decimate(
 	void* callback_object = NULL
 ) ;
 
+/**
+ *\fn decimateParallel
+ * Function that decimates the provided mesh by batches of independent edge collapses,
+ * with the error of EdgeSelector_QEM (quadric of the two vertices at the approximated position).
+ * At each pass:
+ * - among the collapsible edges of lowest error (batchRatio of them), the ones whose error
+ *   is the smallest over their region (both vertices and their neighbors) are selected,
+ *   then the same among the remaining edges whose region does not touch a selected one,
+ *   until the regions of the selected edges form a maximal disjoint set;
+ * - the selected edges are collapsed by increasing error;
+ * - the errors of the edges of the modified regions are recomputed in parallel.
+ * The approximators are called concurrently on different edges (approximate must only
+ * write the approximation of its edge: no predictor). A smaller batchRatio gives results
+ * closer to the serial decimation, with more passes.
+ *
+ * \param map the map to decimate
+ * \param position the vertex position embeddings
+ * \param a a vector containing the approximators, the first one approximates the position on edges
+ * \param nbWantedVertices the aimed amount of vertices after decimation
+ * \param batchRatio fraction of the collapsible edges that are candidates at each pass
+ * \param nbth number of threads
+ * \param callback_wrapper a callback function for progress monitoring (default NULL)
+ * \param callback_object the object to call the callback on (default NULL)
+ *
+ * \return 0 if nbWantedVertices achieved, 1 if no more edges are collapsible, -1 if the first approximator does not approximate the position on edges
+ */
+template <typename PFP>
+int decimateParallel(
+	typename PFP::MAP& map,
+	VertexAttribute<typename PFP::VEC3, typename PFP::MAP>& position,
+	std::vector<ApproximatorGen<PFP>*>& a,
+	unsigned int nbWantedVertices,
+	float batchRatio = 0.25f,
+	unsigned int nbth = Parallel::NumberOfThreads,
+	void (*callback_wrapper)(void*, const void*) = NULL,
+	void* callback_object = NULL
+) ;
+
+/**
+ *\fn decimateParallel
+ * Same with a QEM approximator of the position
+ */
+template <typename PFP>
+int decimateParallel(
+	typename PFP::MAP& map,
+	VertexAttribute<typename PFP::VEC3, typename PFP::MAP>& position,
+	unsigned int nbWantedVertices,
+	float batchRatio = 0.25f,
+	unsigned int nbth = Parallel::NumberOfThreads
+) ;
+
 } // namespace Decimation
 
 } // namespace Surface
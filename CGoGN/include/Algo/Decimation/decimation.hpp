@@ -270,6 +270,378 @@ int decimate(
 	return finished == true ? 0 : 1 ; // finished correctly
 }
 
+namespace ParallelCollapse
+{
+
+/**
+ * apply f on the vertex indices of the region of the collapse of edge d:
+ * its two vertices and their neighbors (some are given twice)
+ */
+template <typename MAP, typename FUNC>
+inline void foreachRegionVertex(MAP& map, Dart d, FUNC f)
+{
+	Dart dd = map.phi2(d) ;
+	Dart it = d ;
+	do
+	{
+		f(map.template getEmbedding<VERTEX>(map.phi1(it))) ;
+		it = map.phi2_1(it) ;
+	} while(it != d) ;
+	it = dd ;
+	do
+	{
+		f(map.template getEmbedding<VERTEX>(map.phi1(it))) ;
+		it = map.phi2_1(it) ;
+	} while(it != dd) ;
+}
+
+/**
+ * key that orders the collapses by error then by edge index
+ * (the bits of a positive float are ordered as the float)
+ */
+inline unsigned long long key(float error, unsigned int edge)
+{
+	unsigned int bits ;
+	std::memcpy(&bits, &error, sizeof(bits)) ;
+	return (static_cast<unsigned long long>(bits) << 32) | edge ;
+}
+
+} // namespace ParallelCollapse
+
+template <typename PFP>
+int decimateParallel(
+	typename PFP::MAP& map,
+	VertexAttribute<typename PFP::VEC3, typename PFP::MAP>& position,
+	std::vector<ApproximatorGen<PFP>*>& approximators,
+	unsigned int nbWantedVertices,
+	float batchRatio,
+	unsigned int nbth,
+	void (*callback_wrapper)(void*, const void*),
+	void* callback_object
+)
+{
+	typedef typename PFP::MAP MAP ;
+	typedef typename PFP::VEC3 VEC3 ;
+	typedef typename PFP::REAL REAL ;
+	typedef unsigned long long Key ;
+	const Key LOCKED = ~Key(0) ;		// keys of valid errors are below these values
+	const Key FREE = ~Key(0) - 1 ;
+
+	if (approximators.empty())
+		return -1 ;
+	Approximator<PFP, VEC3, EDGE>* posApprox = dynamic_cast<Approximator<PFP, VEC3, EDGE>*>(approximators[0]) ;
+	if (posApprox == NULL || posApprox->getApproximatedAttributeName() != position.name())
+		return -1 ;
+
+	Utils::ThreadPool* pool = (nbth > 1) ? &Utils::ThreadPool::shared(nbth - 1) : NULL ;
+	auto run = [&] (unsigned int nb, const Utils::ThreadPool::RangeFunction& f)
+	{
+		if (pool != NULL)
+			pool->parallelFor(nb, f) ;
+		else
+			f(0, nb, 0) ;
+	} ;
+
+	// vertex quadrics, shared with the approximators (as EdgeSelector_QEM does)
+	std::string attrName = position.name() ;
+	attrName += "_QEM" ;
+	VertexAttribute<Utils::Quadric<REAL>, MAP> quadric = map.template getAttribute<Utils::Quadric<REAL>, VERTEX, MAP>(attrName) ;
+	bool ownQuadric = !quadric.isValid() ;
+	if (ownQuadric)
+		quadric = map.template addAttribute<Utils::Quadric<REAL>, VERTEX, MAP>(attrName) ;
+
+	std::vector<Dart> vertices ;
+	foreach_cell<VERTEX>(map, [&] (Vertex v) { vertices.push_back(v.dart) ; }) ;
+	unsigned int nbVertices = uint32(vertices.size()) ;
+	run(nbVertices, [&] (unsigned int b, unsigned int e, unsigned int)
+	{
+		for (unsigned int i = b; i < e; ++i)
+		{
+			Utils::Quadric<REAL> q ;
+			Dart it = vertices[i] ;
+			do
+			{
+				if (!map.isBoundaryMarkedCurrent(it))
+					q += Utils::Quadric<REAL>(position[it], position[map.phi1(it)], position[map.phi_1(it)]) ;
+				it = map.phi2_1(it) ;
+			} while(it != vertices[i]) ;
+			quadric[vertices[i]] = q ;
+		}
+	}) ;
+	std::vector<Dart>().swap(vertices) ;
+
+	for(typename std::vector<ApproximatorGen<PFP>*>::iterator it = approximators.begin(); it != approximators.end(); ++it)
+		(*it)->init() ;
+
+	// edge errors (max for the edges that cannot collapse)
+	const REAL NOERROR = std::numeric_limits<REAL>::max() ;
+	EdgeAutoAttribute<REAL, MAP> errors(map) ;
+	auto computeError = [&] (Dart d)
+	{
+		REAL err = NOERROR ;
+		if (map.edgeCanCollapse(d))
+		{
+			for(typename std::vector<ApproximatorGen<PFP>*>::iterator it = approximators.begin(); it != approximators.end(); ++it)
+				(*it)->approximate(d) ;
+			Utils::Quadric<REAL> q ;
+			q += quadric[d] ;
+			q += quadric[map.phi2(d)] ;
+			err = q(posApprox->getApprox(d)) ;
+			if (!(err >= REAL(0)))
+				err = REAL(0) ;
+		}
+		errors[d] = err ;
+	} ;
+
+	std::vector<Dart> edges ;
+	foreach_cell<EDGE>(map, [&] (Edge e) { edges.push_back(e.dart) ; }) ;
+	run(uint32(edges.size()), [&] (unsigned int b, unsigned int e, unsigned int)
+	{
+		for (unsigned int i = b; i < e; ++i)
+			computeError(edges[i]) ;
+	}) ;
+
+	const AttributeContainer& dartCont = map.template getAttributeContainer<DART>() ;
+	std::vector<unsigned int> edgePass(map.template getAttributeContainer<EDGE>().realEnd(), 0) ;
+	std::vector<std::atomic<Key> > stamps(map.template getAttributeContainer<VERTEX>().realEnd()) ;
+	std::vector<std::pair<Key, Dart> > candidates ;
+	std::vector<std::pair<Key, Dart> > chosen ;
+	std::vector<char> selected ;
+	std::vector<Dart> merged ;
+	std::vector<Dart> updated ;
+	std::vector<Dart> dirty ;
+
+	bool finished = nbVertices <= nbWantedVertices ;
+	for (unsigned int pass = 1; !finished; pass += 2)
+	{
+		// remove the collapsed edges from the list (when two edges are merged
+		// both darts may remain: only the first one is kept) and get the candidates
+		candidates.clear() ;
+		unsigned int nbEdges = 0 ;
+		for (std::vector<Dart>::const_iterator it = edges.begin(); it != edges.end(); ++it)
+		{
+			if (!dartCont.used(it->index))
+				continue ;
+			unsigned int e = map.template getEmbedding<EDGE>(*it) ;
+			if (edgePass[e] == pass)
+				continue ;
+			edgePass[e] = pass ;
+			edges[nbEdges++] = *it ;
+			if (errors[e] != NOERROR)
+				candidates.push_back(std::make_pair(ParallelCollapse::key(float(errors[e]), e), *it)) ;
+		}
+		edges.resize(nbEdges) ;
+		if (candidates.empty())
+			break ;
+
+		// keep the candidates of lowest error
+		unsigned int nbToRemove = nbVertices - nbWantedVertices ;
+		unsigned int nbc = uint32(std::ceil(batchRatio * candidates.size())) ;
+		nbc = std::max(1u, std::min(nbc, nbToRemove)) ;
+		if (nbc < candidates.size())
+		{
+			std::nth_element(candidates.begin(), candidates.begin() + nbc, candidates.end()) ;
+			candidates.resize(nbc) ;
+		}
+
+		// select an independent set of collapses: at each round the candidates of
+		// smallest key over their region are kept and the candidates whose region
+		// touches a kept region are discarded
+		chosen.clear() ;
+		while (!candidates.empty() && chosen.size() < nbToRemove)
+		{
+			unsigned int nba = uint32(candidates.size()) ;
+			run(nba, [&] (unsigned int b, unsigned int e, unsigned int)
+			{
+				for (unsigned int i = b; i < e; ++i)
+					ParallelCollapse::foreachRegionVertex(map, candidates[i].second, [&] (unsigned int v)
+					{
+						stamps[v].store(FREE, std::memory_order_relaxed) ;
+					}) ;
+			}) ;
+			run(nba, [&] (unsigned int b, unsigned int e, unsigned int)
+			{
+				for (unsigned int i = b; i < e; ++i)
+				{
+					Key k = candidates[i].first ;
+					ParallelCollapse::foreachRegionVertex(map, candidates[i].second, [&] (unsigned int v)
+					{
+						Key cur = stamps[v].load(std::memory_order_relaxed) ;
+						while (k < cur && !stamps[v].compare_exchange_weak(cur, k, std::memory_order_relaxed)) {}
+					}) ;
+				}
+			}) ;
+			selected.assign(nba, 1) ;
+			run(nba, [&] (unsigned int b, unsigned int e, unsigned int)
+			{
+				for (unsigned int i = b; i < e; ++i)
+				{
+					Key k = candidates[i].first ;
+					ParallelCollapse::foreachRegionVertex(map, candidates[i].second, [&] (unsigned int v)
+					{
+						if (stamps[v].load(std::memory_order_relaxed) != k)
+							selected[i] = 0 ;
+					}) ;
+				}
+			}) ;
+
+			for (unsigned int i = 0; i < nba; ++i)
+			{
+				if (selected[i])
+				{
+					chosen.push_back(candidates[i]) ;
+					ParallelCollapse::foreachRegionVertex(map, candidates[i].second, [&] (unsigned int v)
+					{
+						stamps[v].store(LOCKED, std::memory_order_relaxed) ;
+					}) ;
+				}
+			}
+			run(nba, [&] (unsigned int b, unsigned int e, unsigned int)
+			{
+				for (unsigned int i = b; i < e; ++i)
+				{
+					if (selected[i])
+					{
+						selected[i] = 0 ;
+						continue ;
+					}
+					selected[i] = 1 ;
+					ParallelCollapse::foreachRegionVertex(map, candidates[i].second, [&] (unsigned int v)
+					{
+						if (stamps[v].load(std::memory_order_relaxed) == LOCKED)
+							selected[i] = 0 ;
+					}) ;
+				}
+			}) ;
+			unsigned int nbs = 0 ;
+			for (unsigned int i = 0; i < nba; ++i)
+			{
+				if (selected[i])
+					candidates[nbs++] = candidates[i] ;
+			}
+			candidates.resize(nbs) ;
+		}
+		if (chosen.size() > nbToRemove)
+		{
+			std::nth_element(chosen.begin(), chosen.begin() + nbToRemove, chosen.end()) ;
+			chosen.resize(nbToRemove) ;
+		}
+		std::sort(chosen.begin(), chosen.end()) ;
+
+		// collapse (the regions are disjoint: the approximations are still valid)
+		merged.clear() ;
+		for (typename std::vector<std::pair<Key, Dart> >::const_iterator it = chosen.begin(); it != chosen.end(); ++it)
+		{
+			Dart d = it->second ;
+			Dart d2 = map.phi2(map.phi_1(d)) ;
+			Dart dd2 = map.phi2(map.phi_1(map.phi2(d))) ;
+
+			Utils::Quadric<REAL> q ;
+			q += quadric[d] ;
+			q += quadric[map.phi2(d)] ;
+
+			for(typename std::vector<ApproximatorGen<PFP>*>::iterator ait = approximators.begin(); ait != approximators.end(); ++ait)
+				(*ait)->saveApprox(d) ;
+
+			map.collapseEdge(d) ;
+
+			for(typename std::vector<ApproximatorGen<PFP>*>::iterator ait = approximators.begin(); ait != approximators.end(); ++ait)
+				(*ait)->affectApprox(d2) ;
+			quadric[d2] = q ;
+			merged.push_back(d2) ;
+			merged.push_back(dd2) ;
+
+			--nbVertices ;
+			if (callback_wrapper != NULL && callback_object != NULL)
+				callback_wrapper(callback_object, &nbVertices) ;
+		}
+		if (nbVertices <= nbWantedVertices)
+			finished = true ;
+
+		// recompute the errors of the edges of the new vertices (their quadric changed)
+		// and re-test the collapsibility of the edges of the faces around their neighbors
+		updated.clear() ;
+		dirty.clear() ;
+		auto markDirty = [&] (Dart d, std::vector<Dart>& list)
+		{
+			unsigned int e = map.template getEmbedding<EDGE>(d) ;
+			if (edgePass[e] != pass + 1)
+			{
+				edgePass[e] = pass + 1 ;
+				list.push_back(d) ;
+			}
+		} ;
+		for (std::vector<Dart>::const_iterator it = merged.begin(); it != merged.end(); it += 2)
+		{
+			Dart vit = *it ;
+			do
+			{
+				markDirty(vit, updated) ;
+				vit = map.phi2_1(vit) ;
+			} while(vit != *it) ;
+		}
+		for (std::vector<Dart>::const_iterator it = merged.begin(); it != merged.end(); it += 2)
+		{
+			Dart vit = *it ;
+			do
+			{
+				markDirty(map.phi1(vit), dirty) ;
+				if (vit == *it || vit == *(it + 1))		// the degree of the opposite vertices changed
+				{
+					Dart nit = map.phi1(vit) ;
+					do
+					{
+						markDirty(nit, dirty) ;
+						markDirty(map.phi1(nit), dirty) ;
+						nit = map.phi2_1(nit) ;
+					} while(nit != map.phi1(vit)) ;
+				}
+				vit = map.phi2_1(vit) ;
+			} while(vit != *it) ;
+		}
+		run(uint32(updated.size()), [&] (unsigned int b, unsigned int e, unsigned int)
+		{
+			for (unsigned int i = b; i < e; ++i)
+				computeError(updated[i]) ;
+		}) ;
+		// the darts of the merged edges may have been kept for the removed ones
+		edges.insert(edges.end(), updated.begin(), updated.end()) ;
+		run(uint32(dirty.size()), [&] (unsigned int b, unsigned int e, unsigned int)
+		{
+			for (unsigned int i = b; i < e; ++i)
+			{
+				if (!map.edgeCanCollapse(dirty[i]))
+					errors[dirty[i]] = NOERROR ;
+				else if (errors[dirty[i]] == NOERROR)
+					computeError(dirty[i]) ;
+			}
+		}) ;
+	}
+
+	if (ownQuadric)
+		map.removeAttribute(quadric) ;
+
+	return finished ? 0 : 1 ;
+}
+
+template <typename PFP>
+int decimateParallel(
+	typename PFP::MAP& map,
+	VertexAttribute<typename PFP::VEC3, typename PFP::MAP>& position,
+	unsigned int nbWantedVertices,
+	float batchRatio,
+	unsigned int nbth
+)
+{
+	std::vector<ApproximatorGen<PFP>*> approximators ;
+	approximators.push_back(new Approximator_QEM<PFP>(map, position)) ;
+
+	int status = decimateParallel<PFP>(map, position, approximators, nbWantedVertices, batchRatio, nbth) ;
+
+	delete approximators[0] ;
+	return status ;
+}
+
 } // namespace Decimation
 
 } // namespace Surface
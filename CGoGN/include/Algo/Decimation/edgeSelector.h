@@ -29,6 +29,7 @@
 #include "Algo/Decimation/approximator.h"
 #include "Algo/Geometry/boundingbox.h"
 #include "Utils/qem.h"
+#include "Utils/indexedHeap.h"
 #include "Algo/Geometry/normal.h"
 #include "Algo/Selection/collector.h"
 #include "Algo/Geometry/curvature.h"
@@ -109,7 +110,7 @@ private:
 
 	typedef struct
 	{
-		typename std::multimap<REAL,Dart>::iterator it ;
+		typename Utils::IndexedHeap<REAL,Dart>::Handle it ;
 		bool valid ;
 		static std::string CGoGNnameOfType() { return "LengthEdgeInfo" ; }
 	} LengthEdgeInfo ;
@@ -117,8 +118,7 @@ private:
 
 	EdgeAttribute<EdgeInfo, MAP> edgeInfo ;
 
-	std::multimap<REAL,Dart> edges ;
-	typename std::multimap<REAL,Dart>::iterator cur ;
+	Utils::IndexedHeap<REAL,Dart> edges ;
 
 	void initEdgeInfo(Dart d) ;
 	void updateEdgeInfo(Dart d, bool recompute) ;
@@ -156,7 +156,7 @@ public:
 			(*errors)[d] = -1 ;
 			if (edgeInfo[d].valid)
 			{
-				(*errors)[d] = edgeInfo[d].it->first ;
+				(*errors)[d] = edges.key(edgeInfo[d].it) ;
 			}
 		}
 	}
@@ -176,7 +176,7 @@ private:
 
 	typedef	struct
 	{
-		typename std::multimap<REAL,Dart>::iterator it ;
+		typename Utils::IndexedHeap<REAL,Dart>::Handle it ;
 		bool valid ;
 		static std::string CGoGNnameOfType() { return "QEMedgeInfo" ; }
 	} QEMedgeInfo ;
@@ -186,8 +186,7 @@ private:
 	VertexAttribute<Utils::Quadric<REAL>, MAP> quadric ;
 	Utils::Quadric<REAL> tmpQ ;
 
-	std::multimap<REAL,Dart> edges ;
-	typename std::multimap<REAL,Dart>::iterator cur ;
+	Utils::IndexedHeap<REAL,Dart> edges ;
 
 	void initEdgeInfo(Dart d) ;
 	void updateEdgeInfo(Dart d, bool recompute) ;
@@ -232,7 +231,7 @@ private:
 
 	typedef	struct
 	{
-		typename std::multimap<REAL,Dart>::iterator it ;
+		typename Utils::IndexedHeap<REAL,Dart>::Handle it ;
 		bool valid ;
 		static std::string CGoGNnameOfType() { return "QEMedgeInfo" ; }
 	} QEMedgeInfo ;
@@ -241,8 +240,7 @@ private:
 	EdgeAttribute<EdgeInfo, MAP> edgeInfo ;
 	VertexAttribute<Utils::Quadric<REAL>, MAP> quadric ;
 
-	std::multimap<REAL,Dart> edges ;
-	typename std::multimap<REAL,Dart>::iterator cur ;
+	Utils::IndexedHeap<REAL,Dart> edges ;
 
 	void initEdgeInfo(Dart d) ;
 	void updateEdgeInfo(Dart d, bool recompute) ;
@@ -288,7 +286,7 @@ private:
 
 	typedef	struct
 	{
-		typename std::multimap<REAL,Dart>::iterator it ;
+		typename Utils::IndexedHeap<REAL,Dart>::Handle it ;
 		bool valid ;
 		static std::string CGoGNnameOfType() { return "NormalAreaEdgeInfo" ; }
 	} NormalAreaEdgeInfo ;
@@ -297,8 +295,7 @@ private:
 	EdgeAttribute<EdgeInfo, MAP> edgeInfo ;
 	EdgeAttribute<Geom::Matrix<3,3,REAL>, MAP> edgeMatrix ;
 
-	std::multimap<REAL,Dart> edges ;
-	typename std::multimap<REAL,Dart>::iterator cur ;
+	Utils::IndexedHeap<REAL,Dart> edges ;
 
 	void initEdgeInfo(Dart d) ;
 	void updateEdgeInfo(Dart d) ;
@@ -342,7 +339,7 @@ private:
 
 	typedef	struct
 	{
-		typename std::multimap<REAL,Dart>::iterator it ;
+		typename Utils::IndexedHeap<REAL,Dart>::Handle it ;
 		bool valid ;
 		static std::string CGoGNnameOfType() { return "CurvatureEdgeInfo" ; }
 	} CurvatureEdgeInfo ;
@@ -361,8 +358,7 @@ private:
 	VertexAttribute<VEC3, MAP> Kmin ;
 	VertexAttribute<VEC3, MAP> Knormal ;
 
-	std::multimap<REAL,Dart> edges ;
-	typename std::multimap<REAL,Dart>::iterator cur ;
+	Utils::IndexedHeap<REAL,Dart> edges ;
 
 	void initEdgeInfo(Dart d) ;
 	void updateEdgeInfo(Dart d, bool recompute) ;
@@ -453,7 +449,7 @@ private:
 
 	typedef	struct
 	{
-		typename std::multimap<REAL,Dart>::iterator it ;
+		typename Utils::IndexedHeap<REAL,Dart>::Handle it ;
 		bool valid ;
 		static std::string CGoGNnameOfType() { return "CurvatureTensorEdgeInfo" ; }
 	} CurvatureTensorEdgeInfo ;
@@ -463,8 +459,7 @@ private:
 	EdgeAttribute<REAL, MAP> edgeangle ;
 	EdgeAttribute<REAL, MAP> edgearea ;
 
-	std::multimap<REAL,Dart> edges ;
-	typename std::multimap<REAL,Dart>::iterator cur ;
+	Utils::IndexedHeap<REAL,Dart> edges ;
 
 	void initEdgeInfo(Dart d) ;
 	void updateEdgeInfo(Dart d) ; // TODO : usually has a 2nd arg (, bool recompute) : why ??
@@ -521,7 +516,7 @@ private:
 
 	typedef	struct
 	{
-		typename std::multimap<REAL,Dart>::iterator it ;
+		typename Utils::IndexedHeap<REAL,Dart>::Handle it ;
 		bool valid ;
 		static std::string CGoGNnameOfType() { return "MinDetailEdgeInfo" ; }
 	} MinDetailEdgeInfo ;
@@ -529,8 +524,7 @@ private:
 
 	EdgeAttribute<EdgeInfo, MAP> edgeInfo ;
 
-	std::multimap<REAL,Dart> edges ;
-	typename std::multimap<REAL,Dart>::iterator cur ;
+	Utils::IndexedHeap<REAL,Dart> edges ;
 
 	void initEdgeInfo(Dart d) ;
 	void updateEdgeInfo(Dart d, bool recompute) ;
@@ -577,7 +571,7 @@ private:
 
 	typedef	struct
 	{
-		typename std::multimap<REAL,Dart>::iterator it ;
+		typename Utils::IndexedHeap<REAL,Dart>::Handle it ;
 		bool valid ;
 		static std::string CGoGNnameOfType() { return "ColorNaiveEdgeInfo" ; }
 	} ColorNaiveedgeInfo ;
@@ -586,8 +580,7 @@ private:
 	EdgeAttribute<EdgeInfo, MAP> edgeInfo ;
 	VertexAttribute<Utils::Quadric<REAL>, MAP> m_quadric ;
 
-	std::multimap<REAL,Dart> edges ;
-	typename std::multimap<REAL,Dart>::iterator cur ;
+	Utils::IndexedHeap<REAL,Dart> edges ;
 
 	void initEdgeInfo(Dart d) ;
 	void updateEdgeInfo(Dart d, bool recompute) ;
@@ -645,7 +638,7 @@ private:
 
 	typedef	struct
 	{
-		typename std::multimap<REAL,Dart>::iterator it ;
+		typename Utils::IndexedHeap<REAL,Dart>::Handle it ;
 		bool valid ;
 		static std::string CGoGNnameOfType() { return "GeomColOptGradEdgeInfo" ; }
 	} ColorNaiveedgeInfo ;
@@ -654,8 +647,7 @@ private:
 	EdgeAttribute<EdgeInfo, MAP> edgeInfo ;
 	VertexAttribute<Utils::Quadric<REAL>, MAP> m_quadric ;
 
-	std::multimap<REAL,Dart> edges ;
-	typename std::multimap<REAL,Dart>::iterator cur ;
+	Utils::IndexedHeap<REAL,Dart> edges ;
 
 	void initEdgeInfo(Dart d) ;
 	void updateEdgeInfo(Dart d) ;
@@ -708,7 +700,7 @@ public:
 			(*errors)[d] = -1 ;
 			if (edgeInfo[d].valid)
 			{
-				(*errors)[d] = edgeInfo[d].it->first ;
+				(*errors)[d] = edges.key(edgeInfo[d].it) ;
 			}
 		}
 	}
@@ -735,7 +727,7 @@ private:
 
 	typedef	struct
 	{
-		typename std::multimap<REAL,Dart>::iterator it ;
+		typename Utils::IndexedHeap<REAL,Dart>::Handle it ;
 		bool valid ;
 		static std::string CGoGNnameOfType() { return "QEMextColorEdgeInfo" ; }
 	} QEMextColorEdgeInfo ;
@@ -744,8 +736,7 @@ private:
 	EdgeAttribute<EdgeInfo, MAP> edgeInfo ;
 	VertexAttribute<Utils::QuadricNd<REAL,6>, MAP> m_quadric ;
 
-	std::multimap<REAL,Dart> edges ;
-	typename std::multimap<REAL,Dart>::iterator cur ;
+	Utils::IndexedHeap<REAL,Dart> edges ;
 
 	void initEdgeInfo(Dart d) ;
 	void updateEdgeInfo(Dart d, bool recompute) ;
@@ -795,7 +786,7 @@ public:
 			(*errors)[d] = -1 ;
 			if (edgeInfo[d].valid)
 			{
-				(*errors)[d] = edgeInfo[d].it->first ;
+				(*errors)[d] = edges.key(edgeInfo[d].it) ;
 			}
 		}
 	}
@@ -158,17 +158,15 @@ bool EdgeSelector_Length<PFP>::init()
 		initEdgeInfo(e.dart) ;
 	}
 
-	cur = edges.begin() ; // init the current edge to the first one
-
 	return true ;
 }
 
 template <typename PFP>
 bool EdgeSelector_Length<PFP>::nextEdge(Dart& d) const
 {
-	if(cur == edges.end() || edges.empty())
+	if(edges.empty())
 		return false ;
-	d = (*cur).second ;
+	d = edges.top() ;
 	return true ;
 }
 
@@ -188,7 +186,7 @@ void EdgeSelector_Length<PFP>::updateBeforeCollapse(Dart d)
 	edgeE = &(edgeInfo[m.phi_1(d)]) ;	// the concerned edges
 	if(edgeE->valid)
 		edges.erase(edgeE->it) ;
-									// from the multimap
+									// from the heap
 	Dart dd = m.phi2(d) ;
 	if(dd != d)
 	{
@@ -229,18 +227,14 @@ void EdgeSelector_Length<PFP>::updateAfterCollapse(Dart d2, Dart dd2)
 
 		vit = m.phi2_1(vit) ;
 	} while(vit != d2) ;
-
-	cur = edges.begin() ; // set the current edge to the first one
 }
 
 template <typename PFP>
 void EdgeSelector_Length<PFP>::updateWithoutCollapse()
 {
-	EdgeInfo& einfo = edgeInfo[(*cur).second] ;
+	EdgeInfo& einfo = edgeInfo[edges.top()] ;
 	einfo.valid = false ;
 	edges.erase(einfo.it) ;
-
-	cur = edges.begin();
 }
 
 template <typename PFP>
@@ -263,7 +257,7 @@ void EdgeSelector_Length<PFP>::updateEdgeInfo(Dart d, bool recompute)
 	if(recompute)
 	{
 		if(einfo.valid)
-			edges.erase(einfo.it) ;			// remove the edge from the multimap
+			edges.erase(einfo.it) ;			// remove the edge from the heap
 		if(m.edgeCanCollapse(d))
 			computeEdgeInfo(d, einfo) ;
 		else
@@ -291,7 +285,7 @@ template <typename PFP>
 void EdgeSelector_Length<PFP>::computeEdgeInfo(Dart d, EdgeInfo& einfo)
 {
 	VEC3 vec = Algo::Geometry::vectorOutOfDart<PFP>(this->m_map, d, position) ;
-	einfo.it = edges.insert(std::make_pair(vec.norm2(), d)) ;
+	einfo.it = edges.insert(vec.norm2(), d) ;
 	einfo.valid = true ;
 }
 
@@ -334,9 +328,7 @@ bool EdgeSelector_QEM<PFP>::init()
 	for (Edge e : allEdgesOf(m))
 	{
 		initEdgeInfo(e.dart) ;	// init the edges with their optimal position
-	}							// and insert them in the multimap according to their error
-
-	cur = edges.begin() ; // init the current edge to the first one
+	}							// and insert them in the heap according to their error
 
 	return true ;
 }
@@ -344,9 +336,9 @@ bool EdgeSelector_QEM<PFP>::init()
 template <typename PFP>
 bool EdgeSelector_QEM<PFP>::nextEdge(Dart& d) const
 {
-	if(cur == edges.end() || edges.empty())
+	if(edges.empty())
 		return false ;
-	d = (*cur).second ;
+	d = edges.top() ;
 	return true ;
 }
 
@@ -366,7 +358,7 @@ void EdgeSelector_QEM<PFP>::updateBeforeCollapse(Dart d)
 	edgeE = &(edgeInfo[m.phi_1(d)]) ;	// the concerned edges
 	if(edgeE->valid)
 		edges.erase(edgeE->it) ;
-									// from the multimap
+									// from the heap
 	Dart dd = m.phi2(d) ;
 	if(dd != d)
 	{
@@ -413,19 +405,14 @@ void EdgeSelector_QEM<PFP>::updateAfterCollapse(Dart d2, Dart dd2)
 
 		vit = m.phi2_1(vit) ;
 	} while(vit != d2) ;
-
-	cur = edges.begin() ; // set the current edge to the first one
 }
 
 template <typename PFP>
 void EdgeSelector_QEM<PFP>::updateWithoutCollapse()
 {
-	EdgeInfo& einfo = edgeInfo[(*cur).second] ;
+	EdgeInfo& einfo = edgeInfo[edges.top()] ;
 	einfo.valid = false ;
 	edges.erase(einfo.it) ;
-
-	//edges.erase(cur) ;
-	cur = edges.begin();
 }
 
 template <typename PFP>
@@ -450,7 +437,7 @@ void EdgeSelector_QEM<PFP>::updateEdgeInfo(Dart d, bool recompute)
 	if(recompute)
 	{
 		if(einfo.valid)
-			edges.erase(einfo.it) ;		// remove the edge from the multimap
+			edges.erase(einfo.it) ;		// remove the edge from the heap
 		if(m.edgeCanCollapse(d))
 			computeEdgeInfo(d, einfo) ;
 		else
@@ -489,7 +476,7 @@ void EdgeSelector_QEM<PFP>::computeEdgeInfo(Dart d, EdgeInfo& einfo)
 
 	REAL err = quad(m_positionApproximator.getApprox(d)) ;
 
-	einfo.it = edges.insert(std::make_pair(err, d)) ;
+	einfo.it = edges.insert(err, d) ;
 	einfo.valid = true ;
 }
 
@@ -532,9 +519,7 @@ bool EdgeSelector_QEMml<PFP>::init()
 	for (Edge e : allEdgesOf(m))
 	{
 		initEdgeInfo(e.dart) ;	// init the edges with their optimal position
-	}							// and insert them in the multimap according to their error
-
-	cur = edges.begin() ; // init the current edge to the first one
+	}							// and insert them in the heap according to their error
 
 	return true ;
 }
@@ -542,9 +527,9 @@ bool EdgeSelector_QEMml<PFP>::init()
 template <typename PFP>
 bool EdgeSelector_QEMml<PFP>::nextEdge(Dart& d) const
 {
-	if(cur == edges.end() || edges.empty())
+	if(edges.empty())
 		return false ;
-	d = (*cur).second ;
+	d = edges.top() ;
 	return true ;
 }
 
@@ -564,7 +549,7 @@ void EdgeSelector_QEMml<PFP>::updateBeforeCollapse(Dart d)
 	edgeE = &(edgeInfo[m.phi_1(d)]) ;	// the concerned edges
 	if(edgeE->valid)
 		edges.erase(edgeE->it) ;
-									// from the multimap
+									// from the heap
 	Dart dd = m.phi2(d) ;
 	if(dd != d)
 	{
@@ -655,18 +640,14 @@ void EdgeSelector_QEMml<PFP>::updateAfterCollapse(Dart d2, Dart dd2)
 
 		vit = m.phi2_1(vit) ;
 	} while(vit != d2) ;
-
-	cur = edges.begin() ; // set the current edge to the first one
 }
 
 template <typename PFP>
 void EdgeSelector_QEMml<PFP>::updateWithoutCollapse()
 {
-	EdgeInfo& einfo = edgeInfo[(*cur).second] ;
+	EdgeInfo& einfo = edgeInfo[edges.top()] ;
 	einfo.valid = false ;
 	edges.erase(einfo.it) ;
-
-	cur = edges.begin();
 }
 
 template <typename PFP>
@@ -691,7 +672,7 @@ void EdgeSelector_QEMml<PFP>::updateEdgeInfo(Dart d, bool recompute)
 	if(recompute)
 	{
 		if(einfo.valid)
-			edges.erase(einfo.it) ;		// remove the edge from the multimap
+			edges.erase(einfo.it) ;		// remove the edge from the heap
 		if(m.edgeCanCollapse(d))
 			computeEdgeInfo(d, einfo) ;
 		else
@@ -729,7 +710,7 @@ void EdgeSelector_QEMml<PFP>::computeEdgeInfo(Dart d, EdgeInfo& einfo)
 	m_positionApproximator.approximate(d) ;
 
 	REAL err = quad(m_positionApproximator.getApprox(d)) ;
-	einfo.it = edges.insert(std::make_pair(err, d)) ;
+	einfo.it = edges.insert(err, d) ;
 	einfo.valid = true ;
 }
 
@@ -759,17 +740,15 @@ bool EdgeSelector_NormalArea<PFP>::init()
 		initEdgeInfo(e.dart) ;	// init "edgeInfo" and "edges"
 	}
 
-	cur = edges.begin() ; // init the current edge to the first one
-
 	return true ;
 }
 
 template <typename PFP>
 bool EdgeSelector_NormalArea<PFP>::nextEdge(Dart& d) const
 {
-	if(cur == edges.end() || edges.empty())
+	if(edges.empty())
 		return false ;
-	d = (*cur).second ;
+	d = edges.top() ;
 	return true ;
 }
 
@@ -800,7 +779,7 @@ void EdgeSelector_NormalArea<PFP>::updateBeforeCollapse(Dart d)
 		edges.erase(edgeE->it) ;
 		edgeE->valid = false;
 	}
-									// from the multimap
+									// from the heap
 	Dart dd = m.phi2(d) ;
 	edgeE = &(edgeInfo[m.phi1(dd)]) ;
 	if(edgeE->valid)
@@ -829,7 +808,7 @@ void EdgeSelector_NormalArea<PFP>::updateAfterCollapse(Dart d2, Dart /*dd2*/)
 		computeEdgeMatrix(dit);
 	}
 
-	// update the multimap
+	// update the heap
 
 	Traversor2VVaE<MAP> tv (m,d2);
 	CellMarkerStore<MAP, EDGE> eMark (m);
@@ -846,7 +825,6 @@ void EdgeSelector_NormalArea<PFP>::updateAfterCollapse(Dart d2, Dart /*dd2*/)
 		}
 	}
 
-	cur = edges.begin() ; // set the current edge to the first one
 }
 
 template <typename PFP>
@@ -870,7 +848,7 @@ void EdgeSelector_NormalArea<PFP>::updateEdgeInfo(Dart d)
 	EdgeInfo& einfo = edgeInfo[d] ;
 
 	if(einfo.valid)
-		edges.erase(einfo.it) ;		// remove the edge from the multimap
+		edges.erase(einfo.it) ;		// remove the edge from the heap
 
 	if(m.edgeCanCollapse(d))
 		computeEdgeInfo(d, einfo) ;
@@ -932,7 +910,7 @@ void EdgeSelector_NormalArea<PFP>::computeEdgeInfo(Dart d, EdgeInfo& einfo)
 //	err /= area*area ; // ca favorise la contraction des gros triangles : maillages très in-homogènes et qualité géométrique mauvaise
 */
 
-	einfo.it = edges.insert(std::make_pair(err, d)) ;
+	einfo.it = edges.insert(err, d) ;
 	einfo.valid = true ;
 }
 
@@ -970,9 +948,7 @@ bool EdgeSelector_Curvature<PFP>::init()
 	for (Edge e : allEdgesOf(m))
 	{
 		initEdgeInfo(e.dart) ;	// init the edges with their optimal position
-	}							// and insert them in the multimap according to their error
-
-	cur = edges.begin() ; // init the current edge to the first one
+	}							// and insert them in the heap according to their error
 
 	return true ;
 }
@@ -980,9 +956,9 @@ bool EdgeSelector_Curvature<PFP>::init()
 template <typename PFP>
 bool EdgeSelector_Curvature<PFP>::nextEdge(Dart& d) const
 {
-	if(cur == edges.end() || edges.empty())
+	if(edges.empty())
 		return false ;
-	d = (*cur).second ;
+	d = edges.top() ;
 	return true ;
 }
 
@@ -1002,7 +978,7 @@ void EdgeSelector_Curvature<PFP>::updateBeforeCollapse(Dart d)
 	edgeE = &(edgeInfo[m.phi_1(d)]) ;	// the concerned edges
 	if(edgeE->valid)
 		edges.erase(edgeE->it) ;
-									// from the multimap
+									// from the heap
 	Dart dd = m.phi2(d) ;
 	if(dd != d)
 	{
@@ -1050,18 +1026,14 @@ void EdgeSelector_Curvature<PFP>::updateAfterCollapse(Dart d2, Dart dd2)
 
 		vit = m.phi2_1(vit) ;
 	} while(vit != d2) ;
-
-	cur = edges.begin() ; // set the current edge to the first one
 }
 
 template <typename PFP>
 void EdgeSelector_Curvature<PFP>::updateWithoutCollapse()
 {
-	EdgeInfo& einfo = edgeInfo[(*cur).second] ;
+	EdgeInfo& einfo = edgeInfo[edges.top()] ;
 	einfo.valid = false ;
 	edges.erase(einfo.it) ;
-
-	cur = edges.begin();
 }
 
 template <typename PFP>
@@ -1086,7 +1058,7 @@ void EdgeSelector_Curvature<PFP>::updateEdgeInfo(Dart d, bool recompute)
 	if(recompute)
 	{
 		if(einfo.valid)
-			edges.erase(einfo.it) ;			// remove the edge from the multimap
+			edges.erase(einfo.it) ;			// remove the edge from the heap
 		if(m.edgeCanCollapse(d))
 			computeEdgeInfo(d, einfo) ;
 		else
@@ -1156,7 +1128,7 @@ void EdgeSelector_Curvature<PFP>::computeEdgeInfo(Dart d, EdgeInfo& einfo)
 //	REAL cDir1_deviation_2 = REAL(1) / fabs(cDir1 * Kmax[v2]) ;
 //	err += cDir1_deviation_1 + cDir1_deviation_2 ;
 
-	einfo.it = edges.insert(std::make_pair(err, d)) ;
+	einfo.it = edges.insert(err, d) ;
 	einfo.valid = true ;
 }
 
@@ -1181,9 +1153,7 @@ bool EdgeSelector_CurvatureTensor<PFP>::init()
 	for (Edge e : allEdgesOf(m))
 	{
 		initEdgeInfo(e.dart) ;	// init the edges with their optimal position
-	}							// and insert them in the multimap according to their error
-
-	cur = edges.begin() ; // init the current edge to the first one
+	}							// and insert them in the heap according to their error
 
 	return true ;
 }
@@ -1191,9 +1161,9 @@ bool EdgeSelector_CurvatureTensor<PFP>::init()
 template <typename PFP>
 bool EdgeSelector_CurvatureTensor<PFP>::nextEdge(Dart& d) const
 {
-	if(cur == edges.end() || edges.empty())
+	if(edges.empty())
 		return false ;
-	d = (*cur).second ;
+	d = edges.top() ;
 	return true ;
 }
 
@@ -1224,7 +1194,7 @@ void EdgeSelector_CurvatureTensor<PFP>::updateBeforeCollapse(Dart d)
 		edges.erase(edgeE->it) ;
 		edgeE->valid = false;
 	}
-									// from the multimap
+									// from the heap
 	Dart dd = m.phi2(d) ;
 	edgeE = &(edgeInfo[m.phi1(dd)]) ;
 	if(edgeE->valid)
@@ -1262,7 +1232,7 @@ void EdgeSelector_CurvatureTensor<PFP>::updateAfterCollapse(Dart d2, Dart /*dd2*
 		}
 	}
 
-	// update the multimap
+	// update the heap
 	Traversor2VVaE<MAP> tv (m,d2);
 	eMark.unmarkAll();
 	for(Dart dit = tv.begin() ; dit != tv.end() ; dit = tv.next())
@@ -1278,7 +1248,6 @@ void EdgeSelector_CurvatureTensor<PFP>::updateAfterCollapse(Dart d2, Dart /*dd2*
 		}
 	}
 
-	cur = edges.begin() ; // set the current edge to the first one
 }
 
 template <typename PFP>
@@ -1302,7 +1271,7 @@ void EdgeSelector_CurvatureTensor<PFP>::updateEdgeInfo(Dart d)
 	EdgeInfo& einfo = edgeInfo[d] ;
 
 	if(einfo.valid)
-		edges.erase(einfo.it) ;		// remove the edge from the multimap
+		edges.erase(einfo.it) ;		// remove the edge from the heap
 
 	if(m.edgeCanCollapse(d))
 		computeEdgeInfo(d, einfo) ;
@@ -1365,7 +1334,7 @@ void EdgeSelector_CurvatureTensor<PFP>::computeEdgeInfo(Dart d, EdgeInfo& einfo)
 //	if (v1 % 5000 == 0) CGoGNout << e_val << CGoGNendl << err << CGoGNendl ;
 
 	// update the priority queue and edgeinfo
-	einfo.it = edges.insert(std::make_pair(err, d)) ;
+	einfo.it = edges.insert(err, d) ;
 	einfo.valid = true ;
 }
 
@@ -1393,9 +1362,7 @@ bool EdgeSelector_MinDetail<PFP>::init()
 	for (Edge e : allEdgesOf(m))
 	{
 		initEdgeInfo(e.dart) ;	// init the edges with their optimal position
-	}							// and insert them in the multimap according to their error
-
-	cur = edges.begin() ; // init the current edge to the first one
+	}							// and insert them in the heap according to their error
 
 	return true ;
 }
@@ -1403,9 +1370,9 @@ bool EdgeSelector_MinDetail<PFP>::init()
 template <typename PFP>
 bool EdgeSelector_MinDetail<PFP>::nextEdge(Dart& d) const
 {
-	if(cur == edges.end() || edges.empty())
+	if(edges.empty())
 		return false ;
-	d = (*cur).second ;
+	d = edges.top() ;
 	return true ;
 }
 
@@ -1425,7 +1392,7 @@ void EdgeSelector_MinDetail<PFP>::updateBeforeCollapse(Dart d)
 	edgeE = &(edgeInfo[m.phi_1(d)]) ;	// the concerned edges
 	if(edgeE->valid)
 		edges.erase(edgeE->it) ;
-									// from the multimap
+									// from the heap
 	Dart dd = m.phi2(d) ;
 	if(dd != d)
 	{
@@ -1466,18 +1433,14 @@ void EdgeSelector_MinDetail<PFP>::updateAfterCollapse(Dart d2, Dart dd2)
 
 		vit = m.phi2_1(vit) ;
 	} while(vit != d2) ;
-
-	cur = edges.begin() ; // set the current edge to the first one
 }
 
 template <typename PFP>
 void EdgeSelector_MinDetail<PFP>::updateWithoutCollapse()
 {
-	EdgeInfo& einfo = edgeInfo[(*cur).second] ;
+	EdgeInfo& einfo = edgeInfo[edges.top()] ;
 	einfo.valid = false ;
 	edges.erase(einfo.it) ;
-
-	cur = edges.begin();
 }
 
 template <typename PFP>
@@ -1500,7 +1463,7 @@ void EdgeSelector_MinDetail<PFP>::updateEdgeInfo(Dart d, bool recompute)
 	if(recompute)
 	{
 		if(einfo.valid)
-			edges.erase(einfo.it) ;			// remove the edge from the multimap
+			edges.erase(einfo.it) ;			// remove the edge from the heap
 		if(m.edgeCanCollapse(d))
 			computeEdgeInfo(d, einfo) ;
 		else
@@ -1532,7 +1495,7 @@ void EdgeSelector_MinDetail<PFP>::computeEdgeInfo(Dart d, EdgeInfo& einfo)
 	m_positionApproximator.approximate(d) ;
 	err = m_positionApproximator.getDetail(d).norm2() ;
 
-	einfo.it = edges.insert(std::make_pair(err, d)) ;
+	einfo.it = edges.insert(err, d) ;
 	einfo.valid = true ;
 }
 
@@ -1581,9 +1544,7 @@ bool EdgeSelector_ColorNaive<PFP>::init()
 	for (Edge e : allEdgesOf(m))
 	{
 		initEdgeInfo(e.dart) ;	// init the edges with their optimal position
-	}							// and insert them in the multimap according to their error
-
-	cur = edges.begin() ; // init the current edge to the first one
+	}							// and insert them in the heap according to their error
 
 	return true ;
 }
@@ -1591,9 +1552,9 @@ bool EdgeSelector_ColorNaive<PFP>::init()
 template <typename PFP>
 bool EdgeSelector_ColorNaive<PFP>::nextEdge(Dart& d) const
 {
-	if(cur == edges.end() || edges.empty())
+	if(edges.empty())
 		return false ;
-	d = (*cur).second ;
+	d = edges.top() ;
 	return true ;
 }
 
@@ -1613,7 +1574,7 @@ void EdgeSelector_ColorNaive<PFP>::updateBeforeCollapse(Dart d)
 	edgeE = &(edgeInfo[m.phi_1(d)]) ;	// the edges that will disappear
 	if(edgeE->valid)
 		edges.erase(edgeE->it) ;
-										// from the multimap
+										// from the heap
 	Dart dd = m.phi2(d) ;
 	if(dd != d)
 	{
@@ -1676,8 +1637,6 @@ void EdgeSelector_ColorNaive<PFP>::updateAfterCollapse(Dart d2, Dart dd2)
 
 		vit = m.phi2_1(vit) ;
 	} while(vit != d2) ;
-
-	cur = edges.begin() ; // set the current edge to the first one
 }
 
 template <typename PFP>
@@ -1702,7 +1661,7 @@ void EdgeSelector_ColorNaive<PFP>::updateEdgeInfo(Dart d, bool recompute)
 	if(recompute)
 	{
 		if(einfo.valid)
-			edges.erase(einfo.it) ;		// remove the edge from the multimap
+			edges.erase(einfo.it) ;		// remove the edge from the heap
 		if(m.edgeCanCollapse(d))
 			computeEdgeInfo(d, einfo) ;
 		else
@@ -1757,7 +1716,7 @@ void EdgeSelector_ColorNaive<PFP>::computeEdgeInfo(Dart d, EdgeInfo& einfo)
 	// sum of QEM metric and squared difference between new color and old colors
 	REAL err = quad(newPos) + colDiff.norm() ;
 
-	einfo.it = edges.insert(std::make_pair(err, d)) ;
+	einfo.it = edges.insert(err, d) ;
 	einfo.valid = true ;
 }
 
@@ -1806,9 +1765,7 @@ bool EdgeSelector_GeomColOptGradient<PFP>::init()
 	for (Edge e : allEdgesOf(m))
 	{
 		initEdgeInfo(e.dart) ;	// init the edges with their optimal position
-	}							// and insert them in the multimap according to their error
-
-	cur = edges.begin() ; // init the current edge to the first one
+	}							// and insert them in the heap according to their error
 
 	return true ;
 }
@@ -1816,9 +1773,9 @@ bool EdgeSelector_GeomColOptGradient<PFP>::init()
 template <typename PFP>
 bool EdgeSelector_GeomColOptGradient<PFP>::nextEdge(Dart& d) const
 {
-	if(cur == edges.end() || edges.empty())
+	if(edges.empty())
 		return false ;
-	d = (*cur).second ;
+	d = edges.top() ;
 	return true ;
 }
 
@@ -1830,7 +1787,7 @@ void EdgeSelector_GeomColOptGradient<PFP>::updateBeforeCollapse(Dart d)
 	const Dart& v0 = d ;
 	const Dart& v1 = m.phi2(d) ;
 
-	// remove all the edges that will disappear from the multimap
+	// remove all the edges that will disappear from the heap
 	// namely : all edges adjacent to a vertex which is adjacent
 	// to either v0 or v1
 
@@ -1909,7 +1866,7 @@ void EdgeSelector_GeomColOptGradient<PFP>::updateAfterCollapse(Dart d2, Dart /*d
 	// update quadrics
 	recomputeQuadric(d2, true) ;
 
-	// update the multimap
+	// update the heap
 	Traversor2VVaE<MAP> tv(m, d2);
 	CellMarkerStore<MAP, EDGE> eMark(m);
 	for(Dart dit = tv.begin() ; dit != tv.end() ; dit = tv.next())
@@ -1925,7 +1882,6 @@ void EdgeSelector_GeomColOptGradient<PFP>::updateAfterCollapse(Dart d2, Dart /*d
 		}
 	}
 
-	cur = edges.begin() ; // set the current edge to the first one
 }
 
 template <typename PFP>
@@ -1949,7 +1905,7 @@ void EdgeSelector_GeomColOptGradient<PFP>::updateEdgeInfo(Dart d)
 	EdgeInfo& einfo = edgeInfo[d] ;
 
 	if(einfo.valid)
-		edges.erase(einfo.it) ;		// remove the edge from the multimap
+		edges.erase(einfo.it) ;		// remove the edge from the heap
 
 	if(m.edgeCanCollapse(d))
 		computeEdgeInfo(d, einfo) ;
@@ -1984,7 +1940,7 @@ void EdgeSelector_GeomColOptGradient<PFP>::computeEdgeInfo(Dart d, EdgeInfo& ein
 		t * quad(newPos) +
 		(1-t) * (computeEdgeGradientColorError(d, newPos, newCol) + computeEdgeGradientColorError(m.phi2(d), newPos, newCol)).norm() / REAL(sqrt(3.0)) ;
 
-	einfo.it = edges.insert(std::make_pair(err, d)) ;
+	einfo.it = edges.insert(err, d) ;
 	einfo.valid = true ;
 }
 
@@ -2100,9 +2056,7 @@ bool EdgeSelector_QEMextColor<PFP>::init()
 	for (Edge e : allEdgesOf(m))
 	{
 		initEdgeInfo(e.dart) ;	// init the edges with their optimal position
-	}							// and insert them in the multimap according to their error
-
-	cur = edges.begin() ; // init the current edge to the first one
+	}							// and insert them in the heap according to their error
 
 	return true ;
 }
@@ -2110,9 +2064,9 @@ bool EdgeSelector_QEMextColor<PFP>::init()
 template <typename PFP>
 bool EdgeSelector_QEMextColor<PFP>::nextEdge(Dart& d) const
 {
-	if(cur == edges.end() || edges.empty())
+	if(edges.empty())
 		return false ;
-	d = (*cur).second ;
+	d = edges.top() ;
 	return true ;
 }
 
@@ -2132,7 +2086,7 @@ void EdgeSelector_QEMextColor<PFP>::updateBeforeCollapse(Dart d)
 	edgeE = &(edgeInfo[m.phi_1(d)]) ;	// the edges that will disappear
 	if(edgeE->valid)
 		edges.erase(edgeE->it) ;
-										// from the multimap
+										// from the heap
 	Dart dd = m.phi2(d) ;
 	if(dd != d)
 	{
@@ -2207,8 +2161,6 @@ void EdgeSelector_QEMextColor<PFP>::updateAfterCollapse(Dart d2, Dart dd2)
 
 		vit = m.phi2_1(vit) ;
 	} while(vit != d2) ;
-
-	cur = edges.begin() ; // set the current edge to the first one
 }
 
 template <typename PFP>
@@ -2233,7 +2185,7 @@ void EdgeSelector_QEMextColor<PFP>::updateEdgeInfo(Dart d, bool recompute)
 	if(recompute)
 	{
 		if(einfo.valid)
-			edges.erase(einfo.it) ;		// remove the edge from the multimap
+			edges.erase(einfo.it) ;		// remove the edge from the heap
 		if(m.edgeCanCollapse(d))
 			computeEdgeInfo(d, einfo) ;
 		else
@@ -2293,7 +2245,7 @@ void EdgeSelector_QEMextColor<PFP>::computeEdgeInfo(Dart d, EdgeInfo& einfo)
 		einfo.valid = false ;
 	else
 	{
-		einfo.it = edges.insert(std::make_pair(std::max(err,REAL(0)), d)) ;
+		einfo.it = edges.insert(std::max(err,REAL(0)), d) ;
 		einfo.valid = true ;
 	}
 }
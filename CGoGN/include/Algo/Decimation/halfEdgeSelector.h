@@ -28,6 +28,7 @@
 #include "Algo/Decimation/selector.h"
 #include "Algo/Decimation/approximator.h"
 #include "Utils/qem.h"
+#include "Utils/indexedHeap.h"
 #include "Topology/generic/dart.h"
 
 namespace CGoGN
@@ -59,7 +60,7 @@ private:
 
 	typedef	struct
 	{
-		typename std::multimap<REAL, Dart>::iterator it;
+		typename Utils::IndexedHeap<REAL,Dart>::Handle it ;
 		bool valid ;
 		static std::string CGoGNnameOfType() { return "QEMhalfEdgeInfo" ; }
 	} QEMhalfEdgeInfo ;
@@ -68,8 +69,7 @@ private:
 	DartAttribute<HalfEdgeInfo, MAP> halfEdgeInfo ;
 	VertexAttribute<Utils::Quadric<REAL>, MAP> m_quadric ;
 
-	std::multimap<REAL,Dart> halfEdges ;
-	typename std::multimap<REAL,Dart>::iterator cur ;
+	Utils::IndexedHeap<REAL,Dart> halfEdges ;
 
 	void initHalfEdgeInfo(Dart d) ;
 	void updateHalfEdgeInfo(Dart d, bool recompute) ;
@@ -121,7 +121,7 @@ private:
 
 	typedef	struct
 	{
-		typename std::multimap<REAL,Dart>::iterator it ;
+		typename Utils::IndexedHeap<REAL,Dart>::Handle it ;
 		bool valid ;
 		static std::string CGoGNnameOfType() { return "QEMextColorHalfEdgeInfo" ; }
 	} QEMextColorHalfEdgeInfo ;
@@ -130,8 +130,7 @@ private:
 	DartAttribute<HalfEdgeInfo, MAP> halfEdgeInfo ;
 	VertexAttribute<Utils::QuadricNd<REAL,6>, MAP> m_quadric ;
 
-	std::multimap<REAL,Dart> halfEdges ;
-	typename std::multimap<REAL,Dart>::iterator cur ;
+	Utils::IndexedHeap<REAL,Dart> halfEdges ;
 
 	void initHalfEdgeInfo(Dart d) ;
 	void updateHalfEdgeInfo(Dart d, bool recompute) ;
@@ -181,11 +180,11 @@ public:
 			Dart dd = this->m_map.phi2(d) ;
 			if (halfEdgeInfo[d].valid)
 			{
-				(*errors)[d] = halfEdgeInfo[d].it->first ;
+				(*errors)[d] = halfEdges.key(halfEdgeInfo[d].it) ;
 			}
-			if (halfEdgeInfo[dd].valid && halfEdgeInfo[dd].it->first < (*errors)[d])
+			if (halfEdgeInfo[dd].valid && halfEdges.key(halfEdgeInfo[dd].it) < (*errors)[d])
 			{
-				(*errors)[d] = halfEdgeInfo[dd].it->first ;
+				(*errors)[d] = halfEdges.key(halfEdgeInfo[dd].it) ;
 			}
 			if (!(halfEdgeInfo[d].valid || halfEdgeInfo[dd].valid))
 				(*errors)[d] = -1 ;
@@ -215,7 +214,7 @@ private:
 
 	typedef	struct
 	{
-		typename std::multimap<REAL,Dart>::iterator it ;
+		typename Utils::IndexedHeap<REAL,Dart>::Handle it ;
 		bool valid ;
 		static std::string CGoGNnameOfType() { return "QEMextColorNormalHalfEdgeInfo" ; }
 	} QEMextColorNormalHalfEdgeInfo ;
@@ -224,8 +223,7 @@ private:
 	DartAttribute<HalfEdgeInfo, MAP> halfEdgeInfo ;
 	VertexAttribute<Utils::QuadricNd<REAL,9>, MAP> m_quadric ;
 
-	std::multimap<REAL,Dart> halfEdges ;
-	typename std::multimap<REAL,Dart>::iterator cur ;
+	Utils::IndexedHeap<REAL,Dart> halfEdges ;
 
 	void initHalfEdgeInfo(Dart d) ;
 	void updateHalfEdgeInfo(Dart d, bool recompute) ;
@@ -279,11 +277,11 @@ public:
 			Dart dd = this->m_map.phi2(d) ;
 			if (halfEdgeInfo[d].valid)
 			{
-				(*errors)[d] = halfEdgeInfo[d].it->first ;
+				(*errors)[d] = halfEdges.key(halfEdgeInfo[d].it) ;
 			}
-			if (halfEdgeInfo[dd].valid && halfEdgeInfo[dd].it->first < (*errors)[d])
+			if (halfEdgeInfo[dd].valid && halfEdges.key(halfEdgeInfo[dd].it) < (*errors)[d])
 			{
-				(*errors)[d] = halfEdgeInfo[dd].it->first ;
+				(*errors)[d] = halfEdges.key(halfEdgeInfo[dd].it) ;
 			}
 			if (!(halfEdgeInfo[d].valid || halfEdgeInfo[dd].valid))
 				(*errors)[d] = -1 ;
@@ -310,7 +308,7 @@ private:
 
 	typedef	struct
 	{
-		typename std::multimap<REAL,Dart>::iterator it ;
+		typename Utils::IndexedHeap<REAL,Dart>::Handle it ;
 		bool valid ;
 		static std::string CGoGNnameOfType() { return "ColorExperimentalHalfEdgeInfo" ; }
 	} QEMextColorHalfEdgeInfo ;
@@ -319,8 +317,7 @@ private:
 	DartAttribute<HalfEdgeInfo, MAP> halfEdgeInfo ;
 	VertexAttribute<Utils::Quadric<REAL>, MAP> m_quadric ;
 
-	std::multimap<REAL,Dart> halfEdges ;
-	typename std::multimap<REAL,Dart>::iterator cur ;
+	Utils::IndexedHeap<REAL,Dart> halfEdges ;
 
 	void initHalfEdgeInfo(Dart d) ;
 	void updateHalfEdgeInfo(Dart d) ;
@@ -375,11 +372,11 @@ public:
 			Dart dd = this->m_map.phi2(d) ;
 			if (halfEdgeInfo[d].valid)
 			{
-				(*errors)[d] = halfEdgeInfo[d].it->first ;
+				(*errors)[d] = halfEdges.key(halfEdgeInfo[d].it) ;
 			}
-			if (halfEdgeInfo[dd].valid && halfEdgeInfo[dd].it->first < (*errors)[d])
+			if (halfEdgeInfo[dd].valid && halfEdges.key(halfEdgeInfo[dd].it) < (*errors)[d])
 			{
-				(*errors)[d] = halfEdgeInfo[dd].it->first ;
+				(*errors)[d] = halfEdges.key(halfEdgeInfo[dd].it) ;
 			}
 			if (!(halfEdgeInfo[d].valid || halfEdgeInfo[dd].valid))
 				(*errors)[d] = -1 ;
@@ -0,0 +1,193 @@
+/*******************************************************************************
+ * CGoGN: Combinatorial and Geometric modeling with Generic N-dimensional Maps  *
+ * version 0.1                                                                  *
+ * Copyright (C) 2009-2012, IGG Team, LSIIT, University of Strasbourg           *
+ *                                                                              *
+ * This library is free software; you can redistribute it and/or modify it      *
+ * under the terms of the GNU Lesser General Public License as published by the *
+ * Free Software Foundation; either version 2.1 of the License, or (at your     *
+ * option) any later version.                                                   *
+ *                                                                              *
+ * This library is distributed in the hope that it will be useful, but WITHOUT  *
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or        *
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License  *
+ * for more details.                                                            *
+ *                                                                              *
+ * You should have received a copy of the GNU Lesser General Public License     *
+ * along with this library; if not, write to the Free Software Foundation,      *
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301 USA.           *
+ *                                                                              *
+ * Web site: http://cgogn.unistra.fr/                                           *
+ * Contact information: cgogn@unistra.fr                                        *
+ *                                                                              *
+ *******************************************************************************/
+
+#ifndef __ALGO_DEFORMATION_AS_RIGID_AS_POSSIBLE__
+#define __ALGO_DEFORMATION_AS_RIGID_AS_POSSIBLE__
+
+#include "Topology/generic/traversor/traversorCell.h"
+#include "Topology/generic/traversor/traversor2.h"
+#include "Topology/generic/cellmarker.h"
+#include "Algo/LinearSolving/laplacianSolver.h"
+#include "Geometry/vector_batch.h"
+#include "Utils/threadPool.h"
+
+#include <vector>
+
+namespace CGoGN
+{
+
+namespace Algo
+{
+
+namespace Surface
+{
+
+namespace Deformation
+{
+
+/**
+ * As-rigid-as-possible deformation of a surface (topological Laplacian)
+ *
+ * Alternates, for the free vertices:
+ * - the local step: the rotation of each vertex is fitted to the covariance of its
+ *   1-ring between the initial and current positions (in parallel, the rotations being
+ *   computed by batches with Geom::batchFitRotation, warm started from the previous ones),
+ * - the global step: the positions are solved from the initial differential coordinates
+ *   rotated by the mean rotation of each 1-ring (resident factorization of
+ *   LinearSolving::LaplacianSolver, factored again only when the constraints change).
+ * Works without any viewer, the positions being updated in place.
+ */
+template <typename PFP>
+class AsRigidAsPossible
+{
+public:
+	typedef typename PFP::MAP MAP;
+	typedef typename PFP::REAL REAL;
+	typedef typename PFP::VEC3 VEC3;
+	typedef Geom::Matrix<3,3,REAL> MATRIX33;
+	typedef Geom::Vector<4,REAL> QUATERNION;
+
+protected:
+	MAP& m_map;
+
+	VertexAttribute<VEC3, MAP> m_position;
+
+	VertexAttribute<VEC3, MAP> m_positionInit;
+
+	VertexAttribute<unsigned int, MAP> m_index;
+
+	VertexAttribute<VEC3, MAP> m_diffCoord;
+
+	VertexAttribute<VEC3, MAP> m_rotatedDiffCoord;
+
+	unsigned int m_nbVertices;
+
+	unsigned int m_nbth;
+
+	unsigned int m_nbRotationIterations;
+
+	/**
+	* 1-ring of each vertex index (CSR)
+	*/
+	std::vector<unsigned int> m_ringBegin;
+	std::vector<unsigned int> m_ring;
+
+	/**
+	* embedding of the vertex of each index
+	*/
+	std::vector<unsigned int> m_vertexEmb;
+
+	/**
+	* covariance, rotation (as quaternion and matrix) of each vertex index
+	*/
+	std::vector<MATRIX33> m_covariances;
+	std::vector<QUATERNION> m_quaternions;
+	std::vector<MATRIX33> m_rotations;
+
+	LinearSolving::LaplacianSolver<PFP>* m_solver;
+
+	/**
+	* apply f(begin, end) on chunks of [0,nb), in parallel if m_nbth > 1
+	*/
+	template <typename FUNC>
+	void parallelRange(unsigned int nb, FUNC f);
+
+public:
+	/**
+	* @param map the map
+	* @param position the deformed positions (the free vertices are computed)
+	* @param positionInit the rest positions
+	* @param nbth number of threads
+	*/
+	AsRigidAsPossible(MAP& map, VertexAttribute<VEC3, MAP>& position, const VertexAttribute<VEC3, MAP>& positionInit, unsigned int nbth = Parallel::NumberOfThreads);
+
+	~AsRigidAsPossible();
+
+	/**
+	* compute the 1-rings, the differential coordinates of the rest positions and the
+	* Laplacian (called by the constructor, to call again if the mesh or the rest positions change)
+	*/
+	void initialize();
+
+	/**
+	* number of Newton iterations of the rotation fitting in each local step (default 3)
+	*/
+	void setNbRotationIterations(unsigned int nb) { m_nbRotationIterations = nb; }
+
+	/**
+	* set the free vertices (the others, e.g. the handles, keep their position) and factor the system
+	* @return false if the factorization failed
+	*/
+	bool setConstraints(const CellMarker<MAP, VERTEX>& freeMarker);
+
+	/**
+	* forget the factorization (to call when the constraints change)
+	*/
+	void resetConstraints() { m_solver->resetConstraints(); }
+
+	bool isFactorized() const { return m_solver->isFactorized(); }
+
+	/**
+	* set all the rotations to the identity
+	*/
+	void resetRotations();
+
+	/**
+	* rotation of vertex v computed by the last local step
+	*/
+	const MATRIX33& rotation(Vertex v) const { return m_rotations[m_index[v]]; }
+
+	/**
+	* solve the free positions from the (not rotated) differential coordinates
+	*/
+	bool matchDiffCoord();
+
+	/**
+	* local step: fit the rotation of each vertex
+	*/
+	void computeRotations();
+
+	/**
+	* global step: solve the free positions from the rotated differential coordinates
+	*/
+	bool computePositions();
+
+	/**
+	* nbIterations local / global steps
+	* @return false if the constraints are not factored
+	*/
+	bool iterate(unsigned int nbIterations = 1);
+};
+
+} // namespace Deformation
+
+} // namespace Surface
+
+} // namespace Algo
+
+} // namespace CGoGN
+
+#include "Algo/Deformation/asRigidAsPossible.hpp"
+
+#endif
@@ -0,0 +1,208 @@
+/*******************************************************************************
+ * CGoGN: Combinatorial and Geometric modeling with Generic N-dimensional Maps  *
+ * version 0.1                                                                  *
+ * Copyright (C) 2009-2012, IGG Team, LSIIT, University of Strasbourg           *
+ *                                                                              *
+ * This library is free software; you can redistribute it and/or modify it      *
+ * under the terms of the GNU Lesser General Public License as published by the *
+ * Free Software Foundation; either version 2.1 of the License, or (at your     *
+ * option) any later version.                                                   *
+ *                                                                              *
+ * This library is distributed in the hope that it will be useful, but WITHOUT  *
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or        *
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License  *
+ * for more details.                                                            *
+ *                                                                              *
+ * You should have received a copy of the GNU Lesser General Public License     *
+ * along with this library; if not, write to the Free Software Foundation,      *
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301 USA.           *
+ *                                                                              *
+ * Web site: http://cgogn.unistra.fr/                                           *
+ * Contact information: cgogn@unistra.fr                                        *
+ *                                                                              *
+ *******************************************************************************/
+
+#include "Algo/Geometry/laplacian.h"
+#include "Algo/Topo/basic.h"
+
+namespace CGoGN
+{
+
+namespace Algo
+{
+
+namespace Surface
+{
+
+namespace Deformation
+{
+
+template <typename PFP>
+AsRigidAsPossible<PFP>::AsRigidAsPossible(MAP& map, VertexAttribute<VEC3, MAP>& position, const VertexAttribute<VEC3, MAP>& positionInit, unsigned int nbth) :
+	m_map(map),
+	m_position(position),
+	m_positionInit(positionInit),
+	m_nbVertices(0),
+	m_nbth(nbth),
+	m_nbRotationIterations(3),
+	m_solver(NULL)
+{
+	m_index = m_map.template addAttribute<unsigned int, VERTEX, MAP>("");
+	m_diffCoord = m_map.template addAttribute<VEC3, VERTEX, MAP>("");
+	m_rotatedDiffCoord = m_map.template addAttribute<VEC3, VERTEX, MAP>("");
+	initialize();
+}
+
+template <typename PFP>
+AsRigidAsPossible<PFP>::~AsRigidAsPossible()
+{
+	delete m_solver;
+	m_map.removeAttribute(m_index);
+	m_map.removeAttribute(m_diffCoord);
+	m_map.removeAttribute(m_rotatedDiffCoord);
+}
+
+template <typename PFP>
+template <typename FUNC>
+void AsRigidAsPossible<PFP>::parallelRange(unsigned int nb, FUNC f)
+{
+	if ((m_nbth <= 1) || (nb < 2))
+	{
+		f(0, nb);
+		return;
+	}
+
+	Utils::ThreadPool::shared(m_nbth - 1).parallelFor(nb, [&] (unsigned int b, unsigned int e, unsigned int)
+	{
+		f(b, e);
+	});
+}
+
+template <typename PFP>
+void AsRigidAsPossible<PFP>::initialize()
+{
+	m_nbVertices = Algo::Topo::computeIndexCells<VERTEX>(m_map, m_index);
+
+	// 1-rings
+	m_ringBegin.assign(m_nbVertices + 1, 0);
+	m_vertexEmb.assign(m_nbVertices, EMBNULL);
+	foreach_cell<VERTEX>(m_map, [&] (Vertex v)
+	{
+		const unsigned int i = m_index[v];
+		m_vertexEmb[i] = m_map.template getEmbedding<VERTEX>(v.dart);
+		Traversor2VE<MAP> t(m_map, v.dart);
+		for (Dart it = t.begin(); it != t.end(); it = t.next())
+			++m_ringBegin[i+1];
+	});
+	for (unsigned int i = 0; i < m_nbVertices; ++i)
+		m_ringBegin[i+1] += m_ringBegin[i];
+
+	m_ring.resize(m_ringBegin.back());
+	foreach_cell<VERTEX>(m_map, [&] (Vertex v)
+	{
+		unsigned int k = m_ringBegin[m_index[v]];
+		Traversor2VE<MAP> t(m_map, v.dart);
+		for (Dart it = t.begin(); it != t.end(); it = t.next())
+			m_ring[k++] = m_index[m_map.phi1(it)];
+	});
+
+	Algo::Surface::Geometry::computeLaplacianTopoVertices<PFP>(m_map, m_positionInit, m_diffCoord);
+
+	m_covariances.resize(m_nbVertices);
+	m_quaternions.resize(m_nbVertices);
+	m_rotations.resize(m_nbVertices);
+	resetRotations();
+
+	delete m_solver;
+	m_solver = new LinearSolving::LaplacianSolver<PFP>(m_map, m_index, m_nbVertices, m_nbth);
+	m_solver->setLaplacianTopo();
+}
+
+template <typename PFP>
+bool AsRigidAsPossible<PFP>::setConstraints(const CellMarker<MAP, VERTEX>& freeMarker)
+{
+	return m_solver->setConstraints(freeMarker);
+}
+
+template <typename PFP>
+void AsRigidAsPossible<PFP>::resetRotations()
+{
+	for (unsigned int i = 0; i < m_nbVertices; ++i)
+	{
+		m_quaternions[i] = QUATERNION(0, 0, 0, 1);
+		m_rotations[i].identity();
+	}
+}
+
+template <typename PFP>
+bool AsRigidAsPossible<PFP>::matchDiffCoord()
+{
+	return m_solver->solve(m_diffCoord, m_position);
+}
+
+template <typename PFP>
+void AsRigidAsPossible<PFP>::computeRotations()
+{
+	parallelRange(m_nbVertices, [&] (unsigned int b, unsigned int e)
+	{
+		for (unsigned int i = b; i < e; ++i)
+		{
+			const VEC3& p = m_position[m_vertexEmb[i]];
+			const VEC3& pInit = m_positionInit[m_vertexEmb[i]];
+			MATRIX33& cov = m_covariances[i];
+			cov.zero();
+			for (unsigned int k = m_ringBegin[i]; k < m_ringBegin[i+1]; ++k)
+			{
+				const unsigned int emb = m_vertexEmb[m_ring[k]];
+				const VEC3 v = m_position[emb] - p;
+				const VEC3 vInit = m_positionInit[emb] - pInit;
+				for (unsigned int r = 0; r < 3; ++r)
+					for (unsigned int c = 0; c < 3; ++c)
+						cov(r, c) += v[r] * vInit[c];
+			}
+		}
+		Geom::batchFitRotation(&m_covariances[b], &m_quaternions[b], &m_rotations[b], e - b, m_nbRotationIterations);
+	});
+}
+
+template <typename PFP>
+bool AsRigidAsPossible<PFP>::computePositions()
+{
+	// differential coordinates rotated by the mean rotation of the 1-ring
+	parallelRange(m_nbVertices, [&] (unsigned int b, unsigned int e)
+	{
+		for (unsigned int i = b; i < e; ++i)
+		{
+			MATRIX33 r = m_rotations[i];
+			for (unsigned int k = m_ringBegin[i]; k < m_ringBegin[i+1]; ++k)
+				r += m_rotations[m_ring[k]];
+			r /= REAL(m_ringBegin[i+1] - m_ringBegin[i] + 1);
+			m_rotatedDiffCoord[m_vertexEmb[i]] = r * m_diffCoord[m_vertexEmb[i]];
+		}
+	});
+
+	return m_solver->solve(m_rotatedDiffCoord, m_position);
+}
+
+template <typename PFP>
+bool AsRigidAsPossible<PFP>::iterate(unsigned int nbIterations)
+{
+	if (!m_solver->isFactorized())
+		return false;
+
+	for (unsigned int it = 0; it < nbIterations; ++it)
+	{
+		computeRotations();
+		if (!computePositions())
+			return false;
+	}
+	return true;
+}
+
+} // namespace Deformation
+
+} // namespace Surface
+
+} // namespace Algo
+
+} // namespace CGoGN
@@ -74,6 +74,22 @@ bool exportPLYnew(typename PFP::MAP& map, const std::vector<VertexAttribute<type
 template <typename PFP>
 bool exportOFF(typename PFP::MAP& map, const VertexAttribute<typename PFP::VEC3, typename PFP::MAP>& position, const char* filename) ;
 
+/**
+* export the map into a OFF file, chunk by chunk, for maps larger than RAM
+* (see GenericMap::setPager). Nothing is stored but one index per vertex:
+* the vertices are written in the order of their lines and the faces in the
+* order of their darts (reorder the map first for a spatially coherent file,
+* that importOFFStreamed reads with a small memory footprint).
+* Only for maps whose darts are the lines of the dart container (MapMono).
+* @param the_map map to be exported
+* @param position the position container
+* @param filename filename of off file
+* @param nbBlocks number of blocks of darts processed at once
+* @return true
+*/
+template <typename PFP>
+bool exportOFFStreamed(typename PFP::MAP& map, const VertexAttribute<typename PFP::VEC3, typename PFP::MAP>& position, const char* filename, unsigned int nbBlocks = 16) ;
+
 /**
 * export the map into a OBJ file
 * @param the_map map to be exported
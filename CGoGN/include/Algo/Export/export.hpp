@@ -27,9 +27,12 @@
 #include "Topology/generic/traversor/traversorCell.h"
 #include "Topology/generic/traversor/traversor2.h"
 #include "Topology/generic/cellmarker.h"
+#include "Algo/Topo/streaming.h"
 
 #include "Utils/compress.h"
 
+#include <limits>
+
 namespace CGoGN
 {
 
@@ -393,6 +396,77 @@ bool exportOFF(typename PFP::MAP& map, const VertexAttribute<typename PFP::VEC3,
 	return true ;
 }
 
+template <typename PFP>
+bool exportOFFStreamed(typename PFP::MAP& map, const VertexAttribute<typename PFP::VEC3, typename PFP::MAP>& position, const char* filename, unsigned int nbBlocks)
+{
+	typedef typename PFP::MAP MAP;
+	typedef typename PFP::VEC3 VEC3;
+
+	std::ofstream out(filename, std::ios::out | std::ios::binary) ;
+	if (!out.good())
+	{
+		CGoGNerr << "Unable to open file " << filename << CGoGNendl ;
+		return false ;
+	}
+	out.precision(std::numeric_limits<typename PFP::REAL>::max_digits10) ;
+
+	const AttributeContainer& vc = map.template getAttributeContainer<VERTEX>() ;
+	VertexAutoAttribute<unsigned int, MAP> vIndex(map) ;
+
+	// the number of faces is written at the end in the reserved field
+	out << "OFF" << std::endl ;
+	out << vc.size() << " " ;
+	std::streampos nbfPos = out.tellp() ;
+	out << "          " << " 0" << std::endl ;
+
+	// vertices block by block
+	unsigned int vCpt = 0 ;
+	for (unsigned int b = 0; b < vc.getNbBlocks(); ++b)
+	{
+		if (vc.blockEmpty(b))
+			continue ;
+		vc.touchBlock(b) ;
+		unsigned int end = std::min((b + 1) * _BLOCKSIZE_, vc.realEnd()) ;
+		for (unsigned int i = b * _BLOCKSIZE_; i < end; ++i)
+		{
+			if (!vc.used(i))
+				continue ;
+			vIndex[i] = vCpt++ ;
+			const VEC3& v = position[i] ;
+			out << v[0] << " " << v[1] << " " << v[2] << "\n" ;
+		}
+	}
+
+	// faces chunk by chunk, each one written from its dart of smallest index
+	unsigned int nbf = 0 ;
+	Algo::Topo::foreachDartChunk(map, [&] (Dart d)
+	{
+		if (map.isBoundaryMarkedCurrent(d))
+			return ;
+		unsigned int degree = 1 ;
+		for (Dart e = map.phi1(d); e != d; e = map.phi1(e), ++degree)
+		{
+			if (e.index < d.index)
+				return ;
+		}
+		out << degree ;
+		Dart e = d ;
+		do
+		{
+			out << " " << vIndex[map.template getEmbedding<VERTEX>(e)] ;
+			e = map.phi1(e) ;
+		} while (e != d) ;
+		out << "\n" ;
+		++nbf ;
+	}, nbBlocks) ;
+
+	out.seekp(nbfPos) ;
+	out << nbf ;
+
+	out.close() ;
+	return out.good() ;
+}
+
 template <typename PFP>
 bool exportOBJ(typename PFP::MAP& map, const VertexAttribute<typename PFP::VEC3, typename PFP::MAP>& position, const char* filename)
 {
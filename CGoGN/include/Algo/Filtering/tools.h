@@ -23,6 +23,7 @@
 *******************************************************************************/
 
 #include "Geometry/distances.h"
+#include "Algo/Geometry/hausdorff.h"
 #include "Topology/generic/traversor/traversor2.h"
 
 #include <time.h>
@@ -42,52 +43,14 @@ namespace Surface
 namespace Filtering
 {
 
+/**
+* Hausdorff distance between the surface with originalPosition and the surface with position2
+* (vertices of each side against the triangles of the other, see Algo::Geometry::hausdorffDistance)
+*/
 template <typename PFP>
 typename PFP::REAL computeHaussdorf(typename PFP::MAP& map, const VertexAttribute<typename PFP::VEC3, typename PFP::MAP>& originalPosition, const VertexAttribute<typename PFP::VEC3, typename PFP::MAP>& position2)
 {
-	typedef typename PFP::VEC3 VEC3 ;
-	typedef typename PFP::REAL REAL;
-
-	REAL dist_o = 0.0f;
-	REAL dist_f = 0.0f;
-
-	TraversorV<typename PFP::MAP> t(map) ;
-	for(Dart d = t.begin(); d != t.end(); d = t.next())
-	{
-		const VEC3& posO = originalPosition[d] ;
-		const VEC3& posF = position2[d] ;
-
-		REAL dv_o = std::numeric_limits<REAL>::max();
-		REAL dv_f = std::numeric_limits<REAL>::max();
-
-		// just test the faces around the vertex => warning not real haussdorff distance!
-		Traversor2VF<typename PFP::MAP> tf(map, d) ;
-		for(Dart it = tf.begin(); it != tf.end(); it = tf.next())
-		{
-			Dart e = map.phi1(it) ;
-			const VEC3& Bo = originalPosition[e] ;
-			const VEC3& Bf = position2[e] ;
-			e = map.phi1(e) ;
-			const VEC3& Co = originalPosition[e] ;
-			const VEC3& Cf = position2[e] ;
-
-			REAL d = Geom::squaredDistancePoint2Triangle(posO, posF, Bf, Cf);
-			if(d < dv_o)
-				dv_o = d ;
-			d = Geom::squaredDistancePoint2Triangle(posF, posO, Bo, Co) ;
-			if(d < dv_f)
-				dv_f = d ;
-		}
-
-		if(dv_o > dist_o)
-			dist_o = dv_o ;
-		if(dv_f > dist_f)
-			dist_f = dv_f ;
-	}
-
-	if (dist_f > dist_o)
-		return REAL(std::sqrt(dist_f)) ;
-	return REAL(sqrt(dist_o)) ;
+	return Algo::Geometry::hausdorffDistance<PFP>(map, originalPosition, map, position2).max ;
 }
 
 template <typename PFP>
@@ -0,0 +1,73 @@
+/*******************************************************************************
+ * CGoGN: Combinatorial and Geometric modeling with Generic N-dimensional Maps  *
+ * version 0.1                                                                  *
+ * Copyright (C) 2009-2012, IGG Team, LSIIT, University of Strasbourg           *
+ *                                                                              *
+ * This library is free software; you can redistribute it and/or modify it      *
+ * under the terms of the GNU Lesser General Public License as published by the *
+ * Free Software Foundation; either version 2.1 of the License, or (at your     *
+ * option) any later version.                                                   *
+ *                                                                              *
+ * This library is distributed in the hope that it will be useful, but WITHOUT  *
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or        *
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License  *
+ * for more details.                                                            *
+ *                                                                              *
+ * You should have received a copy of the GNU Lesser General Public License     *
+ * along with this library; if not, write to the Free Software Foundation,      *
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301 USA.           *
+ *                                                                              *
+ * Web site: http://cgogn.unistra.fr/                                           *
+ * Contact information: cgogn@unistra.fr                                        *
+ *                                                                              *
+ *******************************************************************************/
+
+
+#ifndef __ALGO_GEOMETRY_BATCH_H__
+#define __ALGO_GEOMETRY_BATCH_H__
+
+#include "Geometry/vector_batch.h"
+#include "Topology/generic/attributeHandler.h"
+
+namespace CGoGN
+{
+
+namespace Algo
+{
+
+namespace Geometry
+{
+
+/**
+ * normalize all the vectors of an attribute, block by block of the
+ * attribute container with the batch kernels (unused lines included:
+ * uninitialized vectors of these lines may become NaN, use it
+ * only on attributes whose all lines hold meaningful vectors)
+ */
+template <typename ATT>
+void normalizeVectors(ATT& attribute) ;
+
+/**
+ * apply a transformation to all the points of an attribute,
+ * block by block of the attribute container with the batch kernels
+ * (unused lines included)
+ */
+template <typename ATT>
+void transformPoints(ATT& attribute, const Geom::Matrix<4,4,typename ATT::DATA_TYPE::DATA_TYPE>& mat) ;
+
+/**
+ * apply a transformation to the points of an attribute given by a set of cells
+ * (gathered in a buffer for the batch kernel)
+ */
+template <typename ATT, typename CELL>
+void transformPoints(ATT& attribute, const std::vector<CELL>& cells, const Geom::Matrix<4,4,typename ATT::DATA_TYPE::DATA_TYPE>& mat) ;
+
+} // namespace Geometry
+
+} // namespace Algo
+
+} // namespace CGoGN
+
+#include "Algo/Geometry/batch.hpp"
+
+#endif
@@ -0,0 +1,89 @@
+/*******************************************************************************
+ * CGoGN: Combinatorial and Geometric modeling with Generic N-dimensional Maps  *
+ * version 0.1                                                                  *
+ * Copyright (C) 2009-2012, IGG Team, LSIIT, University of Strasbourg           *
+ *                                                                              *
+ * This library is free software; you can redistribute it and/or modify it      *
+ * under the terms of the GNU Lesser General Public License as published by the *
+ * Free Software Foundation; either version 2.1 of the License, or (at your     *
+ * option) any later version.                                                   *
+ *                                                                              *
+ * This library is distributed in the hope that it will be useful, but WITHOUT  *
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or        *
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License  *
+ * for more details.                                                            *
+ *                                                                              *
+ * You should have received a copy of the GNU Lesser General Public License     *
+ * along with this library; if not, write to the Free Software Foundation,      *
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301 USA.           *
+ *                                                                              *
+ * Web site: http://cgogn.unistra.fr/                                           *
+ * Contact information: cgogn@unistra.fr                                        *
+ *                                                                              *
+ *******************************************************************************/
+
+
+namespace CGoGN
+{
+
+namespace Algo
+{
+
+namespace Geometry
+{
+
+template <typename ATT>
+void normalizeVectors(ATT& attribute)
+{
+	typedef typename ATT::DATA_TYPE VEC3 ;
+
+	std::vector<void*> addr ;
+	unsigned int byteBlockSize ;
+	unsigned int nbb = attribute.getDataVector()->getBlocksPointers(addr, byteBlockSize) ;
+	unsigned int end = attribute.end() ;
+
+	for (unsigned int b = 0; b < nbb && b * _BLOCKSIZE_ < end; ++b)
+	{
+		unsigned int nb = std::min(_BLOCKSIZE_, end - b * _BLOCKSIZE_) ;
+		Geom::batchNormalize(static_cast<VEC3*>(addr[b]), nb) ;
+	}
+}
+
+template <typename ATT>
+void transformPoints(ATT& attribute, const Geom::Matrix<4,4,typename ATT::DATA_TYPE::DATA_TYPE>& mat)
+{
+	typedef typename ATT::DATA_TYPE VEC3 ;
+
+	std::vector<void*> addr ;
+	unsigned int byteBlockSize ;
+	unsigned int nbb = attribute.getDataVector()->getBlocksPointers(addr, byteBlockSize) ;
+	unsigned int end = attribute.end() ;
+
+	for (unsigned int b = 0; b < nbb && b * _BLOCKSIZE_ < end; ++b)
+	{
+		unsigned int nb = std::min(_BLOCKSIZE_, end - b * _BLOCKSIZE_) ;
+		Geom::batchTransform(mat, static_cast<VEC3*>(addr[b]), nb) ;
+	}
+}
+
+template <typename ATT, typename CELL>
+void transformPoints(ATT& attribute, const std::vector<CELL>& cells, const Geom::Matrix<4,4,typename ATT::DATA_TYPE::DATA_TYPE>& mat)
+{
+	typedef typename ATT::DATA_TYPE VEC3 ;
+
+	std::vector<VEC3> buffer ;
+	buffer.reserve(cells.size()) ;
+	for (typename std::vector<CELL>::const_iterator it = cells.begin(); it != cells.end(); ++it)
+		buffer.push_back(attribute[*it]) ;
+
+	Geom::batchTransform(mat, buffer.empty() ? NULL : &buffer[0], (unsigned int)(buffer.size())) ;
+
+	for (unsigned int i = 0; i < cells.size(); ++i)
+		attribute[cells[i]] = buffer[i] ;
+}
+
+} // namespace Geometry
+
+} // namespace Algo
+
+} // namespace CGoGN
@@ -38,9 +38,35 @@ namespace Algo
 namespace Geometry
 {
 
+namespace Parallel
+{
+
+template <typename PFP>
+Geom::BoundingBox<typename PFP::VEC3> computeBoundingBox(typename PFP::MAP& map, const VertexAttribute<typename PFP::VEC3, typename PFP::MAP>& position)
+{
+	typedef Geom::BoundingBox<typename PFP::VEC3> BB;
+
+	return CGoGN::Parallel::reduce_cell<VERTEX>(map, BB(),
+		[&] (Vertex v) { return BB(position[v]); },
+		[] (BB a, const BB& b)
+		{
+			if (!b.isInitialized())
+				return a;
+			if (!a.isInitialized())
+				return b;
+			a.fusion(b);
+			return a;
+		});
+}
+
+} // namespace Parallel
+
 template <typename PFP>
 Geom::BoundingBox<typename PFP::VEC3> computeBoundingBox(typename PFP::MAP& map, const VertexAttribute<typename PFP::VEC3, typename PFP::MAP>& position)
 {
+	if (CGoGN::Parallel::NumberOfThreads > 1)
+		return Parallel::computeBoundingBox<PFP>(map, position);
+
 	Geom::BoundingBox<typename PFP::VEC3> bb ;
 	foreach_cell<VERTEX>(map, [&] (Vertex v) { bb.addPoint(position[v]) ; });
 	return bb ;
@@ -128,6 +128,15 @@ void computeCentroidELWFaces(typename PFP::MAP& map, const V_ATT& position, F_AT
 template <typename PFP, typename V_ATT>
 void computeNeighborhoodCentroidVertices(typename PFP::MAP& map, const V_ATT& position, V_ATT& vertex_centroid) ;
 
+/**
+ * Compute centroid of all vertices
+ * @param map the map
+ * @param position position vertex attribute
+ * @return the mean of the positions of the vertices
+ */
+template <typename PFP, typename V_ATT>
+typename V_ATT::DATA_TYPE computeCentroid(typename PFP::MAP& map, const V_ATT& position) ;
+
 
 namespace Parallel
 {
@@ -162,6 +171,15 @@ template <typename PFP, typename V_ATT>
 void computeNeighborhoodCentroidVertices(typename PFP::MAP& map,
 		const V_ATT& position, V_ATT& vertex_centroid) ;
 
+/**
+ * Compute centroid of all vertices (in parallel)
+ * @param map the map
+ * @param position position vertex attribute
+ * @return the mean of the positions of the vertices
+ */
+template <typename PFP, typename V_ATT>
+typename V_ATT::DATA_TYPE computeCentroid(typename PFP::MAP& map, const V_ATT& position) ;
+
 } // namespace Parallel
 
 
@@ -175,6 +175,24 @@ void computeNeighborhoodCentroidVertices(typename PFP::MAP& map, const V_ATT& po
 	}, AUTO);
 }
 
+template <typename PFP, typename V_ATT>
+typename V_ATT::DATA_TYPE computeCentroid(typename PFP::MAP& map, const V_ATT& position)
+{
+	if (CGoGN::Parallel::NumberOfThreads > 1)
+		return Parallel::computeCentroid<PFP,V_ATT>(map, position);
+
+	typename V_ATT::DATA_TYPE center(0.0);
+	unsigned int count = 0 ;
+
+	foreach_cell<VERTEX>(map, [&] (Vertex v)
+	{
+		center += position[v];
+		++count ;
+	});
+	center /= count ;
+	return center ;
+}
+
 
 namespace Parallel
 {
@@ -208,6 +226,21 @@ void computeNeighborhoodCentroidVertices(typename PFP::MAP& map,
 	}, FORCE_CELL_MARKING);
 }
 
+template <typename PFP, typename V_ATT>
+typename V_ATT::DATA_TYPE computeCentroid(typename PFP::MAP& map, const V_ATT& position)
+{
+	typedef typename V_ATT::DATA_TYPE EMB;
+	typedef std::pair<EMB, unsigned int> SUM;
+
+	SUM sum = CGoGN::Parallel::reduce_cell<VERTEX>(map, SUM(EMB(0.0), 0),
+		[&] (Vertex v) { return SUM(position[v], 1); },
+		[] (const SUM& a, const SUM& b) { return SUM(a.first + b.first, a.second + b.second); });
+
+	EMB center = sum.first;
+	center /= sum.second ;
+	return center ;
+}
+
 } // namespace Parallel
 
 
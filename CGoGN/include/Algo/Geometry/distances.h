@@ -81,10 +81,6 @@ void closestPointInTriangle(typename PFP::MAP& map, Face f, const VertexAttribut
 template <typename PFP>
 typename PFP::REAL squaredDistancePoint2Edge(typename PFP::MAP& map, Edge e, const VertexAttribute<typename PFP::VEC3, typename PFP::MAP>& position, const typename PFP::VEC3& P) ;
 
-//template <typename PFP>
-//void computeDistance(typename PFP::MAP& map1, const VertexAttribute<typename PFP::VEC3, typename PFP::MAP>& position1, VertexAttribute<typename PFP::REAL, typename PFP::MAP>& distance1,
-//					 typename PFP::MAP& map2, const VertexAttribute<typename PFP::VEC3, typename PFP::MAP>& position2) ;
-
 } // namespace Geometry
 
 } // namespace Algo
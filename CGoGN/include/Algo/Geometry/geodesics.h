@@ -0,0 +1,228 @@
+/*******************************************************************************
+ * CGoGN: Combinatorial and Geometric modeling with Generic N-dimensional Maps  *
+ * version 0.1                                                                  *
+ * Copyright (C) 2009-2012, IGG Team, LSIIT, University of Strasbourg           *
+ *                                                                              *
+ * This library is free software; you can redistribute it and/or modify it      *
+ * under the terms of the GNU Lesser General Public License as published by the *
+ * Free Software Foundation; either version 2.1 of the License, or (at your     *
+ * option) any later version.                                                   *
+ *                                                                              *
+ * This library is distributed in the hope that it will be useful, but WITHOUT  *
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or        *
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License  *
+ * for more details.                                                            *
+ *                                                                              *
+ * You should have received a copy of the GNU Lesser General Public License     *
+ * along with this library; if not, write to the Free Software Foundation,      *
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301 USA.           *
+ *                                                                              *
+ * Web site: http://cgogn.unistra.fr/                                           *
+ * Contact information: cgogn@unistra.fr                                        *
+ *                                                                              *
+ *******************************************************************************/
+
+#ifndef __ALGO_GEOMETRY_GEODESICS_H__
+#define __ALGO_GEOMETRY_GEODESICS_H__
+
+#include "Topology/generic/traversor/traversorCell.h"
+#include "Topology/generic/traversor/traversor2.h"
+#include "Utils/indexedHeap.h"
+#include "Utils/threadPool.h"
+
+#include <vector>
+
+namespace CGoGN
+{
+
+namespace Algo
+{
+
+namespace Surface
+{
+
+namespace Geometry
+{
+
+/**
+* Geodesic distances from sets of source vertices (seeds)
+*
+* The 1-ring of each vertex is stored once (CSR, by vertex index) with the cost
+* of its edges, and the fronts are ordered by d-ary heaps addressed by vertex index
+* (no per vertex iterator, no global unmarking: the vertices reached by a run are
+* stamped with the number of the run).
+* - Dijkstra propagates along the edges (the cost of the edges is given by an
+*   edge attribute, or is their length),
+* - fast marching (positions only) also propagates through the triangles whose
+*   2 other vertices are already fixed (unfolded virtual source), which removes
+*   most of the metrication error of the graph distances.
+*
+* A multi-source run labels each vertex with the number of its closest seed
+* (vertex Voronoi diagram). The runs restricted to regions compute the distances
+* from one seed within its region only: their cost is the size of the region, and
+* the regions of several seeds are processed in parallel.
+*
+* The pathOrigin of a vertex (previous vertex on the path, or the one with the
+* smallest distance for a fast marching triangle update) is the dart phi2(f) of
+* its dart f given by Traversor2VVaE around this previous vertex, the one of a
+* seed is the seed itself.
+*
+* update() must be called when the map, the edge costs or the positions change.
+*/
+template <typename PFP>
+class GeodesicDistance
+{
+public:
+	typedef typename PFP::MAP MAP;
+	typedef typename PFP::REAL REAL;
+	typedef typename PFP::VEC3 VEC3;
+
+	static const unsigned int NIL = 0xffffffff;
+
+protected:
+	MAP& m_map;
+
+	EdgeAttribute<REAL, MAP> m_edgeCost;
+	VertexAttribute<VEC3, MAP> m_position;
+	bool m_fastMarching;
+
+	unsigned int m_nbth;
+
+	VertexAttribute<unsigned int, MAP> m_index;
+	unsigned int m_nbVertices;
+
+	std::vector<unsigned int> m_vertexEmb;
+	std::vector<Dart> m_vertexDart;
+	std::vector<VEC3> m_points;
+
+	/**
+	* 1-rings (CSR): index of the neighbour, its dart phi2(f) and the cost of the edge
+	*/
+	std::vector<unsigned int> m_ringBegin;
+	std::vector<unsigned int> m_ring;
+	std::vector<Dart> m_ringOrigin;
+	std::vector<REAL> m_ringCost;
+
+	/**
+	* triangles of each vertex (CSR): indices of their 2 other vertices
+	*/
+	std::vector<unsigned int> m_triBegin;
+	std::vector<std::pair<unsigned int, unsigned int> > m_triangles;
+
+	/**
+	* state of the vertices during a run
+	*/
+	std::vector<REAL> m_dist;
+	std::vector<Dart> m_origin;
+	std::vector<unsigned int> m_label;
+
+	/**
+	* one front per thread, and the stamps of the vertices reached by the runs of each thread
+	* (the runs of different threads never share a counter or a stamp)
+	*/
+	std::vector<Utils::IndexedHeap<REAL, unsigned int, 4> > m_fronts;
+	std::vector<std::vector<unsigned int> > m_stamps;
+	std::vector<unsigned int> m_nbRuns;
+
+	/**
+	* stamp of a new run of the given thread, the stamps of the thread are reset before they wrap
+	*/
+	unsigned int newStamp(unsigned int thread);
+
+	/**
+	* distance of k through the triangle (k,i,j) unfolded in the plane (i and j fixed),
+	* returns false if the path from the virtual source does not cross the edge [i,j]
+	*/
+	bool triangleDistance(unsigned int k, unsigned int i, unsigned int j, REAL& d) const;
+
+	/**
+	* run the front (initialized with the sources) of the given thread
+	* @param allowed allowed(j) tells if the vertex of index j can be reached
+	* @param fixed fixed(i) is called on each vertex when its distance is final
+	* @return index of the last fixed vertex
+	*/
+	template <bool FAST_MARCHING, typename ALLOWED, typename FIXED>
+	unsigned int propagate(unsigned int thread, unsigned int stamp, ALLOWED allowed, FIXED fixed);
+
+	template <bool FAST_MARCHING>
+	Dart computeFromSeeds(const std::vector<Dart>& seeds, VertexAttribute<REAL, MAP>& distance, VertexAttribute<unsigned int, MAP>& region, VertexAttribute<Dart, MAP>* pathOrigin);
+
+	template <bool FAST_MARCHING>
+	void computeInRegion(Dart seed, const VertexAttribute<unsigned int, MAP>& region, VertexAttribute<REAL, MAP>& distance, VertexAttribute<Dart, MAP>* pathOrigin, unsigned int thread);
+
+	template <bool FAST_MARCHING>
+	void computeInRegions(const std::vector<Dart>& seeds, const VertexAttribute<unsigned int, MAP>& region, VertexAttribute<REAL, MAP>& distance, VertexAttribute<Dart, MAP>* pathOrigin);
+
+public:
+	/**
+	* distances along the edges weighted by edgeCost (Dijkstra only)
+	* @param nbth number of threads used by the runs in regions
+	*/
+	GeodesicDistance(MAP& map, const EdgeAttribute<REAL, MAP>& edgeCost, unsigned int nbth = CGoGN::Parallel::NumberOfThreads);
+
+	/**
+	* distances on the surface of given positions (length of the edges, fast marching allowed)
+	* @param nbth number of threads used by the runs in regions
+	*/
+	GeodesicDistance(MAP& map, const VertexAttribute<VEC3, MAP>& position, unsigned int nbth = CGoGN::Parallel::NumberOfThreads);
+
+	~GeodesicDistance();
+
+	/**
+	* rebuild the 1-rings, the triangles and the costs
+	*/
+	void update();
+
+	unsigned int nbThreads() const { return m_nbth; }
+
+	bool hasFastMarching() const { return m_fastMarching; }
+
+	/**
+	* distance of each vertex to its closest seed along the edges (multi-source Dijkstra),
+	* the vertices not reached are not modified
+	* @param region (out) number of the closest seed in seeds
+	* @param pathOrigin (out, optional) previous vertex on the shortest path
+	* @return the last vertex reached (the farthest from the seeds)
+	*/
+	Dart computeDijkstra(const std::vector<Dart>& seeds, VertexAttribute<REAL, MAP>& distance, VertexAttribute<unsigned int, MAP>& region, VertexAttribute<Dart, MAP>* pathOrigin = NULL);
+
+	/**
+	* same with fast marching
+	*/
+	Dart computeFastMarching(const std::vector<Dart>& seeds, VertexAttribute<REAL, MAP>& distance, VertexAttribute<unsigned int, MAP>& region, VertexAttribute<Dart, MAP>* pathOrigin = NULL);
+
+	/**
+	* distance to seed of the vertices of the region of seed (the vertices connected to seed with
+	* the same region label), the other vertices are not modified
+	* @param thread front and stamps used for the run (in [0,nbThreads())): runs of different regions can be
+	* called at the same time from different threads with different values of thread
+	*/
+	void computeDijkstraInRegion(Dart seed, const VertexAttribute<unsigned int, MAP>& region, VertexAttribute<REAL, MAP>& distance, VertexAttribute<Dart, MAP>* pathOrigin = NULL, unsigned int thread = 0);
+
+	/**
+	* same with fast marching
+	*/
+	void computeFastMarchingInRegion(Dart seed, const VertexAttribute<unsigned int, MAP>& region, VertexAttribute<REAL, MAP>& distance, VertexAttribute<Dart, MAP>* pathOrigin = NULL, unsigned int thread = 0);
+
+	/**
+	* computeDijkstraInRegion for all the seeds (that must be in different regions), in parallel
+	*/
+	void computeDijkstraInRegions(const std::vector<Dart>& seeds, const VertexAttribute<unsigned int, MAP>& region, VertexAttribute<REAL, MAP>& distance, VertexAttribute<Dart, MAP>* pathOrigin = NULL);
+
+	/**
+	* computeFastMarchingInRegion for all the seeds (that must be in different regions), in parallel
+	*/
+	void computeFastMarchingInRegions(const std::vector<Dart>& seeds, const VertexAttribute<unsigned int, MAP>& region, VertexAttribute<REAL, MAP>& distance, VertexAttribute<Dart, MAP>* pathOrigin = NULL);
+};
+
+} // namespace Geometry
+
+} // namespace Surface
+
+} // namespace Algo
+
+} // namespace CGoGN
+
+#include "Algo/Geometry/geodesics.hpp"
+
+#endif
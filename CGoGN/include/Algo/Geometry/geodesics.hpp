@@ -0,0 +1,400 @@
+/*******************************************************************************
+ * CGoGN: Combinatorial and Geometric modeling with Generic N-dimensional Maps  *
+ * version 0.1                                                                  *
+ * Copyright (C) 2009-2012, IGG Team, LSIIT, University of Strasbourg           *
+ *                                                                              *
+ * This library is free software; you can redistribute it and/or modify it      *
+ * under the terms of the GNU Lesser General Public License as published by the *
+ * Free Software Foundation; either version 2.1 of the License, or (at your     *
+ * option) any later version.                                                   *
+ *                                                                              *
+ * This library is distributed in the hope that it will be useful, but WITHOUT  *
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or        *
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License  *
+ * for more details.                                                            *
+ *                                                                              *
+ * You should have received a copy of the GNU Lesser General Public License     *
+ * along with this library; if not, write to the Free Software Foundation,      *
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301 USA.           *
+ *                                                                              *
+ * Web site: http://cgogn.unistra.fr/                                           *
+ * Contact information: cgogn@unistra.fr                                        *
+ *                                                                              *
+ *******************************************************************************/
+
+#include <cmath>
+#include <algorithm>
+
+namespace CGoGN
+{
+
+namespace Algo
+{
+
+namespace Surface
+{
+
+namespace Geometry
+{
+
+template <typename PFP>
+const unsigned int GeodesicDistance<PFP>::NIL;
+
+template <typename PFP>
+GeodesicDistance<PFP>::GeodesicDistance(MAP& map, const EdgeAttribute<REAL, MAP>& edgeCost, unsigned int nbth) :
+	m_map(map),
+	m_edgeCost(edgeCost),
+	m_fastMarching(false),
+	m_nbth(nbth > 0 ? nbth : 1),
+	m_nbVertices(0)
+{
+	m_index = m_map.template addAttribute<unsigned int, VERTEX, MAP>("");
+	update();
+}
+
+template <typename PFP>
+GeodesicDistance<PFP>::GeodesicDistance(MAP& map, const VertexAttribute<VEC3, MAP>& position, unsigned int nbth) :
+	m_map(map),
+	m_position(position),
+	m_fastMarching(true),
+	m_nbth(nbth > 0 ? nbth : 1),
+	m_nbVertices(0)
+{
+	m_index = m_map.template addAttribute<unsigned int, VERTEX, MAP>("");
+	update();
+}
+
+template <typename PFP>
+GeodesicDistance<PFP>::~GeodesicDistance()
+{
+	m_map.removeAttribute(m_index);
+}
+
+template <typename PFP>
+void GeodesicDistance<PFP>::update()
+{
+	m_nbVertices = 0;
+	m_vertexEmb.clear();
+	m_vertexDart.clear();
+	m_ringBegin.assign(1, 0);
+	m_ring.clear();
+	m_ringOrigin.clear();
+	m_triBegin.assign(1, 0);
+	m_triangles.clear();
+
+	// one traversal: the vertices are indexed in the order of the traversal,
+	// the neighbours are stored by embedding then converted to indices
+	foreach_cell<VERTEX>(m_map, [&] (Vertex v)
+	{
+		m_index[v] = m_nbVertices++;
+		m_vertexEmb.push_back(m_map.template getEmbedding<VERTEX>(v.dart));
+		m_vertexDart.push_back(v.dart);
+
+		// 1-ring in the order of Traversor2VVaE
+		Traversor2VVaE<MAP> t(m_map, v);
+		for (Dart f = t.begin(); f != t.end(); f = t.next())
+		{
+			m_ring.push_back(m_map.template getEmbedding<VERTEX>(f));
+			m_ringOrigin.push_back(m_map.phi2(f));
+		}
+		m_ringBegin.push_back((unsigned int)(m_ring.size()));
+
+		// triangles (the other faces are only crossed along their edges)
+		if (m_fastMarching)
+		{
+			Dart d = v.dart;
+			do
+			{
+				if (!m_map.template isBoundaryMarked<2>(d) && m_map.phi1(m_map.phi1(m_map.phi1(d))) == d)
+					m_triangles.push_back(std::make_pair(m_map.template getEmbedding<VERTEX>(m_map.phi1(d)), m_map.template getEmbedding<VERTEX>(m_map.phi_1(d))));
+				d = m_map.phi2(m_map.phi_1(d));
+			} while (d != v.dart);
+			m_triBegin.push_back((unsigned int)(m_triangles.size()));
+		}
+	});
+
+	for (unsigned int k = 0; k < m_ring.size(); ++k)
+		m_ring[k] = m_index[m_ring[k]];
+	for (unsigned int t = 0; t < m_triangles.size(); ++t)
+	{
+		m_triangles[t].first = m_index[m_triangles[t].first];
+		m_triangles[t].second = m_index[m_triangles[t].second];
+	}
+	if (!m_fastMarching)
+		m_triBegin.assign(m_nbVertices + 1, 0);
+
+	// costs
+	m_ringCost.resize(m_ring.size());
+	if (m_fastMarching)
+	{
+		m_points.resize(m_nbVertices);
+		for (unsigned int i = 0; i < m_nbVertices; ++i)
+			m_points[i] = m_position[m_vertexEmb[i]];
+		for (unsigned int i = 0; i < m_nbVertices; ++i)
+			for (unsigned int k = m_ringBegin[i]; k < m_ringBegin[i+1]; ++k)
+				m_ringCost[k] = REAL((m_points[m_ring[k]] - m_points[i]).norm());
+	}
+	else
+	{
+		for (unsigned int k = 0; k < m_ring.size(); ++k)
+			m_ringCost[k] = m_edgeCost[m_ringOrigin[k]];
+	}
+
+	m_dist.assign(m_nbVertices, REAL(0));
+	m_origin.assign(m_nbVertices, Dart());
+	m_label.assign(m_nbVertices, NIL);
+
+	m_fronts.resize(m_nbth);
+	m_stamps.resize(m_nbth);
+	m_nbRuns.assign(m_nbth, 0);
+	for (unsigned int t = 0; t < m_nbth; ++t)
+	{
+		m_fronts[t].clear();
+		m_fronts[t].setNbIds(m_nbVertices);
+		m_stamps[t].assign(m_nbVertices, 0);
+	}
+}
+
+template <typename PFP>
+unsigned int GeodesicDistance<PFP>::newStamp(unsigned int thread)
+{
+	if (m_nbRuns[thread] >= 0x7fffffff)
+	{
+		m_stamps[thread].assign(m_nbVertices, 0);
+		m_nbRuns[thread] = 0;
+	}
+	return ++m_nbRuns[thread];
+}
+
+template <typename PFP>
+bool GeodesicDistance<PFP>::triangleDistance(unsigned int k, unsigned int i, unsigned int j, REAL& d) const
+{
+	const VEC3& pk = m_points[k];
+	const VEC3& pi = m_points[i];
+	const VEC3& pj = m_points[j];
+
+	// edge [i,j] on the x axis, k above it
+	const REAL c = REAL((pj - pi).norm());
+	if (c <= REAL(0))
+		return false;
+	const REAL ki2 = REAL((pk - pi).norm2());
+	const REAL kx = (ki2 - REAL((pk - pj).norm2()) + c * c) / (REAL(2) * c);
+	const REAL ky = std::sqrt(std::max(ki2 - kx * kx, REAL(0)));
+
+	// virtual source below the edge, at distances di and dj of i and j
+	const REAL di = m_dist[i];
+	const REAL dj = m_dist[j];
+	const REAL sx = (di * di - dj * dj + c * c) / (REAL(2) * c);
+	const REAL sy2 = di * di - sx * sx;
+	if (sy2 < REAL(0))
+		return false;
+	const REAL sy = std::sqrt(sy2);
+
+	// the path from the source must cross the edge
+	const REAL h = ky + sy;
+	if (h <= REAL(0))
+		return false;
+	const REAL x = sx + (kx - sx) * sy / h;
+	if ((x < REAL(0)) || (x > c))
+		return false;
+
+	d = std::sqrt((kx - sx) * (kx - sx) + h * h);
+	return true;
+}
+
+template <typename PFP>
+template <bool FAST_MARCHING, typename ALLOWED, typename FIXED>
+unsigned int GeodesicDistance<PFP>::propagate(unsigned int thread, unsigned int stamp, ALLOWED allowed, FIXED fixed)
+{
+	Utils::IndexedHeap<REAL, unsigned int, 4>& front = m_fronts[thread];
+	std::vector<unsigned int>& stamps = m_stamps[thread];
+	unsigned int last = NIL;
+
+	while (!front.empty())
+	{
+		const unsigned int i = front.topHandle();
+		front.pop();
+		fixed(i);
+		last = i;
+
+		const REAL di = m_dist[i];
+		for (unsigned int k = m_ringBegin[i]; k < m_ringBegin[i+1]; ++k)
+		{
+			// allowed is tested first: the vertices of the other regions may be written by other runs
+			const unsigned int j = m_ring[k];
+			if (!allowed(j))
+				continue;
+			const bool reached = (stamps[j] == stamp);
+			if (reached && !front.contains(j))
+				continue;
+
+			REAL dj = di + m_ringCost[k];
+			if (FAST_MARCHING)
+			{
+				// triangles of j with i and another fixed vertex of the same seed
+				for (unsigned int t = m_triBegin[j]; t < m_triBegin[j+1]; ++t)
+				{
+					unsigned int l;
+					if (m_triangles[t].first == i)
+						l = m_triangles[t].second;
+					else if (m_triangles[t].second == i)
+						l = m_triangles[t].first;
+					else
+						continue;
+					if (!allowed(l) || (stamps[l] != stamp) || front.contains(l) || (m_label[l] != m_label[i]))
+						continue;
+					REAL d;
+					if (triangleDistance(j, i, l, d) && (d < dj))
+						dj = d;
+				}
+			}
+
+			if (!reached)
+			{
+				stamps[j] = stamp;
+				m_dist[j] = dj;
+				m_origin[j] = m_ringOrigin[k];
+				m_label[j] = m_label[i];
+				front.insertId(j, dj);
+			}
+			else if (dj < m_dist[j])
+			{
+				m_dist[j] = dj;
+				m_origin[j] = m_ringOrigin[k];
+				m_label[j] = m_label[i];
+				front.update(j, dj);
+			}
+		}
+	}
+
+	return last;
+}
+
+template <typename PFP>
+template <bool FAST_MARCHING>
+Dart GeodesicDistance<PFP>::computeFromSeeds(const std::vector<Dart>& seeds, VertexAttribute<REAL, MAP>& distance, VertexAttribute<unsigned int, MAP>& region, VertexAttribute<Dart, MAP>* pathOrigin)
+{
+	const unsigned int stamp = newStamp(0);
+
+	Utils::IndexedHeap<REAL, unsigned int, 4>& front = m_fronts[0];
+	std::vector<unsigned int>& stamps = m_stamps[0];
+	front.clear();
+	for (unsigned int s = 0; s < seeds.size(); ++s)
+	{
+		const unsigned int i = m_index[seeds[s]];
+		if (stamps[i] == stamp)
+			continue;
+		stamps[i] = stamp;
+		m_dist[i] = REAL(0);
+		m_origin[i] = seeds[s];
+		m_label[i] = s;
+		front.insertId(i, REAL(0));
+	}
+
+	const unsigned int last = propagate<FAST_MARCHING>(0, stamp,
+		[] (unsigned int) { return true; },
+		[&] (unsigned int i)
+		{
+			const unsigned int e = m_vertexEmb[i];
+			distance[e] = m_dist[i];
+			region[e] = m_label[i];
+			if (pathOrigin != NULL)
+				(*pathOrigin)[e] = m_origin[i];
+		});
+
+	return (last != NIL) ? m_vertexDart[last] : Dart();
+}
+
+template <typename PFP>
+template <bool FAST_MARCHING>
+void GeodesicDistance<PFP>::computeInRegion(Dart seed, const VertexAttribute<unsigned int, MAP>& region, VertexAttribute<REAL, MAP>& distance, VertexAttribute<Dart, MAP>* pathOrigin, unsigned int thread)
+{
+	const unsigned int stamp = newStamp(thread);
+	const unsigned int label = region[seed];
+
+	Utils::IndexedHeap<REAL, unsigned int, 4>& front = m_fronts[thread];
+	front.clear();
+	const unsigned int i = m_index[seed];
+	m_stamps[thread][i] = stamp;
+	m_dist[i] = REAL(0);
+	m_origin[i] = seed;
+	m_label[i] = label;
+	front.insertId(i, REAL(0));
+
+	propagate<FAST_MARCHING>(thread, stamp,
+		[&] (unsigned int j) { return region[m_vertexEmb[j]] == label; },
+		[&] (unsigned int j)
+		{
+			const unsigned int e = m_vertexEmb[j];
+			distance[e] = m_dist[j];
+			if (pathOrigin != NULL)
+				(*pathOrigin)[e] = m_origin[j];
+		});
+}
+
+template <typename PFP>
+template <bool FAST_MARCHING>
+void GeodesicDistance<PFP>::computeInRegions(const std::vector<Dart>& seeds, const VertexAttribute<unsigned int, MAP>& region, VertexAttribute<REAL, MAP>& distance, VertexAttribute<Dart, MAP>* pathOrigin)
+{
+	const unsigned int nb = (unsigned int)(seeds.size());
+	if ((m_nbth <= 1) || (nb < 2))
+	{
+		for (unsigned int s = 0; s < nb; ++s)
+			computeInRegion<FAST_MARCHING>(seeds[s], region, distance, pathOrigin, 0);
+		return;
+	}
+
+	// one seed per chunk: the sizes of the regions are not known
+	Utils::ThreadPool::shared(m_nbth - 1).parallelFor(nb, 1, [&] (unsigned int b, unsigned int e, unsigned int w)
+	{
+		for (unsigned int s = b; s < e; ++s)
+			computeInRegion<FAST_MARCHING>(seeds[s], region, distance, pathOrigin, w);
+	});
+}
+
+template <typename PFP>
+Dart GeodesicDistance<PFP>::computeDijkstra(const std::vector<Dart>& seeds, VertexAttribute<REAL, MAP>& distance, VertexAttribute<unsigned int, MAP>& region, VertexAttribute<Dart, MAP>* pathOrigin)
+{
+	return computeFromSeeds<false>(seeds, distance, region, pathOrigin);
+}
+
+template <typename PFP>
+Dart GeodesicDistance<PFP>::computeFastMarching(const std::vector<Dart>& seeds, VertexAttribute<REAL, MAP>& distance, VertexAttribute<unsigned int, MAP>& region, VertexAttribute<Dart, MAP>* pathOrigin)
+{
+	assert(m_fastMarching || !"GeodesicDistance: fast marching needs the positions");
+	return computeFromSeeds<true>(seeds, distance, region, pathOrigin);
+}
+
+template <typename PFP>
+void GeodesicDistance<PFP>::computeDijkstraInRegion(Dart seed, const VertexAttribute<unsigned int, MAP>& region, VertexAttribute<REAL, MAP>& distance, VertexAttribute<Dart, MAP>* pathOrigin, unsigned int thread)
+{
+	computeInRegion<false>(seed, region, distance, pathOrigin, thread);
+}
+
+template <typename PFP>
+void GeodesicDistance<PFP>::computeFastMarchingInRegion(Dart seed, const VertexAttribute<unsigned int, MAP>& region, VertexAttribute<REAL, MAP>& distance, VertexAttribute<Dart, MAP>* pathOrigin, unsigned int thread)
+{
+	assert(m_fastMarching || !"GeodesicDistance: fast marching needs the positions");
+	computeInRegion<true>(seed, region, distance, pathOrigin, thread);
+}
+
+template <typename PFP>
+void GeodesicDistance<PFP>::computeDijkstraInRegions(const std::vector<Dart>& seeds, const VertexAttribute<unsigned int, MAP>& region, VertexAttribute<REAL, MAP>& distance, VertexAttribute<Dart, MAP>* pathOrigin)
+{
+	computeInRegions<false>(seeds, region, distance, pathOrigin);
+}
+
+template <typename PFP>
+void GeodesicDistance<PFP>::computeFastMarchingInRegions(const std::vector<Dart>& seeds, const VertexAttribute<unsigned int, MAP>& region, VertexAttribute<REAL, MAP>& distance, VertexAttribute<Dart, MAP>* pathOrigin)
+{
+	assert(m_fastMarching || !"GeodesicDistance: fast marching needs the positions");
+	computeInRegions<true>(seeds, region, distance, pathOrigin);
+}
+
+} // namespace Geometry
+
+} // namespace Surface
+
+} // namespace Algo
+
+} // namespace CGoGN
@@ -0,0 +1,118 @@
+/*******************************************************************************
+ * CGoGN: Combinatorial and Geometric modeling with Generic N-dimensional Maps  *
+ * version 0.1                                                                  *
+ * Copyright (C) 2009-2012, IGG Team, LSIIT, University of Strasbourg           *
+ *                                                                              *
+ * This library is free software; you can redistribute it and/or modify it      *
+ * under the terms of the GNU Lesser General Public License as published by the *
+ * Free Software Foundation; either version 2.1 of the License, or (at your     *
+ * option) any later version.                                                   *
+ *                                                                              *
+ * This library is distributed in the hope that it will be useful, but WITHOUT  *
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or        *
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License  *
+ * for more details.                                                            *
+ *                                                                              *
+ * You should have received a copy of the GNU Lesser General Public License     *
+ * along with this library; if not, write to the Free Software Foundation,      *
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301 USA.           *
+ *                                                                              *
+ * Web site: http://cgogn.unistra.fr/                                           *
+ * Contact information: cgogn@unistra.fr                                        *
+ *                                                                              *
+ *******************************************************************************/
+
+
+#ifndef __ALGO_GEOMETRY_HAUSDORFF_H__
+#define __ALGO_GEOMETRY_HAUSDORFF_H__
+
+#include "Algo/Selection/faceBVH.h"
+
+namespace CGoGN
+{
+
+namespace Algo
+{
+
+namespace Geometry
+{
+
+/**
+* statistics of the distances measured on the samples of a surface
+*/
+template <typename REAL>
+struct MeshDistance
+{
+	REAL max;
+	REAL mean;
+	REAL rms;
+	unsigned int nbSamples;
+
+	MeshDistance() : max(0), mean(0), rms(0), nbSamples(0) {}
+};
+
+/**
+* one-sided distance from the surface of map to the surface indexed by target
+* Samples are the vertices, and if samplingStep > 0 the points of the edges and
+* of the faces (fan triangles) spaced by about samplingStep. The distance of
+* each sample is its distance to the closest triangle of target.
+* @param map the measured map
+* @param position the vertex attribute storing positions of map
+* @param target hierarchy over the faces of the target map
+* @param distance (out) distance of each vertex of map to the target
+* @param samplingStep distance between samples on edges and faces (0: vertices only)
+* @param nbth number of threads
+* @return max (one-sided Hausdorff distance), mean and RMS of the distances of the samples
+*/
+template <typename PFP>
+MeshDistance<typename PFP::REAL> computeDistance(typename PFP::MAP& map, const VertexAttribute<typename PFP::VEC3, typename PFP::MAP>& position,
+	const Selection::FaceBVH<PFP>& target, VertexAttribute<typename PFP::REAL, typename PFP::MAP>& distance,
+	typename PFP::REAL samplingStep = 0, unsigned int nbth = CGoGN::Parallel::NumberOfThreads);
+
+/**
+* same without storing the distances of the vertices
+*/
+template <typename PFP>
+MeshDistance<typename PFP::REAL> computeDistance(typename PFP::MAP& map, const VertexAttribute<typename PFP::VEC3, typename PFP::MAP>& position,
+	const Selection::FaceBVH<PFP>& target,
+	typename PFP::REAL samplingStep = 0, unsigned int nbth = CGoGN::Parallel::NumberOfThreads);
+
+/**
+* one-sided distance from map1 to map2 (the hierarchy of map2 is built)
+* @param distance1 (out) distance of each vertex of map1 to map2
+*/
+template <typename PFP>
+MeshDistance<typename PFP::REAL> computeDistance(typename PFP::MAP& map1, const VertexAttribute<typename PFP::VEC3, typename PFP::MAP>& position1, VertexAttribute<typename PFP::REAL, typename PFP::MAP>& distance1,
+	typename PFP::MAP& map2, const VertexAttribute<typename PFP::VEC3, typename PFP::MAP>& position2,
+	typename PFP::REAL samplingStep = 0, unsigned int nbth = CGoGN::Parallel::NumberOfThreads);
+
+/**
+* symmetric distance between two surfaces of any connectivity
+* max is the Hausdorff distance, mean and rms are computed on the samples of both sides
+* @param distance1 (out) distance of each vertex of map1 to map2
+* @param distance2 (out) distance of each vertex of map2 to map1
+*/
+template <typename PFP>
+MeshDistance<typename PFP::REAL> hausdorffDistance(
+	typename PFP::MAP& map1, const VertexAttribute<typename PFP::VEC3, typename PFP::MAP>& position1, VertexAttribute<typename PFP::REAL, typename PFP::MAP>& distance1,
+	typename PFP::MAP& map2, const VertexAttribute<typename PFP::VEC3, typename PFP::MAP>& position2, VertexAttribute<typename PFP::REAL, typename PFP::MAP>& distance2,
+	typename PFP::REAL samplingStep = 0, unsigned int nbth = CGoGN::Parallel::NumberOfThreads);
+
+/**
+* same without storing the distances of the vertices
+*/
+template <typename PFP>
+MeshDistance<typename PFP::REAL> hausdorffDistance(
+	typename PFP::MAP& map1, const VertexAttribute<typename PFP::VEC3, typename PFP::MAP>& position1,
+	typename PFP::MAP& map2, const VertexAttribute<typename PFP::VEC3, typename PFP::MAP>& position2,
+	typename PFP::REAL samplingStep = 0, unsigned int nbth = CGoGN::Parallel::NumberOfThreads);
+
+} // namespace Geometry
+
+} // namespace Algo
+
+} // namespace CGoGN
+
+#include "Algo/Geometry/hausdorff.hpp"
+
+#endif
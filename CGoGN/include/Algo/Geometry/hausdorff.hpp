@@ -0,0 +1,286 @@
+/*******************************************************************************
+ * CGoGN: Combinatorial and Geometric modeling with Generic N-dimensional Maps  *
+ * version 0.1                                                                  *
+ * Copyright (C) 2009-2012, IGG Team, LSIIT, University of Strasbourg           *
+ *                                                                              *
+ * This library is free software; you can redistribute it and/or modify it      *
+ * under the terms of the GNU Lesser General Public License as published by the *
+ * Free Software Foundation; either version 2.1 of the License, or (at your     *
+ * option) any later version.                                                   *
+ *                                                                              *
+ * This library is distributed in the hope that it will be useful, but WITHOUT  *
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or        *
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License  *
+ * for more details.                                                            *
+ *                                                                              *
+ * You should have received a copy of the GNU Lesser General Public License     *
+ * along with this library; if not, write to the Free Software Foundation,      *
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301 USA.           *
+ *                                                                              *
+ * Web site: http://cgogn.unistra.fr/                                           *
+ * Contact information: cgogn@unistra.fr                                        *
+ *                                                                              *
+ *******************************************************************************/
+
+
+#include <cmath>
+#include <vector>
+
+namespace CGoGN
+{
+
+namespace Algo
+{
+
+namespace Geometry
+{
+
+/**
+* partial sums of the distances of the samples measured by one thread
+*/
+template <typename REAL>
+struct DistanceAccumulator
+{
+	REAL max;
+	double sum;
+	double sum2;
+	unsigned int nb;
+
+	DistanceAccumulator() : max(0), sum(0), sum2(0), nb(0) {}
+
+	inline void add(REAL d)
+	{
+		if (d > max)
+			max = d;
+		sum += d;
+		sum2 += double(d) * double(d);
+		++nb;
+	}
+
+	inline void merge(const DistanceAccumulator<REAL>& a)
+	{
+		if (a.max > max)
+			max = a.max;
+		sum += a.sum;
+		sum2 += a.sum2;
+		nb += a.nb;
+	}
+
+	MeshDistance<REAL> result() const
+	{
+		MeshDistance<REAL> md;
+		md.max = max;
+		md.nbSamples = nb;
+		if (nb > 0)
+		{
+			md.mean = REAL(sum / nb);
+			md.rms = REAL(std::sqrt(sum2 / nb));
+		}
+		return md;
+	}
+};
+
+/**
+* distance from P to the target
+* prevP / prevDist: previous sample and its distance (prevDist < 0 if none),
+* they bound the search (the distance is 1-Lipschitz)
+*/
+template <typename PFP>
+typename PFP::REAL distanceToTarget(const Selection::FaceBVH<PFP>& target, const typename PFP::VEC3& P, const typename PFP::VEC3& prevP, typename PFP::REAL prevDist)
+{
+	typedef typename PFP::REAL REAL;
+
+	REAL d2;
+	if (prevDist >= 0)
+	{
+		REAL bound = prevDist + (P - prevP).norm();
+		// small enlargement so that the closest face is always found despite rounding
+		bound = bound * REAL(1.001) + std::numeric_limits<REAL>::epsilon();
+		if (target.closestFace(P, d2, bound * bound).valid())
+			return std::sqrt(d2);
+	}
+	target.closestFace(P, d2);
+	return std::sqrt(d2);
+}
+
+/**
+* measure the samples of map, partial sums merged in acc
+*/
+template <typename PFP>
+void accumulateDistances(typename PFP::MAP& map, const VertexAttribute<typename PFP::VEC3, typename PFP::MAP>& position,
+	const Selection::FaceBVH<PFP>& target, VertexAttribute<typename PFP::REAL, typename PFP::MAP>* distance,
+	typename PFP::REAL samplingStep, unsigned int nbth, DistanceAccumulator<typename PFP::REAL>& acc)
+{
+	typedef typename PFP::MAP MAP;
+	typedef typename PFP::VEC3 VEC3;
+	typedef typename PFP::REAL REAL;
+
+	if (target.getNbTriangles() == 0)
+		return;
+
+	// cells are gathered by the calling thread, the workers only read the map
+	std::vector<Dart> vertices;
+	foreach_cell<VERTEX>(map, [&] (Vertex v) { vertices.push_back(v.dart); });
+
+	std::vector<Dart> edges;
+	std::vector<Dart> faces;
+	if (samplingStep > 0)
+	{
+		foreach_cell<EDGE>(map, [&] (Edge e) { edges.push_back(e.dart); });
+		foreach_cell<FACE>(map, [&] (Face f) { faces.push_back(f.dart); });
+	}
+
+	Utils::ThreadPool* pool = (nbth > 1) ? &Utils::ThreadPool::shared(nbth - 1) : NULL;
+	std::vector<DistanceAccumulator<REAL> > accs(pool ? pool->nbWorkers() : 1);
+
+	auto run = [&] (unsigned int nb, unsigned int chunkSize, const Utils::ThreadPool::RangeFunction& f)
+	{
+		if (pool)
+			pool->parallelFor(nb, chunkSize, f);
+		else
+			f(0, nb, 0);
+	};
+
+	run((unsigned int)(vertices.size()), 1024, [&] (unsigned int b, unsigned int e, unsigned int w)
+	{
+		VEC3 prevP;
+		REAL prevDist = -1;
+		for (unsigned int i = b; i < e; ++i)
+		{
+			const VEC3& P = position[vertices[i]];
+			REAL d = distanceToTarget<PFP>(target, P, prevP, prevDist);
+			if (distance)
+				(*distance)[vertices[i]] = d;
+			accs[w].add(d);
+			prevP = P;
+			prevDist = d;
+		}
+	});
+
+	// inner points of the edges
+	run((unsigned int)(edges.size()), 512, [&] (unsigned int b, unsigned int e, unsigned int w)
+	{
+		for (unsigned int i = b; i < e; ++i)
+		{
+			const VEC3& A = position[edges[i]];
+			VEC3 AB = position[map.phi1(edges[i])] - A;
+			unsigned int k = (unsigned int)(std::ceil(AB.norm() / samplingStep));
+			VEC3 prevP = A;
+			REAL prevDist = -1;
+			for (unsigned int j = 1; j < k; ++j)
+			{
+				VEC3 P = A + AB * (REAL(j) / REAL(k));
+				prevDist = distanceToTarget<PFP>(target, P, prevP, prevDist);
+				accs[w].add(prevDist);
+				prevP = P;
+			}
+		}
+	});
+
+	// inner points of the triangles of the fan of each face
+	run((unsigned int)(faces.size()), 64, [&] (unsigned int b, unsigned int e, unsigned int w)
+	{
+		for (unsigned int i = b; i < e; ++i)
+		{
+			Dart f = faces[i];
+			const VEC3& A = position[f];
+			Dart dd = map.phi1(f);
+			Dart ddd = map.phi1(dd);
+			while (ddd != f)
+			{
+				VEC3 AB = position[dd] - A;
+				VEC3 AC = position[ddd] - A;
+				REAL l = std::max(std::max(AB.norm(), AC.norm()), (AC - AB).norm());
+				unsigned int k = (unsigned int)(std::ceil(l / samplingStep));
+				VEC3 prevP = A;
+				REAL prevDist = -1;
+				for (unsigned int u = 1; u + 1 < k; ++u)
+				{
+					for (unsigned int v = 1; u + v < k; ++v)
+					{
+						VEC3 P = A + AB * (REAL(u) / REAL(k)) + AC * (REAL(v) / REAL(k));
+						prevDist = distanceToTarget<PFP>(target, P, prevP, prevDist);
+						accs[w].add(prevDist);
+						prevP = P;
+					}
+				}
+				dd = ddd;
+				ddd = map.phi1(ddd);
+			}
+		}
+	});
+
+	for (unsigned int i = 0; i < accs.size(); ++i)
+		acc.merge(accs[i]);
+}
+
+template <typename PFP>
+MeshDistance<typename PFP::REAL> computeDistance(typename PFP::MAP& map, const VertexAttribute<typename PFP::VEC3, typename PFP::MAP>& position,
+	const Selection::FaceBVH<PFP>& target, VertexAttribute<typename PFP::REAL, typename PFP::MAP>& distance,
+	typename PFP::REAL samplingStep, unsigned int nbth)
+{
+	DistanceAccumulator<typename PFP::REAL> acc;
+	accumulateDistances<PFP>(map, position, target, &distance, samplingStep, nbth, acc);
+	return acc.result();
+}
+
+template <typename PFP>
+MeshDistance<typename PFP::REAL> computeDistance(typename PFP::MAP& map, const VertexAttribute<typename PFP::VEC3, typename PFP::MAP>& position,
+	const Selection::FaceBVH<PFP>& target,
+	typename PFP::REAL samplingStep, unsigned int nbth)
+{
+	DistanceAccumulator<typename PFP::REAL> acc;
+	accumulateDistances<PFP>(map, position, target, NULL, samplingStep, nbth, acc);
+	return acc.result();
+}
+
+template <typename PFP>
+MeshDistance<typename PFP::REAL> computeDistance(typename PFP::MAP& map1, const VertexAttribute<typename PFP::VEC3, typename PFP::MAP>& position1, VertexAttribute<typename PFP::REAL, typename PFP::MAP>& distance1,
+	typename PFP::MAP& map2, const VertexAttribute<typename PFP::VEC3, typename PFP::MAP>& position2,
+	typename PFP::REAL samplingStep, unsigned int nbth)
+{
+	Selection::FaceBVH<PFP> bvh2(map2, position2, 4, nbth);
+	return computeDistance<PFP>(map1, position1, bvh2, distance1, samplingStep, nbth);
+}
+
+template <typename PFP>
+MeshDistance<typename PFP::REAL> hausdorffDistance(
+	typename PFP::MAP& map1, const VertexAttribute<typename PFP::VEC3, typename PFP::MAP>& position1, VertexAttribute<typename PFP::REAL, typename PFP::MAP>& distance1,
+	typename PFP::MAP& map2, const VertexAttribute<typename PFP::VEC3, typename PFP::MAP>& position2, VertexAttribute<typename PFP::REAL, typename PFP::MAP>& distance2,
+	typename PFP::REAL samplingStep, unsigned int nbth)
+{
+	DistanceAccumulator<typename PFP::REAL> acc;
+	{
+		Selection::FaceBVH<PFP> bvh2(map2, position2, 4, nbth);
+		accumulateDistances<PFP>(map1, position1, bvh2, &distance1, samplingStep, nbth, acc);
+	}
+	{
+		Selection::FaceBVH<PFP> bvh1(map1, position1, 4, nbth);
+		accumulateDistances<PFP>(map2, position2, bvh1, &distance2, samplingStep, nbth, acc);
+	}
+	return acc.result();
+}
+
+template <typename PFP>
+MeshDistance<typename PFP::REAL> hausdorffDistance(
+	typename PFP::MAP& map1, const VertexAttribute<typename PFP::VEC3, typename PFP::MAP>& position1,
+	typename PFP::MAP& map2, const VertexAttribute<typename PFP::VEC3, typename PFP::MAP>& position2,
+	typename PFP::REAL samplingStep, unsigned int nbth)
+{
+	DistanceAccumulator<typename PFP::REAL> acc;
+	{
+		Selection::FaceBVH<PFP> bvh2(map2, position2, 4, nbth);
+		accumulateDistances<PFP>(map1, position1, bvh2, NULL, samplingStep, nbth, acc);
+	}
+	{
+		Selection::FaceBVH<PFP> bvh1(map1, position1, 4, nbth);
+		accumulateDistances<PFP>(map2, position2, bvh1, NULL, samplingStep, nbth, acc);
+	}
+	return acc.result();
+}
+
+} // namespace Geometry
+
+} // namespace Algo
+
+} // namespace CGoGN
@@ -24,6 +24,7 @@
 
 #include "Topology/generic/traversor/traversorCell.h"
 #include "Topology/generic/traversor/traversor2.h"
+#include "Topology/generic/traversor/traversor3.h"
 #include "Algo/Geometry/basic.h"
 
 namespace CGoGN
@@ -43,12 +43,30 @@ namespace Geometry
 template<typename PFP, typename V_ATT>
 typename V_ATT::DATA_TYPE triangleNormal(typename PFP::MAP& map, Face f, const V_ATT& position) ;
 
+/**
+ * Newell's normal of a face before normalization
+ */
+template<typename PFP, typename V_ATT>
+typename V_ATT::DATA_TYPE newellNormalDirection(typename PFP::MAP& map, Face f, const V_ATT& position);
+
 template<typename PFP, typename V_ATT>
 typename V_ATT::DATA_TYPE newellNormal(typename PFP::MAP& map, Face f, const V_ATT& position);
 
 template<typename PFP, typename V_ATT>
 typename V_ATT::DATA_TYPE faceNormal(typename PFP::MAP& map, Face f, const V_ATT& position) ;
 
+/**
+ * normal of a face before normalization (faceNormal is its normalized value)
+ */
+template<typename PFP, typename V_ATT>
+typename V_ATT::DATA_TYPE faceNormalDirection(typename PFP::MAP& map, Face f, const V_ATT& position) ;
+
+/**
+ * normal of a vertex before normalization (vertexNormal is its normalized value)
+ */
+template<typename PFP, typename V_ATT>
+typename V_ATT::DATA_TYPE vertexNormalDirection(typename PFP::MAP& map, Vertex v, const V_ATT& position) ;
+
 template<typename PFP, typename V_ATT>
 typename V_ATT::DATA_TYPE vertexNormal(typename PFP::MAP& map, Vertex v, const V_ATT& position) ;
 
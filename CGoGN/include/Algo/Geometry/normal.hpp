@@ -57,7 +57,7 @@ typename V_ATT::DATA_TYPE triangleNormal(typename PFP::MAP& map, Face f, const V
 }
 
 template<typename PFP, typename V_ATT>
-typename V_ATT::DATA_TYPE newellNormal(typename PFP::MAP& map, Face f, const V_ATT& position)
+typename V_ATT::DATA_TYPE newellNormalDirection(typename PFP::MAP& map, Face f, const V_ATT& position)
 {
 	CHECK_ATTRIBUTEHANDLER_ORBIT(V_ATT, VERTEX);
 
@@ -73,6 +73,13 @@ typename V_ATT::DATA_TYPE newellNormal(typename PFP::MAP& map, Face f, const V_A
 		N[2] += (P[0] - Q[0]) * (P[1] + Q[1]);
 	});
 
+	return N;
+}
+
+template<typename PFP, typename V_ATT>
+typename V_ATT::DATA_TYPE newellNormal(typename PFP::MAP& map, Face f, const V_ATT& position)
+{
+	typename V_ATT::DATA_TYPE N = newellNormalDirection<PFP>(map, f, position);
 	N.normalize();
 	return N;
 }
@@ -89,7 +96,18 @@ typename V_ATT::DATA_TYPE faceNormal(typename PFP::MAP& map, Face f, const V_ATT
 }
 
 template<typename PFP, typename V_ATT>
-typename V_ATT::DATA_TYPE vertexNormal(typename PFP::MAP& map, Vertex v, const V_ATT& position)
+typename V_ATT::DATA_TYPE faceNormalDirection(typename PFP::MAP& map, Face f, const V_ATT& position)
+{
+	CHECK_ATTRIBUTEHANDLER_ORBIT(V_ATT, VERTEX);
+
+	if(map.faceDegree(f) == 3)
+		return Geom::triangleNormal(position[f.dart], position[map.phi1(f)], position[map.phi_1(f)]) ;
+	else
+		return newellNormalDirection<PFP>(map, f, position) ;
+}
+
+template<typename PFP, typename V_ATT>
+typename V_ATT::DATA_TYPE vertexNormalDirection(typename PFP::MAP& map, Vertex v, const V_ATT& position)
 {
 	CHECK_ATTRIBUTEHANDLER_ORBIT(V_ATT, VERTEX);
 
@@ -113,6 +131,13 @@ typename V_ATT::DATA_TYPE vertexNormal(typename PFP::MAP& map, Vertex v, const V
 		}
 	});
 
+	return N ;
+}
+
+template<typename PFP, typename V_ATT>
+typename V_ATT::DATA_TYPE vertexNormal(typename PFP::MAP& map, Vertex v, const V_ATT& position)
+{
+	typename V_ATT::DATA_TYPE N = vertexNormalDirection<PFP>(map, v, position) ;
 	N.normalize() ;
 	return N ;
 }
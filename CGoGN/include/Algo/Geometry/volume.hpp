@@ -146,22 +146,12 @@ namespace Parallel
 template <typename PFP>
 typename PFP::REAL totalVolume(typename PFP::MAP& map, const VertexAttribute<typename PFP::VEC3, typename PFP::MAP>& position)
 {
-	// allocate a vector of 1 accumulator for each thread
-	std::vector<typename PFP::REAL> vols(CGoGN::Parallel::NumberOfThreads-1, 0.0);
+	// sum of volumes (accumulated in double as the serial version)
+	double vol = CGoGN::Parallel::reduce_cell<VOLUME>(map, 0.0,
+		[&] (Vol v) { return double(convexPolyhedronVolume<PFP>(map, v, position)); },
+		[] (double a, double b) { return a + b; });
 
-	// foreach volume
-	CGoGN::Parallel::foreach_cell<VOLUME>(map, [&] (Vol v, unsigned int thr)
-	{
-		// add volume to the thread accumulator
-		vols[thr-1] += convexPolyhedronVolume<PFP>(map, v, position) ;
-	});
-
-	// compute the sum of volumes
-	typename PFP::REAL total(0);
-	for (int i=0; i< CGoGN::Parallel::NumberOfThreads-1; ++i )
-		total += vols[i];
-
-	return total;
+	return typename PFP::REAL(vol);
 }
 
 } // namespace Parallel
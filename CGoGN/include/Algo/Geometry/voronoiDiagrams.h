@@ -2,11 +2,11 @@
 #define __VORONOI_DIAGRAMS_H__
 
 #include <vector>
-#include <map>
 #include <set>
 
 //#include "Topology/map/map2.h"
 #include "Topology/generic/traversor/traversor2.h"
+#include "Algo/Geometry/geodesics.h"
 
 namespace CGoGN
 {
@@ -28,30 +28,25 @@ class VoronoiDiagram
 	typedef typename PFP::REAL REAL;
 
 protected :
-	typedef struct
-	{
-		typename std::multimap<REAL,Dart>::iterator it ;
-		bool valid ;
-//		unsigned int region;
-		Dart pathOrigin;
-		static std::string CGoGNnameOfType() { return "VoronoiVertexInfo" ; }
-	} VoronoiVertexInfo ;
-
-	typedef NoTypeNameAttribute<VoronoiVertexInfo> VertexInfo ;
-
 	MAP& map;
 	const EdgeAttribute<REAL, MAP>& edgeCost; // weights on the graph edges
 	VertexAttribute<unsigned int, MAP>& regions; // region labels
 	std::vector<Dart> border;
 	std::vector<Dart> seeds;
 
-	VertexAttribute<VertexInfo, MAP> vertexInfo;
-	std::multimap<REAL,Dart> front ;
-	CellMarker<MAP, VERTEX> vmReached;
+	VertexAttribute<REAL, MAP> vertexDistances; // distances from the seeds
+	VertexAttribute<Dart, MAP> vertexPathOrigins; // previous vertex on the shortest path from origin
+	bool ownAttributes;
+
+	// fronts propagated by a geodesic engine (d-ary heaps, parallel runs in the regions)
+	GeodesicDistance<PFP>* geodesics;
+	unsigned int nbThreads;
+
+	VoronoiDiagram (MAP& m, const EdgeAttribute<REAL, MAP>& c, VertexAttribute<unsigned int, MAP>& r, VertexAttribute<REAL, MAP>& d, VertexAttribute<Dart, MAP>& o, unsigned int nbth);
 
 public :
-	VoronoiDiagram (MAP& m, const EdgeAttribute<REAL, MAP>& c, VertexAttribute<unsigned int, MAP>& r);
-	~VoronoiDiagram ();
+	VoronoiDiagram (MAP& m, const EdgeAttribute<REAL, MAP>& c, VertexAttribute<unsigned int, MAP>& r, unsigned int nbth = CGoGN::Parallel::NumberOfThreads);
+	virtual ~VoronoiDiagram ();
 
 	const std::vector<Dart>& getSeeds () { return seeds; }
 	virtual void setSeeds_fromVector (const std::vector<Dart>&);
@@ -66,10 +61,11 @@ public :
 
 protected :
 	virtual void clear ();
-	void initFrontWithSeeds();
-	virtual void collectVertexFromFront(Dart e);
-	void addVertexToFront(Dart f, REAL d);
-	void updateVertexInFront(Dart f, REAL d);
+	// thread selects the front of the engine (seeds of different regions can be processed at the same time)
+	void computeDistancesWithinRegion (Dart seed, unsigned int thread);
+	// apply f(numSeed, thread) on all the seeds, in parallel
+	template <typename FUNC>
+	void foreachSeed (FUNC f);
 };
 
 template <typename PFP>
@@ -86,6 +82,7 @@ private :
 	VertexAttribute<REAL, MAP>& distances; // distances from the seed
 	VertexAttribute<Dart, MAP>& pathOrigins; // previous vertex on the shortest path from origin
 	VertexAttribute<REAL, MAP>& areaElts; // area element attached to each vertex
+	VertexAttribute<VEC3, MAP> positions; // "position" attribute of the map (fetched by the public methods)
 
 public :
 	CentroidalVoronoiDiagram (
@@ -94,7 +91,8 @@ public :
 			VertexAttribute<unsigned int, MAP>& r,
 			VertexAttribute<REAL, MAP>& d,
 			VertexAttribute<Dart, MAP>& o,
-			VertexAttribute<REAL, MAP>& a);
+			VertexAttribute<REAL, MAP>& a,
+			unsigned int nbth = CGoGN::Parallel::NumberOfThreads);
 
 	~CentroidalVoronoiDiagram ();
 
@@ -113,7 +111,6 @@ public :
 
 protected :
 	void clear();
-	void collectVertexFromFront(Dart e);
 	REAL cumulateEnergyFromRoot(Dart e);
 	void cumulateEnergyAndGradientFromSeed(unsigned int numSeed);
 	Dart selectBestNeighborFromSeed(unsigned int numSeed);
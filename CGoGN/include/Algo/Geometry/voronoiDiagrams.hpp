@@ -15,19 +15,40 @@ namespace Geometry
  ***********************************************************/
 
 template <typename PFP>
-VoronoiDiagram<PFP>::VoronoiDiagram (MAP& m, const EdgeAttribute<REAL, MAP>& p, VertexAttribute<unsigned int, MAP>& r) :
+VoronoiDiagram<PFP>::VoronoiDiagram (MAP& m, const EdgeAttribute<REAL, MAP>& p, VertexAttribute<unsigned int, MAP>& r, unsigned int nbth) :
 	map(m),
 	edgeCost (p),
 	regions (r),
-	vmReached(m)
+	ownAttributes (true),
+	nbThreads (nbth > 0 ? nbth : 1)
 {
-	vertexInfo = map.template addAttribute<VertexInfo, VERTEX, typename PFP::MAP>("vertexInfo");
+	vertexDistances = map.template addAttribute<REAL, VERTEX, MAP>("");
+	vertexPathOrigins = map.template addAttribute<Dart, VERTEX, MAP>("");
+	geodesics = new GeodesicDistance<PFP>(map, edgeCost, nbThreads);
+}
+
+template <typename PFP>
+VoronoiDiagram<PFP>::VoronoiDiagram (MAP& m, const EdgeAttribute<REAL, MAP>& p, VertexAttribute<unsigned int, MAP>& r, VertexAttribute<REAL, MAP>& d, VertexAttribute<Dart, MAP>& o, unsigned int nbth) :
+	map(m),
+	edgeCost (p),
+	regions (r),
+	vertexDistances (d),
+	vertexPathOrigins (o),
+	ownAttributes (false),
+	nbThreads (nbth > 0 ? nbth : 1)
+{
+	geodesics = new GeodesicDistance<PFP>(map, edgeCost, nbThreads);
 }
 
 template <typename PFP>
 VoronoiDiagram<PFP>::~VoronoiDiagram ()
 {
-	map.removeAttribute(vertexInfo);
+	delete geodesics;
+	if (ownAttributes)
+	{
+		map.removeAttribute(vertexDistances);
+		map.removeAttribute(vertexPathOrigins);
+	}
 }
 
 template <typename PFP>
@@ -35,8 +56,6 @@ void VoronoiDiagram<PFP>::clear ()
 {
 	regions.setAllValues(0);
 	border.clear();
-	front.clear();
-	vmReached.unmarkAll();
 }
 
 template <typename PFP>
@@ -85,91 +104,28 @@ void VoronoiDiagram<PFP>::setSeeds_random (unsigned int nseeds)
 	}
 }
 
-template <typename PFP>
-void VoronoiDiagram<PFP>::initFrontWithSeeds ()
-{
-//	vmReached.unmarkAll();
-	clear();
-	for (unsigned int i = 0; i < seeds.size(); i++)
-	{
-		Dart d = seeds[i];
-		vmReached.mark(d);
-		vertexInfo[d].it = front.insert(std::pair<REAL,Dart>(0.0, d));
-		vertexInfo[d].valid = true;
-		regions[d] = i;
-		vertexInfo[d].pathOrigin = d;
-	}
-}
-
 //template <typename PFP>
 //void VoronoiDiagram<PFP>::setCost (const EdgeAttribute<typename PFP::REAL,typename PFP::MAP>& c)
 //{
 //	edgeCost = c;
 //}
 
-template <typename PFP>
-void VoronoiDiagram<PFP>::collectVertexFromFront(Dart e)
-{
-	regions[e] = regions[vertexInfo[e].pathOrigin];
-	front.erase(vertexInfo[e].it);
-	vertexInfo[e].valid=false;
-}
-
-template <typename PFP>
-void VoronoiDiagram<PFP>::addVertexToFront(Dart f, REAL d)
-{
-	VertexInfo& vi (vertexInfo[f]);
-	vi.it = front.insert(std::pair<REAL,Dart>(d + edgeCost[f], f));
-	vi.valid = true;
-	vi.pathOrigin = map.phi2(f);
-	vmReached.mark(f);
-}
-
-template <typename PFP>
-void VoronoiDiagram<PFP>::updateVertexInFront(Dart f, REAL d)
-{
-	VertexInfo& vi (vertexInfo[f]);
-	REAL dist = d + edgeCost[f];
-	if (dist < vi.it->first)
-	{
-		front.erase(vi.it);
-		vi.it = front.insert(std::pair<REAL,Dart>(dist, f));
-		vi.pathOrigin = map.phi2(f);
-	}
-}
-
 template <typename PFP>
 Dart VoronoiDiagram<PFP>::computeDiagram ()
 {
-	initFrontWithSeeds();
+	clear();
 
-	Dart e;
-	while ( !front.empty() )
-	{
-		e = front.begin()->second;
-		REAL d = front.begin()->first;
+	// the map or the costs may have changed since the last diagram
+	geodesics->update();
+	Dart e = geodesics->computeDijkstra(seeds, vertexDistances, regions, &vertexPathOrigins);
 
-		collectVertexFromFront(e);
+	// border edges
+	foreach_cell<EDGE>(map, [&] (Edge ed)
+	{
+		if (regions[ed.dart] != regions[map.phi2(ed.dart)])
+			border.push_back(ed.dart);
+	});
 
-		Traversor2VVaE<MAP> tv (map, e);
-		for (Dart f = tv.begin(); f != tv.end(); f=tv.next())
-		{
-			if (vmReached.isMarked(f))
-			{ // f has been reached
-				if (vertexInfo[f].valid) // f is in the front : update
-					updateVertexInFront(f,d);
-				else // f is not in the front any more (already collected) : detect a border edge
-				{
-					if ( regions[f] != regions[e] )
-						border.push_back(f);
-				}
-			}
-			else
-			{ // f has not been reached : add it to the front
-				addVertexToFront(f,d);
-			}
-		}
-	}
 	return e;
 }
 
@@ -204,36 +160,32 @@ void VoronoiDiagram<PFP>::computeDiagram_incremental (unsigned int nseeds)
 template <typename PFP>
 void VoronoiDiagram<PFP>::computeDistancesWithinRegion (Dart seed)
 {
-	// init
-	front.clear();
-	vmReached.unmarkAll();
+	computeDistancesWithinRegion(seed, 0);
+}
 
-	vmReached.mark(seed);
-	vertexInfo[seed].it = front.insert(std::pair<REAL,Dart>(0.0, seed));
-	vertexInfo[seed].valid = true;
-	vertexInfo[seed].pathOrigin = seed;
+template <typename PFP>
+void VoronoiDiagram<PFP>::computeDistancesWithinRegion (Dart seed, unsigned int thread)
+{
+	geodesics->computeDijkstraInRegion(seed, regions, vertexDistances, &vertexPathOrigins, thread);
+}
 
-	//compute
-	while ( !front.empty() )
+template <typename PFP>
+template <typename FUNC>
+void VoronoiDiagram<PFP>::foreachSeed (FUNC f)
+{
+	const unsigned int nb = (unsigned int)(seeds.size());
+	if ((nbThreads <= 1) || (nb < 2))
 	{
-		Dart e = front.begin()->second;
-		REAL d = front.begin()->first;
-
-		collectVertexFromFront(e);
-
-		Traversor2VVaE<MAP> tv (map, e);
-		for (Dart f = tv.begin(); f != tv.end(); f=tv.next())
-		{
-			if (vmReached.isMarked(f))
-			{ // f has been reached
-				if (vertexInfo[f].valid) updateVertexInFront(f,d); // f is in the front : update
-			}
-			else
-			{ // f has not been reached : add it to the front
-				if ( regions[f] == regions[e] ) addVertexToFront(f,d);
-			}
-		}
+		for (unsigned int i = 0; i < nb; ++i)
+			f(i, 0);
+		return;
 	}
+
+	Utils::ThreadPool::shared(nbThreads - 1).parallelFor(nb, [&] (unsigned int b, unsigned int e, unsigned int w)
+	{
+		for (unsigned int i = b; i < e; ++i)
+			f(i, w);
+	});
 }
 
 /***********************************************************
@@ -247,8 +199,9 @@ CentroidalVoronoiDiagram<PFP>::CentroidalVoronoiDiagram (
 	VertexAttribute<unsigned int, MAP>& r,
 	VertexAttribute<REAL, MAP>& d,
 	VertexAttribute<Dart, MAP>& o,
-	VertexAttribute<REAL, MAP>& a) :
-		VoronoiDiagram<PFP>(m,c,r), distances(d), pathOrigins(o), areaElts(a)
+	VertexAttribute<REAL, MAP>& a,
+	unsigned int nbth) :
+		VoronoiDiagram<PFP>(m,c,r,d,o,nbth), distances(d), pathOrigins(o), areaElts(a)
 {
 }
 
@@ -264,15 +217,6 @@ void CentroidalVoronoiDiagram<PFP>::clear ()
 	distances.setAllValues(0.0);
 }
 
-template <typename PFP>
-void CentroidalVoronoiDiagram<PFP>::collectVertexFromFront(Dart e)
-{
-	distances[e] = this->vertexInfo[e].it->first;
-	pathOrigins[e] = this->vertexInfo[e].pathOrigin;
-
-	VoronoiDiagram<PFP>::collectVertexFromFront(e);
-}
-
 
 template <typename PFP>
 void CentroidalVoronoiDiagram<PFP>::setSeeds_fromVector (const std::vector<Dart>& s)
@@ -298,28 +242,37 @@ void CentroidalVoronoiDiagram<PFP>::computeDiagram_incremental (unsigned int nse
 template <typename PFP>
 void CentroidalVoronoiDiagram<PFP>::cumulateEnergy()
 {
-	globalEnergy = 0.0;
-	for (unsigned int i = 0; i < this->seeds.size(); i++)
+	// the regions are independent
+	this->foreachSeed([&] (unsigned int i, unsigned int)
 	{
 		cumulateEnergyFromRoot(this->seeds[i]);
+	});
+
+	globalEnergy = 0.0;
+	for (unsigned int i = 0; i < this->seeds.size(); i++)
 		globalEnergy += distances[this->seeds[i]];
-	}
 }
 
 template <typename PFP>
 void CentroidalVoronoiDiagram<PFP>::cumulateEnergyAndGradients()
 {
-	globalEnergy = 0.0;
-	for (unsigned int i = 0; i < this->seeds.size(); i++)
+	positions = this->map.template getAttribute<VEC3, VERTEX, MAP>("position");
+
+	this->foreachSeed([&] (unsigned int i, unsigned int)
 	{
 		cumulateEnergyAndGradientFromSeed(i);
+	});
+
+	globalEnergy = 0.0;
+	for (unsigned int i = 0; i < this->seeds.size(); i++)
 		globalEnergy += distances[this->seeds[i]];
-	}
 }
 
 template <typename PFP>
 unsigned int CentroidalVoronoiDiagram<PFP>::moveSeedsOneEdgeNoCheck()
 {
+	positions = this->map.template getAttribute<VEC3, VERTEX, MAP>("position");
+
 	unsigned int m = 0;
 	for (unsigned int i = 0; i < this->seeds.size(); i++)
 	{
@@ -339,8 +292,11 @@ unsigned int CentroidalVoronoiDiagram<PFP>::moveSeedsOneEdgeNoCheck()
 template <typename PFP>
 unsigned int CentroidalVoronoiDiagram<PFP>::moveSeedsOneEdgeCheck()
 {
-	unsigned int m = 0;
-	for (unsigned int i = 0; i < this->seeds.size(); i++)
+	positions = this->map.template getAttribute<VEC3, VERTEX, MAP>("position");
+
+	// each seed only reads and writes the vertices of its region: the seeds are moved in parallel
+	std::vector<unsigned char> moved(this->seeds.size(), 0);
+	this->foreachSeed([&] (unsigned int i, unsigned int thread)
 	{
 		Dart oldSeed = this->seeds[i];
 		Dart newSeed = selectBestNeighborFromSeed(i);
@@ -350,22 +306,28 @@ unsigned int CentroidalVoronoiDiagram<PFP>::moveSeedsOneEdgeCheck()
 		{
 			REAL regionEnergy = distances[oldSeed];
 			this->seeds[i] = newSeed;
-			this->computeDistancesWithinRegion(newSeed);
+			this->computeDistancesWithinRegion(newSeed, thread);
 			cumulateEnergyAndGradientFromSeed(i);
 			if (distances[newSeed] < regionEnergy)
-				m++;
+				moved[i] = 1;
 			else
 				this->seeds[i] = oldSeed;
 		}
-	}
+	});
+
+	unsigned int m = 0;
+	for (unsigned int i = 0; i < moved.size(); i++)
+		m += moved[i];
 	return m;
 }
 
 template <typename PFP>
 unsigned int CentroidalVoronoiDiagram<PFP>::moveSeedsToMedioid()
 {
-	unsigned int m = 0;
-	for (unsigned int i = 0; i < this->seeds.size(); i++)
+	positions = this->map.template getAttribute<VEC3, VERTEX, MAP>("position");
+
+	std::vector<unsigned char> moved(this->seeds.size(), 0);
+	this->foreachSeed([&] (unsigned int i, unsigned int thread)
 	{
 		Dart oldSeed, newSeed;
 		unsigned int seedMoved = 0;
@@ -378,7 +340,7 @@ unsigned int CentroidalVoronoiDiagram<PFP>::moveSeedsToMedioid()
 
 			newSeed = selectBestNeighborFromSeed(i);
 			this->seeds[i] = newSeed;
-			this->computeDistancesWithinRegion(newSeed);
+			this->computeDistancesWithinRegion(newSeed, thread);
 			cumulateEnergyAndGradientFromSeed(i);
 			if (distances[newSeed] < regionEnergy)
 				seedMoved = 1;
@@ -390,8 +352,12 @@ unsigned int CentroidalVoronoiDiagram<PFP>::moveSeedsToMedioid()
 
 		} while (newSeed != oldSeed);
 
-		m += seedMoved;
-	}
+		moved[i] = seedMoved;
+	});
+
+	unsigned int m = 0;
+	for (unsigned int i = 0; i < moved.size(); i++)
+		m += moved[i];
 	return m;
 }
 
@@ -401,10 +367,11 @@ typename PFP::REAL CentroidalVoronoiDiagram<PFP>::cumulateEnergyFromRoot(Dart e)
 	REAL distArea = areaElts[e] * distances[e];
 	distances[e] = areaElts[e] * distances[e] * distances[e];
 
+	// the vertices of the other regions are not read (they may be written by other threads)
 	Traversor2VVaE<MAP> tv (this->map, e);
 	for (Dart f = tv.begin(); f != tv.end(); f=tv.next())
 	{
-		if ( pathOrigins[f] == this->map.phi2(f))
+		if ( this->regions[f] == this->regions[e] && pathOrigins[f] == this->map.phi2(f))
 		{
 			distArea += cumulateEnergyFromRoot(f);
 			distances[e] += distances[f];
@@ -431,7 +398,7 @@ void CentroidalVoronoiDiagram<PFP>::cumulateEnergyAndGradientFromSeed(unsigned i
 	Traversor2VVaE<MAP> tv (this->map, e);
 	for (Dart f = tv.begin(); f != tv.end(); f=tv.next())
 	{
-		if ( pathOrigins[f] == this->map.phi2(f))
+		if ( this->regions[f] == this->regions[e] && pathOrigins[f] == this->map.phi2(f))
 		{
 			REAL distArea = cumulateEnergyFromRoot(f);
 			da.push_back(distArea);
@@ -443,7 +410,7 @@ void CentroidalVoronoiDiagram<PFP>::cumulateEnergyAndGradientFromSeed(unsigned i
 	// compute the gradient
 	// TODO : check if the computation of grad and proj is still valid for other edgeCost than geodesic distances
 	VEC3 grad (0.0);
-	const VertexAttribute<VEC3, MAP>& pos = this->map.template getAttribute<VEC3, VERTEX, typename PFP::MAP>("position");
+	const VertexAttribute<VEC3, MAP>& pos = positions;
 
 	for (unsigned int j = 0; j < v.size(); ++j)
 	{
@@ -462,14 +429,14 @@ Dart CentroidalVoronoiDiagram<PFP>::selectBestNeighborFromSeed(unsigned int numS
 	typedef typename PFP::REAL REAL;
 	Dart e = this->seeds[numSeed];
 	Dart newSeed = e;
-	const VertexAttribute<VEC3, MAP>& pos = this->map.template getAttribute<VEC3,VERTEX,typename PFP::MAP>("position");
+	const VertexAttribute<VEC3, MAP>& pos = positions;
 
 	// TODO : check if the computation of grad and proj is still valid for other edgeCost than geodesic distances
 	REAL maxProj = 0;
 	Traversor2VVaE<MAP> tv (this->map, e);
 	for (Dart f = tv.begin(); f != tv.end(); f=tv.next())
 	{
-		if ( pathOrigins[f] == this->map.phi2(f))
+		if ( this->regions[f] == this->regions[e] && pathOrigins[f] == this->map.phi2(f))
 		{
 			VEC3 edgeV = pos[f] - pos[this->map.phi2(f)];
 	//		edgeV.normalize();
@@ -30,6 +30,7 @@
 #include "Topology/generic/dartmarker.h"
 
 #include "Algo/Import/import2tables.h"
+#include "Algo/Import/sewingTable.h"
 
 namespace CGoGN
 {
@@ -54,6 +55,20 @@ namespace Import
 template <typename PFP>
 bool importMesh(typename PFP::MAP& map, const std::string& filename, std::vector<std::string>& attrNames, bool mergeCloseVertices = false);
 
+/**
+* import an OFF file face by face, for maps larger than RAM (see GenericMap::setPager)
+* No table of the mesh is built: the file is mapped, the vertices are read directly
+* in the position attribute and each face is sewn to the open edges of the faces
+* already read. The open edges stay few when the faces of the file are spatially
+* coherent (see Export::exportOFFStreamed).
+* @param map the map in which the function imports the mesh
+* @param filename
+* @param attrNames attribute names
+* @return a boolean indicating if import was successful
+*/
+template <typename PFP>
+bool importOFFStreamed(typename PFP::MAP& map, const std::string& filename, std::vector<std::string>& attrNames);
+
 /**
 * import a voxellisation
 * @param map the map in which the function imports the mesh
@@ -27,6 +27,9 @@
 #include "Container/fakeAttribute.h"
 #include "Algo/Modelisation/polyhedron.h"
 #include "Algo/Topo/basic.h"
+#include "Algo/Import/textParser.h"
+
+#include <unordered_map>
 
 namespace CGoGN
 {
@@ -45,18 +48,15 @@ bool importMesh(typename PFP::MAP& map, MeshTablesSurface<PFP>& mts)
 {
 	typedef typename PFP::MAP MAP;
 
-	VertexAutoAttribute< NoTypeNameAttribute< std::vector<Dart> >, MAP> vecDartsPerVertex(map, "incidents");
-
 	unsigned nbf = mts.getNbFaces();
 	int index = 0;
 	// buffer for tempo faces (used to remove degenerated edges)
 	std::vector<unsigned int> edgesBuffer;
 	edgesBuffer.reserve(16);
 
-	DartMarkerNoUnmark<MAP> m(map) ;
-
-//	unsigned int vemb = EMBNULL;
-//	auto fsetemb = [&] (Dart d) { map.template initDartEmbedding<VERTEX>(d, vemb); };
+	// created darts, in order of creation
+	std::vector<Dart> darts;
+	darts.reserve(mts.getNbEmbIdx());
 
 	// for each face of table
 	for(unsigned int i = 0; i < nbf; ++i)
@@ -87,56 +87,61 @@ bool importMesh(typename PFP::MAP& map, MeshTablesSurface<PFP>& mts)
 			{
 				unsigned int vemb = edgesBuffer[j];	// get embedding
 				map.template foreach_dart_of_orbit<PFP::MAP::VERTEX_OF_PARENT>(d, [&] (Dart dd) { map.template initDartEmbedding<VERTEX>(dd, vemb); });
-
-				m.mark(d) ;								// mark on the fly to unmark on second loop
-				vecDartsPerVertex[vemb].push_back(d);	// store incident darts for fast adjacency reconstruction
+				darts.push_back(d);
 				d = map.phi1(d);
 			}
 		}
 	}
 
+	// group the darts by edge
+	Algo::Import::SewingTable table;
+	table.build(darts, [&] (Dart d, unsigned int& a, unsigned int& b)
+	{
+		a = map.template getEmbedding<VERTEX>(d);
+		b = map.template getEmbedding<VERTEX>(map.phi1(d));
+	}, map.template getAttributeContainer<VERTEX>().realEnd(), CGoGN::Parallel::NumberOfThreads);
+	std::vector<Dart>().swap(darts);
+
 	bool needBijectiveCheck = false;
 
-	// reconstruct neighbourhood
+	// reconstruct neighbourhood: the darts of an edge are sewn in their order of creation
 	unsigned int nbBoundaryEdges = 0;
-	for (Dart d = map.begin(); d != map.end(); map.next(d))
+	for (unsigned int v = 0; v < table.nbBuckets(); ++v)
 	{
-		if (m.isMarked(d))
+		unsigned int end = table.bucketEnd(v);
+		for (unsigned int b = table.bucketBegin(v); b < end; )
 		{
-			// darts incident to end vertex of edge
-			std::vector<Dart>& vec = vecDartsPerVertex[map.phi1(d)];
-
-			unsigned int embd = map.template getEmbedding<VERTEX>(d);
-			Dart good_dart = NIL;
-			bool firstOK = true;
-			for (typename std::vector<Dart>::iterator it = vec.begin(); it != vec.end() && good_dart == NIL; ++it)
+			unsigned int e = table.groupEnd(b, end);
+			for (unsigned int i = b; i < e; ++i)
 			{
-				if (map.template getEmbedding<VERTEX>(map.phi1(*it)) == embd)
+				Dart d = table.dart(i);
+				if (map.phi2(d) != d)	// already sewn
+					continue;
+
+				unsigned int embd = map.template getEmbedding<VERTEX>(d);
+				Dart good_dart = NIL;
+				for (unsigned int j = b; j < e && good_dart == NIL; ++j)
 				{
-					good_dart = *it;
-					if (good_dart == map.phi2(good_dart))
-					{
-						map.sewFaces(d, good_dart, false);
-						m.template unmarkOrbit<EDGE>(d);
-					}
-					else
+					Dart dd = table.dart(j);
+					if (map.template getEmbedding<VERTEX>(map.phi1(dd)) == embd)
 					{
-						good_dart = NIL;
-						firstOK = false;
+						if (dd == map.phi2(dd))
+						{
+							good_dart = dd;
+							map.sewFaces(d, good_dart, false);
+						}
+						else
+							needBijectiveCheck = true;
 					}
 				}
-			}
-
-			if (!firstOK)
-				needBijectiveCheck = true;
 
-			if (good_dart == NIL)
-			{
-				m.template unmarkOrbit<EDGE>(d);
-				++nbBoundaryEdges;
+				if (good_dart == NIL)
+					++nbBoundaryEdges;
 			}
+			b = e;
 		}
 	}
+	table.clear();
 
 	if (nbBoundaryEdges > 0)
 	{
@@ -182,6 +187,160 @@ bool importVoxellisation(typename PFP::MAP& map, Algo::Surface::Modelisation::Vo
     return importMesh<PFP>(map, mts);
 }
 
+template <typename PFP>
+bool importOFFStreamed(typename PFP::MAP& map, const std::string& filename, std::vector<std::string>& attrNames)
+{
+	using namespace CGoGN::Algo::Import;
+	typedef typename PFP::MAP MAP;
+	typedef typename PFP::VEC3 VEC3;
+
+	VertexAttribute<VEC3, MAP> positions = map.template getAttribute<VEC3, VERTEX, MAP>("position") ;
+	if (!positions.isValid())
+		positions = map.template addAttribute<VEC3, VERTEX, MAP>("position") ;
+	attrNames.push_back(positions.name()) ;
+
+	AttributeContainer& container = map.template getAttributeContainer<VERTEX>() ;
+
+	TextFile file;
+	if (!file.open(filename))
+	{
+		CGoGNerr << "Unable to open file " << filename << CGoGNendl;
+		return false;
+	}
+	const char* p = file.begin();
+	const char* e = file.end();
+
+	const char* l = nextLine(p, e);
+	if (std::string(p, l).find("OFF") == std::string::npos)
+	{
+		CGoGNerr << "Problem reading off file: not an off file" << CGoGNendl;
+		return false;
+	}
+	p = l;
+
+	while ((p != e) && emptyLine(p, e))
+		p = nextLine(p, e);
+	long nbv, nbf;
+	if (!parseInt(p, e, nbv) || !parseInt(p, e, nbf) || (nbv < 0) || (nbf < 0))
+	{
+		CGoGNerr << "Problem reading off file: wrong header" << CGoGNendl;
+		return false;
+	}
+	p = nextLine(p, e);
+
+	// vertices: the table of their lines is only built if these are not consecutive
+	unsigned int firstID = EMBNULL;
+	std::vector<unsigned int> verticesID;
+	for (long i = 0; i < nbv; ++i)
+	{
+		while ((p != e) && emptyLine(p, e))
+			p = nextLine(p, e);
+		double x, y, z;
+		const char* r = p;
+		if (!parseReal(r, e, x) || !parseReal(r, e, y) || !parseReal(r, e, z))
+		{
+			CGoGNerr << "Problem reading off file: wrong vertex" << CGoGNendl;
+			return false;
+		}
+		p = nextLine(p, e);
+
+		unsigned int id = container.insertLine();
+		if (i == 0)
+			firstID = id;
+		else if (verticesID.empty() && (id != firstID + unsigned(i)))
+		{
+			for (long j = 0; j < i; ++j)
+				verticesID.push_back(firstID + unsigned(j));
+		}
+		if (!verticesID.empty())
+			verticesID.push_back(id);
+		positions[id] = VEC3(typename PFP::REAL(x), typename PFP::REAL(y), typename PFP::REAL(z));
+	}
+
+	// open half-edges (a,b) of the faces already read, by key a << 32 | b
+	std::unordered_map<unsigned long long, Dart> openEdges;
+	std::vector<unsigned int> edgesBuffer;
+	edgesBuffer.reserve(16);
+	// half-edges already open with the same vertices: their darts stay unsewn
+	unsigned int nbDuplicates = 0;
+	bool needBijectiveCheck = false;
+
+	for (long i = 0; i < nbf; ++i)
+	{
+		while ((p != e) && emptyLine(p, e))
+			p = nextLine(p, e);
+		const char* r = p;
+		long n, index;
+		if (!parseInt(r, e, n) || (n < 0))
+		{
+			CGoGNerr << "Problem reading off file: wrong face" << CGoGNendl;
+			return false;
+		}
+
+		// store face in buffer, removing degenerated edges
+		edgesBuffer.clear();
+		unsigned int prec = EMBNULL;
+		for (long j = 0; j < n; ++j)
+		{
+			if (!parseInt(r, e, index) || (index < 0) || (index >= nbv))
+			{
+				CGoGNerr << "Problem reading off file: wrong face" << CGoGNendl;
+				return false;
+			}
+			unsigned int em = verticesID.empty() ? firstID + unsigned(index) : verticesID[index];
+			if (em != prec)
+			{
+				prec = em;
+				edgesBuffer.push_back(em);
+			}
+		}
+		p = nextLine(p, e);
+		if (!edgesBuffer.empty() && (edgesBuffer.front() == edgesBuffer.back()))
+			edgesBuffer.pop_back();
+
+		unsigned int nbe = uint32(edgesBuffer.size());
+		if (nbe < 3)
+			continue;
+
+		Dart d = map.newFace(nbe, false);
+		for (unsigned int j = 0; j < nbe; ++j)
+		{
+			unsigned int a = edgesBuffer[j];
+			unsigned int b = edgesBuffer[(j + 1) % nbe];
+			map.template foreach_dart_of_orbit<PFP::MAP::VERTEX_OF_PARENT>(d, [&] (Dart dd) { map.template initDartEmbedding<VERTEX>(dd, a); });
+
+			// sew with the opposite open half-edge, or open this one
+			typename std::unordered_map<unsigned long long, Dart>::iterator it = openEdges.find((static_cast<unsigned long long>(b) << 32) | a);
+			if (it != openEdges.end())
+			{
+				map.sewFaces(d, it->second, false);
+				openEdges.erase(it);
+			}
+			else if (!openEdges.insert(std::make_pair((static_cast<unsigned long long>(a) << 32) | b, d)).second)
+			{
+				++nbDuplicates;
+				needBijectiveCheck = true;
+			}
+			d = map.phi1(d);
+		}
+	}
+
+	const unsigned int nbUnsewn = uint32(openEdges.size()) + nbDuplicates;
+	if (nbUnsewn > 0)
+	{
+		unsigned int nbH = map.closeMap();
+		CGoGNout << "Map closed (" << nbUnsewn << " boundary edges / " << nbH << " holes)" << CGoGNendl;
+	}
+
+	if (needBijectiveCheck)
+	{
+		// ensure bijection between topo and embedding
+		Algo::Topo::bijectiveOrbitEmbedding<VERTEX>(map);
+	}
+
+	return true;
+}
+
 template <typename PFP2, typename PFP3>
 bool import3DMap(typename PFP2::MAP& map2, typename PFP3::MAP& map3, std::vector<std::string>& attrNames, bool mergeCloseVertices)
 {
@@ -582,8 +741,6 @@ bool importMesh(typename PFP::MAP& map, MeshTablesVolume<PFP>& mtv)
     typedef typename PFP::MAP MAP;
     typedef typename PFP::VEC3 VEC3;
 
-    VertexAutoAttribute< NoTypeNameAttribute< std::vector<Dart> >, MAP> vecDartsPerVertex(map, "incidents");
-
     unsigned int nbv = mtv.getNbVolumes();
     unsigned int index = 0;
     // buffer for tempo faces (used to remove degenerated edges)
@@ -592,6 +749,10 @@ bool importMesh(typename PFP::MAP& map, MeshTablesVolume<PFP>& mtv)
 
     DartMarkerNoUnmark<MAP> m(map) ;
 
+    // created darts, in order of creation
+    std::vector<Dart> darts;
+    darts.reserve(mtv.getNbEmbIdx() * 3);
+
     unsigned int vemb = EMBNULL;
     //auto fsetemb = [&] (Dart d) { map.template initDartEmbedding<VERTEX>(d, vemb); };
 
@@ -640,34 +801,34 @@ bool importMesh(typename PFP::MAP& map, MeshTablesVolume<PFP>& mtv)
             vemb = edgesBuffer[0];		// get embedding
             map.template foreach_dart_of_orbit<PFP::MAP::VERTEX_OF_PARENT>(d, [&] (Dart dd) { map.template initDartEmbedding<VERTEX>(dd, vemb); });
             Dart dd = d;
-            vecDartsPerVertex[vemb].push_back(dd); m.mark(dd); dd = map.phi1(map.phi2(dd));
-            vecDartsPerVertex[vemb].push_back(dd); m.mark(dd); dd = map.phi1(map.phi2(dd));
-            vecDartsPerVertex[vemb].push_back(dd); m.mark(dd);
+            darts.push_back(dd); m.mark(dd); dd = map.phi1(map.phi2(dd));
+            darts.push_back(dd); m.mark(dd); dd = map.phi1(map.phi2(dd));
+            darts.push_back(dd); m.mark(dd);
 
             // 2.
             d = map.phi1(d);
             vemb = edgesBuffer[1];
             map.template foreach_dart_of_orbit<PFP::MAP::VERTEX_OF_PARENT>(d, [&] (Dart dd) { map.template initDartEmbedding<VERTEX>(dd, vemb); });
             dd = d;
-            vecDartsPerVertex[vemb].push_back(dd); m.mark(dd); dd = map.phi1(map.phi2(dd));
-            vecDartsPerVertex[vemb].push_back(dd); m.mark(dd);
+            darts.push_back(dd); m.mark(dd); dd = map.phi1(map.phi2(dd));
+            darts.push_back(dd); m.mark(dd);
 
             // 3.
             d = map.phi1(d);
             vemb = edgesBuffer[2];
             map.template foreach_dart_of_orbit<PFP::MAP::VERTEX_OF_PARENT>(d, [&] (Dart dd) { map.template initDartEmbedding<VERTEX>(dd, vemb); });
             dd = d;
-            vecDartsPerVertex[vemb].push_back(dd); m.mark(dd); dd = map.phi1(map.phi2(dd));
-            vecDartsPerVertex[vemb].push_back(dd); m.mark(dd); dd = map.phi1(map.phi2(dd));
-            vecDartsPerVertex[vemb].push_back(dd); m.mark(dd);
+            darts.push_back(dd); m.mark(dd); dd = map.phi1(map.phi2(dd));
+            darts.push_back(dd); m.mark(dd); dd = map.phi1(map.phi2(dd));
+            darts.push_back(dd); m.mark(dd);
 
             // 4.
             d = map.phi1(d);
             vemb = edgesBuffer[3];
             map.template foreach_dart_of_orbit<PFP::MAP::VERTEX_OF_PARENT>(d, [&] (Dart dd) { map.template initDartEmbedding<VERTEX>(dd, vemb); });
             dd = d;
-            vecDartsPerVertex[vemb].push_back(dd); m.mark(dd); dd = map.phi1(map.phi2(dd));
-            vecDartsPerVertex[vemb].push_back(dd); m.mark(dd);
+            darts.push_back(dd); m.mark(dd); dd = map.phi1(map.phi2(dd));
+            darts.push_back(dd); m.mark(dd);
         }
         else if(nbf == 4) //tetrahedral case
         {
@@ -684,7 +845,7 @@ bool importMesh(typename PFP::MAP& map, MeshTablesVolume<PFP>& mtv)
                 do
                 {
                     m.mark(dd) ;
-                    vecDartsPerVertex[vemb].push_back(dd);
+                    darts.push_back(dd);
                     dd = map.phi1(map.phi2(dd));
                 } while(dd != d);
 
@@ -702,7 +863,7 @@ bool importMesh(typename PFP::MAP& map, MeshTablesVolume<PFP>& mtv)
             do
             {
                 m.mark(dd) ;
-                vecDartsPerVertex[vemb].push_back(dd);
+                darts.push_back(dd);
                 dd = map.phi1(map.phi2(dd));
             } while(dd != d);
 
@@ -715,46 +876,46 @@ bool importMesh(typename PFP::MAP& map, MeshTablesVolume<PFP>& mtv)
             vemb = edgesBuffer[0];		// get embedding
             map.template foreach_dart_of_orbit<PFP::MAP::VERTEX_OF_PARENT>(d, [&] (Dart dd) { map.template initDartEmbedding<VERTEX>(dd, vemb); });
             Dart dd = d;
-            vecDartsPerVertex[vemb].push_back(dd); m.mark(dd); dd = map.phi1(map.phi2(dd));
-            vecDartsPerVertex[vemb].push_back(dd); m.mark(dd); dd = map.phi1(map.phi2(dd));
-            vecDartsPerVertex[vemb].push_back(dd); m.mark(dd);
+            darts.push_back(dd); m.mark(dd); dd = map.phi1(map.phi2(dd));
+            darts.push_back(dd); m.mark(dd); dd = map.phi1(map.phi2(dd));
+            darts.push_back(dd); m.mark(dd);
 
             // 2.
             d = map.phi1(d);
             vemb = edgesBuffer[1];
             map.template foreach_dart_of_orbit<PFP::MAP::VERTEX_OF_PARENT>(d, [&] (Dart dd) { map.template initDartEmbedding<VERTEX>(dd, vemb); });
             dd = d;
-            vecDartsPerVertex[vemb].push_back(dd); m.mark(dd); dd = map.phi1(map.phi2(dd));
-            vecDartsPerVertex[vemb].push_back(dd); m.mark(dd); dd = map.phi1(map.phi2(dd));
-            vecDartsPerVertex[vemb].push_back(dd); m.mark(dd);
+            darts.push_back(dd); m.mark(dd); dd = map.phi1(map.phi2(dd));
+            darts.push_back(dd); m.mark(dd); dd = map.phi1(map.phi2(dd));
+            darts.push_back(dd); m.mark(dd);
 
             // 3.
             d = map.phi1(d);
             vemb = edgesBuffer[2];
             map.template foreach_dart_of_orbit<PFP::MAP::VERTEX_OF_PARENT>(d, [&] (Dart dd) { map.template initDartEmbedding<VERTEX>(dd, vemb); });
             dd = d;
-            vecDartsPerVertex[vemb].push_back(dd); m.mark(dd); dd = map.phi1(map.phi2(dd));
-            vecDartsPerVertex[vemb].push_back(dd); m.mark(dd); dd = map.phi1(map.phi2(dd));
-            vecDartsPerVertex[vemb].push_back(dd); m.mark(dd);
+            darts.push_back(dd); m.mark(dd); dd = map.phi1(map.phi2(dd));
+            darts.push_back(dd); m.mark(dd); dd = map.phi1(map.phi2(dd));
+            darts.push_back(dd); m.mark(dd);
 
             // 4.
             d = map.phi1(d);
             vemb = edgesBuffer[3];
             map.template foreach_dart_of_orbit<PFP::MAP::VERTEX_OF_PARENT>(d, [&] (Dart dd) { map.template initDartEmbedding<VERTEX>(dd, vemb); });
             dd = d;
-            vecDartsPerVertex[vemb].push_back(dd); m.mark(dd); dd = map.phi1(map.phi2(dd));
-            vecDartsPerVertex[vemb].push_back(dd); m.mark(dd); dd = map.phi1(map.phi2(dd));
-            vecDartsPerVertex[vemb].push_back(dd); m.mark(dd);
+            darts.push_back(dd); m.mark(dd); dd = map.phi1(map.phi2(dd));
+            darts.push_back(dd); m.mark(dd); dd = map.phi1(map.phi2(dd));
+            darts.push_back(dd); m.mark(dd);
 
             // 5.
             d = map.phi_1(map.phi2(d));
             vemb = edgesBuffer[4];
             map.template foreach_dart_of_orbit<PFP::MAP::VERTEX_OF_PARENT>(d, [&] (Dart dd) { map.template initDartEmbedding<VERTEX>(dd, vemb); });
             dd = d;
-            vecDartsPerVertex[vemb].push_back(dd); m.mark(dd); dd = map.phi1(map.phi2(dd));
-            vecDartsPerVertex[vemb].push_back(dd); m.mark(dd); dd = map.phi1(map.phi2(dd));
-            vecDartsPerVertex[vemb].push_back(dd); m.mark(dd); dd = map.phi1(map.phi2(dd));
-            vecDartsPerVertex[vemb].push_back(dd); m.mark(dd);
+            darts.push_back(dd); m.mark(dd); dd = map.phi1(map.phi2(dd));
+            darts.push_back(dd); m.mark(dd); dd = map.phi1(map.phi2(dd));
+            darts.push_back(dd); m.mark(dd); dd = map.phi1(map.phi2(dd));
+            darts.push_back(dd); m.mark(dd);
         }
         else if(nbf == 6) //prism case
         {
@@ -764,54 +925,54 @@ bool importMesh(typename PFP::MAP& map, MeshTablesVolume<PFP>& mtv)
             vemb = edgesBuffer[0];		// get embedding
             map.template foreach_dart_of_orbit<PFP::MAP::VERTEX_OF_PARENT>(d, [&] (Dart dd) { map.template initDartEmbedding<VERTEX>(dd, vemb); });
             Dart dd = d;
-            vecDartsPerVertex[vemb].push_back(dd); m.mark(dd); dd = map.phi1(map.phi2(dd));
-            vecDartsPerVertex[vemb].push_back(dd); m.mark(dd); dd = map.phi1(map.phi2(dd));
-            vecDartsPerVertex[vemb].push_back(dd); m.mark(dd);
+            darts.push_back(dd); m.mark(dd); dd = map.phi1(map.phi2(dd));
+            darts.push_back(dd); m.mark(dd); dd = map.phi1(map.phi2(dd));
+            darts.push_back(dd); m.mark(dd);
 
             // 2.
             d = map.phi1(d);
             vemb = edgesBuffer[1];
             map.template foreach_dart_of_orbit<PFP::MAP::VERTEX_OF_PARENT>(d, [&] (Dart dd) { map.template initDartEmbedding<VERTEX>(dd, vemb); });
             dd = d;
-            vecDartsPerVertex[vemb].push_back(dd); m.mark(dd); dd = map.phi1(map.phi2(dd));
-            vecDartsPerVertex[vemb].push_back(dd); m.mark(dd); dd = map.phi1(map.phi2(dd));
-            vecDartsPerVertex[vemb].push_back(dd); m.mark(dd);
+            darts.push_back(dd); m.mark(dd); dd = map.phi1(map.phi2(dd));
+            darts.push_back(dd); m.mark(dd); dd = map.phi1(map.phi2(dd));
+            darts.push_back(dd); m.mark(dd);
 
             // 3.
             d = map.phi1(d);
             vemb = edgesBuffer[2];
             map.template foreach_dart_of_orbit<PFP::MAP::VERTEX_OF_PARENT>(d, [&] (Dart dd) { map.template initDartEmbedding<VERTEX>(dd, vemb); });
             dd = d;
-            vecDartsPerVertex[vemb].push_back(dd); m.mark(dd); dd = map.phi1(map.phi2(dd));
-            vecDartsPerVertex[vemb].push_back(dd); m.mark(dd); dd = map.phi1(map.phi2(dd));
-            vecDartsPerVertex[vemb].push_back(dd); m.mark(dd);
+            darts.push_back(dd); m.mark(dd); dd = map.phi1(map.phi2(dd));
+            darts.push_back(dd); m.mark(dd); dd = map.phi1(map.phi2(dd));
+            darts.push_back(dd); m.mark(dd);
 
             // 5.
             d = map.template phi<2112>(d);
             vemb = edgesBuffer[3];
             map.template foreach_dart_of_orbit<PFP::MAP::VERTEX_OF_PARENT>(d, [&] (Dart dd) { map.template initDartEmbedding<VERTEX>(dd, vemb); });
             dd = d;
-            vecDartsPerVertex[vemb].push_back(dd); m.mark(dd); dd = map.phi1(map.phi2(dd));
-            vecDartsPerVertex[vemb].push_back(dd); m.mark(dd); dd = map.phi1(map.phi2(dd));
-            vecDartsPerVertex[vemb].push_back(dd); m.mark(dd);
+            darts.push_back(dd); m.mark(dd); dd = map.phi1(map.phi2(dd));
+            darts.push_back(dd); m.mark(dd); dd = map.phi1(map.phi2(dd));
+            darts.push_back(dd); m.mark(dd);
 
             // 6.
             d = map.phi_1(d);
             vemb = edgesBuffer[4];
             map.template foreach_dart_of_orbit<PFP::MAP::VERTEX_OF_PARENT>(d, [&] (Dart dd) { map.template initDartEmbedding<VERTEX>(dd, vemb); });
             dd = d;
-            vecDartsPerVertex[vemb].push_back(dd); m.mark(dd); dd = map.phi1(map.phi2(dd));
-            vecDartsPerVertex[vemb].push_back(dd); m.mark(dd); dd = map.phi1(map.phi2(dd));
-            vecDartsPerVertex[vemb].push_back(dd); m.mark(dd);
+            darts.push_back(dd); m.mark(dd); dd = map.phi1(map.phi2(dd));
+            darts.push_back(dd); m.mark(dd); dd = map.phi1(map.phi2(dd));
+            darts.push_back(dd); m.mark(dd);
 
             // 7.
             d = map.phi_1(d);
             vemb = edgesBuffer[5];
             map.template foreach_dart_of_orbit<PFP::MAP::VERTEX_OF_PARENT>(d, [&] (Dart dd) { map.template initDartEmbedding<VERTEX>(dd, vemb); });
             dd = d;
-            vecDartsPerVertex[vemb].push_back(dd); m.mark(dd); dd = map.phi1(map.phi2(dd));
-            vecDartsPerVertex[vemb].push_back(dd); m.mark(dd); dd = map.phi1(map.phi2(dd));
-            vecDartsPerVertex[vemb].push_back(dd); m.mark(dd);
+            darts.push_back(dd); m.mark(dd); dd = map.phi1(map.phi2(dd));
+            darts.push_back(dd); m.mark(dd); dd = map.phi1(map.phi2(dd));
+            darts.push_back(dd); m.mark(dd);
 
         }
         else if(nbf == 8) //hexahedral case
@@ -822,72 +983,72 @@ bool importMesh(typename PFP::MAP& map, MeshTablesVolume<PFP>& mtv)
             vemb = edgesBuffer[0];		// get embedding
             map.template foreach_dart_of_orbit<PFP::MAP::VERTEX_OF_PARENT>(d, [&] (Dart dd) { map.template initDartEmbedding<VERTEX>(dd, vemb); });
             Dart dd = d;
-            vecDartsPerVertex[vemb].push_back(dd); m.mark(dd); dd = map.phi1(map.phi2(dd));
-            vecDartsPerVertex[vemb].push_back(dd); m.mark(dd); dd = map.phi1(map.phi2(dd));
-            vecDartsPerVertex[vemb].push_back(dd); m.mark(dd);
+            darts.push_back(dd); m.mark(dd); dd = map.phi1(map.phi2(dd));
+            darts.push_back(dd); m.mark(dd); dd = map.phi1(map.phi2(dd));
+            darts.push_back(dd); m.mark(dd);
 
             // 2.
             d = map.phi1(d);
             vemb = edgesBuffer[1];
             map.template foreach_dart_of_orbit<PFP::MAP::VERTEX_OF_PARENT>(d, [&] (Dart dd) { map.template initDartEmbedding<VERTEX>(dd, vemb); });
             dd = d;
-            vecDartsPerVertex[vemb].push_back(dd); m.mark(dd); dd = map.phi1(map.phi2(dd));
-            vecDartsPerVertex[vemb].push_back(dd); m.mark(dd); dd = map.phi1(map.phi2(dd));
-            vecDartsPerVertex[vemb].push_back(dd); m.mark(dd);
+            darts.push_back(dd); m.mark(dd); dd = map.phi1(map.phi2(dd));
+            darts.push_back(dd); m.mark(dd); dd = map.phi1(map.phi2(dd));
+            darts.push_back(dd); m.mark(dd);
 
             // 3.
             d = map.phi1(d);
             vemb = edgesBuffer[2];
             map.template foreach_dart_of_orbit<PFP::MAP::VERTEX_OF_PARENT>(d, [&] (Dart dd) { map.template initDartEmbedding<VERTEX>(dd, vemb); });
             dd = d;
-            vecDartsPerVertex[vemb].push_back(dd); m.mark(dd); dd = map.phi1(map.phi2(dd));
-            vecDartsPerVertex[vemb].push_back(dd); m.mark(dd); dd = map.phi1(map.phi2(dd));
-            vecDartsPerVertex[vemb].push_back(dd); m.mark(dd);
+            darts.push_back(dd); m.mark(dd); dd = map.phi1(map.phi2(dd));
+            darts.push_back(dd); m.mark(dd); dd = map.phi1(map.phi2(dd));
+            darts.push_back(dd); m.mark(dd);
 
             // 4.
             d = map.phi1(d);
             vemb = edgesBuffer[3];
             map.template foreach_dart_of_orbit<PFP::MAP::VERTEX_OF_PARENT>(d, [&] (Dart dd) { map.template initDartEmbedding<VERTEX>(dd, vemb); });
             dd = d;
-            vecDartsPerVertex[vemb].push_back(dd); m.mark(dd); dd = map.phi1(map.phi2(dd));
-            vecDartsPerVertex[vemb].push_back(dd); m.mark(dd); dd = map.phi1(map.phi2(dd));
-            vecDartsPerVertex[vemb].push_back(dd); m.mark(dd);
+            darts.push_back(dd); m.mark(dd); dd = map.phi1(map.phi2(dd));
+            darts.push_back(dd); m.mark(dd); dd = map.phi1(map.phi2(dd));
+            darts.push_back(dd); m.mark(dd);
 
             // 5.
             d = map.template phi<2112>(d);
             vemb = edgesBuffer[4];
             map.template foreach_dart_of_orbit<PFP::MAP::VERTEX_OF_PARENT>(d, [&] (Dart dd) { map.template initDartEmbedding<VERTEX>(dd, vemb); });
             dd = d;
-            vecDartsPerVertex[vemb].push_back(dd); m.mark(dd); dd = map.phi1(map.phi2(dd));
-            vecDartsPerVertex[vemb].push_back(dd); m.mark(dd); dd = map.phi1(map.phi2(dd));
-            vecDartsPerVertex[vemb].push_back(dd); m.mark(dd);
+            darts.push_back(dd); m.mark(dd); dd = map.phi1(map.phi2(dd));
+            darts.push_back(dd); m.mark(dd); dd = map.phi1(map.phi2(dd));
+            darts.push_back(dd); m.mark(dd);
 
             // 6.
             d = map.phi_1(d);
             vemb = edgesBuffer[5];
             map.template foreach_dart_of_orbit<PFP::MAP::VERTEX_OF_PARENT>(d, [&] (Dart dd) { map.template initDartEmbedding<VERTEX>(dd, vemb); });
             dd = d;
-            vecDartsPerVertex[vemb].push_back(dd); m.mark(dd); dd = map.phi1(map.phi2(dd));
-            vecDartsPerVertex[vemb].push_back(dd); m.mark(dd); dd = map.phi1(map.phi2(dd));
-            vecDartsPerVertex[vemb].push_back(dd); m.mark(dd);
+            darts.push_back(dd); m.mark(dd); dd = map.phi1(map.phi2(dd));
+            darts.push_back(dd); m.mark(dd); dd = map.phi1(map.phi2(dd));
+            darts.push_back(dd); m.mark(dd);
 
             // 7.
             d = map.phi_1(d);
             vemb = edgesBuffer[6];
             map.template foreach_dart_of_orbit<PFP::MAP::VERTEX_OF_PARENT>(d, [&] (Dart dd) { map.template initDartEmbedding<VERTEX>(dd, vemb); });
             dd = d;
-            vecDartsPerVertex[vemb].push_back(dd); m.mark(dd); dd = map.phi1(map.phi2(dd));
-            vecDartsPerVertex[vemb].push_back(dd); m.mark(dd); dd = map.phi1(map.phi2(dd));
-            vecDartsPerVertex[vemb].push_back(dd); m.mark(dd);
+            darts.push_back(dd); m.mark(dd); dd = map.phi1(map.phi2(dd));
+            darts.push_back(dd); m.mark(dd); dd = map.phi1(map.phi2(dd));
+            darts.push_back(dd); m.mark(dd);
 
             // 8.
             d = map.phi_1(d);
             vemb = edgesBuffer[7];
             map.template foreach_dart_of_orbit<PFP::MAP::VERTEX_OF_PARENT>(d, [&] (Dart dd) { map.template initDartEmbedding<VERTEX>(dd, vemb); });
             dd = d;
-            vecDartsPerVertex[vemb].push_back(dd); m.mark(dd); dd = map.phi1(map.phi2(dd));
-            vecDartsPerVertex[vemb].push_back(dd); m.mark(dd); dd = map.phi1(map.phi2(dd));
-            vecDartsPerVertex[vemb].push_back(dd); m.mark(dd);
+            darts.push_back(dd); m.mark(dd); dd = map.phi1(map.phi2(dd));
+            darts.push_back(dd); m.mark(dd); dd = map.phi1(map.phi2(dd));
+            darts.push_back(dd); m.mark(dd);
 
         }  //end of hexa
 
@@ -895,21 +1056,37 @@ bool importMesh(typename PFP::MAP& map, MeshTablesVolume<PFP>& mtv)
 
     std::cout << " elements created " << std::endl;
 
+    // group the darts by edge: the faces to sew together share an edge
+    Algo::Import::SewingTable table;
+    table.build(darts, [&] (Dart d, unsigned int& a, unsigned int& b)
+    {
+        a = map.template getEmbedding<VERTEX>(d);
+        b = map.template getEmbedding<VERTEX>(map.phi1(d));
+    }, map.template getAttributeContainer<VERTEX>().realEnd(), CGoGN::Parallel::NumberOfThreads);
+
     //reconstruct neighbourhood
     unsigned int nbBoundaryFaces = 0 ;
-    for (Dart d = map.begin(); d != map.end(); map.next(d))
+    for (unsigned int i = 0; i < darts.size(); ++i)
     {
+        Dart d = darts[i];
         if (m.isMarked(d))
         {
-            std::vector<Dart>& vec = vecDartsPerVertex[map.phi1(d)];
+            unsigned int embd = map.template getEmbedding<VERTEX>(d);
+            unsigned int embd1 = map.template getEmbedding<VERTEX>(map.phi1(d));
+            unsigned int embd11 = map.template getEmbedding<VERTEX>(map.phi1(map.phi1(d)));
 
+            // darts of the edge, in their order of creation
             Dart good_dart = NIL;
-            for(typename std::vector<Dart>::iterator it = vec.begin(); it != vec.end() && good_dart == NIL; ++it)
+            unsigned int b, e;
+            table.edgeDarts(embd, embd1, b, e);
+            for (unsigned int j = b; j < e && good_dart == NIL; ++j)
             {
-                if(map.template getEmbedding<VERTEX>(map.phi1(*it)) == map.template getEmbedding<VERTEX>(d) &&
-                        map.template getEmbedding<VERTEX>(map.phi_1(*it)) == map.template getEmbedding<VERTEX>(map.phi1(map.phi1(d))))
+                Dart dd = table.dart(j);
+                if (map.template getEmbedding<VERTEX>(dd) == embd1 &&
+                        map.template getEmbedding<VERTEX>(map.phi1(dd)) == embd &&
+                        map.template getEmbedding<VERTEX>(map.phi_1(dd)) == embd11)
                 {
-                    good_dart = *it ;
+                    good_dart = dd ;
                 }
             }
 
@@ -935,22 +1112,6 @@ bool importMesh(typename PFP::MAP& map, MeshTablesVolume<PFP>& mtv)
         }
     }
 
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
     /*
     //reconstruct neighbourhood
     unsigned int nbBoundaryFaces = 0 ;
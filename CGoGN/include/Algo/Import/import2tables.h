@@ -84,6 +84,11 @@ protected:
 	*/
 	std::vector<unsigned int> m_emb;
 
+	/**
+	* append the tables of faces read by chunks (in parallel) to m_nbEdges / m_emb
+	*/
+	void concatChunkTables(std::vector<std::vector<short> >& nbEdges, std::vector<std::vector<unsigned int> >& emb, unsigned int nbth);
+
 #ifdef CGOGN_WITH_ASSIMP
 	void extractMeshRec(AttributeContainer& container, VertexAttribute<VEC3, MAP>& positions, const struct aiScene* scene, const struct aiNode* nd, struct aiMatrix4x4* trafo);
 #endif
@@ -127,10 +132,24 @@ public:
 
     inline unsigned int getEmbIdx(int i) { return  m_emb[i]; }
 
+    inline unsigned int getNbEmbIdx() const { return (unsigned int)(m_emb.size()); }
+
     bool importMesh(const std::string& filename, std::vector<std::string>& attrNames);
 
     bool importVoxellisation(Algo::Surface::Modelisation::Voxellisation& voxellisation, std::vector<std::string>& attrNames);
 
+	/**
+	* fill the tables with triangles computed in memory by chunks (e.g. one chunk per thread)
+	* The vertices are numbered across the chunks, in order; the triangles of a chunk can use
+	* the vertices of any chunk. The chunk tables are consumed (emptied).
+	* @param positions the attribute in which the vertices are stored
+	* @param vertices the vertices of each chunk
+	* @param triangles the indices (3 per triangle) of the triangles of each chunk
+	* @param attrNames attribute names
+	* @param nbth number of threads used to fill the tables
+	*/
+	bool importTriangleChunks(VertexAttribute<VEC3, MAP>& positions, std::vector<std::vector<VEC3> >& vertices, std::vector<std::vector<unsigned int> >& triangles, std::vector<std::string>& attrNames, unsigned int nbth = Parallel::NumberOfThreads);
+
 	bool importPlySLFgenericBin(const std::string& filename, std::vector<std::string>& attrNames);
 
 	template <typename PFP3>
@@ -222,6 +241,8 @@ public:
 
     inline unsigned int getEmbIdx(int i) { return  m_emb[i]; }
 
+    inline unsigned int getNbEmbIdx() const { return (unsigned int)(m_emb.size()); }
+
     bool importMesh(const std::string& filename, std::vector<std::string>& attrNames);
 
 	MeshTablesVolume(MAP& map):
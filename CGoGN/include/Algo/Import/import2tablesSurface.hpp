@@ -24,6 +24,8 @@
 
 #include "Algo/Import/importPlyData.h"
 #include "Algo/Geometry/boundingbox.h"
+#include "Geometry/point_grid.h"
+#include "Algo/Import/textParser.h"
 #include "Topology/generic/autoAttributeHandler.h"
 
 #include "Algo/Modelisation/voxellisation.h"
@@ -44,6 +46,30 @@ namespace Surface
 namespace Import
 {
 
+template<typename PFP>
+void MeshTablesSurface<PFP>::concatChunkTables(std::vector<std::vector<short> >& nbEdges, std::vector<std::vector<unsigned int> >& emb, unsigned int nbth)
+{
+    const unsigned int nbChunks = uint32(nbEdges.size());
+    std::vector<std::size_t> firstFace(nbChunks + 1, m_nbEdges.size());
+    std::vector<std::size_t> firstEmb(nbChunks + 1, m_emb.size());
+    for (unsigned int c = 0; c < nbChunks; ++c)
+    {
+        firstFace[c+1] = firstFace[c] + nbEdges[c].size();
+        firstEmb[c+1] = firstEmb[c] + emb[c].size();
+    }
+
+    m_nbEdges.resize(firstFace[nbChunks]);
+    m_emb.resize(firstEmb[nbChunks]);
+
+    Algo::Import::parallelChunks(nbChunks, nbth, [&] (unsigned int c)
+    {
+        std::copy(nbEdges[c].begin(), nbEdges[c].end(), m_nbEdges.begin() + firstFace[c]);
+        std::copy(emb[c].begin(), emb[c].end(), m_emb.begin() + firstEmb[c]);
+        std::vector<short>().swap(nbEdges[c]);
+        std::vector<unsigned int>().swap(emb[c]);
+    });
+}
+
 template<typename PFP>
 bool MeshTablesSurface<PFP>::importMesh(const std::string& filename, std::vector<std::string>& attrNames)
 {
@@ -104,6 +130,8 @@ bool MeshTablesSurface<PFP>::importMesh(const std::string& filename, std::vector
 template<typename PFP>
 bool MeshTablesSurface<PFP>::importTrian(const std::string& filename, std::vector<std::string>& attrNames)
 {
+	using namespace CGoGN::Algo::Import;
+
 	VertexAttribute<VEC3, MAP> positions =  m_map.template getAttribute<VEC3, VERTEX, MAP>("position") ;
 
     if (!positions.isValid())
@@ -113,16 +141,25 @@ bool MeshTablesSurface<PFP>::importTrian(const std::string& filename, std::vecto
 
     AttributeContainer& container = m_map.template getAttributeContainer<VERTEX>() ;
 
-    // open file
-    std::ifstream fp(filename.c_str(), std::ios::in);
-    if (!fp.good())
+    // map file
+    TextFile file;
+    if (!file.open(filename))
     {
         CGoGNerr << "Unable to open file " << filename << CGoGNendl;
         return false;
     }
+    const char* p = file.begin();
+    const char* e = file.end();
 
-    // read nb of points
-    fp >> m_nbVertices;
+    // the format is a stream of tokens: read them (blanks and ends of lines are separators)
+    long nb;
+    skipBlanks(p, e);
+    if (!parseInt(p, e, nb) || (nb < 0))
+    {
+        CGoGNerr << "Problem reading trian file: wrong number of points" << CGoGNendl;
+        return false;
+    }
+    m_nbVertices = uint32(nb);
 
     // read points
     std::vector<unsigned int> verticesID;
@@ -130,17 +167,29 @@ bool MeshTablesSurface<PFP>::importTrian(const std::string& filename, std::vecto
 
     for (unsigned int i = 0; i < m_nbVertices; ++i)
     {
-        VEC3 pos;
-        fp >> pos[0];
-        fp >> pos[1];
-        fp >> pos[2];
+        double pos[3];
+        for (unsigned int k = 0; k < 3; ++k)
+        {
+            skipBlanks(p, e);
+            if (!parseReal(p, e, pos[k]))
+            {
+                CGoGNerr << "Problem reading trian file: wrong point " << i << CGoGNendl;
+                return false;
+            }
+        }
         unsigned int id = container.insertLine();
-        positions[id] = pos;
+        positions[id] = VEC3(DATA_TYPE(pos[0]), DATA_TYPE(pos[1]), DATA_TYPE(pos[2]));
         verticesID.push_back(id);
     }
 
     // read nb of faces
-    fp >> m_nbFaces;
+    skipBlanks(p, e);
+    if (!parseInt(p, e, nb) || (nb < 0))
+    {
+        CGoGNerr << "Problem reading trian file: wrong number of faces" << CGoGNendl;
+        return false;
+    }
+    m_nbFaces = uint32(nb);
     m_nbEdges.reserve(m_nbFaces);
     m_emb.reserve(3*m_nbFaces);
 
@@ -148,23 +197,22 @@ bool MeshTablesSurface<PFP>::importTrian(const std::string& filename, std::vecto
     for (unsigned int i = 0; i < m_nbFaces; ++i)
     {
         m_nbEdges.push_back(3);
-        // read the three vertices of triangle
-        int pt;
-        fp >> pt;
-        m_emb.push_back(verticesID[pt]);
-        fp >> pt;
-        m_emb.push_back(verticesID[pt]);
-        fp >> pt;
-        m_emb.push_back(verticesID[pt]);
-
-        // neighbour not always good in files !!
-        int neigh;
-        fp >> neigh;
-        fp >> neigh;
-        fp >> neigh;
+        // read the three vertices of triangle and the three neighbours
+        // (neighbour not always good in files !!)
+        for (unsigned int k = 0; k < 6; ++k)
+        {
+            long pt;
+            skipBlanks(p, e);
+            if (!parseInt(p, e, pt) || ((k < 3) && ((pt < 0) || (pt >= long(m_nbVertices)))))
+            {
+                CGoGNerr << "Problem reading trian file: wrong face " << i << CGoGNendl;
+                return false;
+            }
+            if (k < 3)
+                m_emb.push_back(verticesID[pt]);
+        }
     }
 
-    fp.close();
     return true;
 }
 
@@ -241,6 +289,8 @@ bool MeshTablesSurface<PFP>::importTrianBinGz(const std::string& filename, std::
 template<typename PFP>
 bool MeshTablesSurface<PFP>::importOff(const std::string& filename, std::vector<std::string>& attrNames)
 {
+	using namespace CGoGN::Algo::Import;
+
 	VertexAttribute<VEC3, MAP> positions = m_map.template getAttribute<VEC3, VERTEX, MAP>("position") ;
 
     if (!positions.isValid())
@@ -250,90 +300,117 @@ bool MeshTablesSurface<PFP>::importOff(const std::string& filename, std::vector<
 
     AttributeContainer& container = m_map.template getAttributeContainer<VERTEX>() ;
 
-    // open file
-    std::ifstream fp(filename.c_str(), std::ios::in);
-    if (!fp.good())
+    // map file
+    TextFile file;
+    if (!file.open(filename))
     {
         CGoGNerr << "Unable to open file " << filename << CGoGNendl;
         return false;
     }
-
-    std::string ligne;
+    const char* p = file.begin();
+    const char* e = file.end();
 
     // lecture de OFF
-    std::getline (fp, ligne);
-    if (ligne.rfind("OFF") == std::string::npos)
+    const char* l = nextLine(p, e);
+    if (std::string(p, l).find("OFF") == std::string::npos)
     {
         CGoGNerr << "Problem reading off file: not an off file" << CGoGNendl;
-        CGoGNerr << ligne << CGoGNendl;
         return false;
     }
+    p = l;
 
     // lecture des nombres de sommets/faces/aretes
-    int nbe;
+    while ((p != e) && emptyLine(p, e))
+        p = nextLine(p, e);
+    long nbv, nbf;
+    if (!parseInt(p, e, nbv) || !parseInt(p, e, nbf) || (nbv < 0) || (nbf < 0))
     {
-        do
-        {
-            std::getline (fp, ligne);
-        } while (ligne.size() == 0);
-
-        std::stringstream oss(ligne);
-        oss >> m_nbVertices;
-        oss >> m_nbFaces;
-        oss >> nbe;
+        CGoGNerr << "Problem reading off file: wrong header" << CGoGNendl;
+        return false;
     }
+    m_nbVertices = uint32(nbv);
+    m_nbFaces = uint32(nbf);
+    p = nextLine(p, e);
 
-    //lecture sommets
     std::vector<unsigned int> verticesID;
     verticesID.reserve(m_nbVertices);
-    for (unsigned int i = 0; i < m_nbVertices;++i)
-    {
-        do
-        {
-            std::getline (fp, ligne);
-        } while (ligne.size() == 0);
-
-        std::stringstream oss(ligne);
-
-        float x,y,z;
-        oss >> x;
-        oss >> y;
-        oss >> z;
-        // on peut ajouter ici la lecture de couleur si elle existe
-        VEC3 pos(x,y,z);
-
-        unsigned int id = container.insertLine();
-        positions[id] = pos;
-
-        verticesID.push_back(id);
+    for (unsigned int i = 0; i < m_nbVertices; ++i)
+        verticesID.push_back(container.insertLine());
+
+    // cut the remaining of the file in chunks of lines
+    const unsigned int nbth = Parallel::NumberOfThreads;
+    const unsigned int nbChunks = nbTextChunks(e - p, nbth);
+    std::vector<const char*> bounds;
+    splitLines(p, e, nbChunks, bounds);
+
+    // count the non empty lines of each chunk to get the index of their first line
+    std::vector<unsigned int> firstLine(nbChunks + 1, 0);
+    parallelChunks(nbChunks, nbth, [&] (unsigned int c)
+    {
+        unsigned int nb = 0;
+        for (const char* q = bounds[c]; q != bounds[c+1]; q = nextLine(q, bounds[c+1]))
+            if (!emptyLine(q, bounds[c+1]))
+                ++nb;
+        firstLine[c+1] = nb;
+    });
+    for (unsigned int c = 0; c < nbChunks; ++c)
+        firstLine[c+1] += firstLine[c];
+
+    if (firstLine[nbChunks] < m_nbVertices + m_nbFaces)
+    {
+        CGoGNerr << "Problem reading off file: missing lines" << CGoGNendl;
+        return false;
     }
 
-    // lecture faces
-    // normalement nbVertices*8 devrait suffire largement
-    m_nbEdges.reserve(m_nbFaces);
-    m_emb.reserve(m_nbVertices*8);
-
-    for (unsigned int i = 0; i < m_nbFaces; ++i)
+    // lecture sommets (directly in the attribute) et faces (in tables of the chunks)
+    std::vector<std::vector<short> > chunkNbEdges(nbChunks);
+    std::vector<std::vector<unsigned int> > chunkEmb(nbChunks);
+    std::vector<char> chunkOk(nbChunks, 1);
+    parallelChunks(nbChunks, nbth, [&] (unsigned int c)
     {
-        do
+        const char* ce = bounds[c+1];
+        unsigned int line = firstLine[c];
+        for (const char* q = bounds[c]; (q != ce) && (line < m_nbVertices + m_nbFaces); q = nextLine(q, ce))
         {
-            std::getline (fp, ligne);
-        } while (ligne.size() == 0);
+            if (emptyLine(q, ce))
+                continue;
+            const char* r = q;
+            if (line < m_nbVertices)
+            {
+                double x, y, z;
+                if (!parseReal(r, ce, x) || !parseReal(r, ce, y) || !parseReal(r, ce, z))
+                    chunkOk[c] = 0;
+                // on peut ajouter ici la lecture de couleur si elle existe
+                positions[verticesID[line]] = VEC3(DATA_TYPE(x), DATA_TYPE(y), DATA_TYPE(z));
+            }
+            else
+            {
+                long n, index;
+                if (!parseInt(r, ce, n) || (n < 0))
+                    n = 0, chunkOk[c] = 0;
+                chunkNbEdges[c].push_back(short(n));
+                for (long j = 0; j < n; ++j)
+                {
+                    if (!parseInt(r, ce, index) || (index < 0) || (index >= long(m_nbVertices)))
+                        index = 0, chunkOk[c] = 0;
+                    chunkEmb[c].push_back(verticesID[index]);
+                }
+                // on peut ajouter ici la lecture de couleur si elle existe
+            }
+            ++line;
+        }
+    });
 
-        std::stringstream oss(ligne);
-        unsigned int n;
-        oss >> n;
-        m_nbEdges.push_back(n);
-        for (unsigned int j = 0; j < n; ++j)
+    for (unsigned int c = 0; c < nbChunks; ++c)
+    {
+        if (!chunkOk[c])
         {
-            int index; // index du plongement
-            oss >> index;
-            m_emb.push_back(verticesID[index]);
+            CGoGNerr << "Problem reading off file: wrong vertex or face" << CGoGNendl;
+            return false;
         }
-        // on peut ajouter ici la lecture de couleur si elle existe
     }
 
-    fp.close();
+    concatChunkTables(chunkNbEdges, chunkEmb, nbth);
     return true;
 }
 
@@ -381,6 +458,43 @@ bool MeshTablesSurface<PFP>::importVoxellisation(Algo::Surface::Modelisation::Vo
     return true;
 }
 
+template<typename PFP>
+bool MeshTablesSurface<PFP>::importTriangleChunks(VertexAttribute<VEC3, MAP>& positions, std::vector<std::vector<VEC3> >& vertices, std::vector<std::vector<unsigned int> >& triangles, std::vector<std::string>& attrNames, unsigned int nbth)
+{
+	attrNames.push_back(positions.name()) ;
+
+	AttributeContainer& container = m_map.template getAttributeContainer<VERTEX>();
+
+	std::vector<unsigned int> verticesID;
+	for (unsigned int c = 0; c < vertices.size(); ++c)
+	{
+		for (typename std::vector<VEC3>::const_iterator it = vertices[c].begin(); it != vertices[c].end(); ++it)
+		{
+			unsigned int id = container.insertLine();
+			positions[id] = *it;
+			verticesID.push_back(id);
+		}
+		std::vector<VEC3>().swap(vertices[c]);
+	}
+	m_nbVertices = uint32(verticesID.size());
+
+	const unsigned int nbChunks = uint32(triangles.size());
+	std::vector<std::vector<short> > nbEdges(nbChunks);
+	Algo::Import::parallelChunks(nbChunks, nbth, [&] (unsigned int c)
+	{
+		nbEdges[c].assign(triangles[c].size() / 3, 3);
+		for (std::vector<unsigned int>::iterator it = triangles[c].begin(); it != triangles[c].end(); ++it)
+			*it = verticesID[*it];
+	});
+
+	m_nbFaces = 0;
+	for (unsigned int c = 0; c < nbChunks; ++c)
+		m_nbFaces += uint32(nbEdges[c].size());
+
+	concatChunkTables(nbEdges, triangles, nbth);
+	return true;
+}
+
 template <typename PFP>
 template <typename PFP3>
 bool MeshTablesSurface<PFP>::import3DMap(typename PFP3::MAP& map, std::vector<std::string>& attrNames)
@@ -541,6 +655,8 @@ bool MeshTablesSurface<PFP>::importMeshBin(const std::string& filename, std::vec
 template <typename PFP>
 bool MeshTablesSurface<PFP>::importObj(const std::string& filename, std::vector<std::string>& attrNames)
 {
+	using namespace CGoGN::Algo::Import;
+
 	VertexAttribute<VEC3, MAP> positions =  m_map.template getAttribute<VEC3, VERTEX, MAP>("position") ;
 
     if (!positions.isValid())
@@ -550,115 +666,107 @@ bool MeshTablesSurface<PFP>::importObj(const std::string& filename, std::vector<
 
     AttributeContainer& container = m_map.template getAttributeContainer<VERTEX>() ;
 
-    // open file
-    std::ifstream fp(filename.c_str(), std::ios::binary);
-    if (!fp.good())
+    // map file
+    TextFile file;
+    if (!file.open(filename))
     {
         CGoGNerr << "Unable to open file " << filename << CGoGNendl;
         return false;
     }
 
-//	fp.seekg(0, std::ios::end);
-//	int ab = fp.tellg();
-//	fp.seekg(0, std::ios::beg);
-//	int ac = fp.tellg();
-
-    std::string ligne;
-    std::string tag;
-
-    do
-    {
-        fp >> tag;
-        std::getline (fp, ligne);
-    }while (tag != std::string("v"));
-
-    // lecture des sommets
-    std::vector<unsigned int> verticesID;
-    verticesID.reserve(102400); // on tape large (400Ko wahouuuuu !!)
+    const unsigned int nbth = CGoGN::Parallel::NumberOfThreads;
+    const unsigned int nbChunks = nbTextChunks(file.end() - file.begin(), nbth);
+    std::vector<const char*> bounds;
+    splitLines(file.begin(), file.end(), nbChunks, bounds);
 
-    unsigned int i = 0;
-    do
+    // tag of the line starting at q: 'v' (vertex), 'f' (face) or 0
+    auto lineTag = [] (const char*& q, const char* e) -> char
     {
-        if (tag == std::string("v"))
+        skipSpaces(q, e);
+        if ((e - q >= 2) && ((q[0] == 'v') || (q[0] == 'f')) && ((q[1] == ' ') || (q[1] == '\t')))
         {
-            std::stringstream oss(ligne);
-
-            float x,y,z;
-            oss >> x;
-            oss >> y;
-            oss >> z;
-
-            VEC3 pos(x,y,z);
-
-            unsigned int id = container.insertLine();
-            positions[id] = pos;
-
-            verticesID.push_back(id);
-            i++;
+            q += 2;
+            return q[-2];
         }
+        return 0;
+    };
 
-        fp >> tag;
-        std::getline(fp, ligne);
-    } while (!fp.eof());
-
-    m_nbVertices = uint32(verticesID.size());
-
-    // close/clear/open only way to go back to beginning of file
-    fp.close();
-    fp.clear();
-    fp.open(filename.c_str());
-
-    do
+    // count the vertices of each chunk to get the index of their first vertex
+    std::vector<unsigned int> firstVertex(nbChunks + 1, 0);
+    parallelChunks(nbChunks, nbth, [&] (unsigned int c)
     {
-        fp >> tag;
-        std::getline (fp, ligne);
-    } while (tag != std::string("f"));
+        unsigned int nb = 0;
+        for (const char* q = bounds[c]; q != bounds[c+1]; q = nextLine(q, bounds[c+1]))
+        {
+            const char* r = q;
+            if (lineTag(r, bounds[c+1]) == 'v')
+                ++nb;
+        }
+        firstVertex[c+1] = nb;
+    });
+    for (unsigned int c = 0; c < nbChunks; ++c)
+        firstVertex[c+1] += firstVertex[c];
 
-    m_nbEdges.reserve(verticesID.size()*2);
-    m_emb.reserve(verticesID.size()*8);
+    m_nbVertices = firstVertex[nbChunks];
+    std::vector<unsigned int> verticesID;
+    verticesID.reserve(m_nbVertices);
+    for (unsigned int i = 0; i < m_nbVertices; ++i)
+        verticesID.push_back(container.insertLine());
 
-    std::vector<int> table;
-    table.reserve(64); // NBV cotes pour une face devrait suffire
-    m_nbFaces = 0;
-    do
+    // lecture des sommets (directly in the attribute) et des faces (in tables of the chunks)
+    std::vector<std::vector<short> > chunkNbEdges(nbChunks);
+    std::vector<std::vector<unsigned int> > chunkEmb(nbChunks);
+    std::vector<char> chunkOk(nbChunks, 1);
+    parallelChunks(nbChunks, nbth, [&] (unsigned int c)
     {
-        if (tag == std::string("f")) // lecture d'une face
+        const char* ce = bounds[c+1];
+        unsigned int nbv = firstVertex[c]; // number of vertices read before the current line
+        for (const char* q = bounds[c]; q != ce; q = nextLine(q, ce))
         {
-            std::stringstream oss(ligne);
-            table.clear();
-            while (!oss.eof())  // lecture de tous les indices
+            const char* r = q;
+            char tag = lineTag(r, ce);
+            if (tag == 'v')
             {
-                std::string str;
-                oss >> str;
-
-                unsigned int ind = 0;
-
-                while ((ind<str.length()) && (str[ind]!='/'))
-                    ind++;
-
-                if (ind > 0)
+                double x, y, z;
+                if (!parseReal(r, ce, x) || !parseReal(r, ce, y) || !parseReal(r, ce, z))
+                    chunkOk[c] = 0;
+                positions[verticesID[nbv++]] = VEC3(DATA_TYPE(x), DATA_TYPE(y), DATA_TYPE(z));
+            }
+            else if (tag == 'f')
+            {
+                short n = 0;
+                long index;
+                // indices v, v/vt, v//vn or v/vt/vn: only v is used
+                while (parseInt(r, ce, index))
                 {
-                    long index;
-                    std::stringstream iss(str.substr(0, ind));
-                    iss >> index;
-                    table.push_back(index);
+                    // les index commencent a 1 (boufonnerie d'obj ;), negative index are relative
+                    index = (index < 0) ? long(nbv) + index : index - 1;
+                    if ((index < 0) || (index >= long(m_nbVertices)))
+                    {
+                        chunkOk[c] = 0;
+                        index = 0;
+                    }
+                    chunkEmb[c].push_back(verticesID[index]);
+                    ++n;
+                    skipToken(r, ce);
                 }
+                chunkNbEdges[c].push_back(n);
             }
+        }
+    });
 
-            unsigned int n = uint32(table.size());
-            m_nbEdges.push_back(short(n));
-            for (unsigned int j = 0; j < n; ++j)
-            {
-                int index = table[j] - 1; // les index commencent a 1 (boufonnerie d'obj ;)
-                m_emb.push_back(verticesID[index]);
-            }
-            m_nbFaces++;
+    for (unsigned int c = 0; c < nbChunks; ++c)
+    {
+        if (!chunkOk[c])
+        {
+            CGoGNerr << "Problem reading obj file: wrong vertex or face" << CGoGNendl;
+            return false;
         }
-        fp >> tag;
-        std::getline(fp, ligne);
-     } while (!fp.eof());
+    }
+
+    concatChunkTables(chunkNbEdges, chunkEmb, nbth);
+    m_nbFaces = uint32(m_nbEdges.size());
 
-    fp.close ();
     return true;
 }
 
@@ -1578,72 +1686,8 @@ bool MeshTablesSurface<PFP>::importASSIMP(const std::string& filename, std::vect
 template<typename PFP>
 bool MeshTablesSurface<PFP>::mergeCloseVertices()
 {
-    const int NBV = 64; // seems to be good
-
-    const int NEIGH[27] = {
-    -NBV*NBV - NBV - 1, 	-NBV*NBV - NBV, 	-NBV*NBV - NBV + 1,
-    -NBV*NBV - 1, 	-NBV*NBV, 	-NBV*NBV + 1,
-    -NBV*NBV + NBV - 1,	-NBV*NBV + NBV,	- NBV*NBV + NBV + 1,
-    -NBV - 1,	- NBV,	-NBV + 1,
-    -1,	0,	1,
-    NBV - 1,	NBV,	NBV + 1,
-    NBV*NBV - NBV - 1,	NBV*NBV - NBV,	NBV*NBV - NBV + 1,
-    NBV*NBV - 1,	NBV*NBV,	NBV*NBV + 1,
-    NBV*NBV + NBV - 1,	NBV*NBV + NBV,	NBV*NBV + NBV + 1};
-
-    std::vector<unsigned int>** grid;
-    grid = new std::vector<unsigned int>*[NBV*NBV*NBV];
-
-    // init grid with null ptrs
-    for (unsigned int i=0; i<NBV*NBV*NBV; ++i)
-        grid[i] = NULL;
-
 	VertexAttribute<VEC3, MAP> positions = m_map.template getAttribute<VEC3, VERTEX, MAP>("position");
 
-    // compute BB
-    Geom::BoundingBox<typename PFP::VEC3> bb(positions[ positions.begin() ]) ;
-    for (unsigned int i = positions.begin(); i != positions.end(); positions.next(i))
-    {
-        bb.addPoint(positions[i]) ;
-    }
-
-    // add one voxel around to avoid testing
-    typename PFP::VEC3 bbsize = (bb.max() - bb.min());
-    typename PFP::VEC3 one = bbsize/(NBV-2);
-    one*= 1.001f;
-    bb.addPoint( bb.min() - one);
-    bb.addPoint( bb.max() + one);
-    bbsize = (bb.max() - bb.min());
-
-	VertexAutoAttribute<unsigned int, MAP> gridIndex(m_map, "gridIndex");
-	VertexAutoAttribute<unsigned int, MAP> newIndices(m_map, "newIndices");
-
-    // Store each vertex in the grid and store voxel index in vertex attribute
-    for (unsigned int i = positions.begin(); i != positions.end(); positions.next(i))
-    {
-        typename PFP::VEC3 P = positions[i];
-        P -= bb.min();
-		typename PFP::REAL pz = floor((P[2] / bbsize[2])*NBV);
-		typename PFP::REAL py = floor((P[1] / bbsize[1])*NBV);
-		typename PFP::REAL px = floor((P[0] / bbsize[0])*NBV);
-
-        unsigned int index = uint32(NBV*NBV*pz + NBV*py + px);
-
-        if (pz==63)
-            std::cout << "z 63 bb:"<<bb<<"  P="<<positions[i]<< std::endl;
-
-        std::vector<unsigned int>* vox = grid[index];
-        if (vox==NULL)
-        {
-            grid[index] = new std::vector<unsigned int>();
-            grid[index]->reserve(8);
-            vox = grid[index];
-        }
-        vox->push_back(i);
-        gridIndex[i] = index;
-        newIndices[i] = 0xffffffff;
-    }
-
     // compute EPSILON: average length of 50 of 100 first edges of faces divide by 10000 (very very closed)
     unsigned int nbf = 100;
     if (nbf> m_nbFaces)
@@ -1661,35 +1705,37 @@ bool MeshTablesSurface<PFP>::mergeCloseVertices()
 
 	typename PFP::REAL epsilon = typename PFP::REAL(d / 10000.0);
 
+	// grid of cells of size epsilon: close vertices are in neighboring cells
+	Geom::PointGrid<typename PFP::VEC3> grid(epsilon);
+	grid.reserve(m_nbVertices);
+
+	VertexAutoAttribute<unsigned int, MAP> newIndices(m_map, "newIndices");
 
-    // traverse vertices
+    for (unsigned int i = positions.begin(); i != positions.end(); positions.next(i))
+    {
+        grid.addPoint(positions[i], i);
+        newIndices[i] = 0xffffffff;
+    }
+    grid.build();
+
+    // traverse vertices: a vertex that is not merged gets the next close ones
     for (unsigned int i = positions.begin(); i != positions.end(); positions.next(i))
     {
         if (newIndices[i] == 0xffffffff)
         {
             const typename PFP::VEC3& P = positions[i];
 
-            for (unsigned int n=0; n<27; ++n)
+            grid.foreach_neighbor(P, [&] (unsigned int v)
             {
-                std::vector<unsigned int>* voxel = grid[gridIndex[i]+NEIGH[n]];
-                if (voxel != NULL)
+                if ((v > i) && (newIndices[v] == 0xffffffff))
                 {
-                    for (std::vector<unsigned int>::iterator v = voxel->begin(); v != voxel->end(); ++v)
-                    {
-                        if ((*v != i) && (*v != 0xffffffff))
-                        {
-                            typename PFP::VEC3 Q = positions[*v];
-                            Q -= P;
-                            typename PFP::REAL d2 = Q*Q;
-                            if (d2 < epsilon*epsilon)
-                            {
-                                newIndices[*v] = i;
-                                *v = 0xffffffff;
-                            }
-                        }
-                    }
+                    typename PFP::VEC3 Q = positions[v];
+                    Q -= P;
+                    typename PFP::REAL d2 = Q*Q;
+                    if (d2 < epsilon*epsilon)
+                        newIndices[v] = i;
                 }
-            }
+            });
         }
     }
 
@@ -1713,13 +1759,6 @@ bool MeshTablesSurface<PFP>::mergeCloseVertices()
         }
     }
 
-    // release grid memory
-    for (unsigned int i=0; i<NBV*NBV*NBV; ++i)
-        if (grid[i]!=NULL)
-            delete grid[i];
-
-    delete[] grid;
-
     return true;
 }
 
@@ -1728,6 +1767,8 @@ bool MeshTablesSurface<PFP>::mergeCloseVertices()
 template<typename PFP>
 bool MeshTablesSurface<PFP>::importSTLAscii(const std::string& filename, std::vector<std::string>& attrNames)
 {
+	using namespace CGoGN::Algo::Import;
+
 	VertexAttribute<VEC3, MAP> positions =  m_map.template getAttribute<VEC3, VERTEX, MAP>("position") ;
 
     if (!positions.isValid())
@@ -1737,82 +1778,123 @@ bool MeshTablesSurface<PFP>::importSTLAscii(const std::string& filename, std::ve
 
     AttributeContainer& container = m_map.template getAttributeContainer<VERTEX>() ;
 
-    // open file
-    std::ifstream fp(filename.c_str(), std::ios::in);
-    if (!fp.good())
+    // map file
+    TextFile file;
+    if (!file.open(filename))
     {
         CGoGNerr << "Unable to open file " << filename << CGoGNendl;
         return false;
     }
 
+    const unsigned int nbth = CGoGN::Parallel::NumberOfThreads;
+    const unsigned int nbChunks = nbTextChunks(file.end() - file.begin(), nbth);
+    std::vector<const char*> bounds;
+    splitLines(file.begin(), file.end(), nbChunks, bounds);
 
-    std::vector<unsigned int> verticesID;
-    verticesID.reserve(1000);
-    std::vector<VEC3> m_points;
-
-    m_nbFaces = 0;
-    m_nbVertices = 0;
-
-    m_nbEdges.reserve(1000);
-    m_emb.reserve(3000);
-
-    std::string ligne;
-    std::string tag;
-
-    do
+    // is the line starting at q a "vertex x y z" line
+    auto vertexLine = [] (const char*& q, const char* e) -> bool
     {
-        fp >> tag;
-        std::getline (fp, ligne);
-    }while (tag != std::string("vertex"));
+        skipSpaces(q, e);
+        if ((e - q >= 7) && (strncmp(q, "vertex", 6) == 0) && ((q[6] == ' ') || (q[6] == '\t')))
+        {
+            q += 7;
+            return true;
+        }
+        return false;
+    };
 
-    do
+    // count the vertex lines of each chunk
+    std::vector<unsigned int> firstPoint(nbChunks + 1, 0);
+    parallelChunks(nbChunks, nbth, [&] (unsigned int c)
     {
-        for (int i=0; i<3; ++i)
+        unsigned int nb = 0;
+        for (const char* q = bounds[c]; q != bounds[c+1]; q = nextLine(q, bounds[c+1]))
         {
-            std::stringstream oss(ligne);
-            float x,y,z;
-            oss >> x;
-            oss >> y;
-            oss >> z;
-
-            VEC3 pos(x,y,z);
-
-            typename std::vector<VEC3>::iterator it = find (m_points.begin(), m_points.end(), pos);
-            if (it != m_points.end())
-            {
-                unsigned int idP = uint32(it - m_points.begin());
-                m_emb.push_back(verticesID[idP]);
-            }
-            else
+            const char* r = q;
+            if (vertexLine(r, bounds[c+1]))
+                ++nb;
+        }
+        firstPoint[c+1] = nb;
+    });
+    for (unsigned int c = 0; c < nbChunks; ++c)
+        firstPoint[c+1] += firstPoint[c];
+
+    // read the points of the triangles
+    const unsigned int nbPoints = firstPoint[nbChunks] / 3 * 3;
+    std::vector<VEC3> points(nbPoints);
+    std::vector<char> chunkOk(nbChunks, 1);
+    parallelChunks(nbChunks, nbth, [&] (unsigned int c)
+    {
+        unsigned int i = firstPoint[c];
+        for (const char* q = bounds[c]; (q != bounds[c+1]) && (i < nbPoints); q = nextLine(q, bounds[c+1]))
+        {
+            const char* r = q;
+            if (vertexLine(r, bounds[c+1]))
             {
-                unsigned int id = container.insertLine();
-                positions[id] = pos;
-                verticesID.push_back(id);
-                m_points.push_back(pos);
-                m_emb.push_back(id);
+                double x, y, z;
+                if (!parseReal(r, bounds[c+1], x) || !parseReal(r, bounds[c+1], y) || !parseReal(r, bounds[c+1], z))
+                    chunkOk[c] = 0;
+                points[i++] = VEC3(DATA_TYPE(x), DATA_TYPE(y), DATA_TYPE(z));
             }
-            fp >> tag;
-            std::getline (fp, ligne);
         }
-        m_nbEdges.push_back(3);
+    });
 
-        do
+    for (unsigned int c = 0; c < nbChunks; ++c)
+    {
+        if (!chunkOk[c])
         {
-            fp >> tag;
-            std::getline (fp, ligne);
-        }while (!fp.eof() && (tag != std::string("vertex")));
+            CGoGNerr << "Problem reading stl file: wrong vertex" << CGoGNendl;
+            return false;
+        }
+    }
 
-    }while (!fp.eof());
+    // identical points are the same vertex: sort to find them,
+    // vertices are created in the order of their first occurrence
+    std::vector<unsigned int> order(nbPoints);
+    for (unsigned int i = 0; i < nbPoints; ++i)
+        order[i] = i;
+    std::sort(order.begin(), order.end(), [&] (unsigned int a, unsigned int b)
+    {
+        const VEC3& pa = points[a];
+        const VEC3& pb = points[b];
+        if (pa[0] != pb[0]) return pa[0] < pb[0];
+        if (pa[1] != pb[1]) return pa[1] < pb[1];
+        if (pa[2] != pb[2]) return pa[2] < pb[2];
+        return a < b;
+    });
+
+    std::vector<unsigned int> first(nbPoints);
+    for (unsigned int i = 0; i < nbPoints; ++i)
+    {
+        if ((i > 0) && (points[order[i]] == points[order[i-1]]))
+            first[order[i]] = first[order[i-1]];
+        else
+            first[order[i]] = order[i];
+    }
+
+    m_nbEdges.reserve(m_nbEdges.size() + nbPoints / 3);
+    m_emb.reserve(m_emb.size() + nbPoints);
+    std::vector<unsigned int> verticesID(nbPoints);
+    m_nbVertices = 0;
+    for (unsigned int i = 0; i < nbPoints; ++i)
+    {
+        if (first[i] == i)
+        {
+            unsigned int id = container.insertLine();
+            positions[id] = points[i];
+            verticesID[i] = id;
+            ++m_nbVertices;
+        }
+        m_emb.push_back(verticesID[first[i]]);
+        if (i % 3 == 2)
+            m_nbEdges.push_back(3);
+    }
 
-    m_nbVertices = uint32(m_points.size());
     m_nbFaces = uint32(m_nbEdges.size());
 
-    fp.close();
     return true;
 }
 
-
-
 template<typename PFP>
 bool MeshTablesSurface<PFP>::importSTLBin(const std::string& filename, std::vector<std::string>& attrNames)
 {
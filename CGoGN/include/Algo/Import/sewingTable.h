@@ -0,0 +1,99 @@
+/*******************************************************************************
+ * CGoGN: Combinatorial and Geometric modeling with Generic N-dimensional Maps  *
+ * version 0.1                                                                  *
+ * Copyright (C) 2009-2012, IGG Team, LSIIT, University of Strasbourg           *
+ *                                                                              *
+ * This library is free software; you can redistribute it and/or modify it      *
+ * under the terms of the GNU Lesser General Public License as published by the *
+ * Free Software Foundation; either version 2.1 of the License, or (at your     *
+ * option) any later version.                                                   *
+ *                                                                              *
+ * This library is distributed in the hope that it will be useful, but WITHOUT  *
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or        *
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License  *
+ * for more details.                                                            *
+ *                                                                              *
+ * You should have received a copy of the GNU Lesser General Public License     *
+ * along with this library; if not, write to the Free Software Foundation,      *
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301 USA.           *
+ *                                                                              *
+ * Web site: http://cgogn.unistra.fr/                                           *
+ * Contact information: cgogn@unistra.fr                                        *
+ *                                                                              *
+ *******************************************************************************/
+
+
+#ifndef __SEWING_TABLE_H__
+#define __SEWING_TABLE_H__
+
+#include <vector>
+#include "Topology/generic/dart.h"
+
+namespace CGoGN
+{
+
+namespace Algo
+{
+
+namespace Import
+{
+
+/*
+ * Flat table of the darts created by an import, grouped by the (undirected) edge
+ * they belong to. It replaces the per vertex vectors of incident darts used to
+ * find the dart to sew with: the darts are bucketed by the smallest vertex of their
+ * edge (counting sort, one buffer), then sorted by the other vertex in each bucket.
+ * The darts of an edge are contiguous and stay in their order of insertion.
+ */
+class SewingTable
+{
+protected:
+	struct Entry
+	{
+		unsigned int other;
+		Dart dart;
+	};
+
+	std::vector<unsigned int> m_offsets;
+	std::vector<Entry> m_entries;
+
+public:
+	/**
+	 * fill the table
+	 * @param darts the darts in their order of insertion
+	 * @param edgeOf function (Dart, unsigned int& a, unsigned int& b) giving the vertices
+	 * of the edge of a dart, called twice for each dart by the calling thread
+	 * (only the sort of the buckets is parallel)
+	 * @param nbVertices vertex embeddings are in [0,nbVertices)
+	 * @param nbth number of threads
+	 */
+	template <typename EDGEFUNC>
+	void build(const std::vector<Dart>& darts, EDGEFUNC edgeOf, unsigned int nbVertices, unsigned int nbth);
+
+	unsigned int nbBuckets() const { return (unsigned int)(m_offsets.size()) - 1; }
+
+	// entries of the edges whose smallest vertex is v
+	unsigned int bucketBegin(unsigned int v) const { return m_offsets[v]; }
+
+	unsigned int bucketEnd(unsigned int v) const { return m_offsets[v + 1]; }
+
+	// entry following the group of entry i (darts of the same edge) in a bucket ending at end
+	unsigned int groupEnd(unsigned int i, unsigned int end) const;
+
+	// entries [first,last) of the darts of the edge of vertices a and b
+	void edgeDarts(unsigned int a, unsigned int b, unsigned int& first, unsigned int& last) const;
+
+	Dart dart(unsigned int i) const { return m_entries[i].dart; }
+
+	void clear();
+};
+
+} // namespace Import
+
+} // namespace Algo
+
+} // namespace CGoGN
+
+#include "Algo/Import/sewingTable.hpp"
+
+#endif
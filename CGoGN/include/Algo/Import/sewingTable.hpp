@@ -0,0 +1,131 @@
+/*******************************************************************************
+ * CGoGN: Combinatorial and Geometric modeling with Generic N-dimensional Maps  *
+ * version 0.1                                                                  *
+ * Copyright (C) 2009-2012, IGG Team, LSIIT, University of Strasbourg           *
+ *                                                                              *
+ * This library is free software; you can redistribute it and/or modify it      *
+ * under the terms of the GNU Lesser General Public License as published by the *
+ * Free Software Foundation; either version 2.1 of the License, or (at your     *
+ * option) any later version.                                                   *
+ *                                                                              *
+ * This library is distributed in the hope that it will be useful, but WITHOUT  *
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or        *
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License  *
+ * for more details.                                                            *
+ *                                                                              *
+ * You should have received a copy of the GNU Lesser General Public License     *
+ * along with this library; if not, write to the Free Software Foundation,      *
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301 USA.           *
+ *                                                                              *
+ * Web site: http://cgogn.unistra.fr/                                           *
+ * Contact information: cgogn@unistra.fr                                        *
+ *                                                                              *
+ *******************************************************************************/
+
+
+#include <algorithm>
+#include "Utils/threadPool.h"
+
+namespace CGoGN
+{
+
+namespace Algo
+{
+
+namespace Import
+{
+
+template <typename EDGEFUNC>
+void SewingTable::build(const std::vector<Dart>& darts, EDGEFUNC edgeOf, unsigned int nbVertices, unsigned int nbth)
+{
+	unsigned int nb = (unsigned int)(darts.size());
+
+	// counting sort on the smallest vertex (stable: keeps the order of insertion)
+	m_offsets.assign(nbVertices + 1, 0);
+	for (unsigned int i = 0; i < nb; ++i)
+	{
+		unsigned int a, b;
+		edgeOf(darts[i], a, b);
+		++m_offsets[std::min(a, b)];
+	}
+	unsigned int sum = 0;
+	for (unsigned int v = 0; v <= nbVertices; ++v)
+	{
+		unsigned int c = m_offsets[v];
+		m_offsets[v] = sum;
+		sum += c;
+	}
+
+	m_entries.resize(nb);
+	std::vector<unsigned int> cursor(m_offsets);
+	for (unsigned int i = 0; i < nb; ++i)
+	{
+		unsigned int a, b;
+		edgeOf(darts[i], a, b);
+		Entry& en = m_entries[cursor[std::min(a, b)]++];
+		en.other = std::max(a, b);
+		en.dart = darts[i];
+	}
+	std::vector<unsigned int>().swap(cursor);
+
+	// stable sort of the (small) buckets by other vertex, in parallel
+	auto sortBuckets = [&] (unsigned int first, unsigned int last, unsigned int)
+	{
+		for (unsigned int v = first; v < last; ++v)
+		{
+			std::vector<Entry>::iterator b = m_entries.begin() + m_offsets[v];
+			std::vector<Entry>::iterator e = m_entries.begin() + m_offsets[v + 1];
+			if (e - b > 16)
+			{
+				std::stable_sort(b, e, [] (const Entry& x, const Entry& y) { return x.other < y.other; });
+				continue;
+			}
+			for (std::vector<Entry>::iterator it = b; ++it < e; )
+			{
+				Entry en = *it;
+				std::vector<Entry>::iterator jt = it;
+				for (; jt != b && en.other < (jt - 1)->other; --jt)
+					*jt = *(jt - 1);
+				*jt = en;
+			}
+		}
+	};
+
+	if (nbth > 1)
+		Utils::ThreadPool::shared(nbth - 1).parallelFor(nbVertices, 4096, sortBuckets);
+	else
+		sortBuckets(0, nbVertices, 0);
+}
+
+inline unsigned int SewingTable::groupEnd(unsigned int i, unsigned int end) const
+{
+	unsigned int other = m_entries[i].other;
+	while ((i < end) && (m_entries[i].other == other))
+		++i;
+	return i;
+}
+
+inline void SewingTable::edgeDarts(unsigned int a, unsigned int b, unsigned int& first, unsigned int& last) const
+{
+	unsigned int v = std::min(a, b);
+	unsigned int other = std::max(a, b);
+	unsigned int end = m_offsets[v + 1];
+	first = m_offsets[v];
+	while ((first < end) && (m_entries[first].other < other))
+		++first;
+	last = first;
+	while ((last < end) && (m_entries[last].other == other))
+		++last;
+}
+
+inline void SewingTable::clear()
+{
+	std::vector<unsigned int>().swap(m_offsets);
+	std::vector<Entry>().swap(m_entries);
+}
+
+} // namespace Import
+
+} // namespace Algo
+
+} // namespace CGoGN
@@ -0,0 +1,352 @@
+/*******************************************************************************
+ * CGoGN: Combinatorial and Geometric modeling with Generic N-dimensional Maps  *
+ * version 0.1                                                                  *
+ * Copyright (C) 2009-2012, IGG Team, LSIIT, University of Strasbourg           *
+ *                                                                              *
+ * This library is free software; you can redistribute it and/or modify it      *
+ * under the terms of the GNU Lesser General Public License as published by the *
+ * Free Software Foundation; either version 2.1 of the License, or (at your     *
+ * option) any later version.                                                   *
+ *                                                                              *
+ * This library is distributed in the hope that it will be useful, but WITHOUT  *
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or        *
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License  *
+ * for more details.                                                            *
+ *                                                                              *
+ * You should have received a copy of the GNU Lesser General Public License     *
+ * along with this library; if not, write to the Free Software Foundation,      *
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301 USA.           *
+ *                                                                              *
+ * Web site: http://cgogn.unistra.fr/                                           *
+ * Contact information: cgogn@unistra.fr                                        *
+ *                                                                              *
+ *******************************************************************************/
+
+
+#ifndef _TEXT_PARSER_H
+#define _TEXT_PARSER_H
+
+#include <vector>
+#include <string>
+#include <cstring>
+#include <cstdlib>
+#include <cmath>
+#include <fstream>
+
+#include "Utils/mappedFile.h"
+#include "Utils/threadPool.h"
+
+namespace CGoGN
+{
+
+namespace Algo
+{
+
+namespace Import
+{
+
+/**
+* Fast parsing of ASCII mesh files: the file is mapped in memory (or read in
+* a buffer when mapping is not available), cut in chunks at line boundaries
+* and the chunks are parsed in parallel with allocation-free number parsers
+* (no stream, no per-line string).
+* Parsing functions skip the leading blanks of the current line (not the
+* end of line) and move the pointer after the parsed token.
+*/
+class TextFile
+{
+protected:
+	Utils::MappedFile* m_file;
+	// content of the file when it cannot be mapped
+	std::vector<char> m_buffer;
+
+public:
+	TextFile(): m_file(NULL) {}
+
+	~TextFile() { close(); }
+
+	bool open(const std::string& filename)
+	{
+		close();
+		m_file = Utils::MappedFile::open(filename, true);
+		if (m_file != NULL)
+			return true;
+
+		std::ifstream in(filename.c_str(), std::ios::in | std::ios::binary);
+		if (!in.good())
+			return false;
+		in.seekg(0, std::ios::end);
+		std::streamoff size = in.tellg();
+		if (size <= 0)
+			return false;
+		in.seekg(0, std::ios::beg);
+		m_buffer.resize(std::size_t(size));
+		in.read(&m_buffer[0], size);
+		if (in.gcount() != size)
+		{
+			m_buffer.clear();
+			return false;
+		}
+		return true;
+	}
+
+	void close()
+	{
+		if (m_file != NULL)
+			m_file->unref();
+		m_file = NULL;
+		std::vector<char>().swap(m_buffer);
+	}
+
+	inline const char* begin() const { return (m_file != NULL) ? m_file->data() : m_buffer.data(); }
+
+	inline const char* end() const { return (m_file != NULL) ? m_file->data() + m_file->size() : m_buffer.data() + m_buffer.size(); }
+};
+
+/**
+* skip spaces and tabs (and \r)
+*/
+inline void skipSpaces(const char*& p, const char* e)
+{
+	while ((p != e) && ((*p == ' ') || (*p == '\t') || (*p == '\r')))
+		++p;
+}
+
+/**
+* skip all the blanks including end of lines (for token based formats)
+*/
+inline void skipBlanks(const char*& p, const char* e)
+{
+	while ((p != e) && ((*p == ' ') || (*p == '\t') || (*p == '\r') || (*p == '\n')))
+		++p;
+}
+
+/**
+* skip the current token (until a blank)
+*/
+inline void skipToken(const char*& p, const char* e)
+{
+	while ((p != e) && (*p != ' ') && (*p != '\t') && (*p != '\r') && (*p != '\n'))
+		++p;
+}
+
+/**
+* @return the beginning of the next line (e if none)
+*/
+inline const char* nextLine(const char* p, const char* e)
+{
+	const char* n = static_cast<const char*>(memchr(p, '\n', e - p));
+	return (n == NULL) ? e : n + 1;
+}
+
+/**
+* is the line starting at p empty (only blanks or a # comment)
+*/
+inline bool emptyLine(const char* p, const char* e)
+{
+	skipSpaces(p, e);
+	return (p == e) || (*p == '\n') || (*p == '#');
+}
+
+/**
+* parse an integer
+*/
+inline bool parseInt(const char*& p, const char* e, long& v)
+{
+	skipSpaces(p, e);
+	bool neg = false;
+	if ((p != e) && ((*p == '-') || (*p == '+')))
+		neg = (*p++ == '-');
+	if ((p == e) || (*p < '0') || (*p > '9'))
+		return false;
+	long r = 0;
+	while ((p != e) && (*p >= '0') && (*p <= '9'))
+		r = 10 * r + (*p++ - '0');
+	v = neg ? -r : r;
+	return true;
+}
+
+/**
+* parse a real number (decimal or scientific notation, nan/inf through strtod)
+* the token must end with a blank or the end of the text
+*/
+inline bool parseReal(const char*& p, const char* e, double& v)
+{
+	static const double pow10[23] = {
+		1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+		1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+	};
+
+	skipSpaces(p, e);
+	const char* start = p;
+	bool neg = false;
+	if ((p != e) && ((*p == '-') || (*p == '+')))
+		neg = (*p++ == '-');
+
+	// mantissa on 19 significant digits, the others only shift the exponent
+	unsigned long long m = 0;
+	int nbDigits = 0;
+	int exp10 = 0;
+	bool digits = false;
+	bool truncated = false;
+	while ((p != e) && (*p >= '0') && (*p <= '9'))
+	{
+		digits = true;
+		if (nbDigits < 19)
+		{
+			m = 10 * m + (*p - '0');
+			if (m != 0)
+				++nbDigits;
+		}
+		else
+		{
+			truncated = truncated || (*p != '0');
+			++exp10;
+		}
+		++p;
+	}
+	if ((p != e) && (*p == '.'))
+	{
+		++p;
+		while ((p != e) && (*p >= '0') && (*p <= '9'))
+		{
+			digits = true;
+			if (nbDigits < 19)
+			{
+				m = 10 * m + (*p - '0');
+				if (m != 0)
+					++nbDigits;
+				--exp10;
+			}
+			else
+				truncated = truncated || (*p != '0');
+			++p;
+		}
+	}
+
+	if (digits && (p != e) && ((*p == 'e') || (*p == 'E')))
+	{
+		// the exponent must follow immediately: optional sign and at least one digit
+		++p;
+		bool negExp = false;
+		if ((p != e) && ((*p == '-') || (*p == '+')))
+			negExp = (*p++ == '-');
+		if ((p == e) || (*p < '0') || (*p > '9'))
+		{
+			p = start;
+			return false;
+		}
+		int x = 0;
+		while ((p != e) && (*p >= '0') && (*p <= '9'))
+		{
+			if (x < 100000)
+				x = 10 * x + (*p - '0');
+			++p;
+		}
+		exp10 += negExp ? -x : x;
+	}
+
+	const bool endOfToken = (p == e) || (*p == ' ') || (*p == '\t') || (*p == '\r') || (*p == '\n');
+
+	// exact mantissa and power of ten: one rounding, the result is correctly rounded
+	if (digits && endOfToken && !truncated && (m <= (1ull << 53)) && (exp10 >= -22) && (exp10 <= 22))
+	{
+		double r = double(m);
+		if (exp10 < 0)
+			r /= pow10[-exp10];
+		else
+			r *= pow10[exp10];
+		v = neg ? -r : r;
+		return true;
+	}
+
+	// nan, inf, long mantissas, large exponents or garbage: let the C library decide on a copy of the token
+	p = start;
+	skipToken(p, e);
+	std::size_t n = p - start;
+	char buffer[64];
+	std::string str;
+	const char* token = buffer;
+	if (n < 64)
+	{
+		memcpy(buffer, start, n);
+		buffer[n] = '\0';
+	}
+	else
+	{
+		str.assign(start, n);
+		token = str.c_str();
+	}
+	char* endConv;
+	v = strtod(token, &endConv);
+	if ((n == 0) || (endConv != token + n))
+	{
+		p = start;
+		return false;
+	}
+	return true;
+}
+
+/**
+* number of chunks used to parse a text of given size with nbth threads
+*/
+inline unsigned int nbTextChunks(std::size_t size, unsigned int nbth)
+{
+	if (nbth <= 1)
+		return 1;
+	std::size_t nb = size >> 20; // at least 1MB per chunk
+	if (nb > 8 * nbth)
+		nb = 8 * nbth;
+	return (nb < 1) ? 1 : (unsigned int)(nb);
+}
+
+/**
+* cut [b,e) in nbChunks pieces at line boundaries
+* @param bounds (OUT) nbChunks+1 pointers, chunk i is [bounds[i],bounds[i+1])
+*/
+inline void splitLines(const char* b, const char* e, unsigned int nbChunks, std::vector<const char*>& bounds)
+{
+	bounds.clear();
+	bounds.reserve(nbChunks + 1);
+	bounds.push_back(b);
+	std::size_t size = e - b;
+	for (unsigned int i = 1; i < nbChunks; ++i)
+	{
+		const char* p = b + size * i / nbChunks;
+		if (p < bounds.back())
+			p = bounds.back();
+		else if ((p != b) && (*(p - 1) != '\n'))
+			p = nextLine(p, e);
+		bounds.push_back(p);
+	}
+	bounds.push_back(e);
+}
+
+/**
+* apply f(chunk) on each chunk, in parallel if nbth > 1
+*/
+template <typename FUNC>
+void parallelChunks(unsigned int nbChunks, unsigned int nbth, FUNC f)
+{
+	if ((nbth <= 1) || (nbChunks <= 1))
+	{
+		for (unsigned int i = 0; i < nbChunks; ++i)
+			f(i);
+		return;
+	}
+
+	Utils::ThreadPool& pool = Utils::ThreadPool::shared(nbth - 1);
+	pool.parallelFor(nbChunks, 1, [&] (unsigned int b, unsigned int e, unsigned int)
+	{
+		for (unsigned int i = b; i < e; ++i)
+			f(i);
+	});
+}
+
+} // namespace Import
+
+} // namespace Algo
+
+} // namespace CGoGN
+
+#endif
@@ -0,0 +1,185 @@
+/*******************************************************************************
+ * CGoGN: Combinatorial and Geometric modeling with Generic N-dimensional Maps  *
+ * version 0.1                                                                  *
+ * Copyright (C) 2009-2012, IGG Team, LSIIT, University of Strasbourg           *
+ *                                                                              *
+ * This library is free software; you can redistribute it and/or modify it      *
+ * under the terms of the GNU Lesser General Public License as published by the *
+ * Free Software Foundation; either version 2.1 of the License, or (at your     *
+ * option) any later version.                                                   *
+ *                                                                              *
+ * This library is distributed in the hope that it will be useful, but WITHOUT  *
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or        *
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License  *
+ * for more details.                                                            *
+ *                                                                              *
+ * You should have received a copy of the GNU Lesser General Public License     *
+ * along with this library; if not, write to the Free Software Foundation,      *
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301 USA.           *
+ *                                                                              *
+ * Web site: http://cgogn.unistra.fr/                                           *
+ * Contact information: cgogn@unistra.fr                                        *
+ *                                                                              *
+ *******************************************************************************/
+
+#ifndef __LINEAR_SOLVING_LAPLACIAN_SOLVER__
+#define __LINEAR_SOLVING_LAPLACIAN_SOLVER__
+
+#include "Topology/generic/traversor/traversorCell.h"
+#include "Topology/generic/traversor/traversor2.h"
+#include "Topology/generic/cellmarker.h"
+#include "Utils/threadPool.h"
+
+#include "Eigen/Sparse"
+#include "Eigen/SparseCholesky"
+
+#include <vector>
+
+namespace CGoGN
+{
+
+namespace Algo
+{
+
+namespace LinearSolving
+{
+
+/**
+ * Least squares Laplacian system with a resident factorization
+ *
+ * Solves the system built by addRowsRHS_Laplacian_Topo / addRowsRHS_Laplacian_Cotan
+ * (one normalized Laplacian row per vertex, the non free vertices locked to their
+ * position) without OpenNL:
+ * - the rows are assembled once in CSR from the vertices of the map (in parallel),
+ * - the normal equations of the free vertices are factored (sparse LDLT) when the
+ *   constraints change,
+ * - each solve computes the 3 coordinates at once with sparse products and the
+ *   substitutions of the resident factorization.
+ */
+template <typename PFP>
+class LaplacianSolver
+{
+public:
+	typedef typename PFP::MAP MAP;
+	typedef typename PFP::REAL REAL;
+	typedef typename PFP::VEC3 VEC3;
+
+	typedef Eigen::SparseMatrix<double, Eigen::RowMajor> RowMatrix;
+	typedef Eigen::SparseMatrix<double> ColMatrix;
+	typedef Eigen::Matrix<double, Eigen::Dynamic, 3> Coords;
+
+protected:
+	MAP& m_map;
+
+	VertexAttribute<unsigned int, MAP> m_index;
+
+	unsigned int m_nbVertices;
+
+	unsigned int m_nbth;
+
+	/**
+	* normalized Laplacian rows (CSR, one row per vertex index)
+	*/
+	std::vector<unsigned int> m_rowBegin;
+	std::vector<unsigned int> m_columns;
+	std::vector<double> m_coeffs;
+
+	/**
+	* embedding of the vertex of each index
+	*/
+	std::vector<unsigned int> m_vertexEmb;
+
+	/**
+	* index of each vertex among the free variables (-1 for locked vertices)
+	*/
+	std::vector<int> m_freeIndex;
+
+	/**
+	* vertex index of each free variable
+	*/
+	std::vector<unsigned int> m_freeVertices;
+
+	/**
+	* transposed columns of the free variables (one row per free variable)
+	*/
+	RowMatrix m_freeColumnsT;
+
+	Eigen::SimplicialLDLT<ColMatrix> m_ldlt;
+
+	/**
+	* inverse of the diagonal of the factorization
+	*/
+	std::vector<double> m_invDiag;
+
+	bool m_factorized;
+
+	/**
+	* assemble the rows, weight(it) gives the weight of the edge of dart it in the row of its vertex
+	*/
+	template <typename WEIGHT>
+	void assemble(WEIGHT weight);
+
+	/**
+	* apply f(vertex) on each vertex, in parallel if m_nbth > 1
+	*/
+	template <typename FUNC>
+	void parallelVertices(FUNC f);
+
+	/**
+	* apply f(begin, end) on chunks of [0,nb), in parallel if m_nbth > 1
+	*/
+	template <typename FUNC>
+	void parallelRange(unsigned int nb, FUNC f);
+
+public:
+	/**
+	* @param map the map
+	* @param index index of the vertices (in [0,nbVertices), see Algo::Topo::computeIndexCells)
+	* @param nbVertices number of vertices
+	* @param nbth number of threads used for assembly and products
+	*/
+	LaplacianSolver(MAP& map, const VertexAttribute<unsigned int, MAP>& index, unsigned int nbVertices, unsigned int nbth = Parallel::NumberOfThreads);
+
+	/**
+	* set the rows of the topological Laplacian (as addRows_Laplacian_Topo)
+	*/
+	void setLaplacianTopo();
+
+	/**
+	* set the rows of the cotangent Laplacian (as addRows_Laplacian_Cotan)
+	*/
+	void setLaplacianCotan(const EdgeAttribute<REAL, MAP>& edgeWeight, const VertexAttribute<REAL, MAP>& vertexArea);
+
+	/**
+	* set the free vertices (the others are locked) and factor the system
+	* @return false if the factorization failed (e.g. a connected component without locked vertex)
+	*/
+	bool setConstraints(const CellMarker<MAP, VERTEX>& freeMarker);
+
+	/**
+	* forget the factorization (to call when the constraints change)
+	*/
+	void resetConstraints() { m_factorized = false; }
+
+	/**
+	* is the system factored for the current constraints ?
+	*/
+	bool isFactorized() const { return m_factorized; }
+
+	/**
+	* solve the system for the 3 coordinates: the free vertices of position are
+	* computed from the right hand side rhs and the locked vertices of position
+	* (same result as setupVariables / addRowsRHS_Laplacian_XXX / getResult for each coord)
+	*/
+	bool solve(const VertexAttribute<VEC3, MAP>& rhs, VertexAttribute<VEC3, MAP>& position);
+};
+
+} // namespace LinearSolving
+
+} // namespace Algo
+
+} // namespace CGoGN
+
+#include "Algo/LinearSolving/laplacianSolver.hpp"
+
+#endif
@@ -0,0 +1,322 @@
+/*******************************************************************************
+ * CGoGN: Combinatorial and Geometric modeling with Generic N-dimensional Maps  *
+ * version 0.1                                                                  *
+ * Copyright (C) 2009-2012, IGG Team, LSIIT, University of Strasbourg           *
+ *                                                                              *
+ * This library is free software; you can redistribute it and/or modify it      *
+ * under the terms of the GNU Lesser General Public License as published by the *
+ * Free Software Foundation; either version 2.1 of the License, or (at your     *
+ * option) any later version.                                                   *
+ *                                                                              *
+ * This library is distributed in the hope that it will be useful, but WITHOUT  *
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or        *
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License  *
+ * for more details.                                                            *
+ *                                                                              *
+ * You should have received a copy of the GNU Lesser General Public License     *
+ * along with this library; if not, write to the Free Software Foundation,      *
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301 USA.           *
+ *                                                                              *
+ * Web site: http://cgogn.unistra.fr/                                           *
+ * Contact information: cgogn@unistra.fr                                        *
+ *                                                                              *
+ *******************************************************************************/
+
+#include <cmath>
+#include <algorithm>
+
+namespace CGoGN
+{
+
+namespace Algo
+{
+
+namespace LinearSolving
+{
+
+template <typename PFP>
+LaplacianSolver<PFP>::LaplacianSolver(MAP& map, const VertexAttribute<unsigned int, MAP>& index, unsigned int nbVertices, unsigned int nbth) :
+	m_map(map),
+	m_index(index),
+	m_nbVertices(nbVertices),
+	m_nbth(nbth),
+	m_factorized(false)
+{}
+
+template <typename PFP>
+template <typename FUNC>
+void LaplacianSolver<PFP>::parallelVertices(FUNC f)
+{
+	if (m_nbth <= 1)
+		foreach_cell<VERTEX>(m_map, f);
+	else
+		CGoGN::Parallel::foreach_cell<VERTEX>(m_map, [&] (Vertex v, unsigned int /*thr*/) { f(v); }, AUTO, m_nbth);
+}
+
+template <typename PFP>
+template <typename FUNC>
+void LaplacianSolver<PFP>::parallelRange(unsigned int nb, FUNC f)
+{
+	if ((m_nbth <= 1) || (nb < 2))
+	{
+		f(0, nb);
+		return;
+	}
+
+	Utils::ThreadPool::shared(m_nbth - 1).parallelFor(nb, [&] (unsigned int b, unsigned int e, unsigned int)
+	{
+		f(b, e);
+	});
+}
+
+template <typename PFP>
+template <typename WEIGHT>
+void LaplacianSolver<PFP>::assemble(WEIGHT weight)
+{
+	m_factorized = false;
+
+	// size of the rows: neighbours + diagonal
+	m_rowBegin.assign(m_nbVertices + 1, 0);
+	m_vertexEmb.assign(m_nbVertices, EMBNULL);
+	parallelVertices([&] (Vertex v)
+	{
+		const unsigned int i = m_index[v];
+		m_vertexEmb[i] = m_map.template getEmbedding<VERTEX>(v.dart);
+		unsigned int nb = 1;
+		Traversor2VE<MAP> t(m_map, v.dart);
+		for (Dart it = t.begin(); it != t.end(); it = t.next())
+			++nb;
+		m_rowBegin[i+1] = nb;
+	});
+
+	for (unsigned int i = 0; i < m_nbVertices; ++i)
+		m_rowBegin[i+1] += m_rowBegin[i];
+
+	m_columns.resize(m_rowBegin.back());
+	m_coeffs.resize(m_rowBegin.back());
+
+	// normalized rows (as NL_NORMALIZE_ROWS), sorted by column
+	parallelVertices([&] (Vertex v)
+	{
+		const unsigned int i = m_index[v];
+		const unsigned int b = m_rowBegin[i];
+		unsigned int k = b;
+		double aii = 0;
+		double norm2 = 0;
+		Traversor2VE<MAP> t(m_map, v.dart);
+		for (Dart it = t.begin(); it != t.end(); it = t.next())
+		{
+			const double aij = weight(v, it);
+			aii += aij;
+			norm2 += aij * aij;
+			m_columns[k] = m_index[m_map.phi1(it)];
+			m_coeffs[k] = aij;
+			++k;
+		}
+		m_columns[k] = i;
+		m_coeffs[k] = -aii;
+		norm2 += aii * aii;
+
+		const double s = (norm2 > 0) ? 1.0 / std::sqrt(norm2) : 1.0;
+		for (unsigned int j = b; j <= k; ++j)
+		{
+			m_coeffs[j] *= s;
+			// insertion in the sorted part of the row
+			for (unsigned int l = j; (l > b) && (m_columns[l-1] > m_columns[l]); --l)
+			{
+				std::swap(m_columns[l-1], m_columns[l]);
+				std::swap(m_coeffs[l-1], m_coeffs[l]);
+			}
+		}
+	});
+}
+
+template <typename PFP>
+void LaplacianSolver<PFP>::setLaplacianTopo()
+{
+	assemble([] (Vertex, Dart) { return 1.0; });
+}
+
+template <typename PFP>
+void LaplacianSolver<PFP>::setLaplacianCotan(const EdgeAttribute<REAL, MAP>& edgeWeight, const VertexAttribute<REAL, MAP>& vertexArea)
+{
+	assemble([&] (Vertex v, Dart it) { return double(edgeWeight[it] / vertexArea[v]); });
+}
+
+template <typename PFP>
+bool LaplacianSolver<PFP>::setConstraints(const CellMarker<MAP, VERTEX>& freeMarker)
+{
+	m_freeIndex.assign(m_nbVertices, -1);
+	m_freeVertices.clear();
+	for (unsigned int i = 0; i < m_nbVertices; ++i)
+	{
+		if (freeMarker.isMarked(m_vertexEmb[i]))
+		{
+			m_freeIndex[i] = int(m_freeVertices.size());
+			m_freeVertices.push_back(i);
+		}
+	}
+	const unsigned int nbFree = uint32(m_freeVertices.size());
+
+	// columns of the free variables (the free indices grow with the vertex indices: rows stay sorted)
+	RowMatrix freeColumns(m_nbVertices, nbFree);
+	std::vector<int> rowBegin(m_nbVertices + 1, 0);
+	parallelRange(m_nbVertices, [&] (unsigned int b, unsigned int e)
+	{
+		for (unsigned int i = b; i < e; ++i)
+		{
+			int nb = 0;
+			for (unsigned int k = m_rowBegin[i]; k < m_rowBegin[i+1]; ++k)
+				if (m_freeIndex[m_columns[k]] >= 0)
+					++nb;
+			rowBegin[i+1] = nb;
+		}
+	});
+	for (unsigned int i = 0; i < m_nbVertices; ++i)
+		rowBegin[i+1] += rowBegin[i];
+
+	freeColumns.resizeNonZeros(rowBegin.back());
+	std::copy(rowBegin.begin(), rowBegin.end(), freeColumns.outerIndexPtr());
+	parallelRange(m_nbVertices, [&] (unsigned int b, unsigned int e)
+	{
+		for (unsigned int i = b; i < e; ++i)
+		{
+			int l = rowBegin[i];
+			for (unsigned int k = m_rowBegin[i]; k < m_rowBegin[i+1]; ++k)
+			{
+				const int f = m_freeIndex[m_columns[k]];
+				if (f >= 0)
+				{
+					freeColumns.innerIndexPtr()[l] = f;
+					freeColumns.valuePtr()[l] = m_coeffs[k];
+					++l;
+				}
+			}
+		}
+	});
+
+	m_freeColumnsT = freeColumns.transpose();
+
+	// normal equations of the free variables
+	ColMatrix normal = m_freeColumnsT * freeColumns;
+	m_ldlt.compute(normal);
+	m_factorized = (m_ldlt.info() == Eigen::Success);
+
+	if (m_factorized)
+	{
+		const Eigen::VectorXd diag = m_ldlt.vectorD();
+		m_invDiag.resize(nbFree);
+		for (unsigned int f = 0; f < nbFree; ++f)
+			m_invDiag[f] = 1.0 / diag[f];
+	}
+	return m_factorized;
+}
+
+template <typename PFP>
+bool LaplacianSolver<PFP>::solve(const VertexAttribute<VEC3, MAP>& rhs, VertexAttribute<VEC3, MAP>& position)
+{
+	if (!m_factorized)
+		return false;
+
+	const unsigned int nbFree = uint32(m_freeVertices.size());
+
+	// right hand side minus the contribution of the locked vertices
+	Coords residual(m_nbVertices, 3);
+	parallelRange(m_nbVertices, [&] (unsigned int b, unsigned int e)
+	{
+		for (unsigned int i = b; i < e; ++i)
+		{
+			const VEC3& r = rhs[m_vertexEmb[i]];
+			double r0 = r[0], r1 = r[1], r2 = r[2];
+			for (unsigned int k = m_rowBegin[i]; k < m_rowBegin[i+1]; ++k)
+			{
+				const unsigned int j = m_columns[k];
+				if (m_freeIndex[j] < 0)
+				{
+					const VEC3& p = position[m_vertexEmb[j]];
+					r0 -= m_coeffs[k] * p[0];
+					r1 -= m_coeffs[k] * p[1];
+					r2 -= m_coeffs[k] * p[2];
+				}
+			}
+			residual(i, 0) = r0;
+			residual(i, 1) = r1;
+			residual(i, 2) = r2;
+		}
+	});
+
+	// projection on the free variables (stored permuted as the factorization, 3 coordinates interleaved)
+	const int* perm = m_ldlt.permutationP().indices().data();
+	std::vector<double> y(3 * nbFree);
+	parallelRange(nbFree, [&] (unsigned int b, unsigned int e)
+	{
+		for (unsigned int f = b; f < e; ++f)
+		{
+			double y0 = 0, y1 = 0, y2 = 0;
+			for (typename RowMatrix::InnerIterator it(m_freeColumnsT, f); it; ++it)
+			{
+				y0 += it.value() * residual(it.index(), 0);
+				y1 += it.value() * residual(it.index(), 1);
+				y2 += it.value() * residual(it.index(), 2);
+			}
+			double* yf = &y[3 * perm[f]];
+			yf[0] = y0;
+			yf[1] = y1;
+			yf[2] = y2;
+		}
+	});
+
+	// substitutions L D L^T: one traversal of L for the 3 coordinates
+	const ColMatrix& L = m_ldlt.matrixL().nestedExpression();
+	const int* colBegin = L.outerIndexPtr();
+	const int* rows = L.innerIndexPtr();
+	const double* values = L.valuePtr();
+	for (unsigned int j = 0; j < nbFree; ++j)
+	{
+		const double y0 = y[3*j], y1 = y[3*j+1], y2 = y[3*j+2];
+		for (int k = colBegin[j]; k < colBegin[j+1]; ++k)
+		{
+			double* yi = &y[3 * rows[k]];
+			yi[0] -= values[k] * y0;
+			yi[1] -= values[k] * y1;
+			yi[2] -= values[k] * y2;
+		}
+	}
+	for (unsigned int j = 0; j < nbFree; ++j)
+	{
+		y[3*j] *= m_invDiag[j];
+		y[3*j+1] *= m_invDiag[j];
+		y[3*j+2] *= m_invDiag[j];
+	}
+	for (unsigned int j = nbFree; j-- > 0; )
+	{
+		double y0 = y[3*j], y1 = y[3*j+1], y2 = y[3*j+2];
+		for (int k = colBegin[j]; k < colBegin[j+1]; ++k)
+		{
+			const double* yi = &y[3 * rows[k]];
+			y0 -= values[k] * yi[0];
+			y1 -= values[k] * yi[1];
+			y2 -= values[k] * yi[2];
+		}
+		y[3*j] = y0;
+		y[3*j+1] = y1;
+		y[3*j+2] = y2;
+	}
+
+	parallelRange(nbFree, [&] (unsigned int b, unsigned int e)
+	{
+		for (unsigned int f = b; f < e; ++f)
+		{
+			const double* yf = &y[3 * perm[f]];
+			position[m_vertexEmb[m_freeVertices[f]]] = VEC3(REAL(yf[0]), REAL(yf[1]), REAL(yf[2]));
+		}
+	});
+
+	return true;
+}
+
+} // namespace LinearSolving
+
+} // namespace Algo
+
+} // namespace CGoGN
@@ -118,6 +118,28 @@ protected:
 	 */
 	bool m_Alloc;
 
+	/**
+	 * width (in cubes) of the blocks of the first level of the min-max hierarchy (0 if not built)
+	 */
+	int m_blockSize;
+
+	/**
+	 * number of blocks in X, Y, Z of each level of the min-max hierarchy
+	 */
+	std::vector<Geom::Vec3i> m_nbBlocks;
+
+	/**
+	 * min and max voxel values of the blocks of each level of the min-max hierarchy
+	 */
+	std::vector< std::vector<DataType> > m_blockMin;
+	std::vector< std::vector<DataType> > m_blockMax;
+
+	/**
+	 * recursive traversal of the min-max hierarchy (see activeBlocks)
+	 */
+	template< typename Windowing >
+	unsigned int activeBlocksRec(const Windowing& wind, int level, int bx, int by, int bz, std::vector<unsigned char>& active) const;
+
 	/**
 	* Test if a point is in the image
 	*
@@ -342,6 +364,52 @@ public:
 	template< typename Windowing >
 	float computeVolume(const Windowing& wind) const;
 
+	/**
+	 * @name Min-max hierarchy
+	 * Blocks of the first level contain blockSize^3 cubes: block (bx,by,bz) covers the voxels
+	 * [bx*blockSize, (bx+1)*blockSize] (clamped to the image) in each direction. A block
+	 * of level l+1 gathers 2x2x2 blocks of level l.
+	 * The hierarchy does not depend on the windowing: it is built once and used for
+	 * any iso-value. It must be rebuilt if the voxels are modified.
+	 */
+	//@{
+	/**
+	 * build the min-max hierarchy
+	 * @param blockSize width (in cubes) of the blocks of the first level
+	 */
+	void buildMinMaxBlocks(int blockSize = 8);
+
+	/**
+	 * release the min-max hierarchy
+	 */
+	void clearMinMaxBlocks();
+
+	/**
+	 * is the min-max hierarchy built ?
+	 */
+	bool hasMinMaxBlocks() const { return m_blockSize > 0; }
+
+	/**
+	 * get the width (in cubes) of the blocks of the first level
+	 */
+	int getBlockSize() const { return m_blockSize; }
+
+	/**
+	 * get the number of blocks of the first level in X, Y, Z
+	 */
+	Geom::Vec3i getNbBlocks() const { return m_nbBlocks.front(); }
+
+	/**
+	 * flag the blocks of the first level that can be crossed by the surface,
+	 * by traversing the hierarchy from its top level (the min-max hierarchy must be built)
+	 * @param wind the windowing function
+	 * @param active flag for each block of first level (index bx + nbx*(by + nby*bz))
+	 * @return the number of active blocks
+	 */
+	template< typename Windowing >
+	unsigned int activeBlocks(const Windowing& wind, std::vector<unsigned char>& active) const;
+	//@}
+
 	/**
 	 * local (3x3) blur of image
 	 */
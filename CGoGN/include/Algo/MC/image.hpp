@@ -48,7 +48,8 @@ Image<DataType>::Image():
 	m_Data	(NULL),
 	m_OX	(0),
 	m_OY	(0),
-	m_OZ	(0)
+	m_OZ	(0),
+	m_blockSize(0)
 {
 }
 
@@ -64,7 +65,8 @@ Image<DataType>::Image(DataType *data, int wx, int wy, int wz, float sx, float s
 	m_OZ   (0),
 	m_SX   (sx),
 	m_SY   (sy),
-	m_SZ   (sz)
+	m_SZ   (sz),
+	m_blockSize(0)
 {
 	if ( copy )
 	{
@@ -635,6 +637,144 @@ float Image<DataType>::computeVolume(const Windowing& wind) const
 	return float(vol);
 }
 
+template< typename  DataType >
+void Image<DataType>::buildMinMaxBlocks(int blockSize)
+{
+	clearMinMaxBlocks();
+	if ((blockSize < 1) || (m_WX < 2) || (m_WY < 2) || (m_WZ < 2))
+		return;
+
+	m_blockSize = blockSize;
+
+	// first level: blocks of blockSize^3 cubes (the last block of each direction ends at the border)
+	Geom::Vec3i nb((m_WX-2)/blockSize + 1, (m_WY-2)/blockSize + 1, (m_WZ-2)/blockSize + 1);
+	m_nbBlocks.push_back(nb);
+	m_blockMin.push_back(std::vector<DataType>(nb[0]*nb[1]*nb[2]));
+	m_blockMax.push_back(std::vector<DataType>(nb[0]*nb[1]*nb[2]));
+
+	unsigned int b = 0;
+	for (int bz = 0; bz < nb[2]; ++bz)
+	{
+		const int ze = std::min((bz+1)*blockSize, m_WZ-1);
+		for (int by = 0; by < nb[1]; ++by)
+		{
+			const int ye = std::min((by+1)*blockSize, m_WY-1);
+			for (int bx = 0; bx < nb[0]; ++bx, ++b)
+			{
+				const int xb = bx*blockSize;
+				const int xe = std::min((bx+1)*blockSize, m_WX-1);
+				DataType vmin = m_Data[xb + m_WX*(by*blockSize) + m_WXY*(bz*blockSize)];
+				DataType vmax = vmin;
+				for (int z = bz*blockSize; z <= ze; ++z)
+				{
+					for (int y = by*blockSize; y <= ye; ++y)
+					{
+						const DataType* data = getVoxelPtr(xb, y, z);
+						for (int x = xb; x <= xe; ++x, ++data)
+						{
+							if (*data < vmin)
+								vmin = *data;
+							if (vmax < *data)
+								vmax = *data;
+						}
+					}
+				}
+				m_blockMin[0][b] = vmin;
+				m_blockMax[0][b] = vmax;
+			}
+		}
+	}
+
+	// next levels: blocks of 2x2x2 blocks of previous level, until a single block
+	while ((nb[0] > 1) || (nb[1] > 1) || (nb[2] > 1))
+	{
+		const Geom::Vec3i nbc = nb;
+		const std::vector<DataType>& cmin = m_blockMin.back();
+		const std::vector<DataType>& cmax = m_blockMax.back();
+
+		nb = Geom::Vec3i((nbc[0]+1)/2, (nbc[1]+1)/2, (nbc[2]+1)/2);
+		std::vector<DataType> lmin(nb[0]*nb[1]*nb[2]);
+		std::vector<DataType> lmax(nb[0]*nb[1]*nb[2]);
+
+		b = 0;
+		for (int bz = 0; bz < nb[2]; ++bz)
+		{
+			for (int by = 0; by < nb[1]; ++by)
+			{
+				for (int bx = 0; bx < nb[0]; ++bx, ++b)
+				{
+					const unsigned int c0 = 2*bx + nbc[0]*(2*by + nbc[1]*2*bz);
+					DataType vmin = cmin[c0];
+					DataType vmax = cmax[c0];
+					for (int cz = 2*bz; cz < std::min(2*bz+2, nbc[2]); ++cz)
+					{
+						for (int cy = 2*by; cy < std::min(2*by+2, nbc[1]); ++cy)
+						{
+							for (int cx = 2*bx; cx < std::min(2*bx+2, nbc[0]); ++cx)
+							{
+								const unsigned int c = cx + nbc[0]*(cy + nbc[1]*cz);
+								if (cmin[c] < vmin)
+									vmin = cmin[c];
+								if (vmax < cmax[c])
+									vmax = cmax[c];
+							}
+						}
+					}
+					lmin[b] = vmin;
+					lmax[b] = vmax;
+				}
+			}
+		}
+
+		m_nbBlocks.push_back(nb);
+		m_blockMin.push_back(std::vector<DataType>());
+		m_blockMin.back().swap(lmin);
+		m_blockMax.push_back(std::vector<DataType>());
+		m_blockMax.back().swap(lmax);
+	}
+}
+
+template< typename  DataType >
+void Image<DataType>::clearMinMaxBlocks()
+{
+	m_blockSize = 0;
+	m_nbBlocks.clear();
+	m_blockMin.clear();
+	m_blockMax.clear();
+}
+
+template< typename  DataType >
+template< typename Windowing >
+unsigned int Image<DataType>::activeBlocks(const Windowing& wind, std::vector<unsigned char>& active) const
+{
+	active.assign(m_blockMin.front().size(), 0);
+	return activeBlocksRec(wind, int(m_blockMin.size()) - 1, 0, 0, 0, active);
+}
+
+template< typename  DataType >
+template< typename Windowing >
+unsigned int Image<DataType>::activeBlocksRec(const Windowing& wind, int level, int bx, int by, int bz, std::vector<unsigned char>& active) const
+{
+	const Geom::Vec3i& nb = m_nbBlocks[level];
+	const unsigned int b = bx + nb[0]*(by + nb[1]*bz);
+	if (!wind.mixed(m_blockMin[level][b], m_blockMax[level][b]))
+		return 0;
+
+	if (level == 0)
+	{
+		active[b] = 1;
+		return 1;
+	}
+
+	const Geom::Vec3i& nbc = m_nbBlocks[level-1];
+	unsigned int nba = 0;
+	for (int cz = 2*bz; cz < std::min(2*bz+2, nbc[2]); ++cz)
+		for (int cy = 2*by; cy < std::min(2*by+2, nbc[1]); ++cy)
+			for (int cx = 2*bx; cx < std::min(2*bx+2, nbc[0]); ++cx)
+				nba += activeBlocksRec(wind, level-1, cx, cy, cz, active);
+	return nba;
+}
+
 template< typename  DataType >
 Image<DataType>* Image<DataType>::Blur3()
 {
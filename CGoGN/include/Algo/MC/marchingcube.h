@@ -205,6 +205,20 @@ protected:
 
 	L_DART createTriEmb(unsigned int e1, unsigned int e2, unsigned int e3);
 
+	/**
+	* extract the vertices and triangles of the cubes of slices [z0,z1) in tables (used by parallelMeshing)
+	* The vertices are numbered from 0 plane by plane (and each vertex of the last plane z1 is appended
+	* at the end, in the order in which the slab starting at z1 creates its first vertices)
+	* @param z0 first slice of cubes
+	* @param z1 slice after the last slice of cubes
+	* @param active flags of the blocks of the image that can be crossed by the surface (see
+	* Image::activeBlocks), the other blocks are skipped; empty if the image has no min-max hierarchy
+	* @param vertices the created vertices (positions)
+	* @param triangles the indices (3 per triangle) of the created triangles
+	* @return the number of vertices that are not in plane z1
+	*/
+	unsigned int extractSlab(int z0, int z1, const std::vector<unsigned char>& active, std::vector<VEC3>& vertices, std::vector<unsigned int>& triangles);
+
 public:
 	/**
 	* constructor from filename
@@ -245,6 +259,25 @@ public:
 	*/
 	void simpleMeshing();
 
+	/**
+	* parallel version of Marching Cubes algorithm
+	* The volume is cut in slabs of slices that are extracted in parallel in tables of
+	* vertices/triangles; the vertices of the planes shared by two slabs are stitched and
+	* the tables are imported in the map (Import::importMesh). The produced tables do not
+	* depend on the number of threads.
+	* If the min-max hierarchy of the image is built (Image::buildMinMaxBlocks), the blocks
+	* that can not be crossed by the surface are skipped.
+	* @param nbth number of threads
+	*/
+	void parallelMeshing(unsigned int nbth = Parallel::NumberOfThreads);
+
+	/**
+	 * change the windowing (iso-value) used by next meshing
+	 * (the min-max hierarchy of the image does not depend on it and is kept)
+	 * @param wind the windowing class (for inside/outside distinguish)
+	 */
+	void setWindowing(const Windowing<DataType>& wind) { m_windowFunc = wind; }
+
 	/**
 	 * get pointer on result mesh after processing
 	 * @return the mesh
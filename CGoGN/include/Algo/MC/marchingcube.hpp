@@ -24,7 +24,9 @@
 
 #include "Algo/MC/windowing.h"
 #include "Topology/generic/dartmarker.h"
+#include "Algo/Import/import.h"
 #include <vector>
+#include <algorithm>
 
 namespace CGoGN
 {
@@ -249,6 +251,210 @@ void MarchingCube<DataType, Windowing, PFP>::simpleMeshing()
 	CGoGNout << "Taille carte:"<<m_map->getNbDarts()<<" brins"<<CGoGNendl;
 }
 
+template< typename  DataType, template < typename D2 > class Windowing, typename PFP >
+unsigned int MarchingCube<DataType, Windowing, PFP>::extractSlab(int z0, int z1, const std::vector<unsigned char>& active, std::vector<VEC3>& vertices, std::vector<unsigned int>& triangles)
+{
+	const int lTx = m_Image->getWidthX();
+	const int lTy = m_Image->getWidthY();
+	const int lTz = m_Image->getWidthZ();
+	const int lTxy = m_Image->getWidthXY();
+
+	// blocks of the min-max hierarchy (a single active block without hierarchy):
+	// an edge or a cube is in the block of its lowest voxel (clamped to the last cube)
+	static const unsigned char allActive = 1;
+	const unsigned char* blockFlags = &allActive;
+	int blockSize = std::max(std::max(lTx, lTy), lTz);
+	int nbBx = 1;
+	int nbBxy = 1;
+	if (!active.empty())
+	{
+		blockFlags = &active[0];
+		blockSize = m_Image->getBlockSize();
+		nbBx = m_Image->getNbBlocks()[0];
+		nbBxy = nbBx * m_Image->getNbBlocks()[1];
+	}
+	auto blockOf = [&] (int v, int width) { return std::min(v, width-2) / blockSize; };
+	auto blockBegin = [&] (int b) { return b*blockSize; };
+	auto blockEnd = [&] (int b) { return (b == nbBx-1) ? lTx : (b+1)*blockSize; };
+
+	// index of the vertices on the x-edges and y-edges of the two planes of the current
+	// slice of cubes, and on its z-edges (only read when the cube index says the edge is cut)
+	std::vector<unsigned int> edgesX0(lTxy), edgesY0(lTxy), edgesX1(lTxy), edgesY1(lTxy), edgesZ(lTxy);
+
+	// vertices on x-edges and y-edges of plane z
+	auto cutPlane = [&] (int z, std::vector<unsigned int>& edgesX, std::vector<unsigned int>& edgesY)
+	{
+		const DataType* data = m_Image->getVoxelPtr(0, 0, z);
+		const unsigned char* planeFlags = blockFlags + nbBxy*blockOf(z, lTz);
+		for (int y = 0; y < lTy; ++y)
+		{
+			const unsigned char* rowFlags = planeFlags + nbBx*blockOf(y, lTy);
+			for (int bx = 0; bx < nbBx; ++bx)
+			{
+				if (!rowFlags[bx])
+					continue;
+				for (int x = blockBegin(bx); x < blockEnd(bx); ++x)
+				{
+					const int i = y*lTx + x;
+					const bool in = m_windowFunc.inside(data[i]);
+					if ((x < lTx-1) && (in != m_windowFunc.inside(data[i+1])))
+					{
+						edgesX[i] = uint32(vertices.size());
+						vertices.push_back(recalPoint(VEC3(REAL(x), REAL(y), REAL(z)), VEC3(m_windowFunc.interpole(data[i], data[i+1]), 0., 0.)));
+					}
+					if ((y < lTy-1) && (in != m_windowFunc.inside(data[i+lTx])))
+					{
+						edgesY[i] = uint32(vertices.size());
+						vertices.push_back(recalPoint(VEC3(REAL(x), REAL(y), REAL(z)), VEC3(0., m_windowFunc.interpole(data[i], data[i+lTx]), 0.)));
+					}
+				}
+			}
+		}
+	};
+
+	cutPlane(z0, edgesX0, edgesY0);
+
+	unsigned int nbOwned = 0;
+	for (int z = z0; z < z1; ++z)
+	{
+		const DataType* data = m_Image->getVoxelPtr(0, 0, z);
+		const unsigned char* sliceFlags = blockFlags + nbBxy*blockOf(z, lTz);
+
+		// vertices on z-edges between planes z and z+1
+		for (int y = 0; y < lTy; ++y)
+		{
+			const unsigned char* rowFlags = sliceFlags + nbBx*blockOf(y, lTy);
+			for (int bx = 0; bx < nbBx; ++bx)
+			{
+				if (!rowFlags[bx])
+					continue;
+				for (int x = blockBegin(bx); x < blockEnd(bx); ++x)
+				{
+					const int i = y*lTx + x;
+					if (m_windowFunc.inside(data[i]) != m_windowFunc.inside(data[i+lTxy]))
+					{
+						edgesZ[i] = uint32(vertices.size());
+						vertices.push_back(recalPoint(VEC3(REAL(x), REAL(y), REAL(z)), VEC3(0., 0., m_windowFunc.interpole(data[i], data[i+lTxy]))));
+					}
+				}
+			}
+		}
+
+		if (z+1 == z1)
+			nbOwned = uint32(vertices.size());
+		cutPlane(z+1, edgesX1, edgesY1);
+
+		// triangles of the cubes (same vertex order as createLocalFaces)
+		for (int y = 0; y < lTy-1; ++y)
+		{
+			const unsigned char* rowFlags = sliceFlags + nbBx*blockOf(y, lTy);
+			for (int bx = 0; bx < nbBx; ++bx)
+			{
+				if (!rowFlags[bx])
+					continue;
+				const int xe = std::min(blockEnd(bx), lTx-1);
+				for (int x = blockBegin(bx); x < xe; ++x)
+				{
+					const int i = y*lTx + x;
+					const unsigned char ucCubeIndex = computeIndex(data + i);
+					if ((ucCubeIndex == 0) || (ucCubeIndex == 255))
+						continue;
+
+					unsigned int lVertTable[12];
+					lVertTable[ 0] = edgesX0[i];
+					lVertTable[ 1] = edgesY0[i+1];
+					lVertTable[ 2] = edgesX0[i+lTx];
+					lVertTable[ 3] = edgesY0[i];
+					lVertTable[ 4] = edgesX1[i];
+					lVertTable[ 5] = edgesY1[i+1];
+					lVertTable[ 6] = edgesX1[i+lTx];
+					lVertTable[ 7] = edgesY1[i];
+					lVertTable[ 8] = edgesZ[i];
+					lVertTable[ 9] = edgesZ[i+1];
+					lVertTable[10] = edgesZ[i+1+lTx];
+					lVertTable[11] = edgesZ[i+lTx];
+
+					const char* cTriangle = accelMCTable::m_TriTable[ucCubeIndex];
+					for (int t = 0; cTriangle[t] != -1; ++t)
+						triangles.push_back(lVertTable[int(cTriangle[t])]);
+				}
+			}
+		}
+
+		edgesX0.swap(edgesX1);
+		edgesY0.swap(edgesY1);
+	}
+
+	return nbOwned;
+}
+
+template< typename  DataType, template < typename D2 > class Windowing, typename PFP >
+void MarchingCube<DataType, Windowing, PFP>::parallelMeshing(unsigned int nbth)
+{
+	// create the mesh if needed
+	if (m_map == NULL)
+	{
+		m_map = new L_MAP();
+	}
+
+	m_fOrigin   =  VEC3((float)(m_Image->getOrigin()[0]),(float)(m_Image->getOrigin()[1]),(float)(m_Image->getOrigin()[2]));
+
+	m_fScal[0] = m_Image->getVoxSizeX();
+	m_fScal[1] = m_Image->getVoxSizeY();
+	m_fScal[2] = m_Image->getVoxSizeZ();
+
+	const int lTzm = m_Image->getWidthZ() - 1;
+	if ((lTzm < 1) || (m_Image->getWidthX() < 2) || (m_Image->getWidthY() < 2))
+		return;
+
+	if (nbth == 0)
+		nbth = 1;
+
+	// some slabs per thread to balance the load (the tables do not depend on the partition:
+	// vertices are numbered plane by plane and triangles cube by cube in both cases)
+	const unsigned int nbSlabs = (nbth == 1) ? 1u : std::min(unsigned(lTzm), 4*nbth);
+
+	// blocks of the image that can be crossed by the surface
+	std::vector<unsigned char> active;
+	if (m_Image->hasMinMaxBlocks())
+		m_Image->activeBlocks(m_windowFunc, active);
+
+	std::vector<std::vector<VEC3> > vertices(nbSlabs);
+	std::vector<std::vector<unsigned int> > triangles(nbSlabs);
+	std::vector<unsigned int> nbOwned(nbSlabs);
+
+	Algo::Import::parallelChunks(nbSlabs, nbth, [&] (unsigned int s)
+	{
+		const int z0 = int((unsigned long long)(lTzm) * s / nbSlabs);
+		const int z1 = int((unsigned long long)(lTzm) * (s+1) / nbSlabs);
+		nbOwned[s] = extractSlab(z0, z1, active, vertices[s], triangles[s]);
+	});
+
+	// stitch the slabs: the vertices of the last plane of a slab are the first vertices
+	// of the next slab, in the same order, so they are removed and the local indices shifted
+	std::vector<unsigned int> firstVertex(nbSlabs + 1, 0);
+	for (unsigned int s = 0; s < nbSlabs; ++s)
+	{
+		if (s + 1 < nbSlabs)
+			vertices[s].resize(nbOwned[s]);
+		firstVertex[s+1] = firstVertex[s] + uint32(vertices[s].size());
+	}
+
+	Algo::Import::parallelChunks(nbSlabs, nbth, [&] (unsigned int s)
+	{
+		const unsigned int first = firstVertex[s];
+		for (std::vector<unsigned int>::iterator it = triangles[s].begin(); it != triangles[s].end(); ++it)
+			*it += first;
+	});
+
+	Import::MeshTablesSurface<PFP> mts(*m_map);
+	std::vector<std::string> attrNames;
+	mts.importTriangleChunks(m_positions, vertices, triangles, attrNames, nbth);
+	Import::importMesh<PFP>(*m_map, mts);
+
+	CGoGNout << "Taille carte:"<<m_map->getNbDarts()<<" brins"<<CGoGNendl;
+}
+
 template< typename  DataType, template < typename D2 > class Windowing, typename PFP >
 unsigned char MarchingCube<DataType, Windowing, PFP>::computeIndex(const DataType* const _ucData) const
 {
@@ -49,6 +49,7 @@ namespace MC
  * and minimum interface are function
  * - inside
  * - interpole
+ * - mixed
  *
  */
 template<class DataType>
@@ -126,6 +127,17 @@ public:
     float interpole(DataType /*val1*/, DataType /*val2*/) const {
 		return 0.5f;
 	}
+
+	/**
+	 * Can a block of voxels with values in [vmin,vmax] contain inside and outside voxels ?
+	 * (used to skip empty blocks, see Image::buildMinMaxBlocks)
+	 * Here false for uniform blocks only (values of Vec types are not ordered)
+	 * @param vmin min value of the block
+	 * @param vmax max value of the block
+	 */
+	bool mixed(DataType vmin, DataType vmax) const {
+		return !(vmin == vmax);
+	}
 };
 
 /**
@@ -161,6 +173,17 @@ public:
 	float interpole(DataType, DataType) const {
 		return 0.5f;
 	}
+
+	/**
+	 * Can a block of voxels with values in [vmin,vmax] contain inside and outside voxels ?
+	 * (used to skip empty blocks, see Image::buildMinMaxBlocks)
+	 * Here false for uniform blocks only (values of Vec types are not ordered)
+	 * @param vmin min value of the block
+	 * @param vmax max value of the block
+	 */
+	bool mixed(DataType vmin, DataType vmax) const {
+		return !(vmin == vmax);
+	}
 };
 
 /**
@@ -195,6 +218,16 @@ public:
 	float interpole(DataType val1, DataType val2) const {
 		return  static_cast<float>(this->m_value - val1) / static_cast<float>(val2 - val1);
 	}
+
+	/**
+	 * Can a block of voxels with values in [vmin,vmax] contain inside and outside voxels ?
+	 * (used to skip empty blocks, see Image::buildMinMaxBlocks)
+	 * @param vmin min value of the block
+	 * @param vmax max value of the block
+	 */
+	bool mixed(DataType vmin, DataType vmax) const {
+		return (vmin < this->m_value) && !(vmax < this->m_value);
+	}
 };
 
 /**
@@ -229,6 +262,16 @@ public:
 	float interpole(DataType val1, DataType val2) const {
 		return  static_cast<float>(this->m_value - val1) / static_cast<float>(val2 - val1);
 	}
+
+	/**
+	 * Can a block of voxels with values in [vmin,vmax] contain inside and outside voxels ?
+	 * (used to skip empty blocks, see Image::buildMinMaxBlocks)
+	 * @param vmin min value of the block
+	 * @param vmax max value of the block
+	 */
+	bool mixed(DataType vmin, DataType vmax) const {
+		return !(this->m_value < vmin) && (this->m_value < vmax);
+	}
 };
 
 
@@ -277,6 +320,18 @@ public:
 		}
 		return static_cast<float>(this->m_max - val2) / static_cast<float>(val1 - val2);
 	}
+
+	/**
+	 * Can a block of voxels with values in [vmin,vmax] contain inside and outside voxels ?
+	 * (used to skip empty blocks, see Image::buildMinMaxBlocks)
+	 * @param vmin min value of the block
+	 * @param vmax max value of the block
+	 */
+	bool mixed(DataType vmin, DataType vmax) const {
+		if ((vmax < this->m_min) || (this->m_max < vmin))
+			return false;
+		return (vmin < this->m_min) || (this->m_max < vmax);
+	}
 };
 
 }
@@ -401,7 +401,9 @@ void CatmullClarkSubdivision(typename PFP::MAP& map, EMBV& attributs)
 		// else nothing to do point already in the middle of segment
 	}
 
-	// Compute vertex points
+	// Compute vertex points (stored apart: boundary rings read the neighbour vertices)
+	std::vector<EMB> vertPoints;
+	vertPoints.reserve(l_verts.size());
 	for (typename std::vector<Dart>::iterator vert = l_verts.begin(); vert != l_verts.end(); ++vert)
 	{
 		m0.unmark(*vert);
@@ -427,8 +429,10 @@ void CatmullClarkSubdivision(typename PFP::MAP& map, EMBV& attributs)
 		deltaV += 2.0*sumEdge;							// + sumEdge/n)
 		deltaV /= float(n*n);								// /n
 
-		attributs[*vert] += deltaV;
+		vertPoints.push_back(attributs[*vert] + deltaV);
 	}
+	for (unsigned int i = 0; i < l_verts.size(); ++i)
+		attributs[l_verts[i]] = vertPoints[i];
 }
 
 
@@ -682,7 +686,9 @@ void LoopSubdivision(typename PFP::MAP& map, EMBV& attributs)
 		// else nothing to do point already in the middle of segment
 	}
 
-	// Compute vertex points
+	// Compute vertex points (stored apart: the rings read the old positions of the neighbours)
+	std::vector<EMB> vertPoints;
+	vertPoints.reserve(l_verts.size());
 	for(typename std::vector<Dart>::iterator vert = l_verts.begin(); vert != l_verts.end(); ++vert)
 	{
 		m0.unmark(*vert);
@@ -712,8 +718,10 @@ void LoopSubdivision(typename PFP::MAP& map, EMBV& attributs)
 			emcp *= (1.0f - beta);
 			emcp += temp;
 		}
-		attributs[*vert] = emcp;
+		vertPoints.push_back(emcp);
 	}
+	for (unsigned int i = 0; i < l_verts.size(); ++i)
+		attributs[l_verts[i]] = vertPoints[i];
 
 	// insert new edges
 	for (Dart d = map.begin(); d != map.end(); map.next(d))
@@ -724,6 +732,10 @@ void LoopSubdivision(typename PFP::MAP& map, EMBV& attributs)
 			me.template unmarkOrbit<FACE>(d) ;
 			mv.template unmarkOrbit<FACE>(d) ;
 
+			// the boundary faces are not split
+			if (map.template isBoundaryMarked<2>(d))
+				continue ;
+
 			Dart dd = d;
 			Dart e = map.template phi<11>(dd) ;
 			map.splitFace(dd, e);
@@ -0,0 +1,129 @@
+/*******************************************************************************
+ * CGoGN: Combinatorial and Geometric modeling with Generic N-dimensional Maps  *
+ * version 0.1                                                                  *
+ * Copyright (C) 2009-2012, IGG Team, LSIIT, University of Strasbourg           *
+ *                                                                              *
+ * This library is free software; you can redistribute it and/or modify it      *
+ * under the terms of the GNU Lesser General Public License as published by the *
+ * Free Software Foundation; either version 2.1 of the License, or (at your     *
+ * option) any later version.                                                   *
+ *                                                                              *
+ * This library is distributed in the hope that it will be useful, but WITHOUT  *
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or        *
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License  *
+ * for more details.                                                            *
+ *                                                                              *
+ * You should have received a copy of the GNU Lesser General Public License     *
+ * along with this library; if not, write to the Free Software Foundation,      *
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301 USA.           *
+ *                                                                              *
+ * Web site: http://cgogn.unistra.fr/                                           *
+ * Contact information: cgogn@unistra.fr                                        *
+ *                                                                              *
+ *******************************************************************************/
+
+
+#ifndef __SUBDIVISION_FLAT_H__
+#define __SUBDIVISION_FLAT_H__
+
+#include <vector>
+
+#include "Topology/generic/traversor/traversorCell.h"
+#include "Algo/Topo/basic.h"
+#include "Utils/threadPool.h"
+
+namespace CGoGN
+{
+
+namespace Algo
+{
+
+namespace Surface
+{
+
+namespace Modelisation
+{
+
+/**
+ * Flat tables of the half-edges of the (non boundary) faces of a map,
+ * used by the one-shot subdivision kernels
+ */
+template <typename MAP>
+class FaceHalfEdges
+{
+public:
+	/// first half-edge of each face (size nbFaces()+1)
+	std::vector<unsigned int> m_faceBegin;
+	/// face of each half-edge
+	std::vector<unsigned int> m_face;
+	/// dart of each half-edge
+	std::vector<Dart> m_dart;
+	/// vertex embedding at the origin of each half-edge
+	std::vector<unsigned int> m_vertex;
+	/// opposite half-edge (EMBNULL on the boundary)
+	std::vector<unsigned int> m_twin;
+	/// edge index of each half-edge
+	std::vector<unsigned int> m_edge;
+	/// half-edge of each dart (EMBNULL for boundary darts)
+	std::vector<unsigned int> m_halfEdgeOfDart;
+
+	unsigned int m_nbEdges;
+
+	/**
+	 * fill the tables from the faces of map
+	 * @param pool thread pool (NULL for a serial computation)
+	 */
+	void build(const MAP& map, Utils::ThreadPool* pool);
+
+	inline unsigned int nbFaces() const { return (unsigned int)(m_faceBegin.size()) - 1; }
+	inline unsigned int nbHalfEdges() const { return (unsigned int)(m_vertex.size()); }
+	inline unsigned int degree(unsigned int f) const { return m_faceBegin[f + 1] - m_faceBegin[f]; }
+
+	inline unsigned int next(unsigned int h) const
+	{
+		return (h + 1 < m_faceBegin[m_face[h] + 1]) ? h + 1 : m_faceBegin[m_face[h]];
+	}
+
+	inline unsigned int prev(unsigned int h) const
+	{
+		return (h > m_faceBegin[m_face[h]]) ? h - 1 : m_faceBegin[m_face[h] + 1] - 1;
+	}
+
+	/// does h carry the index of its edge (one half-edge per edge)
+	inline bool isEdgeOwner(unsigned int h) const { return m_twin[h] == EMBNULL || h < m_twin[h]; }
+};
+
+/**
+ * Loop subdivision scheme computed in one shot: the new positions are
+ * computed in parallel from flat tables of the mesh, then the refined
+ * connectivity is written at once (exact number of faces and vertices,
+ * faces sewn in parallel). Gives the same positions as LoopSubdivision.
+ * Only vertex attributes (and the given one on the new vertices) are kept,
+ * edge and face embeddings are reset, other dart attributes are lost.
+ * Falls back to LoopSubdivision if some faces are not triangles or if
+ * cells of other orbits than vertices, edges and faces are embedded.
+ * @param nbth number of threads
+ */
+template <typename PFP, typename EMBV>
+void LoopSubdivisionFlat(typename PFP::MAP& map, EMBV& attributs, unsigned int nbth = 1);
+
+/**
+ * Catmull-Clark subdivision scheme computed in one shot (see LoopSubdivisionFlat)
+ * Gives the same positions as CatmullClarkSubdivision, to which it falls back
+ * if cells of other orbits than vertices, edges and faces are embedded.
+ * @param nbth number of threads
+ */
+template <typename PFP, typename EMBV>
+void CatmullClarkSubdivisionFlat(typename PFP::MAP& map, EMBV& attributs, unsigned int nbth = 1);
+
+} // namespace Modelisation
+
+} // namespace Surface
+
+} // namespace Algo
+
+} // namespace CGoGN
+
+#include "Algo/Modelisation/subdivisionFlat.hpp"
+
+#endif
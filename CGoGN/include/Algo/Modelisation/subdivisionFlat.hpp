@@ -0,0 +1,496 @@
+/*******************************************************************************
+ * CGoGN: Combinatorial and Geometric modeling with Generic N-dimensional Maps  *
+ * version 0.1                                                                  *
+ * Copyright (C) 2009-2012, IGG Team, LSIIT, University of Strasbourg           *
+ *                                                                              *
+ * This library is free software; you can redistribute it and/or modify it      *
+ * under the terms of the GNU Lesser General Public License as published by the *
+ * Free Software Foundation; either version 2.1 of the License, or (at your     *
+ * option) any later version.                                                   *
+ *                                                                              *
+ * This library is distributed in the hope that it will be useful, but WITHOUT  *
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or        *
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License  *
+ * for more details.                                                            *
+ *                                                                              *
+ * You should have received a copy of the GNU Lesser General Public License     *
+ * along with this library; if not, write to the Free Software Foundation,      *
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301 USA.           *
+ *                                                                              *
+ * Web site: http://cgogn.unistra.fr/                                           *
+ * Contact information: cgogn@unistra.fr                                        *
+ *                                                                              *
+ *******************************************************************************/
+
+
+#include "Algo/Modelisation/subdivision.h"
+
+namespace CGoGN
+{
+
+namespace Algo
+{
+
+namespace Surface
+{
+
+namespace Modelisation
+{
+
+namespace SubdivisionFlat
+{
+
+/**
+ * run f on [0,nb[ in chunks on the pool, or in the calling thread if there is no pool
+ */
+inline void run(Utils::ThreadPool* pool, unsigned int nb, unsigned int chunkSize, const Utils::ThreadPool::RangeFunction& f)
+{
+	if (pool != NULL)
+		pool->parallelFor(nb, chunkSize, f);
+	else
+		f(0, nb, 0);
+}
+
+/**
+ * can the topology be rebuilt at once: only the vertices, edges and faces
+ * may be embedded (the other cells would keep embeddings of removed darts)
+ */
+template <typename MAP>
+bool rebuildableTopology(const MAP& map)
+{
+	for (unsigned int orbit = VERTEX; orbit < NB_ORBITS; ++orbit)
+	{
+		if ((orbit != VERTEX) && (orbit != EDGE) && (orbit != FACE) && map.isOrbitEmbedded(orbit))
+			return false;
+	}
+	return true;
+}
+
+/**
+ * remove all the darts of the map (and the edge and face cells), the vertex
+ * cells are kept without any dart: they are referenced again by the new faces
+ */
+template <typename MAP>
+void clearTopologyKeepVertices(MAP& map)
+{
+	assert(rebuildableTopology(map) || !"clearTopologyKeepVertices: cells of other orbits are embedded");
+
+	map.detachCSRTraversals();
+
+	map.template getAttributeContainer<DART>().clear(false);
+	if (map.template isOrbitEmbedded<EDGE>())
+		map.template getAttributeContainer<EDGE>().clear(false);
+	if (map.template isOrbitEmbedded<FACE>())
+		map.template getAttributeContainer<FACE>().clear(false);
+
+	AttributeContainer& cont = map.template getAttributeContainer<VERTEX>();
+	for (unsigned int i = cont.begin(); i != cont.end(); cont.next(i))
+		cont.setNbRefs(i, 1);
+}
+
+/**
+ * close the holes and embed the edges and faces (if needed) once the new faces are sewn
+ */
+template <typename MAP>
+void finishTopology(MAP& map, bool hasBoundary)
+{
+	if (hasBoundary)
+		map.closeMap();
+	if (map.template isOrbitEmbedded<EDGE>())
+		Algo::Topo::initAllOrbitsEmbedding<EDGE>(map);
+	if (map.template isOrbitEmbedded<FACE>())
+		Algo::Topo::initAllOrbitsEmbedding<FACE>(map);
+}
+
+/**
+ * i-th dart of the face of d
+ */
+template <typename MAP>
+inline Dart faceDart(const MAP& map, Dart d, unsigned int i)
+{
+	for (; i > 0; --i)
+		d = map.phi1(d);
+	return d;
+}
+
+} // namespace SubdivisionFlat
+
+template <typename MAP>
+void FaceHalfEdges<MAP>::build(const MAP& map, Utils::ThreadPool* pool)
+{
+	std::vector<Dart> faces;
+	foreach_cell<FACE>(map, [&] (Face f) { faces.push_back(f.dart); });
+	const unsigned int nbf = (unsigned int)(faces.size());
+
+	m_faceBegin.resize(nbf + 1);
+	m_faceBegin[0] = 0;
+	SubdivisionFlat::run(pool, nbf, 4096, [&] (unsigned int b, unsigned int e, unsigned int)
+	{
+		for (unsigned int f = b; f < e; ++f)
+			m_faceBegin[f + 1] = map.faceDegree(Face(faces[f]));
+	});
+	for (unsigned int f = 0; f < nbf; ++f)
+		m_faceBegin[f + 1] += m_faceBegin[f];
+
+	const unsigned int nbh = m_faceBegin[nbf];
+	m_face.resize(nbh);
+	m_dart.resize(nbh);
+	m_vertex.resize(nbh);
+	m_twin.resize(nbh);
+	m_edge.resize(nbh);
+	m_halfEdgeOfDart.assign(map.template getAttributeContainer<DART>().end(), EMBNULL);
+
+	SubdivisionFlat::run(pool, nbf, 4096, [&] (unsigned int b, unsigned int e, unsigned int)
+	{
+		for (unsigned int f = b; f < e; ++f)
+		{
+			unsigned int h = m_faceBegin[f];
+			Dart d = faces[f];
+			do
+			{
+				m_face[h] = f;
+				m_dart[h] = d;
+				m_vertex[h] = map.template getEmbedding<VERTEX>(d);
+				m_halfEdgeOfDart[map.dartIndex(d)] = h;
+				++h;
+				d = map.phi1(d);
+			} while (d != faces[f]);
+		}
+	});
+
+	SubdivisionFlat::run(pool, nbh, 4096, [&] (unsigned int b, unsigned int e, unsigned int)
+	{
+		for (unsigned int h = b; h < e; ++h)
+			m_twin[h] = m_halfEdgeOfDart[map.dartIndex(map.phi2(m_dart[h]))];
+	});
+
+	m_nbEdges = 0;
+	for (unsigned int h = 0; h < nbh; ++h)
+	{
+		if (isEdgeOwner(h))
+			m_edge[h] = m_nbEdges++;
+	}
+	SubdivisionFlat::run(pool, nbh, 4096, [&] (unsigned int b, unsigned int e, unsigned int)
+	{
+		for (unsigned int h = b; h < e; ++h)
+		{
+			if (!isEdgeOwner(h))
+				m_edge[h] = m_edge[m_twin[h]];
+		}
+	});
+}
+
+template <typename PFP, typename EMBV>
+void LoopSubdivisionFlat(typename PFP::MAP& map, EMBV& attributs, unsigned int nbth)
+{
+	typedef typename PFP::MAP MAP;
+	typedef typename EMBV::DATA_TYPE EMB;
+
+	Utils::ThreadPool* pool = (nbth > 1) ? &Utils::ThreadPool::shared(nbth - 1) : NULL;
+
+	FaceHalfEdges<MAP> table;
+	table.build(map, pool);
+	const unsigned int nbf = table.nbFaces();
+	const unsigned int nbh = table.nbHalfEdges();
+
+	bool flat = SubdivisionFlat::rebuildableTopology(map);
+	for (unsigned int f = 0; f < nbf && flat; ++f)
+		flat = (table.degree(f) == 3);
+	if (!flat)
+	{
+		LoopSubdivision<PFP>(map, attributs);
+		return;
+	}
+
+	// vertex points (from the old positions)
+	std::vector<Dart> vertices;
+	foreach_cell<VERTEX>(map, [&] (Vertex v) { vertices.push_back(v.dart); });
+	const unsigned int nbv = (unsigned int)(vertices.size());
+	std::vector<unsigned int> vertexEmb(nbv);
+	std::vector<EMB> vertexPoints(nbv);
+
+	SubdivisionFlat::run(pool, nbv, 1024, [&] (unsigned int b, unsigned int e, unsigned int)
+	{
+		for (unsigned int i = b; i < e; ++i)
+		{
+			Dart v = vertices[i];
+			EMB temp(0.0);
+			int n = 0;
+			Dart x = v;
+			do
+			{
+				temp += attributs[map.phi1(x)];
+				++n;
+				x = map.phi2_1(x);
+			} while (x != v);
+			EMB emcp = attributs[v];
+			if (n == 6)
+			{
+				temp /= 16.0;
+				emcp *= 10.0/16.0;
+				emcp += temp;
+			}
+			else
+			{
+				double beta = betaF(n) ;
+				temp *= (beta / double(n));
+				emcp *= (1.0f - beta);
+				emcp += temp;
+			}
+			vertexEmb[i] = map.template getEmbedding<VERTEX>(v);
+			vertexPoints[i] = emcp;
+		}
+	});
+
+	// edge points
+	std::vector<EMB> edgePoints(table.m_nbEdges);
+	SubdivisionFlat::run(pool, nbh, 4096, [&] (unsigned int b, unsigned int e, unsigned int)
+	{
+		for (unsigned int h = b; h < e; ++h)
+		{
+			if (!table.isEdgeOwner(h))
+				continue;
+			EMB p = attributs[table.m_vertex[h]];
+			p += attributs[table.m_vertex[table.next(h)]];
+			p *= 0.5;
+			unsigned int t = table.m_twin[h];
+			if (t != EMBNULL)
+			{
+				p *= 0.75;
+				EMB temp = attributs[table.m_vertex[table.prev(h)]];
+				temp += attributs[table.m_vertex[table.prev(t)]];
+				temp *= 1.0 / 8.0;
+				p += temp;
+			}
+			edgePoints[table.m_edge[h]] = p;
+		}
+	});
+
+	bool hasBoundary = false;
+	for (unsigned int h = 0; h < nbh && !hasBoundary; ++h)
+		hasBoundary = (table.m_twin[h] == EMBNULL);
+
+	// new topology: one triangle for each corner (indexed by its half-edge)
+	// and one central triangle for each face (indexed by nbh + face)
+	std::vector<unsigned int> edgeVertex(table.m_nbEdges);
+	for (unsigned int i = 0; i < table.m_nbEdges; ++i)
+		edgeVertex[i] = map.template newCell<VERTEX>();
+
+	SubdivisionFlat::clearTopologyKeepVertices(map);
+
+	std::vector<Dart> newFaces(4 * nbf);
+	auto addTriangle = [&] (unsigned int a, unsigned int b, unsigned int c) -> Dart
+	{
+		Dart d = map.newFace(3, false);
+		map.template initDartEmbedding<VERTEX>(d, a);
+		map.template initDartEmbedding<VERTEX>(map.phi1(d), b);
+		map.template initDartEmbedding<VERTEX>(map.phi_1(d), c);
+		return d;
+	};
+	for (unsigned int f = 0; f < nbf; ++f)
+	{
+		const unsigned int h0 = table.m_faceBegin[f];
+		for (unsigned int h = h0; h < h0 + 3; ++h)
+			newFaces[h] = addTriangle(table.m_vertex[h], edgeVertex[table.m_edge[h]], edgeVertex[table.m_edge[table.prev(h)]]);
+		newFaces[nbh + f] = addTriangle(edgeVertex[table.m_edge[h0]], edgeVertex[table.m_edge[h0 + 1]], edgeVertex[table.m_edge[h0 + 2]]);
+	}
+
+	// each dart is sewn once, by the face of the owner half-edge
+	SubdivisionFlat::run(pool, nbf, 1024, [&] (unsigned int b, unsigned int e, unsigned int)
+	{
+		for (unsigned int f = b; f < e; ++f)
+		{
+			const unsigned int h0 = table.m_faceBegin[f];
+			for (unsigned int j = 0; j < 3; ++j)
+			{
+				const unsigned int h = h0 + j;
+				// corner with central triangle
+				map.sewFaces(map.phi1(newFaces[h]), SubdivisionFlat::faceDart(map, newFaces[nbh + f], (j + 2) % 3), false);
+				// the two halves of the edge with the opposite face
+				const unsigned int t = table.m_twin[h];
+				if (t != EMBNULL && h < t)
+				{
+					map.sewFaces(newFaces[h], map.phi_1(newFaces[table.next(t)]), false);
+					map.sewFaces(map.phi_1(newFaces[table.next(h)]), newFaces[t], false);
+				}
+			}
+		}
+	});
+
+	SubdivisionFlat::finishTopology(map, hasBoundary);
+
+	SubdivisionFlat::run(pool, nbv, 4096, [&] (unsigned int b, unsigned int e, unsigned int)
+	{
+		for (unsigned int i = b; i < e; ++i)
+			attributs[vertexEmb[i]] = vertexPoints[i];
+	});
+	SubdivisionFlat::run(pool, table.m_nbEdges, 4096, [&] (unsigned int b, unsigned int e, unsigned int)
+	{
+		for (unsigned int i = b; i < e; ++i)
+			attributs[edgeVertex[i]] = edgePoints[i];
+	});
+}
+
+template <typename PFP, typename EMBV>
+void CatmullClarkSubdivisionFlat(typename PFP::MAP& map, EMBV& attributs, unsigned int nbth)
+{
+	typedef typename PFP::MAP MAP;
+	typedef typename EMBV::DATA_TYPE EMB;
+
+	if (!SubdivisionFlat::rebuildableTopology(map))
+	{
+		CatmullClarkSubdivision<PFP>(map, attributs);
+		return;
+	}
+
+	Utils::ThreadPool* pool = (nbth > 1) ? &Utils::ThreadPool::shared(nbth - 1) : NULL;
+
+	FaceHalfEdges<MAP> table;
+	table.build(map, pool);
+	const unsigned int nbf = table.nbFaces();
+	const unsigned int nbh = table.nbHalfEdges();
+
+	// face points
+	std::vector<EMB> facePoints(nbf);
+	SubdivisionFlat::run(pool, nbf, 4096, [&] (unsigned int b, unsigned int e, unsigned int)
+	{
+		for (unsigned int f = b; f < e; ++f)
+		{
+			EMB center(0.0);
+			for (unsigned int h = table.m_faceBegin[f]; h < table.m_faceBegin[f + 1]; ++h)
+				center += attributs[table.m_vertex[h]];
+			center /= float(table.degree(f));
+			facePoints[f] = center;
+		}
+	});
+
+	// edge points
+	std::vector<EMB> edgePoints(table.m_nbEdges);
+	SubdivisionFlat::run(pool, nbh, 4096, [&] (unsigned int b, unsigned int e, unsigned int)
+	{
+		for (unsigned int h = b; h < e; ++h)
+		{
+			if (!table.isEdgeOwner(h))
+				continue;
+			EMB p = attributs[table.m_vertex[h]];
+			p += attributs[table.m_vertex[table.next(h)]];
+			p *= 0.5;
+			unsigned int t = table.m_twin[h];
+			if (t != EMBNULL)
+				p += (facePoints[table.m_face[h]] + facePoints[table.m_face[t]]) / 4.0 - (p / 2.0);
+			edgePoints[table.m_edge[h]] = p;
+		}
+	});
+
+	// vertex points (a boundary dart of the ring brings the edge point of its
+	// edge and the old position of the next vertex, as CatmullClarkSubdivision)
+	std::vector<Dart> vertices;
+	foreach_cell<VERTEX>(map, [&] (Vertex v) { vertices.push_back(v.dart); });
+	const unsigned int nbv = (unsigned int)(vertices.size());
+	std::vector<unsigned int> vertexEmb(nbv);
+	std::vector<EMB> vertexPoints(nbv);
+
+	SubdivisionFlat::run(pool, nbv, 1024, [&] (unsigned int b, unsigned int e, unsigned int)
+	{
+		for (unsigned int i = b; i < e; ++i)
+		{
+			Dart v = vertices[i];
+			EMB sumFace(0.0);
+			EMB sumEdge(0.0);
+			int n = 0;
+			Dart x = v;
+			do
+			{
+				unsigned int h = table.m_halfEdgeOfDart[map.dartIndex(x)];
+				if (h != EMBNULL)
+				{
+					sumFace += facePoints[table.m_face[h]];
+					sumEdge += edgePoints[table.m_edge[h]];
+				}
+				else
+				{
+					sumFace += attributs[map.phi1(x)];
+					sumEdge += edgePoints[table.m_edge[table.m_halfEdgeOfDart[map.dartIndex(map.phi2(x))]]];
+				}
+				++n;
+				x = map.phi2_1(x);
+			} while (x != v);
+
+			EMB deltaV = attributs[v] * float(-3*n);
+			deltaV += sumFace;
+			deltaV += 2.0*sumEdge;
+			deltaV /= float(n*n);
+
+			vertexEmb[i] = map.template getEmbedding<VERTEX>(v);
+			vertexPoints[i] = attributs[v] + deltaV;
+		}
+	});
+
+	bool hasBoundary = false;
+	for (unsigned int h = 0; h < nbh && !hasBoundary; ++h)
+		hasBoundary = (table.m_twin[h] == EMBNULL);
+
+	// new topology: one quad for each corner (indexed by its half-edge)
+	std::vector<unsigned int> edgeVertex(table.m_nbEdges);
+	for (unsigned int i = 0; i < table.m_nbEdges; ++i)
+		edgeVertex[i] = map.template newCell<VERTEX>();
+	std::vector<unsigned int> faceVertex(nbf);
+	for (unsigned int i = 0; i < nbf; ++i)
+		faceVertex[i] = map.template newCell<VERTEX>();
+
+	SubdivisionFlat::clearTopologyKeepVertices(map);
+
+	std::vector<Dart> newFaces(nbh);
+	for (unsigned int h = 0; h < nbh; ++h)
+	{
+		Dart d = map.newFace(4, false);
+		map.template initDartEmbedding<VERTEX>(d, table.m_vertex[h]);
+		map.template initDartEmbedding<VERTEX>(map.phi1(d), edgeVertex[table.m_edge[h]]);
+		map.template initDartEmbedding<VERTEX>(map.template phi<11>(d), faceVertex[table.m_face[h]]);
+		map.template initDartEmbedding<VERTEX>(map.phi_1(d), edgeVertex[table.m_edge[table.prev(h)]]);
+		newFaces[h] = d;
+	}
+
+	// each dart is sewn once, by the quad of the owner half-edge
+	SubdivisionFlat::run(pool, nbh, 4096, [&] (unsigned int b, unsigned int e, unsigned int)
+	{
+		for (unsigned int h = b; h < e; ++h)
+		{
+			// quad of h with the quad of the next corner of the face
+			map.sewFaces(map.phi1(newFaces[h]), map.template phi<11>(newFaces[table.next(h)]), false);
+			// the two halves of the edge with the opposite face
+			const unsigned int t = table.m_twin[h];
+			if (t != EMBNULL && h < t)
+			{
+				map.sewFaces(newFaces[h], map.phi_1(newFaces[table.next(t)]), false);
+				map.sewFaces(map.phi_1(newFaces[table.next(h)]), newFaces[t], false);
+			}
+		}
+	});
+
+	SubdivisionFlat::finishTopology(map, hasBoundary);
+
+	SubdivisionFlat::run(pool, nbv, 4096, [&] (unsigned int b, unsigned int e, unsigned int)
+	{
+		for (unsigned int i = b; i < e; ++i)
+			attributs[vertexEmb[i]] = vertexPoints[i];
+	});
+	SubdivisionFlat::run(pool, table.m_nbEdges, 4096, [&] (unsigned int b, unsigned int e, unsigned int)
+	{
+		for (unsigned int i = b; i < e; ++i)
+			attributs[edgeVertex[i]] = edgePoints[i];
+	});
+	SubdivisionFlat::run(pool, nbf, 4096, [&] (unsigned int b, unsigned int e, unsigned int)
+	{
+		for (unsigned int i = b; i < e; ++i)
+			attributs[faceVertex[i]] = facePoints[i];
+	});
+}
+
+} // namespace Modelisation
+
+} // namespace Surface
+
+} // namespace Algo
+
+} // namespace CGoGN
@@ -29,6 +29,7 @@
 #include "Geometry/basic.h"
 
 #include "Topology/generic/traversor/traversor2.h"
+#include "Utils/indexedHeap.h"
 
 #include <algorithm>
 
@@ -479,31 +480,20 @@ protected:
 	const EdgeAttribute<REAL, MAP>& edge_cost;
 	REAL maxDist;
 
-	typedef struct
-	{
-		typename std::multimap<REAL, Dart>::iterator it;
-		bool valid ;
-		static std::string CGoGNnameOfType() { return "DijkstraVertexInfo" ; }
-	} DijkstraVertexInfo ;
-	typedef NoTypeNameAttribute<DijkstraVertexInfo> VertexInfo ;
-
-	VertexAttribute<VertexInfo, MAP> vertexInfo ;
+	// front addressed by vertex embedding (kept allocated between the collections)
+	Utils::IndexedHeap<REAL, unsigned int, 4> front;
+	// dart of each vertex of the front
+	std::vector<Dart> frontDarts;
 
-	std::multimap<REAL, Dart> front;
+	void initFront();
 
 public:
 	Collector_Dijkstra_Vertices(MAP& m, const EdgeAttribute<REAL, MAP>& c, REAL d = 0) :
 		Collector<PFP>(m),
 		edge_cost(c),
 		maxDist(d)
-	{
-		vertexInfo = m.template addAttribute<VertexInfo, VERTEX, typename PFP::MAP>("vertexInfo");
-	}
-	~Collector_Dijkstra_Vertices()
-	{
-		this->map.removeAttribute(vertexInfo);
-	}
-	inline void init (Dart d) { Collector<PFP>::init(d); front.clear(); }
+	{}
+	inline void init (Dart d) { Collector<PFP>::init(d); initFront(); }
 	inline void setMaxDistance(REAL d) { maxDist = d; }
 	inline REAL getMaxDist() const { return maxDist; }
 
@@ -530,31 +520,20 @@ protected:
 	const VertexAttribute<VEC3, MAP>& position;
 	REAL maxDist;
 
-	typedef struct
-	{
-		typename std::multimap<REAL, Dart>::iterator it;
-		bool valid ;
-		static std::string CGoGNnameOfType() { return "DijkstraVertexInfo" ; }
-	} DijkstraVertexInfo ;
-	typedef NoTypeNameAttribute<DijkstraVertexInfo> VertexInfo ;
-
-	VertexAttribute<VertexInfo, MAP> vertexInfo ;
+	// front addressed by vertex embedding (kept allocated between the collections)
+	Utils::IndexedHeap<REAL, unsigned int, 4> front;
+	// dart of each vertex of the front
+	std::vector<Dart> frontDarts;
 
-	std::multimap<REAL, Dart> front;
+	void initFront();
 
 public:
 	Collector_Dijkstra(MAP& m, const VertexAttribute<VEC3, MAP>& p, REAL d = 0) :
 		Collector<PFP>(m),
 		position(p),
 		maxDist(d)
-	{
-			vertexInfo = m.template addAttribute<VertexInfo, VERTEX, typename PFP::MAP>("vertexInfo");
-	}
-	~Collector_Dijkstra()
-	{
-		this->map.removeAttribute(vertexInfo);
-	}
-	inline void init (Dart d) { Collector<PFP>::init(d); front.clear(); }
+	{}
+	inline void init (Dart d) { Collector<PFP>::init(d); initFront(); }
 	inline void setMaxDistance(REAL d) { maxDist = d; }
 	inline REAL getMaxDist() const { return maxDist; }
 	inline const VertexAttribute<VEC3, MAP>& getPosition() const { return position; }
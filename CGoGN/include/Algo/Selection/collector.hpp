@@ -941,6 +941,18 @@ void Collector_Triangles<PFP>::collectBorder(Dart d)
  * Collector Dijkstra_Vertices
  *********************************************************/
 
+template <typename PFP>
+void Collector_Dijkstra_Vertices<PFP>::initFront()
+{
+	const unsigned int nb = this->map.template getAttributeContainer<VERTEX>().end();
+	if (front.nbIds() < nb)
+	{
+		front.setNbIds(nb);
+		frontDarts.resize(nb);
+	}
+	front.clear();
+}
+
 template <typename PFP>
 void Collector_Dijkstra_Vertices<PFP>::collectAll(Dart dinit)
 {
@@ -948,38 +960,38 @@ void Collector_Dijkstra_Vertices<PFP>::collectAll(Dart dinit)
 	this->isInsideCollected = true;
 
 	CellMarkerStore<MAP, VERTEX> vmReached (this->map);
-	vertexInfo[this->centerDart].it = front.insert(std::pair<REAL,Dart>(0.0f, this->centerDart));
-	vertexInfo[this->centerDart].valid = true;
+	const unsigned int center = this->map.template getEmbedding<VERTEX>(this->centerDart);
+	front.insertId(center, 0.0f);
+	frontDarts[center] = this->centerDart;
 	vmReached.mark(this->centerDart);
 
-	while ( !front.empty() && front.begin()->first < this->maxDist)
+	while ( !front.empty() && front.topKey() < this->maxDist)
 	{
-		Dart e = front.begin()->second;
-		REAL d = front.begin()->first;
-		front.erase(vertexInfo[e].it);
-		vertexInfo[e].valid=false;
+		Dart e = frontDarts[front.topHandle()];
+		REAL d = front.topKey();
+		front.pop();
 		this->insideVertices.push_back(e);
 
 		Traversor2VVaE<MAP> tv (this->map, e);
 		for (Dart f = tv.begin(); f != tv.end(); f=tv.next())
 		{
-			VertexInfo& vi (vertexInfo[f]);
+			const unsigned int vf = this->map.template getEmbedding<VERTEX>(f);
 			if (vmReached.isMarked(f))
 			{
-				if (vi.valid) // probably useless (because of distance test) but faster
+				if (front.contains(vf)) // probably useless (because of distance test) but faster
 				{
 					REAL dist = d + edge_cost[f];
-					if (dist < vi.it->first)
+					if (dist < front.key(vf))
 					{
-						front.erase(vi.it);
-						vi.it = front.insert(std::pair<REAL,Dart>(dist, f));
+						front.update(vf, dist);
+						frontDarts[vf] = f;
 					}
 				}
 			}
 			else
 			{
-				vi.it = front.insert(std::pair<REAL,Dart>(d + edge_cost[f], f));
-				vi.valid=true;
+				front.insertId(vf, d + edge_cost[f]);
+				frontDarts[vf] = f;
 				vmReached.mark(f);
 			}
 
@@ -989,8 +1001,8 @@ void Collector_Dijkstra_Vertices<PFP>::collectAll(Dart dinit)
 
 	while ( !front.empty())
 	{
-		vmReached.unmark(front.begin()->second);
-		front.erase(front.begin());
+		vmReached.unmark(front.topHandle());
+		front.pop();
 	}
 
 	CellMarkerStore<MAP, EDGE> em (this->map);
@@ -1033,38 +1045,38 @@ void Collector_Dijkstra_Vertices<PFP>::collectBorder(Dart dinit)
 	init(dinit);
 
 	CellMarkerStore<MAP, VERTEX> vmReached (this->map);
-	vertexInfo[this->centerDart].it = front.insert(std::pair<REAL,Dart>(0.0f, this->centerDart));
-	vertexInfo[this->centerDart].valid = true;
+	const unsigned int center = this->map.template getEmbedding<VERTEX>(this->centerDart);
+	front.insertId(center, 0.0f);
+	frontDarts[center] = this->centerDart;
 	vmReached.mark(this->centerDart);
 
-	while ( !front.empty() && front.begin()->first < this->maxDist)
+	while ( !front.empty() && front.topKey() < this->maxDist)
 	{
-		Dart e = front.begin()->second;
-		REAL d = front.begin()->first;
-		front.erase(vertexInfo[e].it);
-		vertexInfo[e].valid=false;
+		Dart e = frontDarts[front.topHandle()];
+		REAL d = front.topKey();
+		front.pop();
 		this->insideVertices.push_back(e);
 
 		Traversor2VVaE<MAP> tv (this->map, e);
 		for (Dart f = tv.begin(); f != tv.end(); f=tv.next())
 		{
-			VertexInfo& vi (vertexInfo[f]);
+			const unsigned int vf = this->map.template getEmbedding<VERTEX>(f);
 			if (vmReached.isMarked(f))
 			{
-				if (vi.valid) // probably useless (because of distance test) but faster
+				if (front.contains(vf)) // probably useless (because of distance test) but faster
 				{
 					REAL dist = d + edge_cost[f];
-					if (dist < vi.it->first)
+					if (dist < front.key(vf))
 					{
-						front.erase(vi.it);
-						vi.it = front.insert(std::pair<REAL,Dart>(dist, f));
+						front.update(vf, dist);
+						frontDarts[vf] = f;
 					}
 				}
 			}
 			else
 			{
-				vi.it = front.insert(std::pair<REAL,Dart>(d + edge_cost[f], f));
-				vi.valid = true;
+				front.insertId(vf, d + edge_cost[f]);
+				frontDarts[vf] = f;
 				vmReached.mark(f);
 			}
 		}
@@ -1072,8 +1084,8 @@ void Collector_Dijkstra_Vertices<PFP>::collectBorder(Dart dinit)
 
 	while ( !front.empty())
 	{
-		vmReached.unmark(front.begin()->second);
-		front.erase(front.begin());
+		vmReached.unmark(front.topHandle());
+		front.pop();
 	}
 	CellMarkerStore<MAP, FACE> fm (this->map);
 	for (std::vector<Vertex>::iterator e_it = this->insideVertices.begin(); e_it != this->insideVertices.end() ; e_it++)
@@ -1100,6 +1112,18 @@ void Collector_Dijkstra_Vertices<PFP>::collectBorder(Dart dinit)
  * Collector Dijkstra
  *********************************************************/
 
+template <typename PFP>
+void Collector_Dijkstra<PFP>::initFront()
+{
+	const unsigned int nb = this->map.template getAttributeContainer<VERTEX>().end();
+	if (front.nbIds() < nb)
+	{
+		front.setNbIds(nb);
+		frontDarts.resize(nb);
+	}
+	front.clear();
+}
+
 template <typename PFP>
 void Collector_Dijkstra<PFP>::collectAll(Dart dinit)
 {
@@ -1107,38 +1131,38 @@ void Collector_Dijkstra<PFP>::collectAll(Dart dinit)
 	this->isInsideCollected = true;
 
 	CellMarkerStore<MAP, VERTEX> vmReached (this->map);
-	vertexInfo[this->centerDart].it = front.insert(std::pair<REAL,Dart>(0.0f, this->centerDart));
-	vertexInfo[this->centerDart].valid = true;
+	const unsigned int center = this->map.template getEmbedding<VERTEX>(this->centerDart);
+	front.insertId(center, 0.0f);
+	frontDarts[center] = this->centerDart;
 	vmReached.mark(this->centerDart);
 
-	while ( !front.empty() && front.begin()->first < this->maxDist)
+	while ( !front.empty() && front.topKey() < this->maxDist)
 	{
-		Dart e = front.begin()->second;
-		REAL d = front.begin()->first;
-		front.erase(vertexInfo[e].it);
-		vertexInfo[e].valid=false;
+		Dart e = frontDarts[front.topHandle()];
+		REAL d = front.topKey();
+		front.pop();
 		this->insideVertices.push_back(e);
 
 		Traversor2VVaE<MAP> tv (this->map, e);
 		for (Dart f = tv.begin(); f != tv.end(); f=tv.next())
 		{
-			VertexInfo& vi (vertexInfo[f]);
+			const unsigned int vf = this->map.template getEmbedding<VERTEX>(f);
 			if (vmReached.isMarked(f))
 			{
-				if (vi.valid) // probably useless (because of distance test) but faster
+				if (front.contains(vf)) // probably useless (because of distance test) but faster
 				{
 					REAL dist = d + edgeLength(f);
-					if (dist < vi.it->first)
+					if (dist < front.key(vf))
 					{
-						front.erase(vi.it);
-						vi.it = front.insert(std::pair<REAL,Dart>(dist, f));
+						front.update(vf, dist);
+						frontDarts[vf] = f;
 					}
 				}
 			}
 			else
 			{
-				vi.it = front.insert(std::pair<REAL,Dart>(d + edgeLength(f), f));
-				vi.valid = true;
+				front.insertId(vf, d + edgeLength(f));
+				frontDarts[vf] = f;
 				vmReached.mark(f);
 			}
 		}
@@ -1146,8 +1170,8 @@ void Collector_Dijkstra<PFP>::collectAll(Dart dinit)
 
 	while ( !front.empty())
 	{
-		vmReached.unmark(front.begin()->second);
-		front.erase(front.begin());
+		vmReached.unmark(front.topHandle());
+		front.pop();
 	}
 
 	CellMarkerStore<MAP, EDGE> em (this->map);
@@ -1190,38 +1214,38 @@ void Collector_Dijkstra<PFP>::collectBorder(Dart dinit)
 	init(dinit);
 
 	CellMarkerStore<MAP, VERTEX> vmReached (this->map);
-	vertexInfo[this->centerDart].it = front.insert(std::pair<REAL,Dart>(0.0f, this->centerDart));
-	vertexInfo[this->centerDart].valid = true;
+	const unsigned int center = this->map.template getEmbedding<VERTEX>(this->centerDart);
+	front.insertId(center, 0.0f);
+	frontDarts[center] = this->centerDart;
 	vmReached.mark(this->centerDart);
 
-	while ( !front.empty() && front.begin()->first < this->maxDist)
+	while ( !front.empty() && front.topKey() < this->maxDist)
 	{
-		Dart e = front.begin()->second;
-		REAL d = front.begin()->first;
-		front.erase(vertexInfo[e].it);
-		vertexInfo[e].valid=false;
+		Dart e = frontDarts[front.topHandle()];
+		REAL d = front.topKey();
+		front.pop();
 		this->insideVertices.push_back(e);
 
 		Traversor2VVaE<MAP> tv (this->map, e);
 		for (Dart f = tv.begin(); f != tv.end(); f=tv.next())
 		{
-			VertexInfo& vi (vertexInfo[f]);
+			const unsigned int vf = this->map.template getEmbedding<VERTEX>(f);
 			if (vmReached.isMarked(f))
 			{
-				if (vi.valid) // probably useless (because of distance test) but faster
+				if (front.contains(vf)) // probably useless (because of distance test) but faster
 				{
 					REAL dist = d + edgeLength(f);
-					if (dist < vi.it->first)
+					if (dist < front.key(vf))
 					{
-						front.erase(vi.it);
-						vi.it = front.insert(std::pair<REAL,Dart>(dist, f));
+						front.update(vf, dist);
+						frontDarts[vf] = f;
 					}
 				}
 			}
 			else
 			{
-				vi.it = front.insert(std::pair<REAL,Dart>(d + edgeLength(f), f));
-				vi.valid = true;
+				front.insertId(vf, d + edgeLength(f));
+				frontDarts[vf] = f;
 				vmReached.mark(f);
 			}
 		}
@@ -1229,8 +1253,8 @@ void Collector_Dijkstra<PFP>::collectBorder(Dart dinit)
 
 	while ( !front.empty())
 	{
-		vmReached.unmark(front.begin()->second);
-		front.erase(front.begin());
+		vmReached.unmark(front.topHandle());
+		front.pop();
 	}
 
 	CellMarkerStore<MAP, FACE> fm (this->map);
@@ -0,0 +1,214 @@
+/*******************************************************************************
+ * CGoGN: Combinatorial and Geometric modeling with Generic N-dimensional Maps  *
+ * version 0.1                                                                  *
+ * Copyright (C) 2009-2012, IGG Team, LSIIT, University of Strasbourg           *
+ *                                                                              *
+ * This library is free software; you can redistribute it and/or modify it      *
+ * under the terms of the GNU Lesser General Public License as published by the *
+ * Free Software Foundation; either version 2.1 of the License, or (at your     *
+ * option) any later version.                                                   *
+ *                                                                              *
+ * This library is distributed in the hope that it will be useful, but WITHOUT  *
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or        *
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License  *
+ * for more details.                                                            *
+ *                                                                              *
+ * You should have received a copy of the GNU Lesser General Public License     *
+ * along with this library; if not, write to the Free Software Foundation,      *
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301 USA.           *
+ *                                                                              *
+ * Web site: http://cgogn.unistra.fr/                                           *
+ * Contact information: cgogn@unistra.fr                                        *
+ *                                                                              *
+ *******************************************************************************/
+
+
+#ifndef __ALGO_SELECTION_FACEBVH_H__
+#define __ALGO_SELECTION_FACEBVH_H__
+
+#include <vector>
+#include <limits>
+
+#include "Topology/generic/attributeHandler.h"
+#include "Topology/generic/traversor/traversorCell.h"
+#include "Utils/threadPool.h"
+
+namespace CGoGN
+{
+
+namespace Algo
+{
+
+namespace Selection
+{
+
+/**
+ * Bounding volume hierarchy over the faces of a map.
+ * The faces are cut in triangles (fan from the first dart of the face) that are
+ * sorted in a binary tree of axis aligned boxes built with the surface area
+ * heuristic (binned). The top of the tree is built serially, the subtrees
+ * are then built in parallel.
+ * The tree stores darts: it must be rebuilt (build) when the topology changes,
+ * and only refitted (refit) when the positions change.
+ */
+template <typename PFP>
+class FaceBVH
+{
+public:
+	typedef typename PFP::MAP MAP;
+	typedef typename PFP::VEC3 VEC3;
+	typedef typename PFP::REAL REAL;
+
+	/**
+	 * triangle (a,b,c) of the fan of face a
+	 */
+	struct Triangle
+	{
+		Dart a;
+		Dart b;
+		Dart c;
+	};
+
+protected:
+	struct Node
+	{
+		VEC3 bbMin;
+		VEC3 bbMax;
+		unsigned int index;	// first of the two children (inner node) or first triangle (leaf)
+		unsigned int count;	// number of triangles (0 for an inner node)
+	};
+
+	// triangle range to build in a subtree
+	struct BuildTask
+	{
+		unsigned int node;
+		unsigned int begin;
+		unsigned int end;
+	};
+
+	// boxes and centroids of the triangles during the build
+	struct BuildData
+	{
+		std::vector<VEC3> triMin;
+		std::vector<VEC3> triMax;
+		std::vector<VEC3> centroid;
+		std::vector<unsigned int> order;
+	};
+
+	static const unsigned int NB_BINS = 12;
+
+	MAP& m_map;
+
+	const VertexAttribute<VEC3, MAP>& m_position;
+
+	unsigned int m_leafSize;
+
+	// tolerance of the line / box tests
+	REAL m_epsilon;
+
+	std::vector<Triangle> m_triangles;
+
+	std::vector<Node> m_nodes;
+
+	std::vector<unsigned int> m_leaves;
+
+	void subdivide(BuildData& data, std::vector<Node>& nodes, unsigned int n, unsigned int begin, unsigned int end, std::vector<BuildTask>* tasks, unsigned int taskSize);
+
+	void triangleBox(const Triangle& t, VEC3& bbMin, VEC3& bbMax) const;
+
+	static REAL boxArea(const VEC3& bbMin, const VEC3& bbMax);
+
+	static void boxFusion(VEC3& bbMin, VEC3& bbMax, const VEC3& pMin, const VEC3& pMax);
+
+public:
+	/**
+	 * constructor: build the hierarchy
+	 * @param map the map
+	 * @param position the vertex attribute storing positions
+	 * @param leafSize number of triangles under which a node is not split
+	 * @param nbth number of threads used for the build
+	 */
+	FaceBVH(MAP& map, const VertexAttribute<VEC3, MAP>& position, unsigned int leafSize = 4, unsigned int nbth = CGoGN::Parallel::NumberOfThreads);
+
+	/**
+	 * (re)build the hierarchy from the faces of the map
+	 * @param nbth number of threads
+	 */
+	void build(unsigned int nbth = CGoGN::Parallel::NumberOfThreads);
+
+	/**
+	 * update the boxes after a move of the vertices (same topology)
+	 * the tree is kept: its quality decreases with large deformations
+	 * @param nbth number of threads
+	 */
+	void refit(unsigned int nbth = CGoGN::Parallel::NumberOfThreads);
+
+	inline MAP& getMap() const { return m_map; }
+
+	inline const VertexAttribute<VEC3, MAP>& getPosition() const { return m_position; }
+
+	inline unsigned int getNbTriangles() const { return (unsigned int)(m_triangles.size()); }
+
+	inline unsigned int getNbNodes() const { return (unsigned int)(m_nodes.size()); }
+
+	/**
+	 * apply f on the triangles of the leaves whose box (and the boxes of the
+	 * ancestors) pass the test
+	 * @param boxTest bool (const VEC3& bbMin, const VEC3& bbMax)
+	 * @param f void (const Triangle& t)
+	 */
+	template <typename BOXTEST, typename FUNC>
+	void foreachTriangle(BOXTEST boxTest, FUNC f) const;
+
+	/**
+	 * apply f on the triangles whose box is crossed by the line (A,AB)
+	 * enlarged by radius
+	 */
+	template <typename FUNC>
+	void foreachTriangleNearLine(const VEC3& A, const VEC3& AB, REAL radius, FUNC f) const;
+
+	/**
+	 * closest point query: the face that minimizes
+	 * Algo::Geometry::squaredDistancePoint2Face
+	 * @param P the point
+	 * @param dist2 (out) squared distance from P to the face
+	 * @param maxDist2 faces farther than that are ignored
+	 * @return the closest face (NIL if none)
+	 */
+	Face closestFace(const VEC3& P, REAL& dist2, REAL maxDist2 = std::numeric_limits<REAL>::max()) const;
+
+	/**
+	 * closest intersection with a line, as given by faceRaySelection
+	 * (first intersected triangle of the fan of each face)
+	 * @param A point of the line (user side)
+	 * @param AB direction of the line
+	 * @param I (out) intersection point
+	 * @return the face whose intersection is the closest to A (NIL if none)
+	 */
+	Face closestLineIntersection(const VEC3& A, const VEC3& AB, VEC3& I) const;
+
+	/**
+	 * intersection of the line with the fan of a face (first intersected triangle)
+	 */
+	bool faceLineIntersection(Face f, const VEC3& A, const VEC3& AB, VEC3& I) const;
+
+	/**
+	 * squared distance between a point and a box
+	 */
+	static REAL squaredDistanceBox2Point(const VEC3& bbMin, const VEC3& bbMax, const VEC3& P);
+
+	/**
+	 * test if the line (A,AB) crosses a box
+	 */
+	static bool intersectionLineBox(const VEC3& A, const VEC3& AB, const VEC3& bbMin, const VEC3& bbMax);
+};
+
+} // namespace Selection
+
+} // namespace Algo
+
+} // namespace CGoGN
+
+#include "Algo/Selection/faceBVH.hpp"
+
+#endif
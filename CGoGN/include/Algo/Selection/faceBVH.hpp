@@ -0,0 +1,588 @@
+/*******************************************************************************
+ * CGoGN: Combinatorial and Geometric modeling with Generic N-dimensional Maps  *
+ * version 0.1                                                                  *
+ * Copyright (C) 2009-2012, IGG Team, LSIIT, University of Strasbourg           *
+ *                                                                              *
+ * This library is free software; you can redistribute it and/or modify it      *
+ * under the terms of the GNU Lesser General Public License as published by the *
+ * Free Software Foundation; either version 2.1 of the License, or (at your     *
+ * option) any later version.                                                   *
+ *                                                                              *
+ * This library is distributed in the hope that it will be useful, but WITHOUT  *
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or        *
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License  *
+ * for more details.                                                            *
+ *                                                                              *
+ * You should have received a copy of the GNU Lesser General Public License     *
+ * along with this library; if not, write to the Free Software Foundation,      *
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301 USA.           *
+ *                                                                              *
+ * Web site: http://cgogn.unistra.fr/                                           *
+ * Contact information: cgogn@unistra.fr                                        *
+ *                                                                              *
+ *******************************************************************************/
+
+
+#include <algorithm>
+#include <limits>
+
+#include "Geometry/distances.h"
+#include "Geometry/intersection.h"
+
+namespace CGoGN
+{
+
+namespace Algo
+{
+
+namespace Selection
+{
+
+template <typename PFP>
+FaceBVH<PFP>::FaceBVH(MAP& map, const VertexAttribute<VEC3, MAP>& position, unsigned int leafSize, unsigned int nbth) :
+	m_map(map),
+	m_position(position),
+	m_leafSize(leafSize > 0 ? leafSize : 1),
+	m_epsilon(0)
+{
+	build(nbth);
+}
+
+template <typename PFP>
+inline void FaceBVH<PFP>::boxFusion(VEC3& bbMin, VEC3& bbMax, const VEC3& pMin, const VEC3& pMax)
+{
+	for (unsigned int i = 0; i < 3; ++i)
+	{
+		if (pMin[i] < bbMin[i])
+			bbMin[i] = pMin[i];
+		if (pMax[i] > bbMax[i])
+			bbMax[i] = pMax[i];
+	}
+}
+
+template <typename PFP>
+inline typename PFP::REAL FaceBVH<PFP>::boxArea(const VEC3& bbMin, const VEC3& bbMax)
+{
+	VEC3 e = bbMax - bbMin;
+	return REAL(2) * (e[0] * e[1] + e[1] * e[2] + e[2] * e[0]);
+}
+
+template <typename PFP>
+inline void FaceBVH<PFP>::triangleBox(const Triangle& t, VEC3& bbMin, VEC3& bbMax) const
+{
+	bbMin = m_position[t.a];
+	bbMax = bbMin;
+	const VEC3& pb = m_position[t.b];
+	boxFusion(bbMin, bbMax, pb, pb);
+	const VEC3& pc = m_position[t.c];
+	boxFusion(bbMin, bbMax, pc, pc);
+}
+
+template <typename PFP>
+void FaceBVH<PFP>::build(unsigned int nbth)
+{
+	m_triangles.clear();
+	m_nodes.clear();
+	m_leaves.clear();
+
+	// fan triangulation of the faces
+	foreach_cell<FACE>(m_map, [&] (Face f)
+	{
+		Triangle t;
+		t.a = f.dart;
+		t.b = m_map.phi1(f.dart);
+		t.c = m_map.phi1(t.b);
+		do
+		{
+			m_triangles.push_back(t);
+			t.b = t.c;
+			t.c = m_map.phi1(t.b);
+		} while (t.c != f.dart);
+	});
+
+	unsigned int nb = (unsigned int)(m_triangles.size());
+	if (nb == 0)
+		return;
+
+	BuildData data;
+	data.triMin.resize(nb);
+	data.triMax.resize(nb);
+	data.centroid.resize(nb);
+	data.order.resize(nb);
+
+	Utils::ThreadPool::RangeFunction boxes = [&] (unsigned int b, unsigned int e, unsigned int)
+	{
+		for (unsigned int i = b; i < e; ++i)
+		{
+			triangleBox(m_triangles[i], data.triMin[i], data.triMax[i]);
+			data.centroid[i] = (data.triMin[i] + data.triMax[i]) / REAL(2);
+			data.order[i] = i;
+		}
+	};
+
+	m_nodes.resize(1);
+	if (nbth > 1)
+	{
+		Utils::ThreadPool& pool = Utils::ThreadPool::shared(nbth - 1);
+		pool.parallelFor(nb, 4096, boxes);
+
+		// top of the tree, the ranges smaller than taskSize are left to the workers
+		unsigned int taskSize = std::max(nb / (8 * nbth), 4096u);
+		std::vector<BuildTask> tasks;
+		subdivide(data, m_nodes, 0, 0, nb, &tasks, taskSize);
+
+		std::vector< std::vector<Node> > subtrees(tasks.size());
+		pool.parallelFor((unsigned int)(tasks.size()), 1, [&] (unsigned int b, unsigned int e, unsigned int)
+		{
+			for (unsigned int i = b; i < e; ++i)
+			{
+				subtrees[i].resize(1);
+				subdivide(data, subtrees[i], 0, tasks[i].begin, tasks[i].end, NULL, 0);
+			}
+		});
+
+		// the root of a subtree replaces its task node, the other nodes are appended
+		for (unsigned int i = 0; i < tasks.size(); ++i)
+		{
+			std::vector<Node>& local = subtrees[i];
+			unsigned int offset = (unsigned int)(m_nodes.size()) - 1;
+			for (typename std::vector<Node>::iterator it = local.begin(); it != local.end(); ++it)
+			{
+				if (it->count == 0)
+					it->index += offset;
+			}
+			m_nodes[tasks[i].node] = local[0];
+			m_nodes.insert(m_nodes.end(), local.begin() + 1, local.end());
+			std::vector<Node>().swap(local);
+		}
+	}
+	else
+	{
+		boxes(0, nb, 0);
+		subdivide(data, m_nodes, 0, 0, nb, NULL, 0);
+	}
+
+	// store the triangles in the order of the leaves
+	std::vector<Triangle> sorted(nb);
+	for (unsigned int i = 0; i < nb; ++i)
+		sorted[i] = m_triangles[data.order[i]];
+	m_triangles.swap(sorted);
+
+	for (unsigned int n = 0; n < m_nodes.size(); ++n)
+	{
+		if (m_nodes[n].count > 0)
+			m_leaves.push_back(n);
+	}
+
+	VEC3 size = m_nodes[0].bbMax - m_nodes[0].bbMin;
+	m_epsilon = REAL(1e-5) * std::max(size[0], std::max(size[1], size[2]));
+}
+
+template <typename PFP>
+void FaceBVH<PFP>::subdivide(BuildData& data, std::vector<Node>& nodes, unsigned int n, unsigned int begin, unsigned int end, std::vector<BuildTask>* tasks, unsigned int taskSize)
+{
+	unsigned int count = end - begin;
+
+	// bounds of the triangles and of their centroids
+	unsigned int t = data.order[begin];
+	VEC3 bbMin = data.triMin[t];
+	VEC3 bbMax = data.triMax[t];
+	VEC3 cMin = data.centroid[t];
+	VEC3 cMax = cMin;
+	for (unsigned int i = begin + 1; i < end; ++i)
+	{
+		t = data.order[i];
+		boxFusion(bbMin, bbMax, data.triMin[t], data.triMax[t]);
+		boxFusion(cMin, cMax, data.centroid[t], data.centroid[t]);
+	}
+	nodes[n].bbMin = bbMin;
+	nodes[n].bbMax = bbMax;
+
+	if (count <= m_leafSize)
+	{
+		nodes[n].index = begin;
+		nodes[n].count = count;
+		return;
+	}
+
+	if ((tasks != NULL) && (count <= taskSize))
+	{
+		BuildTask task;
+		task.node = n;
+		task.begin = begin;
+		task.end = end;
+		tasks->push_back(task);
+		return;
+	}
+
+	unsigned int axis = 0;
+	VEC3 extent = cMax - cMin;
+	if (extent[1] > extent[axis])
+		axis = 1;
+	if (extent[2] > extent[axis])
+		axis = 2;
+
+	unsigned int mid = begin + count / 2;
+	if (extent[axis] > REAL(0))
+	{
+		// binned surface area heuristic
+		REAL scale = REAL(NB_BINS) / extent[axis];
+		REAL origin = cMin[axis];
+		auto binOf = [&] (unsigned int tri) -> unsigned int
+		{
+			unsigned int b = (unsigned int)((data.centroid[tri][axis] - origin) * scale);
+			return (b < NB_BINS) ? b : NB_BINS - 1;
+		};
+
+		unsigned int binCount[NB_BINS];
+		VEC3 binMin[NB_BINS];
+		VEC3 binMax[NB_BINS];
+		for (unsigned int b = 0; b < NB_BINS; ++b)
+			binCount[b] = 0;
+		for (unsigned int i = begin; i < end; ++i)
+		{
+			t = data.order[i];
+			unsigned int b = binOf(t);
+			if (binCount[b] == 0)
+			{
+				binMin[b] = data.triMin[t];
+				binMax[b] = data.triMax[t];
+			}
+			else
+				boxFusion(binMin[b], binMax[b], data.triMin[t], data.triMax[t]);
+			++binCount[b];
+		}
+
+		// split s: bins [0,s) on the left, [s,NB_BINS) on the right
+		REAL rightArea[NB_BINS];
+		unsigned int rightCount[NB_BINS];
+		VEC3 accMin, accMax;
+		unsigned int acc = 0;
+		for (unsigned int b = NB_BINS - 1; b > 0; --b)
+		{
+			if (binCount[b] > 0)
+			{
+				if (acc == 0)
+				{
+					accMin = binMin[b];
+					accMax = binMax[b];
+				}
+				else
+					boxFusion(accMin, accMax, binMin[b], binMax[b]);
+				acc += binCount[b];
+			}
+			rightCount[b] = acc;
+			rightArea[b] = (acc > 0) ? boxArea(accMin, accMax) : REAL(0);
+		}
+
+		unsigned int bestSplit = 0;
+		REAL bestCost = std::numeric_limits<REAL>::max();
+		acc = 0;
+		for (unsigned int s = 1; s < NB_BINS; ++s)
+		{
+			unsigned int b = s - 1;
+			if (binCount[b] > 0)
+			{
+				if (acc == 0)
+				{
+					accMin = binMin[b];
+					accMax = binMax[b];
+				}
+				else
+					boxFusion(accMin, accMax, binMin[b], binMax[b]);
+				acc += binCount[b];
+			}
+			if ((acc > 0) && (rightCount[s] > 0))
+			{
+				REAL cost = boxArea(accMin, accMax) * REAL(acc) + rightArea[s] * REAL(rightCount[s]);
+				if (cost < bestCost)
+				{
+					bestCost = cost;
+					bestSplit = s;
+				}
+			}
+		}
+
+		// cost of a leaf: count intersections, cost of a split: one traversal step more
+		REAL area = boxArea(bbMin, bbMax);
+		if ((count <= 4 * m_leafSize) && (area > REAL(0)) && (REAL(1) + bestCost / area >= REAL(count)))
+		{
+			nodes[n].index = begin;
+			nodes[n].count = count;
+			return;
+		}
+
+		mid = (unsigned int)(std::partition(data.order.begin() + begin, data.order.begin() + end,
+			[&] (unsigned int tri) { return binOf(tri) < bestSplit; }) - data.order.begin());
+	}
+
+	unsigned int left = (unsigned int)(nodes.size());
+	nodes.resize(left + 2);
+	nodes[n].index = left;
+	nodes[n].count = 0;
+
+	subdivide(data, nodes, left, begin, mid, tasks, taskSize);
+	subdivide(data, nodes, left + 1, mid, end, tasks, taskSize);
+}
+
+template <typename PFP>
+void FaceBVH<PFP>::refit(unsigned int nbth)
+{
+	if (m_nodes.empty())
+		return;
+
+	Utils::ThreadPool::RangeFunction leaves = [&] (unsigned int b, unsigned int e, unsigned int)
+	{
+		for (unsigned int i = b; i < e; ++i)
+		{
+			Node& node = m_nodes[m_leaves[i]];
+			triangleBox(m_triangles[node.index], node.bbMin, node.bbMax);
+			for (unsigned int j = node.index + 1; j < node.index + node.count; ++j)
+			{
+				VEC3 tMin, tMax;
+				triangleBox(m_triangles[j], tMin, tMax);
+				boxFusion(node.bbMin, node.bbMax, tMin, tMax);
+			}
+		}
+	};
+
+	unsigned int nb = (unsigned int)(m_leaves.size());
+	if (nbth > 1)
+		Utils::ThreadPool::shared(nbth - 1).parallelFor(nb, 2048, leaves);
+	else
+		leaves(0, nb, 0);
+
+	// the children are always stored after their parent
+	for (unsigned int n = (unsigned int)(m_nodes.size()); n-- > 0; )
+	{
+		Node& node = m_nodes[n];
+		if (node.count == 0)
+		{
+			node.bbMin = m_nodes[node.index].bbMin;
+			node.bbMax = m_nodes[node.index].bbMax;
+			boxFusion(node.bbMin, node.bbMax, m_nodes[node.index + 1].bbMin, m_nodes[node.index + 1].bbMax);
+		}
+	}
+
+	VEC3 size = m_nodes[0].bbMax - m_nodes[0].bbMin;
+	m_epsilon = REAL(1e-5) * std::max(size[0], std::max(size[1], size[2]));
+}
+
+template <typename PFP>
+template <typename BOXTEST, typename FUNC>
+void FaceBVH<PFP>::foreachTriangle(BOXTEST boxTest, FUNC f) const
+{
+	if (m_nodes.empty())
+		return;
+
+	std::vector<unsigned int> stack;
+	stack.reserve(64);
+	stack.push_back(0);
+	while (!stack.empty())
+	{
+		const Node& node = m_nodes[stack.back()];
+		stack.pop_back();
+		if (!boxTest(node.bbMin, node.bbMax))
+			continue;
+		if (node.count > 0)
+		{
+			for (unsigned int i = node.index; i < node.index + node.count; ++i)
+				f(m_triangles[i]);
+		}
+		else
+		{
+			stack.push_back(node.index + 1);
+			stack.push_back(node.index);
+		}
+	}
+}
+
+template <typename PFP>
+template <typename FUNC>
+void FaceBVH<PFP>::foreachTriangleNearLine(const VEC3& A, const VEC3& AB, REAL radius, FUNC f) const
+{
+	REAL r = radius + m_epsilon;
+	VEC3 border(r, r, r);
+	foreachTriangle([&] (const VEC3& bbMin, const VEC3& bbMax) -> bool
+	{
+		return intersectionLineBox(A, AB, bbMin - border, bbMax + border);
+	}, f);
+}
+
+template <typename PFP>
+Face FaceBVH<PFP>::closestFace(const VEC3& P, REAL& dist2, REAL maxDist2) const
+{
+	Face best = NIL;
+	dist2 = maxDist2;
+	if (m_nodes.empty())
+		return best;
+
+	std::vector<unsigned int> stack;
+	stack.reserve(64);
+	stack.push_back(0);
+	while (!stack.empty())
+	{
+		const Node& node = m_nodes[stack.back()];
+		stack.pop_back();
+		if (squaredDistanceBox2Point(node.bbMin, node.bbMax, P) >= dist2)
+			continue;
+		if (node.count > 0)
+		{
+			for (unsigned int i = node.index; i < node.index + node.count; ++i)
+			{
+				const Triangle& t = m_triangles[i];
+				REAL d2 = Geom::squaredDistancePoint2Triangle(P, m_position[t.a], m_position[t.b], m_position[t.c]);
+				if (d2 < dist2)
+				{
+					dist2 = d2;
+					best = t.a;
+				}
+			}
+		}
+		else
+		{
+			// nearest child visited first
+			const Node& l = m_nodes[node.index];
+			const Node& r = m_nodes[node.index + 1];
+			if (squaredDistanceBox2Point(l.bbMin, l.bbMax, P) <= squaredDistanceBox2Point(r.bbMin, r.bbMax, P))
+			{
+				stack.push_back(node.index + 1);
+				stack.push_back(node.index);
+			}
+			else
+			{
+				stack.push_back(node.index);
+				stack.push_back(node.index + 1);
+			}
+		}
+	}
+
+	return best;
+}
+
+template <typename PFP>
+bool FaceBVH<PFP>::faceLineIntersection(Face f, const VEC3& A, const VEC3& AB, VEC3& I) const
+{
+	const VEC3& Ta = m_position[f.dart];
+	Dart dd = m_map.phi1(f.dart);
+	Dart ddd = m_map.phi1(dd);
+	do
+	{
+		if (Geom::intersectionRayTriangleOpt<VEC3>(A, AB, Ta, m_position[dd], m_position[ddd], I))
+			return true;
+		dd = ddd;
+		ddd = m_map.phi1(dd);
+	} while (ddd != f.dart);
+
+	return false;
+}
+
+template <typename PFP>
+Face FaceBVH<PFP>::closestLineIntersection(const VEC3& A, const VEC3& AB, VEC3& I) const
+{
+	Face best = NIL;
+	if (m_nodes.empty())
+		return best;
+
+	REAL best2 = std::numeric_limits<REAL>::max();
+	VEC3 border(m_epsilon, m_epsilon, m_epsilon);
+
+	std::vector<unsigned int> stack;
+	stack.reserve(64);
+	stack.push_back(0);
+	while (!stack.empty())
+	{
+		const Node& node = m_nodes[stack.back()];
+		stack.pop_back();
+		if (squaredDistanceBox2Point(node.bbMin, node.bbMax, A) >= best2)
+			continue;
+		if (!intersectionLineBox(A, AB, node.bbMin - border, node.bbMax + border))
+			continue;
+		if (node.count > 0)
+		{
+			for (unsigned int i = node.index; i < node.index + node.count; ++i)
+			{
+				const Triangle& t = m_triangles[i];
+				if (Geom::intersectionRayTriangleOpt<VEC3>(A, AB, m_position[t.a], m_position[t.b], m_position[t.c]))
+				{
+					// the point of the face is the one of the first triangle of its fan
+					VEC3 J;
+					faceLineIntersection(t.a, A, AB, J);
+					REAL d2 = (J - A).norm2();
+					if (d2 < best2)
+					{
+						best2 = d2;
+						best = t.a;
+						I = J;
+					}
+				}
+			}
+		}
+		else
+		{
+			const Node& l = m_nodes[node.index];
+			const Node& r = m_nodes[node.index + 1];
+			if (squaredDistanceBox2Point(l.bbMin, l.bbMax, A) <= squaredDistanceBox2Point(r.bbMin, r.bbMax, A))
+			{
+				stack.push_back(node.index + 1);
+				stack.push_back(node.index);
+			}
+			else
+			{
+				stack.push_back(node.index);
+				stack.push_back(node.index + 1);
+			}
+		}
+	}
+
+	return best;
+}
+
+template <typename PFP>
+inline typename PFP::REAL FaceBVH<PFP>::squaredDistanceBox2Point(const VEC3& bbMin, const VEC3& bbMax, const VEC3& P)
+{
+	REAL d2 = 0;
+	for (unsigned int i = 0; i < 3; ++i)
+	{
+		if (P[i] < bbMin[i])
+			d2 += (bbMin[i] - P[i]) * (bbMin[i] - P[i]);
+		else if (P[i] > bbMax[i])
+			d2 += (P[i] - bbMax[i]) * (P[i] - bbMax[i]);
+	}
+	return d2;
+}
+
+template <typename PFP>
+inline bool FaceBVH<PFP>::intersectionLineBox(const VEC3& A, const VEC3& AB, const VEC3& bbMin, const VEC3& bbMax)
+{
+	REAL tMin = -std::numeric_limits<REAL>::max();
+	REAL tMax = std::numeric_limits<REAL>::max();
+	for (unsigned int i = 0; i < 3; ++i)
+	{
+		if (AB[i] == REAL(0))
+		{
+			if ((A[i] < bbMin[i]) || (A[i] > bbMax[i]))
+				return false;
+		}
+		else
+		{
+			REAL t1 = (bbMin[i] - A[i]) / AB[i];
+			REAL t2 = (bbMax[i] - A[i]) / AB[i];
+			if (t1 > t2)
+				std::swap(t1, t2);
+			if (t1 > tMin)
+				tMin = t1;
+			if (t2 < tMax)
+				tMax = t2;
+			if (tMin > tMax)
+				return false;
+		}
+	}
+	return true;
+}
+
+} // namespace Selection
+
+} // namespace Algo
+
+} // namespace CGoGN
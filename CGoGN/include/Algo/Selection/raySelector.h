@@ -27,6 +27,7 @@
 
 #include <vector>
 #include "Algo/Selection/raySelectFunctor.hpp"
+#include "Algo/Selection/faceBVH.h"
 
 namespace CGoGN
 {
@@ -237,6 +238,90 @@ Edge edgesBubbleSelection(
 		const typename PFP::VEC3& cursor,
 		typename PFP::REAL radiusMax);
 
+/**
+ * Selection functions accelerated by a bounding volume hierarchy of the faces:
+ * they give the same cells as the functions above (built with bvh.getMap()
+ * and bvh.getPosition()) but only test the faces close to the ray / plane.
+ * The hierarchy must be refitted when the positions change.
+ */
+
+/**
+ * Function that does the selection of faces, returned darts are sorted from closest to farthest
+ * @param bvh the hierarchy of the faces of the map
+ * @param rayA first point of ray (user side)
+ * @param rayAB direction of ray (directed to the scene)
+ * @param vecFaces (out) vector to store the intersected faces
+ * @param iPoints (out) vector to store the intersection points
+ */
+template<typename PFP>
+void facesRaySelection(
+		const FaceBVH<PFP>& bvh,
+		const typename PFP::VEC3& rayA,
+		const typename PFP::VEC3& rayAB,
+		std::vector<Face>& vecFaces,
+		std::vector<typename PFP::VEC3>& iPoints);
+
+template<typename PFP>
+void facesRaySelection(
+		const FaceBVH<PFP>& bvh,
+		const typename PFP::VEC3& rayA,
+		const typename PFP::VEC3& rayAB,
+		std::vector<Face>& vecFaces);
+
+/**
+ * Function that does the selection of one face (the closest one)
+ */
+template<typename PFP>
+void faceRaySelection(
+		const FaceBVH<PFP>& bvh,
+		const typename PFP::VEC3& rayA,
+		const typename PFP::VEC3& rayAB,
+		Face& face);
+
+template<typename PFP>
+void edgesRaySelection(
+		const FaceBVH<PFP>& bvh,
+		const typename PFP::VEC3& rayA,
+		const typename PFP::VEC3& rayAB,
+		std::vector<Edge>& vecEdges,
+		float distMax);
+
+template<typename PFP>
+void edgeRaySelection(
+		const FaceBVH<PFP>& bvh,
+		const typename PFP::VEC3& rayA,
+		const typename PFP::VEC3& rayAB,
+		Edge& edge);
+
+template<typename PFP>
+void verticesRaySelection(
+		const FaceBVH<PFP>& bvh,
+		const typename PFP::VEC3& rayA,
+		const typename PFP::VEC3& rayAB,
+		std::vector<Vertex>& vecVertices,
+		float dist);
+
+template<typename PFP>
+void vertexRaySelection(
+		const FaceBVH<PFP>& bvh,
+		const typename PFP::VEC3& rayA,
+		const typename PFP::VEC3& rayAB,
+		Vertex& vertex);
+
+template<typename PFP>
+void facesPlanSelection(
+		const FaceBVH<PFP>& bvh,
+		const typename Geom::Plane3D<typename PFP::VEC3::DATA_TYPE>& plan,
+		std::vector<Face>& vecFaces);
+
+template<typename PFP>
+void verticesConeSelection(
+		const FaceBVH<PFP>& bvh,
+		const typename PFP::VEC3& rayA,
+		const typename PFP::VEC3& rayAB,
+		float angle,
+		std::vector<Vertex>& vecVertices);
+
 /**
  * Fonction that do the selection of darts, returned darts are sorted from closest to farthest
  * Dart is here considered as a triangle formed by the 2 end vertices of the edge and the face centroid
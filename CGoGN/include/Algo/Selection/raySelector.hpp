@@ -52,6 +52,152 @@ struct FaceInter
 	FaceInter() {}
 };
 
+/**
+ * sort the faces and their intersection points from closest to farthest of P
+ */
+template <typename PFP>
+void sortFacesInter(const typename PFP::VEC3& P, std::vector<Face>& vecFaces, std::vector<typename PFP::VEC3>& iPoints)
+{
+	if(vecFaces.size() > 0)
+	{
+		// compute all distances to observer for each intersected face
+		// and put them in a vector for sorting
+		typedef std::pair<typename PFP::REAL, FaceInter<PFP> > faceInterDist;
+		std::vector<faceInterDist> dist;
+
+		unsigned int nbi = (unsigned int)(vecFaces.size());
+		dist.resize(nbi);
+		for (unsigned int i = 0; i < nbi; ++i)
+		{
+			dist[i].first = (iPoints[i] - P).norm2();
+			dist[i].second = FaceInter<PFP>(vecFaces[i], iPoints[i]);
+		}
+
+		// sort the vector of pair dist/dart
+		std::sort(dist.begin(), dist.end(), distOrdering<typename PFP::REAL, FaceInter<PFP> >);
+
+		// store result in returned vectors
+		for (unsigned int i = 0; i < nbi; ++i)
+		{
+			vecFaces[i] = dist[i].second.f;
+			iPoints[i] = dist[i].second.i;
+		}
+	}
+}
+
+/**
+ * sort the edges from closest to farthest of P (distance to the middle of the edge)
+ */
+template <typename PFP>
+void sortEdges(typename PFP::MAP& map, const VertexAttribute<typename PFP::VEC3, typename PFP::MAP>& position, const typename PFP::VEC3& P, std::vector<Edge>& vecEdges)
+{
+	if(vecEdges.size() > 0)
+	{
+		typedef std::pair<typename PFP::REAL, Edge> EdgeDist;
+		std::vector<EdgeDist> distnedge;
+
+		unsigned int nbi = (unsigned int)(vecEdges.size());
+		distnedge.resize(nbi);
+
+		// compute all distances to observer for each middle of intersected edge
+		// and put them in a vector for sorting
+		for (unsigned int i = 0; i < nbi; ++i)
+		{
+			Edge e = vecEdges[i];
+			distnedge[i].second = e;
+			typename PFP::VEC3 V = (position[e.dart] + position[map.phi1(e.dart)]) / typename PFP::REAL(2);
+			V -= P;
+			distnedge[i].first = V.norm2();
+		}
+
+		// sort the vector of pair dist/edge
+		std::sort(distnedge.begin(), distnedge.end(), distOrdering<typename PFP::REAL, Edge>);
+
+		// store sorted darts in returned vector
+		for (unsigned int i = 0; i < nbi; ++i)
+			vecEdges[i] = distnedge[i].second;
+	}
+}
+
+/**
+ * sort the vertices from closest to farthest of P
+ */
+template <typename PFP>
+void sortVertices(const VertexAttribute<typename PFP::VEC3, typename PFP::MAP>& position, const typename PFP::VEC3& P, std::vector<Vertex>& vecVertices)
+{
+	if(vecVertices.size() > 0)
+	{
+		typedef std::pair<typename PFP::REAL, Vertex> VertexDist;
+		std::vector<VertexDist> distnvertex;
+
+		unsigned int nbi = (unsigned int)(vecVertices.size());
+		distnvertex.resize(nbi);
+
+		// compute all distances to observer for each intersected vertex
+		// and put them in a vector for sorting
+		for (unsigned int i = 0; i < nbi; ++i)
+		{
+			Vertex v = vecVertices[i];
+			distnvertex[i].second = v;
+			typename PFP::VEC3 V = position[v] - P;
+			distnvertex[i].first = V.norm2();
+		}
+
+		// sort the vector of pair dist/dart
+		std::sort(distnvertex.begin(), distnvertex.end(), distOrdering<typename PFP::REAL, Vertex>);
+
+		// store sorted darts in returned vector
+		for (unsigned int i = 0; i < nbi; ++i)
+			vecVertices[i] = distnvertex[i].second;
+	}
+}
+
+/**
+ * edge of face f closest to point P
+ */
+template <typename PFP>
+Edge closestEdgeInFace(typename PFP::MAP& map, const VertexAttribute<typename PFP::VEC3, typename PFP::MAP>& position, Face f, const typename PFP::VEC3& P)
+{
+	Dart it = f.dart;
+	typename PFP::REAL minDist = squaredDistanceLine2Point(position[it], position[map.phi1(it)], P);
+	Edge edge = it;
+	it = map.phi1(it);
+	while(it != f.dart)
+	{
+		typename PFP::REAL dist = squaredDistanceLine2Point(position[it], position[map.phi1(it)], P);
+		if(dist < minDist)
+		{
+			minDist = dist;
+			edge = it;
+		}
+		it = map.phi1(it);
+	}
+	return edge;
+}
+
+/**
+ * vertex of face f closest to point P
+ */
+template <typename PFP>
+Vertex closestVertexInFace(typename PFP::MAP& map, const VertexAttribute<typename PFP::VEC3, typename PFP::MAP>& position, Face f, const typename PFP::VEC3& P)
+{
+	Dart it = f.dart;
+	typename PFP::REAL minDist = (P - position[it]).norm2();
+	Vertex vertex = it;
+	it = map.phi1(it);
+	while(it != f.dart)
+	{
+		typename PFP::REAL dist = (P - position[it]).norm2();
+		if(dist < minDist)
+		{
+			minDist = dist;
+			vertex = it;
+		}
+		it = map.phi1(it);
+	}
+	return vertex;
+}
+
 /**
  * Function that does the selection of faces, returned faces and intersection points are sorted from closest to farthest
  * @param map the map we want to test
@@ -99,31 +245,7 @@ void facesRaySelection(
 		} while ((ddd != f.dart) && notfound);
 	});
 
-	if(vecFaces.size() > 0)
-	{
-		// compute all distances to observer for each intersected face
-		// and put them in a vector for sorting
-		typedef std::pair<typename PFP::REAL, FaceInter<PFP> > faceInterDist;
-		std::vector<faceInterDist> dist;
-
-		unsigned int nbi = (unsigned int)(vecFaces.size());
-		dist.resize(nbi);
-		for (unsigned int i = 0; i < nbi; ++i)
-		{
-			dist[i].first = (iPoints[i] - rayA).norm2();
-			dist[i].second = FaceInter<PFP>(vecFaces[i], iPoints[i]);
-		}
-
-		// sort the vector of pair dist/dart
-		std::sort(dist.begin(), dist.end(), distOrdering<typename PFP::REAL, FaceInter<PFP> >);
-
-		// store result in returned vectors
-		for (unsigned int i = 0; i < nbi; ++i)
-		{
-			vecFaces[i] = dist[i].second.f;
-			iPoints[i] = dist[i].second.i;
-		}
-	}
+	sortFacesInter<PFP>(rayA, vecFaces, iPoints);
 }
 
 /**
@@ -212,32 +334,7 @@ void edgesRaySelection(
 			vecEdges.push_back(e);
 	});
 
-	if(vecEdges.size() > 0)
-	{
-		typedef std::pair<typename PFP::REAL, Edge> EdgeDist;
-		std::vector<EdgeDist> distnedge;
-
-		unsigned int nbi = (unsigned int)(vecEdges.size());
-		distnedge.resize(nbi);
-
-		// compute all distances to observer for each middle of intersected edge
-		// and put them in a vector for sorting
-		for (unsigned int i = 0; i < nbi; ++i)
-		{
-			Edge e = vecEdges[i];
-			distnedge[i].second = e;
-			typename PFP::VEC3 V = (position[e.dart] + position[map.phi1(e.dart)]) / typename PFP::REAL(2);
-			V -= rayA;
-			distnedge[i].first = V.norm2();
-		}
-
-		// sort the vector of pair dist/edge
-		std::sort(distnedge.begin(), distnedge.end(), distOrdering<typename PFP::REAL, Edge>);
-
-		// store sorted darts in returned vector
-		for (unsigned int i = 0; i < nbi; ++i)
-			vecEdges[i] = distnedge[i].second;
-	}
+	sortEdges<PFP>(map, position, rayA, vecEdges);
 }
 
 /**
@@ -270,21 +367,7 @@ void edgeRaySelection(
 		typename PFP::VEC3 ip = iPoints[0];
 
 		// recuperation de l'arete la plus proche du point d'intersection
-		Face f = vecFaces[0];
-		Dart it = f.dart;
-		typename PFP::REAL minDist = squaredDistanceLine2Point(position[it], position[map.phi1(it)], ip);
-		edge = it;
-		it = map.phi1(it);
-		while(it != f.dart)
-		{
-			typename PFP::REAL dist = squaredDistanceLine2Point(position[it], position[map.phi1(it)], ip);
-			if(dist < minDist)
-			{
-				minDist = dist;
-				edge = it;
-			}
-			it = map.phi1(it);
-		}
+		edge = closestEdgeInFace<PFP>(map, position, vecFaces[0], ip);
 	}
 	else
 		edge = NIL;
@@ -323,31 +406,7 @@ void verticesRaySelection(
 			vecVertices.push_back(v);
 	});
 
-	if(vecVertices.size() > 0)
-	{
-		typedef std::pair<typename PFP::REAL, Vertex> VertexDist;
-		std::vector<VertexDist> distnvertex;
-
-		unsigned int nbi = (unsigned int)(vecVertices.size());
-		distnvertex.resize(nbi);
-
-		// compute all distances to observer for each intersected vertex
-		// and put them in a vector for sorting
-		for (unsigned int i = 0; i < nbi; ++i)
-		{
-			Vertex v = vecVertices[i];
-			distnvertex[i].second = v;
-			typename PFP::VEC3 V = position[v] - rayA;
-			distnvertex[i].first = V.norm2();
-		}
-
-		// sort the vector of pair dist/dart
-		std::sort(distnvertex.begin(), distnvertex.end(), distOrdering<typename PFP::REAL, Vertex>);
-
-		// store sorted darts in returned vector
-		for (unsigned int i = 0; i < nbi; ++i)
-			vecVertices[i] = distnvertex[i].second;
-	}
+	sortVertices<PFP>(position, rayA, vecVertices);
 }
 
 /**
@@ -380,21 +439,7 @@ void vertexRaySelection(
 		typename PFP::VEC3 ip = iPoints[0];
 
 		// recuperation du sommet le plus proche du point d'intersection
-		Face f = vecFaces[0];
-		Dart it = f.dart;
-		typename PFP::REAL minDist = (ip - position[it]).norm2();
-		vertex = it;
-		it = map.phi1(it);
-		while(it != f.dart)
-		{
-			typename PFP::REAL dist = (ip - position[it]).norm2();
-			if(dist < minDist)
-			{
-				minDist = dist;
-				vertex = it;
-			}
-			it = map.phi1(it);
-		}
+		vertex = closestVertexInFace<PFP>(map, position, vecFaces[0], ip);
 	}
 	else
 		vertex = NIL;
@@ -521,28 +566,7 @@ void verticesConeSelection(
 			vecVertices.push_back(v);
 	});
 
-	typedef std::pair<typename PFP::REAL, Vertex> VertexDist;
-	std::vector<VertexDist> distnvertex;
-
-	unsigned int nbi = (unsigned int)(vecVertices.size());
-	distnvertex.resize(nbi);
-
-	// compute all distances to observer for each intersected vertex
-	// and put them in a vector for sorting
-	for (unsigned int i = 0; i < nbi; ++i)
-	{
-		Vertex v = vecVertices[i];
-		distnvertex[i].second = v;
-		typename PFP::VEC3 V = position[v] - rayA;
-		distnvertex[i].first = V.norm2();
-	}
-
-	// sort the vector of pair dist/vertex
-	std::sort(distnvertex.begin(), distnvertex.end(), distOrdering<typename PFP::REAL, Vertex>);
-
-	// store sorted vertices in returned vector
-	for (unsigned int i = 0; i < nbi; ++i)
-		vecVertices[i] = distnvertex[i].second;
+	sortVertices<PFP>(position, rayA, vecVertices);
 }
 
 /**
@@ -585,29 +609,7 @@ void edgesConeSelection(
 			vecEdges.push_back(e);
 	});
 
-	typedef std::pair<typename PFP::REAL, Edge> EdgeDist;
-	std::vector<EdgeDist> distnedge;
-
-	unsigned int nbi = (unsigned int)(vecEdges.size());
-	distnedge.resize(nbi);
-
-	// compute all distances to observer for each middle of intersected edge
-	// and put them in a vector for sorting
-	for (unsigned int i = 0; i < nbi; ++i)
-	{
-		Edge e = vecEdges[i];
-		distnedge[i].second = e;
-		typename PFP::VEC3 V = (position[e.dart] + position[map.phi1(e.dart)]) / typename PFP::REAL(2);
-		V -= rayA;
-		distnedge[i].first = V.norm2();
-	}
-
-	// sort the vector of pair dist/edge
-	std::sort(distnedge.begin(), distnedge.end(), distOrdering<typename PFP::REAL, Edge>);
-
-	// store sorted edges in returned vector
-	for (unsigned int i = 0; i < nbi; ++i)
-		vecEdges[i] = distnedge[i].second;
+	sortEdges<PFP>(map, position, rayA, vecEdges);
 }
 
 template<typename PFP>
@@ -659,6 +661,279 @@ Edge edgesBubbleSelection(
 }
 
 
+/**
+ * Selection functions accelerated by a FaceBVH: same results as the
+ * functions that traverse the whole map (up to the order of equidistant cells)
+ */
+
+template<typename PFP>
+void facesRaySelection(
+		const FaceBVH<PFP>& bvh,
+		const typename PFP::VEC3& rayA,
+		const typename PFP::VEC3& rayAB,
+		std::vector<Face>& vecFaces,
+		std::vector<typename PFP::VEC3>& iPoints)
+{
+	typename PFP::MAP& map = bvh.getMap();
+
+	vecFaces.reserve(256);
+	iPoints.reserve(256);
+	vecFaces.clear();
+	iPoints.clear();
+
+	// the faces cut in several triangles are tested once
+	DartMarkerStore<typename PFP::MAP> dm(map);
+	bvh.foreachTriangleNearLine(rayA, rayAB, 0, [&] (const typename FaceBVH<PFP>::Triangle& t)
+	{
+		if (dm.isMarked(t.a))
+			return;
+		dm.mark(t.a);
+		typename PFP::VEC3 I;
+		if (bvh.faceLineIntersection(t.a, rayA, rayAB, I))
+		{
+			vecFaces.push_back(t.a);
+			iPoints.push_back(I);
+		}
+	});
+
+	sortFacesInter<PFP>(rayA, vecFaces, iPoints);
+}
+
+template<typename PFP>
+void facesRaySelection(
+		const FaceBVH<PFP>& bvh,
+		const typename PFP::VEC3& rayA,
+		const typename PFP::VEC3& rayAB,
+		std::vector<Face>& vecFaces)
+{
+	std::vector<typename PFP::VEC3> iPoints;
+	facesRaySelection<PFP>(bvh, rayA, rayAB, vecFaces, iPoints);
+}
+
+template<typename PFP>
+void faceRaySelection(
+		const FaceBVH<PFP>& bvh,
+		const typename PFP::VEC3& rayA,
+		const typename PFP::VEC3& rayAB,
+		Face& face)
+{
+	typename PFP::VEC3 ip;
+	face = bvh.closestLineIntersection(rayA, rayAB, ip);
+}
+
+template<typename PFP>
+void edgesRaySelection(
+		const FaceBVH<PFP>& bvh,
+		const typename PFP::VEC3& rayA,
+		const typename PFP::VEC3& rayAB,
+		std::vector<Edge>& vecEdges,
+		float distMax)
+{
+	typename PFP::MAP& map = bvh.getMap();
+	const VertexAttribute<typename PFP::VEC3, typename PFP::MAP>& position = bvh.getPosition();
+
+	typename PFP::REAL dist2 = distMax * distMax;
+	typename PFP::REAL AB2 = rayAB * rayAB;
+
+	vecEdges.reserve(256);
+	vecEdges.clear();
+
+	// the edges are those of the faces whose box is close enough to the line
+	DartMarkerStore<typename PFP::MAP> dmf(map);
+	DartMarkerStore<typename PFP::MAP> dme(map);
+	bvh.foreachTriangleNearLine(rayA, rayAB, distMax, [&] (const typename FaceBVH<PFP>::Triangle& t)
+	{
+		if (dmf.isMarked(t.a))
+			return;
+		dmf.mark(t.a);
+		Dart d = t.a;
+		do
+		{
+			if (!dme.isMarked(d))
+			{
+				dme.template markOrbit<EDGE>(d);
+				const typename PFP::VEC3& P = position[d];
+				const typename PFP::VEC3& Q = position[map.phi1(d)];
+				typename PFP::REAL ld2 = Geom::squaredDistanceLine2Seg(rayA, rayAB, AB2, P, Q);
+				if (ld2 < dist2)
+					vecEdges.push_back(d);
+			}
+			d = map.phi1(d);
+		} while (d != t.a);
+	});
+
+	sortEdges<PFP>(map, position, rayA, vecEdges);
+}
+
+template<typename PFP>
+void edgeRaySelection(
+		const FaceBVH<PFP>& bvh,
+		const typename PFP::VEC3& rayA,
+		const typename PFP::VEC3& rayAB,
+		Edge& edge)
+{
+	typename PFP::VEC3 ip;
+	Face f = bvh.closestLineIntersection(rayA, rayAB, ip);
+	if (f.dart != NIL)
+		edge = closestEdgeInFace<PFP>(bvh.getMap(), bvh.getPosition(), f, ip);
+	else
+		edge = NIL;
+}
+
+template<typename PFP>
+void verticesRaySelection(
+		const FaceBVH<PFP>& bvh,
+		const typename PFP::VEC3& rayA,
+		const typename PFP::VEC3& rayAB,
+		std::vector<Vertex>& vecVertices,
+		float dist)
+{
+	typename PFP::MAP& map = bvh.getMap();
+	const VertexAttribute<typename PFP::VEC3, typename PFP::MAP>& position = bvh.getPosition();
+
+	typename PFP::REAL dist2 = dist * dist;
+	typename PFP::REAL AB2 = rayAB * rayAB;
+
+	vecVertices.reserve(256);
+	vecVertices.clear();
+
+	CellMarkerStore<typename PFP::MAP, VERTEX> cm(map);
+	auto test = [&] (Vertex v)
+	{
+		if (cm.isMarked(v))
+			return;
+		cm.mark(v);
+		typename PFP::REAL ld2 = Geom::squaredDistanceLine2Point(rayA, rayAB, AB2, position[v]);
+		if (ld2 < dist2)
+			vecVertices.push_back(v);
+	};
+	bvh.foreachTriangleNearLine(rayA, rayAB, dist, [&] (const typename FaceBVH<PFP>::Triangle& t)
+	{
+		test(t.a);
+		test(t.b);
+		test(t.c);
+	});
+
+	sortVertices<PFP>(position, rayA, vecVertices);
+}
+
+template<typename PFP>
+void vertexRaySelection(
+		const FaceBVH<PFP>& bvh,
+		const typename PFP::VEC3& rayA,
+		const typename PFP::VEC3& rayAB,
+		Vertex& vertex)
+{
+	typename PFP::VEC3 ip;
+	Face f = bvh.closestLineIntersection(rayA, rayAB, ip);
+	if (f.dart != NIL)
+		vertex = closestVertexInFace<PFP>(bvh.getMap(), bvh.getPosition(), f, ip);
+	else
+		vertex = NIL;
+}
+
+template<typename PFP>
+void facesPlanSelection(
+		const FaceBVH<PFP>& bvh,
+		const typename Geom::Plane3D<typename PFP::VEC3::DATA_TYPE>& plan,
+		std::vector<Face>& vecFaces)
+{
+	typedef typename PFP::VEC3 VEC3;
+	typedef typename PFP::REAL REAL;
+
+	typename PFP::MAP& map = bvh.getMap();
+	const VertexAttribute<VEC3, typename PFP::MAP>& position = bvh.getPosition();
+	const VEC3& N = plan.normal();
+
+	DartMarkerStore<typename PFP::MAP> dm(map);
+	bvh.foreachTriangle([&] (const VEC3& bbMin, const VEC3& bbMax) -> bool
+	{
+		// the box is crossed if the distance of its center to the plane
+		// is smaller than its projected radius
+		VEC3 center = (bbMin + bbMax) / REAL(2);
+		VEC3 half = (bbMax - bbMin) / REAL(2);
+		REAL r = half[0] * fabs(N[0]) + half[1] * fabs(N[1]) + half[2] * fabs(N[2]);
+		return fabs(plan.distance(center)) <= r * REAL(1.0001);
+	},
+	[&] (const typename FaceBVH<PFP>::Triangle& t)
+	{
+		if (dm.isMarked(t.a))
+			return;
+		dm.mark(t.a);
+		if(Geom::intersectionTrianglePlan<VEC3>(
+				position[t.a],
+				position[map.phi1(t.a)],
+				position[map.phi_1(t.a)],
+				plan.point(),
+				plan.normal()
+			) == Geom::FACE_INTERSECTION)
+		{
+			vecFaces.push_back(t.a);
+		}
+	});
+}
+
+template<typename PFP>
+void verticesConeSelection(
+		const FaceBVH<PFP>& bvh,
+		const typename PFP::VEC3& rayA,
+		const typename PFP::VEC3& rayAB,
+		float angle,
+		std::vector<Vertex>& vecVertices)
+{
+	typedef typename PFP::VEC3 VEC3;
+	typedef typename PFP::REAL REAL;
+
+	typename PFP::MAP& map = bvh.getMap();
+	const VertexAttribute<VEC3, typename PFP::MAP>& position = bvh.getPosition();
+
+	REAL AB2 = rayAB * rayAB;
+
+	double sin2 = sin(M_PI/180.0 * angle);
+	sin2 = sin2*sin2;
+	double alpha = M_PI/180.0 * angle;
+
+	vecVertices.reserve(256);
+	vecVertices.clear();
+
+	CellMarkerStore<typename PFP::MAP, VERTEX> cm(map);
+	auto test = [&] (Vertex v)
+	{
+		if (cm.isMarked(v))
+			return;
+		cm.mark(v);
+		const VEC3& P = position[v];
+		REAL ld2 = Geom::squaredDistanceLine2Point(rayA, rayAB, AB2, P);
+		VEC3 V = P - rayA;
+		double s2 = double(ld2) / double(V*V);
+		if (s2 < sin2)
+			vecVertices.push_back(v);
+	};
+
+	bvh.foreachTriangle([&] (const VEC3& bbMin, const VEC3& bbMax) -> bool
+	{
+		// the bounding sphere of the box must reach the (double) cone
+		VEC3 center = (bbMin + bbMax) / REAL(2);
+		double r = double((bbMax - center).norm());
+		VEC3 V = center - rayA;
+		double l = double(V.norm());
+		if (l <= r)
+			return true;
+		double ld = sqrt(double(Geom::squaredDistanceLine2Point(rayA, rayAB, AB2, center)));
+		double a = asin(std::min(1.0, ld / l));
+		double b = asin(std::min(1.0, r / l));
+		return (a - b) <= alpha * 1.0001;
+	},
+	[&] (const typename FaceBVH<PFP>::Triangle& t)
+	{
+		test(t.a);
+		test(t.b);
+		test(t.c);
+	});
+
+	sortVertices<PFP>(position, rayA, vecVertices);
+}
+
 //namespace Parallel
 //{
 //
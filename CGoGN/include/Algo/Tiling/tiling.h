@@ -26,6 +26,7 @@
 #define _TILING_H_
 
 #include "Geometry/transfo.h"
+#include "Algo/Geometry/batch.h"
 #include "Topology/generic/cellmarker.h"
 
 namespace CGoGN
@@ -79,18 +79,7 @@ void Tiling<PFP>::transform(VertexAttribute<VEC3, MAP>& position, const Geom::Ma
 //	Geom::Vec4f v3(matrice[2],matrice[6],matrice[10],matrice[14]);
 //	Geom::Vec4f v4(matrice[3],matrice[7],matrice[11],matrice[15]);
 
-    for(typename std::vector<Dart>::iterator di = m_tableVertDarts.begin(); di != m_tableVertDarts.end(); ++di)
-    {
-
-        typename PFP::VEC3& pos = position[*di];
-//
-//		Geom::Vec4f VA(pos[0],pos[1],pos[2],1.0f);
-//
-//		Geom::Vec4f VB((VA*v1),(VA*v2),(VA*v3),(VA*v4));
-//		VEC3 newPos(VB[0]/VB[3],VB[1]/VB[3],VB[2]/VB[3]);
-
-        pos = Geom::transform(pos, matrice);
-    }
+    Algo::Geometry::transformPoints(position, m_tableVertDarts, matrice);
 
     // transform the center only in the surface case
     //m_center = Geom::transform(m_center, matrice);
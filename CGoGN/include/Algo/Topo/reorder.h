@@ -0,0 +1,219 @@
+/*******************************************************************************
+ * CGoGN: Combinatorial and Geometric modeling with Generic N-dimensional Maps  *
+ * version 0.1                                                                  *
+ * Copyright (C) 2009-2012, IGG Team, LSIIT, University of Strasbourg           *
+ *                                                                              *
+ * This library is free software; you can redistribute it and/or modify it      *
+ * under the terms of the GNU Lesser General Public License as published by the *
+ * Free Software Foundation; either version 2.1 of the License, or (at your     *
+ * option) any later version.                                                   *
+ *                                                                              *
+ * This library is distributed in the hope that it will be useful, but WITHOUT  *
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or        *
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License  *
+ * for more details.                                                            *
+ *                                                                              *
+ * You should have received a copy of the GNU Lesser General Public License     *
+ * along with this library; if not, write to the Free Software Foundation,      *
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301 USA.           *
+ *                                                                              *
+ * Web site: http://cgogn.unistra.fr/                                           *
+ * Contact information: cgogn@unistra.fr                                        *
+ *                                                                              *
+ *******************************************************************************/
+
+
+#ifndef __ALGO_TOPO_REORDER__
+#define __ALGO_TOPO_REORDER__
+
+#include <vector>
+#include <algorithm>
+#include <utility>
+
+#include "Topology/generic/attributeHandler.h"
+#include "Topology/generic/dartmarker.h"
+#include "Topology/generic/traversor/traversorCell.h"
+#include "Algo/Geometry/boundingbox.h"
+
+namespace CGoGN
+{
+
+namespace Algo
+{
+
+namespace Topo
+{
+
+/**
+ * Reorder the darts of the map so that the darts of each vertex are contiguous,
+ * the vertices being stored in the given order. The cells of the embedded orbits
+ * follow the order of their first dart (see GenericMap::reorder).
+ * @param vertices one dart per vertex, in the wanted order (the map must be compact)
+ */
+template <typename MAP>
+bool reorderByVertices(MAP& map, const std::vector<Dart>& vertices)
+{
+	unsigned int nbDarts = map.getNbDarts();
+	std::vector<unsigned int> newOfOld(nbDarts, EMBNULL);
+
+	unsigned int rank = 0;
+	for (std::vector<Dart>::const_iterator it = vertices.begin(); it != vertices.end(); ++it)
+	{
+		map.template foreach_dart_of_orbit<VERTEX>(*it, [&] (Dart d)
+		{
+			if (newOfOld[d.index] == EMBNULL)
+				newOfOld[d.index] = rank++;
+		});
+	}
+	// darts of the forgotten vertices at the end
+	for (unsigned int i = 0; i < nbDarts; ++i)
+	{
+		if (newOfOld[i] == EMBNULL)
+			newOfOld[i] = rank++;
+	}
+
+	return map.reorder(newOfOld);
+}
+
+/**
+ * Topological reordering: the vertices are stored in breadth first order
+ * (each connected component from its first vertex), so that the neighbors
+ * of a vertex are close in memory.
+ * The map is compacted first.
+ */
+template <typename MAP>
+bool reorderBFS(MAP& map)
+{
+	map.compact();
+
+	std::vector<Dart> vertices;
+	vertices.reserve(map.getNbDarts() / 4);
+
+	DartMarker<MAP> dm(map);
+	for (Dart d = map.begin(); d != map.end(); map.next(d))
+	{
+		if (dm.isMarked(d))
+			continue;
+
+		// vertices is the queue of the traversal
+		std::size_t first = vertices.size();
+		dm.template markOrbit<VERTEX>(d);
+		vertices.push_back(d);
+		for (std::size_t i = first; i < vertices.size(); ++i)
+		{
+			map.template foreach_dart_of_orbit<VERTEX>(vertices[i], [&] (Dart e)
+			{
+				Dart f = map.phi1(e);
+				if (!dm.isMarked(f))
+				{
+					dm.template markOrbit<VERTEX>(f);
+					vertices.push_back(f);
+				}
+			});
+		}
+	}
+
+	return reorderByVertices<MAP>(map, vertices);
+}
+
+/**
+ * index of the point (x,y,z) on the Hilbert curve of order bits
+ * (Skilling, "Programming the Hilbert curve")
+ */
+inline unsigned long long hilbertIndex(unsigned int x, unsigned int y, unsigned int z, unsigned int bits)
+{
+	unsigned int X[3] = { x, y, z };
+	unsigned int M = 1u << (bits - 1);
+
+	// inverse undo
+	for (unsigned int Q = M; Q > 1; Q >>= 1)
+	{
+		unsigned int P = Q - 1;
+		for (unsigned int i = 0; i < 3; ++i)
+		{
+			if (X[i] & Q)
+				X[0] ^= P;
+			else
+			{
+				unsigned int t = (X[0] ^ X[i]) & P;
+				X[0] ^= t;
+				X[i] ^= t;
+			}
+		}
+	}
+
+	// Gray encode
+	X[1] ^= X[0];
+	X[2] ^= X[1];
+	unsigned int t = 0;
+	for (unsigned int Q = M; Q > 1; Q >>= 1)
+	{
+		if (X[2] & Q)
+			t ^= Q - 1;
+	}
+	for (unsigned int i = 0; i < 3; ++i)
+		X[i] ^= t;
+
+	// interleave the bits of the transposed index
+	unsigned long long h = 0;
+	for (int b = int(bits) - 1; b >= 0; --b)
+	{
+		for (unsigned int i = 0; i < 3; ++i)
+			h = (h << 1) | ((X[i] >> b) & 1u);
+	}
+	return h;
+}
+
+/**
+ * Spatial reordering: the vertices are stored along a Hilbert curve
+ * through the bounding box of the positions, so that close vertices
+ * are close in memory.
+ * The map is compacted first.
+ */
+template <typename PFP>
+bool reorderHilbert(typename PFP::MAP& map, const VertexAttribute<typename PFP::VEC3, typename PFP::MAP>& position)
+{
+	typedef typename PFP::MAP MAP;
+	typedef typename PFP::VEC3 VEC3;
+	typedef typename PFP::REAL REAL;
+
+	map.compact();
+
+	const unsigned int bits = 21;
+	Geom::BoundingBox<VEC3> bb = Algo::Geometry::computeBoundingBox<PFP>(map, position);
+	VEC3 bbMin = bb.min();
+	REAL size = bb.maxSize();
+	REAL scale = (size > REAL(0)) ? REAL((1u << bits) - 1) / size : REAL(0);
+
+	std::vector< std::pair<unsigned long long, Dart> > keys;
+	keys.reserve(map.getNbDarts() / 4);
+	foreach_cell<VERTEX>(map, [&] (Vertex v)
+	{
+		VEC3 p = (position[v] - bbMin) * scale;
+		unsigned int c[3];
+		for (unsigned int i = 0; i < 3; ++i)
+			c[i] = (p[i] > REAL(0)) ? (unsigned int)(p[i]) : 0u;
+		keys.push_back(std::make_pair(hilbertIndex(c[0], c[1], c[2], bits), v.dart));
+	});
+
+	std::sort(keys.begin(), keys.end(), [] (const std::pair<unsigned long long, Dart>& a, const std::pair<unsigned long long, Dart>& b)
+	{
+		return (a.first < b.first) || ((a.first == b.first) && (a.second.index < b.second.index));
+	});
+
+	std::vector<Dart> vertices;
+	vertices.reserve(keys.size());
+	for (unsigned int i = 0; i < keys.size(); ++i)
+		vertices.push_back(keys[i].second);
+	std::vector< std::pair<unsigned long long, Dart> >().swap(keys);
+
+	return reorderByVertices<MAP>(map, vertices);
+}
+
+} // namespace Topo
+
+} // namespace Algo
+
+} // namespace CGoGN
+
+#endif
@@ -0,0 +1,119 @@
+/*******************************************************************************
+ * CGoGN: Combinatorial and Geometric modeling with Generic N-dimensional Maps  *
+ * version 0.1                                                                  *
+ * Copyright (C) 2009-2012, IGG Team, LSIIT, University of Strasbourg           *
+ *                                                                              *
+ * This library is free software; you can redistribute it and/or modify it      *
+ * under the terms of the GNU Lesser General Public License as published by the *
+ * Free Software Foundation; either version 2.1 of the License, or (at your     *
+ * option) any later version.                                                   *
+ *                                                                              *
+ * This library is distributed in the hope that it will be useful, but WITHOUT  *
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or        *
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License  *
+ * for more details.                                                            *
+ *                                                                              *
+ * You should have received a copy of the GNU Lesser General Public License     *
+ * along with this library; if not, write to the Free Software Foundation,      *
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301 USA.           *
+ *                                                                              *
+ * Web site: http://cgogn.unistra.fr/                                           *
+ * Contact information: cgogn@unistra.fr                                        *
+ *                                                                              *
+ *******************************************************************************/
+
+#ifndef __ALGO_TOPO_STREAMING__
+#define __ALGO_TOPO_STREAMING__
+
+#include <vector>
+#include <algorithm>
+
+#include "Topology/generic/genericmap.h"
+
+namespace CGoGN
+{
+
+namespace Algo
+{
+
+namespace Topo
+{
+
+namespace Streaming
+{
+
+/**
+ * touch the blocks of the cells of the darts [first,last) in the container of ORBIT
+ */
+template <unsigned int ORBIT, typename MAP>
+void touchCellBlocks(MAP& map, unsigned int first, unsigned int last, std::vector<unsigned int>& blocks)
+{
+	if (!map.template isOrbitEmbedded<ORBIT>())
+		return;
+
+	const AttributeContainer& dc = map.template getAttributeContainer<DART>();
+	const AttributeContainer& cont = map.template getAttributeContainer<ORBIT>();
+	if (cont.getPager() == NULL)
+		return;
+
+	const AttributeMultiVector<unsigned int>& emb = *(map.template getEmbeddingAttributeVector<ORBIT>());
+	blocks.clear();
+	for (unsigned int i = first; i < last; ++i)
+	{
+		if (dc.used(i) && (emb[i] != EMBNULL))
+			blocks.push_back(emb[i] / _BLOCKSIZE_);
+	}
+	std::sort(blocks.begin(), blocks.end());
+	blocks.erase(std::unique(blocks.begin(), blocks.end()), blocks.end());
+
+	for (std::vector<unsigned int>::const_iterator it = blocks.begin(); it != blocks.end(); ++it)
+		cont.touchBlock(*it);
+}
+
+} // namespace Streaming
+
+/**
+ * Apply a function on each dart of the map, by chunks of blocks of consecutive
+ * darts, for maps larger than RAM (see GenericMap::setPager). Before each chunk,
+ * the blocks of the chunk are touched in the dart container and in the containers
+ * of the embedded orbits, so that the pager keeps them and evicts the others.
+ * The working set is small when neighbor darts have close indices: reorder the
+ * map first (reorderHilbert or reorderBFS).
+ * Only for maps whose darts are the lines of the dart container (MapMono).
+ * @param f a callable taking a Dart
+ * @param nbBlocks number of blocks of darts of each chunk
+ */
+template <typename MAP, typename FUNC>
+void foreachDartChunk(MAP& map, FUNC f, unsigned int nbBlocks = 16)
+{
+	const AttributeContainer& dc = map.template getAttributeContainer<DART>();
+	const unsigned int end = dc.realEnd();
+	const unsigned int chunk = nbBlocks * _BLOCKSIZE_;
+
+	std::vector<unsigned int> blocks;
+	for (unsigned int first = 0; first < end; first += chunk)
+	{
+		unsigned int last = std::min(first + chunk, end);
+
+		for (unsigned int b = first / _BLOCKSIZE_; b <= (last - 1) / _BLOCKSIZE_; ++b)
+			dc.touchBlock(b);
+		Streaming::touchCellBlocks<VERTEX>(map, first, last, blocks);
+		Streaming::touchCellBlocks<EDGE>(map, first, last, blocks);
+		Streaming::touchCellBlocks<FACE>(map, first, last, blocks);
+		Streaming::touchCellBlocks<VOLUME>(map, first, last, blocks);
+
+		for (unsigned int i = first; i < last; ++i)
+		{
+			if (dc.used(i))
+				f(Dart(i));
+		}
+	}
+}
+
+} // namespace Topo
+
+} // namespace Algo
+
+} // namespace CGoGN
+
+#endif
@@ -28,6 +28,7 @@
 #include "Container/sizeblock.h"
 #include "Container/holeblockref.h"
 #include "Container/attributeMultiVector.h"
+#include "Utils/threadPool.h"
 
 #include <vector>
 #include <map>
@@ -145,6 +146,11 @@ protected:
 	 */
 	std::map<std::string, RegisteredBaseAttribute*>* m_attributes_registry_map;
 
+	/**
+	 * pager of the blocks of the attributes (NULL for the heap)
+	 */
+	Utils::BlockPager* m_pager;
+
 public:
 	AttributeContainer();
 
@@ -158,7 +164,7 @@ public:
 
 	void setContainerBrowser(ContainerBrowser* bro) { m_currentBrowser = bro; }
 
-	bool hasBrowser() { return m_currentBrowser != NULL; }
+	bool hasBrowser() const { return m_currentBrowser != NULL; }
 
 	/**************************************
 	 *          BASIC FEATURES            *
@@ -173,8 +179,8 @@ public:
 	template <typename T>
 	AttributeMultiVector<T>* addAttribute(const std::string& attribName);
 
-	/// special version for marker
-	AttributeMultiVector<MarkerBool>* addMarkerAttribute(const std::string& attribName);
+	/// special version for marker (epoch: stamps storage, see AttributeMultiVector<MarkerBool>)
+	AttributeMultiVector<MarkerBool>* addMarkerAttribute(const std::string& attribName, bool epoch = false);
 
 	/**
 	 * add a new attribute to the container
@@ -305,6 +311,36 @@ public:
 	 */
 	void realRNext(unsigned int &it) const;
 
+	/**
+	 * number of blocks of lines of the container
+	 */
+	unsigned int getNbBlocks() const;
+
+	/**
+	 * is there no used line in block b
+	 */
+	bool blockEmpty(unsigned int b) const;
+
+	/**
+	 * are all the lines of block b used
+	 */
+	bool blockFull(unsigned int b) const;
+
+	/**
+	 * tell the pager (if any) that the lines of block b are going to be used
+	 */
+	void touchBlock(unsigned int b) const;
+
+	/**
+	 * apply a function on each used line of the container (browser is not taken into account)
+	 * the blocks are distributed over the workers of the pool: empty blocks are skipped
+	 * and holes are only searched in blocks that are not full
+	 * @param pool the thread pool that runs the function
+	 * @param func a callable taking (line index, worker index)
+	 */
+	template <typename FUNC>
+	void parallelForeachLine(Utils::ThreadPool& pool, FUNC func) const;
+
 	/**************************************
 	 *       INFO ABOUT ATTRIBUTES        *
 	 **************************************/
@@ -356,6 +392,14 @@ public:
 	 */
 	void swap(AttributeContainer& cont);
 
+	/**
+	 * allocate the blocks of the attributes (current and future ones) with a pager,
+	 * markers excepted; NULL brings the blocks back on the heap
+	 */
+	void setPager(Utils::BlockPager* pager);
+
+	Utils::BlockPager* getPager() const { return m_pager; }
+
 	/**
 	 * clear the container
 	 * @param removeAttrib remove the attributes (not only their data)
@@ -368,6 +412,12 @@ public:
 	 */
 	void compact(std::vector<unsigned int>& mapOldNew);
 
+	/**
+	 * move the lines of a compact container (no hole, see compact)
+	 * @param newOfOld newOfOld[i] is the new index of line i (permutation of [0,size()))
+	 */
+	void permute(const std::vector<unsigned int>& newOfOld);
+
 	/**
 	 * Test the fragmentation of container,
 	 * in fact just size/max_size
@@ -406,6 +456,11 @@ public:
 	 */
 	inline void copyLine(unsigned int dstIndex, unsigned int srcIndex);
 
+	/**
+	 * swap the contents (and ref counters) of two used lines
+	 */
+	inline void swapLine(unsigned int index1, unsigned int index2);
+
 	/**
 	* increment the ref counter of the given line
 	* @param index index of the line
@@ -527,6 +582,29 @@ public:
 	*/
 	bool loadBin(CGoGNistream& fs);
 
+	/**
+	* save in a mappable file: same content than saveBin with the data
+	* blocks of attributes aligned for Utils::MappedFile
+	* @param fs a raw (not compressed) file stream
+	* @param id the id to save
+	*/
+	void saveMappable(std::ostream& fs, unsigned int id) const;
+
+	/**
+	* get id from mapped file
+	* @param mf mapped file
+	* @param offset (IN/OUT) position in the file
+	* @param id (OUT) the id of attribute container
+	*/
+	static bool loadMappedId(const Utils::MappedFile& mf, std::size_t& offset, unsigned int& id);
+
+	/**
+	* load from mapped file, attributes adopt the blocks of the mapping
+	* @param mf mapped file
+	* @param offset (IN/OUT) position in the file
+	*/
+	bool loadMapped(Utils::MappedFile& mf, std::size_t& offset);
+
 	/**
 	 * copy container
 	 * TODO a version that compact on the fly ?
@@ -105,6 +105,7 @@ AttributeMultiVector<T>* AttributeContainer::addAttribute(const std::string& att
 	m_lineCost += sizeof(T) ;
 
 	// resize the new attribute so that it has the same size than others
+	amv->setPager(m_pager) ;
 	amv->setNbBlocks(uint32(m_holesBlocks.size())) ;
 
 	m_nbAttributes++ ;
@@ -142,6 +143,7 @@ void AttributeContainer::addAttribute(const std::string& attribName, const std::
 	m_lineCost += sizeof(T) ;
 
 	// resize the new attribute so that it has the same size than others
+	amv->setPager(m_pager) ;
 	amv->setNbBlocks(uint32(m_holesBlocks.size())) ;
 
 	m_nbAttributes++;
@@ -336,6 +338,67 @@ inline void AttributeContainer::realRNext(unsigned int &it) const
 	} while ((it !=0xffffffff) && (!used(it)));
 }
 
+inline unsigned int AttributeContainer::getNbBlocks() const
+{
+	return uint32(m_holesBlocks.size());
+}
+
+inline bool AttributeContainer::blockEmpty(unsigned int b) const
+{
+	return m_holesBlocks[b]->empty();
+}
+
+inline bool AttributeContainer::blockFull(unsigned int b) const
+{
+	return m_holesBlocks[b]->full();
+}
+
+inline void AttributeContainer::touchBlock(unsigned int b) const
+{
+	if (m_pager == NULL)
+		return;
+	for (std::vector<AttributeMultiVectorGen*>::const_iterator it = m_tableAttribs.begin(); it != m_tableAttribs.end(); ++it)
+	{
+		if (*it != NULL)
+			(*it)->touchBlock(b);
+	}
+}
+
+template <typename FUNC>
+void AttributeContainer::parallelForeachLine(Utils::ThreadPool& pool, FUNC func) const
+{
+	const unsigned int end = m_maxSize;
+	const unsigned int nbBlocks = (end + _BLOCKSIZE_ - 1) / _BLOCKSIZE_;
+
+	// one block per chunk of work
+	pool.parallelFor(nbBlocks, 1, [&] (unsigned int bb, unsigned int be, unsigned int w)
+	{
+		for (unsigned int b = bb; b < be; ++b)
+		{
+			const HoleBlockRef* block = m_holesBlocks[b];
+			if (block->empty())
+				continue;
+
+			const unsigned int first = b * _BLOCKSIZE_;
+			const unsigned int last = (end - first > _BLOCKSIZE_) ? first + _BLOCKSIZE_ : end;
+
+			if (block->full())
+			{
+				for (unsigned int i = first; i < last; ++i)
+					func(i, w);
+			}
+			else
+			{
+				for (unsigned int i = first; i < last; ++i)
+				{
+					if (block->used(i - first))
+						func(i, w);
+				}
+			}
+		}
+	});
+}
+
 /**************************************
  *          LINES MANAGEMENT          *
  **************************************/
@@ -371,6 +434,24 @@ inline void AttributeContainer::copyLine(unsigned int dstIndex, unsigned int src
 	}
 }
 
+inline void AttributeContainer::swapLine(unsigned int index1, unsigned int index2)
+{
+	for(unsigned int i = 0; i < m_tableAttribs.size(); ++i)
+	{
+		if (m_tableAttribs[i] != NULL)
+			m_tableAttribs[i]->swapElt(index1, index2);
+	}
+
+	for(unsigned int i = 0; i < m_tableMarkerAttribs.size(); ++i)
+	{
+		m_tableMarkerAttribs[i]->swapElt(index1, index2);
+	}
+
+	unsigned int nbRefs = getNbRefs(index1);
+	setNbRefs(index1, getNbRefs(index2));
+	setNbRefs(index2, nbRefs);
+}
+
 inline void AttributeContainer::refLine(unsigned int index)
 {
 	m_holesBlocks[index / _BLOCKSIZE_]->ref(index % _BLOCKSIZE_);
@@ -26,14 +26,19 @@
 #define __ATTRIBUTE_MULTI_VECTOR__
 
 #include <vector>
+#include <utility>
+#include <algorithm>
 #include <iostream>
 #include <sstream>
 #include <fstream>
 #include <cstring>
+#include <new>
 
 #include <typeinfo>
 
 #include "Container/sizeblock.h"
+#include "Utils/mappedFile.h"
+#include "Utils/blockPager.h"
 
 namespace CGoGN
 {
@@ -79,6 +84,17 @@ protected:
 	 */
 	unsigned int m_index;
 
+	/**
+	 * version of the last modification of each block
+	 * (the blocks beyond the end of the vector are modified at the current version)
+	 */
+	mutable std::vector<unsigned int> m_blockVersions;
+
+	/**
+	 * version given to the modifications (incremented by each synchronization)
+	 */
+	mutable unsigned int m_version;
+
 public:
 	AttributeMultiVectorGen(const std::string& strName, const std::string& strType);
 
@@ -136,6 +152,16 @@ public:
 	*/
 	virtual void addBlock() = 0;
 
+	/**
+	* allocate the blocks with a pager (NULL for the heap), existing blocks are moved
+	*/
+	virtual void setPager(Utils::BlockPager* pager) = 0;
+
+	/**
+	* tell the pager (if any) that block b is going to be used
+	*/
+	virtual void touchBlock(unsigned int b) const = 0;
+
 	/**
 	* set the number of blocks
 	*/
@@ -167,6 +193,41 @@ public:
 
 	virtual unsigned int getBlocksPointers(std::vector<void*>& addr, unsigned int& byteBlockSize) const = 0;
 
+	/**************************************
+	 *       MODIFICATIONS TRACKING       *
+	 **************************************/
+
+	/**
+	 * mark the block of element i as modified
+	 * (concurrent calls are allowed: they all write the same value)
+	 */
+	void setDirty(unsigned int i);
+
+	/**
+	 * mark the blocks of the elements [begin, end[ as modified
+	 */
+	void setDirtyRange(unsigned int begin, unsigned int end);
+
+	/**
+	 * mark all the blocks as modified
+	 */
+	void setAllDirty();
+
+	/**
+	 * get the ranges [first, second[ of the elements of the blocks modified since
+	 * a synchronization (contiguous blocks are merged), and synchronize
+	 * @param since version returned by the last synchronization of this attribute (0 for all the blocks)
+	 * @param ranges the ranges of elements (aligned on blocks)
+	 * @return the version of this synchronization
+	 */
+	unsigned int getDirtyRanges(unsigned int since, std::vector<std::pair<unsigned int, unsigned int> >& ranges) const;
+
+	/**
+	 * synchronize without getting the ranges (all the data has been read)
+	 * @return the version of this synchronization
+	 */
+	unsigned int synchronize() const;
+
 	/**************************************
 	 *          LINES MANAGEMENT          *
 	 **************************************/
@@ -192,6 +253,30 @@ public:
 
 	static bool skipLoadBin(CGoGNistream& fs);
 
+	/**
+	 * save in a mappable file: same infos than saveBin but the data
+	 * blocks start on a Utils::MappedFile::ALIGNMENT boundary
+	 * @param fs raw (not compressed) filestream
+	 * @param id id of mv
+	 */
+	virtual void saveMappable(std::ostream& fs, unsigned int id) = 0;
+
+	static bool loadMappedInfos(const Utils::MappedFile& mf, std::size_t& offset, std::string& name, std::string& type);
+
+	/**
+	 * load from a mapped file, data blocks are adopted (not copied) when possible
+	 * @param mf mapped file
+	 * @param offset (IN/OUT) position in the file
+	 */
+	virtual bool loadMapped(Utils::MappedFile& mf, std::size_t& offset) = 0;
+
+	static bool skipLoadMapped(const Utils::MappedFile& mf, std::size_t& offset);
+
+protected:
+	void saveMappableInfos(std::ostream& fs, unsigned int id, unsigned int nbBlocks, unsigned int blockBytes);
+
+public:
+
 	/**
 	 * lecture binaire
 	 * @param fs filestream
@@ -214,8 +299,29 @@ class AttributeMultiVector : public AttributeMultiVectorGen
 	*/
 	std::vector<T*> m_tableData;
 
+	/**
+	* mapped file some blocks are adopted from (NULL if none)
+	*/
+	Utils::MappedFile* m_mapping;
+
+	/**
+	* pager the blocks are allocated with (NULL for the heap)
+	*/
+	Utils::BlockPager* m_pager;
+
 	inline void setTypeCode();
 
+	/**
+	* allocate a block (with the pager if any)
+	*/
+	inline T* newBlock();
+
+	/**
+	* free a block (blocks adopted from m_mapping are not allocated)
+	*/
+	inline void releaseBlock(T* ptr);
+	void releaseMapping();
+
 public:
 	AttributeMultiVector(const std::string& strName, const std::string& strType);
 
@@ -231,6 +337,10 @@ public:
 
 	void addBlock();
 
+	void setPager(Utils::BlockPager* pager);
+
+	void touchBlock(unsigned int b) const;
+
 	void setNbBlocks(unsigned int nbb);
 
 	unsigned int getNbBlocks() const;
@@ -320,6 +430,15 @@ public:
 	 */
 	bool loadBin(CGoGNistream& fs);
 
+	void saveMappable(std::ostream& fs, unsigned int id);
+
+	/**
+	 * blocks are adopted from the mapped file: if the mapping is copy-on-write
+	 * the written pages are privately copied, if it is read-only the data must
+	 * not be modified. As for saveBin/loadBin, T must be a plain data type.
+	 */
+	bool loadMapped(Utils::MappedFile& mf, std::size_t& offset);
+
 	/**
 	 * lecture binaire
 	 * @param fs filestream
@@ -27,10 +27,11 @@ namespace CGoGN
 {
 
 inline AttributeMultiVectorGen::AttributeMultiVectorGen(const std::string& strName, const std::string& strType):
-	m_attrName(strName), m_typeName(strType)
+	m_attrName(strName), m_typeName(strType), m_version(1)
 {}
 
-inline AttributeMultiVectorGen::AttributeMultiVectorGen()
+inline AttributeMultiVectorGen::AttributeMultiVectorGen():
+	m_version(1)
 {}
 
 inline AttributeMultiVectorGen::~AttributeMultiVectorGen()
@@ -90,19 +91,80 @@ inline CGoGNCodeType AttributeMultiVectorGen::getTypeCode() const
 	return m_typeCode;
 }
 
+/**************************************
+ *       MODIFICATIONS TRACKING       *
+ **************************************/
+
+inline void AttributeMultiVectorGen::setDirty(unsigned int i)
+{
+	unsigned int b = i / _BLOCKSIZE_;
+	if (b < m_blockVersions.size())
+		m_blockVersions[b] = m_version;
+}
+
+inline void AttributeMultiVectorGen::setDirtyRange(unsigned int begin, unsigned int end)
+{
+	if (begin >= end)
+		return;
+	unsigned int bEnd = std::min((end - 1) / _BLOCKSIZE_ + 1, uint32(m_blockVersions.size()));
+	for (unsigned int b = begin / _BLOCKSIZE_; b < bEnd; ++b)
+		m_blockVersions[b] = m_version;
+}
+
+inline void AttributeMultiVectorGen::setAllDirty()
+{
+	m_blockVersions.clear();
+}
+
+inline unsigned int AttributeMultiVectorGen::getDirtyRanges(unsigned int since, std::vector<std::pair<unsigned int, unsigned int> >& ranges) const
+{
+	ranges.clear();
+	unsigned int nbb = getNbBlocks();
+	m_blockVersions.resize(nbb, m_version);
+	if (since >= m_version)		// not given by this attribute
+		since = 0;
+
+	unsigned int b = 0;
+	while (b < nbb)
+	{
+		if (m_blockVersions[b] > since)
+		{
+			unsigned int e = b + 1;
+			while (e < nbb && m_blockVersions[e] > since)
+				++e;
+			ranges.push_back(std::make_pair(b * _BLOCKSIZE_, e * _BLOCKSIZE_));
+			b = e;
+		}
+		else
+			++b;
+	}
+
+	return m_version++;
+}
+
+inline unsigned int AttributeMultiVectorGen::synchronize() const
+{
+	m_blockVersions.resize(getNbBlocks(), m_version);
+	return m_version++;
+}
+
 /***************************************************************************************************/
 /***************************************************************************************************/
 
 
 template <typename T>
 AttributeMultiVector<T>::AttributeMultiVector(const std::string& strName, const std::string& strType):
-	AttributeMultiVectorGen(strName, strType)
+	AttributeMultiVectorGen(strName, strType),
+	m_mapping(NULL),
+	m_pager(NULL)
 {
 	m_tableData.reserve(1024);
 }
 
 template <typename T>
-AttributeMultiVector<T>::AttributeMultiVector()
+AttributeMultiVector<T>::AttributeMultiVector():
+	m_mapping(NULL),
+	m_pager(NULL)
 {
 	m_tableData.reserve(1024);
 }
@@ -111,7 +173,10 @@ template <typename T>
 AttributeMultiVector<T>::~AttributeMultiVector()
 {
 	for (typename std::vector< T* >::iterator it = m_tableData.begin(); it != m_tableData.end(); ++it)
-		delete[] (*it);
+		releaseBlock(*it);
+	releaseMapping();
+	if (m_pager != NULL)
+		m_pager->unref();
 }
 
 template <typename T>
@@ -126,10 +191,50 @@ inline AttributeMultiVectorGen* AttributeMultiVector<T>::new_obj()
  *       MULTI VECTOR MANAGEMENT      *
  **************************************/
 
+template <typename T>
+inline T* AttributeMultiVector<T>::newBlock()
+{
+	if (m_pager == NULL)
+		return new T[_BLOCKSIZE_];
+
+	T* ptr = reinterpret_cast<T*>(m_pager->allocate(_BLOCKSIZE_ * sizeof(T)));
+	if (ptr == NULL)
+		throw std::bad_alloc();
+	for (unsigned int i = 0; i < _BLOCKSIZE_; ++i)
+		new (ptr + i) T;
+	return ptr;
+}
+
+template <typename T>
+inline void AttributeMultiVector<T>::releaseBlock(T* ptr)
+{
+	if ((m_mapping != NULL) && m_mapping->contains(ptr))
+		return;
+
+	if ((m_pager != NULL) && m_pager->contains(ptr))
+	{
+		for (unsigned int i = 0; i < _BLOCKSIZE_; ++i)
+			ptr[i].~T();
+		m_pager->release(ptr);
+	}
+	else
+		delete[] ptr;
+}
+
+template <typename T>
+void AttributeMultiVector<T>::releaseMapping()
+{
+	if (m_mapping != NULL)
+	{
+		m_mapping->unref();
+		m_mapping = NULL;
+	}
+}
+
 template <typename T>
 inline void AttributeMultiVector<T>::addBlock()
 {
-	T* ptr = new T[_BLOCKSIZE_];
+	T* ptr = newBlock();
 	m_tableData.push_back(ptr);
 	// init
 //	T* endPtr = ptr + _BLOCKSIZE_;
@@ -137,6 +242,42 @@ inline void AttributeMultiVector<T>::addBlock()
 //		*ptr++ = T(0);
 }
 
+template <typename T>
+void AttributeMultiVector<T>::setPager(Utils::BlockPager* pager)
+{
+	if (pager == m_pager)
+		return;
+	if (pager != NULL)
+		pager->ref();
+
+	// move the allocated blocks (mapped blocks stay in their file)
+	for (typename std::vector<T*>::iterator it = m_tableData.begin(); it != m_tableData.end(); ++it)
+	{
+		if ((m_mapping != NULL) && m_mapping->contains(*it))
+			continue;
+
+		Utils::BlockPager* old = m_pager;
+		m_pager = pager;
+		T* ptr = newBlock();
+		for (unsigned int i = 0; i < _BLOCKSIZE_; ++i)
+			ptr[i] = (*it)[i];
+		m_pager = old;
+		releaseBlock(*it);
+		*it = ptr;
+	}
+
+	if (m_pager != NULL)
+		m_pager->unref();
+	m_pager = pager;
+}
+
+template <typename T>
+inline void AttributeMultiVector<T>::touchBlock(unsigned int b) const
+{
+	if ((m_pager != NULL) && (b < m_tableData.size()))
+		m_pager->touch(m_tableData[b]);
+}
+
 template <typename T>
 void AttributeMultiVector<T>::setNbBlocks(unsigned int nbb)
 {
@@ -148,8 +289,10 @@ void AttributeMultiVector<T>::setNbBlocks(unsigned int nbb)
 	else
 	{
 		for (size_t i = nbb; i < m_tableData.size(); ++i)
-			delete[] m_tableData[i];
+			releaseBlock(m_tableData[i]);
 		m_tableData.resize(nbb);
+		if (m_blockVersions.size() > nbb)
+			m_blockVersions.resize(nbb);
 	}
 }
 
@@ -172,6 +315,7 @@ void AttributeMultiVector<T>::addBlocksBefore(unsigned int nbb)
 		tempo.push_back(*it);
 
 	m_tableData.swap(tempo);
+	setAllDirty();
 }
 
 template <typename T>
@@ -192,6 +336,7 @@ bool AttributeMultiVector<T>::copy(const AttributeMultiVectorGen* atmvg)
 
 	for (unsigned int i = 0; i < atmv->m_tableData.size(); ++i)
 		std::memcpy(m_tableData[i], atmv->m_tableData[i], _BLOCKSIZE_ * sizeof(T));
+	setAllDirty();
 
 	return true;
 }
@@ -213,6 +358,10 @@ bool AttributeMultiVector<T>::swap(AttributeMultiVectorGen* atmvg)
 	}
 
 	m_tableData.swap(atmv->m_tableData) ;
+	std::swap(m_mapping, atmv->m_mapping) ;
+	std::swap(m_pager, atmv->m_pager) ;
+	setAllDirty();
+	atmv->setAllDirty();
 	return true;
 }
 
@@ -233,7 +382,18 @@ bool AttributeMultiVector<T>::merge(const AttributeMultiVectorGen& att)
 	}
 
 	for (typename std::vector<T*>::const_iterator it = attrib->m_tableData.begin(); it != attrib->m_tableData.end(); ++it)
-		m_tableData.push_back(*it);
+	{
+		if (((attrib->m_mapping != NULL) && attrib->m_mapping->contains(*it)) || (attrib->m_pager != m_pager))
+		{
+			// mapped blocks are owned by their attribute and paged blocks by
+			// their pager: copy them
+			T* ptr = newBlock();
+			std::memcpy(ptr, *it, _BLOCKSIZE_ * sizeof(T));
+			m_tableData.push_back(ptr);
+		}
+		else
+			m_tableData.push_back(*it);
+	}
 
 	return true;
 }
@@ -242,8 +402,10 @@ template <typename T>
 inline void AttributeMultiVector<T>::clear()
 {
 	for (typename std::vector< T* >::iterator it = m_tableData.begin(); it != m_tableData.end(); ++it)
-		delete[] (*it);
+		releaseBlock(*it);
 	m_tableData.clear();
+	releaseMapping();
+	setAllDirty();
 }
 
 template <typename T>
@@ -290,12 +452,14 @@ template <typename T>
 inline void AttributeMultiVector<T>::initElt(unsigned int id)
 {
 	m_tableData[id / _BLOCKSIZE_][id % _BLOCKSIZE_] = T(); // T(0);
+	setDirty(id);
 }
 
 template <typename T>
 inline void AttributeMultiVector<T>::copyElt(unsigned int dst, unsigned int src)
 {
 	m_tableData[dst / _BLOCKSIZE_][dst % _BLOCKSIZE_] = m_tableData[src / _BLOCKSIZE_][src % _BLOCKSIZE_];
+	setDirty(dst);
 }
 
 template <typename T>
@@ -304,12 +468,16 @@ void AttributeMultiVector<T>::swapElt(unsigned int id1, unsigned int id2)
 	T data = m_tableData[id1 / _BLOCKSIZE_][id1 % _BLOCKSIZE_] ;
 	m_tableData[id1 / _BLOCKSIZE_][id1 % _BLOCKSIZE_] = m_tableData[id2 / _BLOCKSIZE_][id2 % _BLOCKSIZE_] ;
 	m_tableData[id2 / _BLOCKSIZE_][id2 % _BLOCKSIZE_] = data ;
+	setDirty(id1);
+	setDirty(id2);
 }
 
 template <typename T>
 void AttributeMultiVector<T>::overwrite(unsigned int src_b, unsigned int src_id, unsigned int dst_b, unsigned int dst_id)
 {
 	m_tableData[dst_b][dst_id] = m_tableData[src_b][src_id];
+	if (dst_b < m_blockVersions.size())
+		m_blockVersions[dst_b] = m_version;
 }
 
 
@@ -376,10 +544,11 @@ bool AttributeMultiVector<T>::loadBin(CGoGNistream& fs)
 	m_tableData.resize(nb);
 	for(unsigned int i = 0; i < nb; ++i)
 	{
-		T* ptr = new T[_BLOCKSIZE_];
+		T* ptr = newBlock();
 		fs.read(reinterpret_cast<char*>(ptr),_BLOCKSIZE_*sizeof(T));
 		m_tableData[i] = ptr;
 	}
+	setAllDirty();
 
 	return true;
 }
@@ -412,6 +581,97 @@ inline bool AttributeMultiVectorGen::skipLoadBin(CGoGNistream& fs)
 }
 
 
+inline void AttributeMultiVectorGen::saveMappableInfos(std::ostream& fs, unsigned int id, unsigned int nbBlocks, unsigned int blockBytes)
+{
+	unsigned int nbs[3];
+	nbs[0] = id;
+	nbs[1] = uint32(m_attrName.size()+1);
+	nbs[2] = uint32(m_typeName.size()+1);
+	fs.write(reinterpret_cast<const char*>(nbs), 3*sizeof(unsigned int));
+	fs.write(m_attrName.c_str(), nbs[1]);
+	fs.write(m_typeName.c_str(), nbs[2]);
+
+	// number of blocks and size of a block (a whole attribute may exceed 4GB)
+	nbs[0] = nbBlocks;
+	nbs[1] = blockBytes;
+	fs.write(reinterpret_cast<const char*>(nbs), 2*sizeof(unsigned int));
+
+	Utils::MappedFile::pad(fs);
+}
+
+inline bool AttributeMultiVectorGen::loadMappedInfos(const Utils::MappedFile& mf, std::size_t& offset, std::string& name, std::string& type)
+{
+	unsigned int nbs[3];
+	if (!mf.read(offset, nbs, 3*sizeof(unsigned int)))
+		return false;
+
+	const char* s1 = mf.get(offset, nbs[1]);
+	const char* s2 = mf.get(offset, nbs[2]);
+	if ((s1 == NULL) || (s2 == NULL) || (nbs[1] == 0) || (nbs[2] == 0))
+		return false;
+
+	name = std::string(s1, nbs[1] - 1);
+	type = std::string(s2, nbs[2] - 1);
+
+	return true;
+}
+
+inline bool AttributeMultiVectorGen::skipLoadMapped(const Utils::MappedFile& mf, std::size_t& offset)
+{
+	unsigned int nbs[2];
+	if (!mf.read(offset, nbs, 2*sizeof(unsigned int)))
+		return false;
+
+	offset = Utils::MappedFile::align(offset);
+	return mf.get(offset, std::size_t(nbs[0]) * nbs[1]) != NULL;
+}
+
+template <typename T>
+void AttributeMultiVector<T>::saveMappable(std::ostream& fs, unsigned int id)
+{
+	saveMappableInfos(fs, id, uint32(m_tableData.size()), _BLOCKSIZE_*sizeof(T));
+
+	// store data blocks (_BLOCKSIZE_*sizeof(T) keeps them aligned)
+	for (typename std::vector<T*>::const_iterator it = m_tableData.begin(); it != m_tableData.end(); ++it)
+		fs.write(reinterpret_cast<const char*>(*it), _BLOCKSIZE_*sizeof(T));
+}
+
+template <typename T>
+bool AttributeMultiVector<T>::loadMapped(Utils::MappedFile& mf, std::size_t& offset)
+{
+	unsigned int nbs[2];
+	if (!mf.read(offset, nbs, 2*sizeof(unsigned int)))
+		return false;
+
+	if (nbs[1] != _BLOCKSIZE_*sizeof(T))
+	{
+		CGoGNerr << "Error loading attribute " << m_attrName << ": wrong block size" << CGoGNendl;
+		return false;
+	}
+
+	clear();
+	if (nbs[0] > 0)
+	{
+		mf.ref();
+		m_mapping = &mf;
+	}
+
+	offset = Utils::MappedFile::align(offset);
+	m_tableData.resize(nbs[0]);
+	for (unsigned int i = 0; i < nbs[0]; ++i)
+	{
+		char* ptr = mf.get(offset, _BLOCKSIZE_*sizeof(T));
+		if (ptr == NULL)
+		{
+			m_tableData.resize(i);
+			return false;
+		}
+		m_tableData[i] = reinterpret_cast<T*>(ptr);
+	}
+
+	return true;
+}
+
 template <typename T>
 void AttributeMultiVector<T>::dump(unsigned int i) const
 {
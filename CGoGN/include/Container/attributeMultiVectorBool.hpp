@@ -22,6 +22,8 @@
 *                                                                              *
 *******************************************************************************/
 #include <cstring>
+#include <algorithm>
+#include <cassert>
 
 namespace CGoGN
 {
@@ -37,22 +39,47 @@ public:
 
 
 
+/**
+ * Attribute of markers. Two storages (chosen at creation, see setEpochMode):
+ * - bits: one bit per element, unmarking all clears the blocks
+ * - epochs: one stamp per element, an element is marked if its stamp is the
+ *   current epoch, so unmarking all only increments the epoch (O(1)); the
+ *   stamps are cleared when the epoch counter wraps.
+ */
 template <>
 class AttributeMultiVector<MarkerBool> : public AttributeMultiVectorGen
 {
+public:
+	typedef unsigned short EpochType;
+
+protected:
 	/**
 	* table of blocks of data pointers: vectors!
 	*/
 	std::vector< unsigned int* > m_tableData;
 
+	/**
+	* table of blocks of stamps (epoch mode)
+	*/
+	std::vector< EpochType* > m_tableEpochs;
+
+	/**
+	* current epoch (0 for bit storage)
+	*/
+	EpochType m_epoch;
+
+	static const unsigned int EPOCH_MAX = 0xffff;
+
 public:
 	AttributeMultiVector(const std::string& strName, const std::string& strType):
-		AttributeMultiVectorGen(strName, strType)
+		AttributeMultiVectorGen(strName, strType),
+		m_epoch(0)
 	{
 		m_tableData.reserve(1024);
 	}
 
-	AttributeMultiVector()
+	AttributeMultiVector():
+		m_epoch(0)
 	{
 		m_tableData.reserve(1024);
 	}
@@ -66,25 +93,65 @@ public:
 		return ptr;
 	}
 
+	/**
+	 * choose the storage (all marks are lost)
+	 * @param b true for epoch stamps, false for bits
+	 */
+	void setEpochMode(bool b)
+	{
+		if (b == isEpochMode())
+			return;
+		unsigned int nbb = getNbBlocks();
+		clear();
+		m_epoch = b ? 1 : 0;
+		setNbBlocks(nbb);
+	}
+
+	inline bool isEpochMode() const
+	{
+		return m_epoch != 0;
+	}
+
 	/**************************************
 	 *       MULTI VECTOR MANAGEMENT      *
 	 **************************************/
 
 	void addBlock()
 	{
+		if (m_epoch)
+		{
+			EpochType* ptr = new EpochType[_BLOCKSIZE_];
+			memset(ptr, 0, _BLOCKSIZE_ * sizeof(EpochType));
+			m_tableEpochs.push_back(ptr);
+			return;
+		}
 		unsigned int* ptr = new unsigned int[_BLOCKSIZE_/32];
 		memset(ptr,0,_BLOCKSIZE_/8);
 		m_tableData.push_back(ptr);
 //		std::cout << "Marker "<<this->getName()<<" - addBlock"<< std::endl;
 	}
 
+	/**
+	 * markers are small and often written: they always stay in memory
+	 */
+	void setPager(Utils::BlockPager* /*pager*/) {}
+
+	void touchBlock(unsigned int /*b*/) const {}
+
 	void setNbBlocks(unsigned int nbb)
 	{
-		if (nbb >= m_tableData.size())
+		if (nbb >= getNbBlocks())
 		{
-			for (size_t i= m_tableData.size(); i <nbb; ++i)
+			for (size_t i = getNbBlocks(); i <nbb; ++i)
 				addBlock();
 		}
+		else if (m_epoch)
+		{
+			for (size_t i = m_tableEpochs.size()-1; i>=nbb; --i)
+				delete[] m_tableEpochs[i];
+
+			m_tableEpochs.resize(nbb);
+		}
 		else
 		{
 			for (size_t i = m_tableData.size()-1; i>=nbb; --i)
@@ -97,6 +164,8 @@ public:
 
 	unsigned int getNbBlocks() const
 	{
+		if (m_epoch)
+			return uint32(m_tableEpochs.size());
 		return uint32(m_tableData.size());
 	}
 
@@ -111,12 +180,25 @@ public:
 			CGoGNerr << "trying to copy attributes of different type" << CGoGNendl;
 			return false;
 		}
+		if (atmv->isEpochMode() != isEpochMode())
+		{
+			CGoGNerr << "trying to copy markers of different storage" << CGoGNendl;
+			return false;
+		}
 //		if (atmv->m_typeName != m_typeName)
 //		{
 //			CGoGNerr << "trying to copy attributes with different type names" << CGoGNendl;
 //			return false;
 //		}
 
+		if (m_epoch)
+		{
+			m_epoch = atmv->m_epoch;
+			for (unsigned int i = 0; i < atmv->m_tableEpochs.size(); ++i)
+				memcpy(m_tableEpochs[i], atmv->m_tableEpochs[i], _BLOCKSIZE_ * sizeof(EpochType));
+			return true;
+		}
+
 		for (unsigned int i = 0; i < atmv->m_tableData.size(); ++i)
 			memcpy(m_tableData[i],atmv->m_tableData[i],_BLOCKSIZE_/8);
 
@@ -139,6 +221,8 @@ public:
 		}
 
 		m_tableData.swap(atmv->m_tableData) ;
+		m_tableEpochs.swap(atmv->m_tableEpochs) ;
+		std::swap(m_epoch, atmv->m_epoch) ;
 		return true;
 	}
 
@@ -157,8 +241,16 @@ public:
 			return false;
 		}
 
+		if (attrib->isEpochMode() != isEpochMode() || attrib->m_epoch != m_epoch)
+		{
+			CGoGNerr << "trying to merge markers of different storage" << CGoGNendl;
+			return false;
+		}
+
 		for (auto it = attrib->m_tableData.begin(); it != attrib->m_tableData.end(); ++it)
 			m_tableData.push_back(*it);
+		for (auto it = attrib->m_tableEpochs.begin(); it != attrib->m_tableEpochs.end(); ++it)
+			m_tableEpochs.push_back(*it);
 
 		return true;
 	}
@@ -168,6 +260,9 @@ public:
 		for (auto it=m_tableData.begin(); it !=m_tableData.end(); ++it)
 			delete[] *it;
 		m_tableData.clear();
+		for (auto it=m_tableEpochs.begin(); it !=m_tableEpochs.end(); ++it)
+			delete[] *it;
+		m_tableEpochs.clear();
 	}
 
 	int getSizeOfType() const
@@ -175,48 +270,93 @@ public:
 		return sizeof(bool); // ?
 	}
 
+	/**
+	 * unmark all: new epoch (stamps cleared when the counter wraps) or blocks cleared
+	 */
 	inline void allFalse()
 	{
-		for (unsigned int i = 0; i < m_tableData.size(); ++i)
+		if (m_epoch)
 		{
-			unsigned int *ptr =m_tableData[i];
-			for (unsigned int j=0; j<_BLOCKSIZE_/32;++j)
-				*ptr++ = 0;
+			if (m_epoch < EPOCH_MAX)
+			{
+				++m_epoch;
+				return;
+			}
+			for (unsigned int i = 0; i < m_tableEpochs.size(); ++i)
+				memset(m_tableEpochs[i], 0, _BLOCKSIZE_ * sizeof(EpochType));
+			m_epoch = 1;
+			return;
 		}
-		//memset(m_tableData[i],0,_BLOCKSIZE_/8);
+		for (unsigned int i = 0; i < m_tableData.size(); ++i)
+			memset(m_tableData[i], 0, _BLOCKSIZE_/8);
 	}
 
 	inline void allTrue()
 	{
-		for (unsigned int i = 0; i < m_tableData.size(); ++i)
+		if (m_epoch)
 		{
-			unsigned int *ptr =m_tableData[i];
-			for (unsigned int j=0; j<_BLOCKSIZE_/32;++j)
-				*ptr++ = 0xffffffff;
+			for (unsigned int i = 0; i < m_tableEpochs.size(); ++i)
+				std::fill(m_tableEpochs[i], m_tableEpochs[i] + _BLOCKSIZE_, m_epoch);
+			return;
 		}
-		//memset(m_tableData[i],0,_BLOCKSIZE_/8);
+		for (unsigned int i = 0; i < m_tableData.size(); ++i)
+			memset(m_tableData[i], 0xff, _BLOCKSIZE_/8);
 	}
 
+	/**
+	 * the words of each block are reduced without branch (vectorized by the compiler),
+	 * the test is done once per block
+	 */
 	inline bool isAllFalse()
 	{
-		for (unsigned int i = 0; i < m_tableData.size(); ++i)
+		if (m_epoch)
 		{
-			unsigned int *ptr =m_tableData[i];
-			for (unsigned int j=0; j<_BLOCKSIZE_/32;++j)
-				if (*ptr++ != 0)
+			for (unsigned int i = 0; i < m_tableEpochs.size(); ++i)
+			{
+				const EpochType* ptr = m_tableEpochs[i];
+				unsigned int nb = 0;
+				for (unsigned int j = 0; j < _BLOCKSIZE_; ++j)
+					nb += (ptr[j] == m_epoch);
+				if (nb != 0)
 					return false;
+			}
+			return true;
+		}
+		for (unsigned int i = 0; i < m_tableData.size(); ++i)
+		{
+			const unsigned int* ptr = m_tableData[i];
+			unsigned int acc = 0;
+			for (unsigned int j = 0; j < _BLOCKSIZE_/32; ++j)
+				acc |= ptr[j];
+			if (acc != 0)
+				return false;
 		}
 		return true;
 	}
 
 	inline bool isAllTrue()
 	{
-		for (unsigned int i = 0; i < m_tableData.size(); ++i)
+		if (m_epoch)
 		{
-			unsigned int *ptr =m_tableData[i];
-			for (unsigned int j=0; j<_BLOCKSIZE_/32;++j)
-				if (*ptr++ != 0xffffffff)
+			for (unsigned int i = 0; i < m_tableEpochs.size(); ++i)
+			{
+				const EpochType* ptr = m_tableEpochs[i];
+				unsigned int nb = 0;
+				for (unsigned int j = 0; j < _BLOCKSIZE_; ++j)
+					nb += (ptr[j] != m_epoch);
+				if (nb != 0)
 					return false;
+			}
+			return true;
+		}
+		for (unsigned int i = 0; i < m_tableData.size(); ++i)
+		{
+			const unsigned int* ptr = m_tableData[i];
+			unsigned int acc = 0xffffffff;
+			for (unsigned int j = 0; j < _BLOCKSIZE_/32; ++j)
+				acc &= ptr[j];
+			if (acc != 0xffffffff)
+				return false;
 		}
 		return true;
 	}
@@ -230,6 +370,11 @@ public:
 	{
 		unsigned int jj = i / _BLOCKSIZE_;
 		unsigned int j = i % _BLOCKSIZE_;
+		if (m_epoch)
+		{
+			m_tableEpochs[jj][j] = 0;
+			return;
+		}
 		unsigned int x = j/32;
 		unsigned int y = j%32;
 		unsigned int mask = 1 << y;
@@ -240,6 +385,11 @@ public:
 	{
 		unsigned int jj = i / _BLOCKSIZE_;
 		unsigned int j = i % _BLOCKSIZE_;
+		if (m_epoch)
+		{
+			m_tableEpochs[jj][j] = m_epoch;
+			return;
+		}
 		unsigned int x = j/32;
 		unsigned int y = j%32;
 		unsigned int mask = 1 << y;
@@ -250,6 +400,11 @@ public:
 	{
 		unsigned int jj = i / _BLOCKSIZE_;
 		unsigned int j = i % _BLOCKSIZE_;
+		if (m_epoch)
+		{
+			m_tableEpochs[jj][j] = b ? m_epoch : 0;
+			return;
+		}
 		unsigned int x = j/32;
 		unsigned int y = j%32;
 		unsigned int mask = 1 << y;
@@ -268,6 +423,8 @@ public:
 	{
 		unsigned int jj = i / _BLOCKSIZE_;
 		unsigned int j = i % _BLOCKSIZE_;
+		if (m_epoch)
+			return m_tableEpochs[jj][j] == m_epoch;
 		unsigned int x = j/32;
 		unsigned int y = j%32;
 
@@ -282,10 +439,10 @@ public:
 	unsigned int getBlocksPointers(std::vector<void*>& addr, unsigned int& /*byteBlockSize*/) const
 	{
 		CGoGNerr << "DO NOT USE getBlocksPointers with bool attribute"<< CGoGNendl;
-		addr.reserve(m_tableData.size());
+		addr.reserve(getNbBlocks());
 		addr.clear();
 
-		for (auto it = m_tableData.begin(); it != m_tableData.end(); ++it)
+		for (unsigned int i = 0; i < getNbBlocks(); ++i)
 			addr.push_back(NULL );
 
 		return uint32(addr.size());
@@ -323,6 +480,12 @@ public:
 	*/
 	void overwrite(unsigned int src_b, unsigned int src_id, unsigned int dst_b, unsigned int dst_id)
 	{
+		if (m_epoch)
+		{
+			m_tableEpochs[dst_b][dst_id] = m_tableEpochs[src_b][src_id];
+			return;
+		}
+
 		bool b = (m_tableData[src_b][src_id/32] & (1 << (src_id%32))) != 0;
 
 		unsigned int mask = 1 << (dst_id%32);
@@ -340,11 +503,13 @@ public:
 
 	/**
 	 * Sauvegarde binaire
+	 * (only the boundary markers are saved, they use the bit storage)
 	 * @param fs filestream
 	 * @param id id of mv
 	 */
 	void saveBin(CGoGNostream& fs, unsigned int id)
 	{
+		assert(!isEpochMode());
 		unsigned int nbs[3];
 		nbs[0] = id;
 		int len1 = int(m_attrName.size()+1);
@@ -392,6 +557,42 @@ public:
 		return true;
 	}
 
+	void saveMappable(std::ostream& fs, unsigned int id)
+	{
+		saveMappableInfos(fs, id, uint32(m_tableData.size()), _BLOCKSIZE_/8);
+
+		for (auto ptrIt = m_tableData.begin(); ptrIt!=m_tableData.end(); ++ptrIt)
+			fs.write(reinterpret_cast<const char*>(*ptrIt),_BLOCKSIZE_/8);
+	}
+
+	/**
+	 * markers are often written: blocks are copied and not adopted
+	 */
+	bool loadMapped(Utils::MappedFile& mf, std::size_t& offset)
+	{
+		unsigned int nbs[2];
+		if (!mf.read(offset, nbs, 2*sizeof(unsigned int)))
+			return false;
+
+		if (nbs[1] != _BLOCKSIZE_/8)
+		{
+			CGoGNerr << "Error loading marker " << m_attrName << ": wrong block size" << CGoGNendl;
+			return false;
+		}
+
+		clear();
+		offset = Utils::MappedFile::align(offset);
+		for(unsigned int i = 0; i < nbs[0]; ++i)
+		{
+			unsigned int* ptr = new unsigned int[_BLOCKSIZE_/32];
+			m_tableData.push_back(ptr);
+			if (!mf.read(offset, ptr, _BLOCKSIZE_/8))
+				return false;
+		}
+
+		return true;
+	}
+
 	/**
 	 * lecture binaire
 	 * @param fs filestream
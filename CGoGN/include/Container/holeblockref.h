@@ -30,6 +30,7 @@
 #include <assert.h>
 
 #include "Container/sizeblock.h"
+#include "Utils/mappedFile.h"
 
 
 namespace CGoGN
@@ -191,6 +192,10 @@ public:
 
 	bool loadBin(CGoGNistream& fs);
 
+	void saveMappable(std::ostream& fs);
+
+	bool loadMapped(const Utils::MappedFile& mf, std::size_t& offset);
+
 	unsigned int* getTableFree(unsigned int & nb) {nb =m_nbfree; return m_tableFree;}
 };
 
@@ -0,0 +1,105 @@
+/*******************************************************************************
+ * CGoGN: Combinatorial and Geometric modeling with Generic N-dimensional Maps  *
+ * version 0.1                                                                  *
+ * Copyright (C) 2009-2012, IGG Team, LSIIT, University of Strasbourg           *
+ *                                                                              *
+ * This library is free software; you can redistribute it and/or modify it      *
+ * under the terms of the GNU Lesser General Public License as published by the *
+ * Free Software Foundation; either version 2.1 of the License, or (at your     *
+ * option) any later version.                                                   *
+ *                                                                              *
+ * This library is distributed in the hope that it will be useful, but WITHOUT  *
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or        *
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License  *
+ * for more details.                                                            *
+ *                                                                              *
+ * You should have received a copy of the GNU Lesser General Public License     *
+ * along with this library; if not, write to the Free Software Foundation,      *
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301 USA.           *
+ *                                                                              *
+ * Web site: http://cgogn.unistra.fr/                                           *
+ * Contact information: cgogn@unistra.fr                                        *
+ *                                                                              *
+ *******************************************************************************/
+
+
+#ifndef __POINT_GRID__
+#define __POINT_GRID__
+
+#include <vector>
+#include <utility>
+
+namespace CGoGN
+{
+
+namespace Geom
+{
+
+/*
+ * Uniform grid of points for the search of close points.
+ * The grid is not allocated: the points are sorted by the key of their cell,
+ * so the memory is linear in the number of points whatever the extent of the set.
+ * Usage: add all the points, build, then query the neighborhoods.
+ */
+template <typename VEC>
+class PointGrid
+{
+public:
+	typedef typename VEC::DATA_TYPE REAL ;
+
+	/**********************************************/
+	/*                CONSTRUCTORS                */
+	/**********************************************/
+
+	/**
+	 * @param cellSize size of the cells: points closer than cellSize
+	 * are found by foreach_neighbor
+	 */
+	PointGrid(REAL cellSize) ;
+
+	/**********************************************/
+	/*                 FUNCTIONS                  */
+	/**********************************************/
+
+	// reserve memory for nb points
+	void reserve(unsigned int nb) ;
+
+	// add a point (with its identifier) to the grid
+	void addPoint(const VEC& p, unsigned int id) ;
+
+	// sort the points: must be called after the last addPoint and before the queries
+	void build() ;
+
+	/**
+	 * apply f on the identifiers of the points of the cell of p and of the
+	 * neighboring cells (candidates: the distance to p has still to be tested)
+	 */
+	template <typename FUNC>
+	void foreach_neighbor(const VEC& p, FUNC f) const ;
+
+	unsigned int nbPoints() const { return (unsigned int)(m_points.size()) ; }
+
+	REAL cellSize() const { return m_cellSize ; }
+
+private:
+	typedef unsigned long long KEY ;
+
+	// coordinate of p in the grid along the given axis
+	long long cellCoord(const VEC& p, unsigned int axis) const ;
+
+	// key of a cell (cells far away may share a key: they are just more candidates)
+	KEY cellKey(long long x, long long y, long long z) const ;
+
+	REAL m_cellSize ;
+	REAL m_invCellSize ;
+	// (cell key, identifier) sorted by key
+	std::vector< std::pair<KEY, unsigned int> > m_points ;
+	bool m_built ;
+} ;
+
+} // namespace Geom
+
+} // namespace CGoGN
+
+#include "Geometry/point_grid.hpp"
+#endif
@@ -0,0 +1,131 @@
+/*******************************************************************************
+ * CGoGN: Combinatorial and Geometric modeling with Generic N-dimensional Maps  *
+ * version 0.1                                                                  *
+ * Copyright (C) 2009-2012, IGG Team, LSIIT, University of Strasbourg           *
+ *                                                                              *
+ * This library is free software; you can redistribute it and/or modify it      *
+ * under the terms of the GNU Lesser General Public License as published by the *
+ * Free Software Foundation; either version 2.1 of the License, or (at your     *
+ * option) any later version.                                                   *
+ *                                                                              *
+ * This library is distributed in the hope that it will be useful, but WITHOUT  *
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or        *
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License  *
+ * for more details.                                                            *
+ *                                                                              *
+ * You should have received a copy of the GNU Lesser General Public License     *
+ * along with this library; if not, write to the Free Software Foundation,      *
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301 USA.           *
+ *                                                                              *
+ * Web site: http://cgogn.unistra.fr/                                           *
+ * Contact information: cgogn@unistra.fr                                        *
+ *                                                                              *
+ *******************************************************************************/
+
+
+#include <algorithm>
+#include <cmath>
+#include <cassert>
+
+namespace CGoGN
+{
+
+namespace Geom
+{
+
+template <typename VEC>
+PointGrid<VEC>::PointGrid(REAL cellSize) :
+	m_cellSize(cellSize),
+	m_built(false)
+{
+	// null size: only identical points are searched, any size does the job
+	if (!(m_cellSize > REAL(0)))
+		m_cellSize = REAL(1) ;
+	m_invCellSize = REAL(1) / m_cellSize ;
+}
+
+template <typename VEC>
+void PointGrid<VEC>::reserve(unsigned int nb)
+{
+	m_points.reserve(nb) ;
+}
+
+template <typename VEC>
+long long PointGrid<VEC>::cellCoord(const VEC& p, unsigned int axis) const
+{
+	if (axis >= p.dimension())
+		return 0 ;
+	// the conversion of a coordinate out of the long long range is undefined:
+	// far cells are clamped (cellKey only keeps 21 bits, the neighbors are
+	// checked by the caller anyway), NaN goes to cell 0
+	const double limit = 4611686018427387904.0 ; // 2^62, room for the neighbor cells
+	double c = std::floor(double(p[axis]) * double(m_invCellSize)) ;
+	if (!(c > -limit))
+		c = (c != c) ? 0.0 : -limit ;
+	else if (c > limit)
+		c = limit ;
+	return (long long)(c) ;
+}
+
+template <typename VEC>
+typename PointGrid<VEC>::KEY PointGrid<VEC>::cellKey(long long x, long long y, long long z) const
+{
+	// 21 bits per coordinate
+	const KEY mask = (KEY(1) << 21) - 1 ;
+	return ((KEY(x) & mask) << 42) | ((KEY(y) & mask) << 21) | (KEY(z) & mask) ;
+}
+
+template <typename VEC>
+void PointGrid<VEC>::addPoint(const VEC& p, unsigned int id)
+{
+	m_points.push_back(std::make_pair(cellKey(cellCoord(p, 0), cellCoord(p, 1), cellCoord(p, 2)), id)) ;
+	m_built = false ;
+}
+
+template <typename VEC>
+void PointGrid<VEC>::build()
+{
+	std::sort(m_points.begin(), m_points.end()) ;
+	m_built = true ;
+}
+
+template <typename VEC>
+template <typename FUNC>
+void PointGrid<VEC>::foreach_neighbor(const VEC& p, FUNC f) const
+{
+	assert(m_built || !"PointGrid: build must be called before queries") ;
+
+	const long long x = cellCoord(p, 0) ;
+	const long long y = cellCoord(p, 1) ;
+	const long long z = cellCoord(p, 2) ;
+	const long long dz = (p.dimension() > 2) ? 1 : 0 ;
+	const long long dy = (p.dimension() > 1) ? 1 : 0 ;
+
+	KEY visited[27] ;
+	unsigned int nbVisited = 0 ;
+
+	for (long long i = x - 1; i <= x + 1; ++i)
+	{
+		for (long long j = y - dy; j <= y + dy; ++j)
+		{
+			for (long long k = z - dz; k <= z + dz; ++k)
+			{
+				KEY key = cellKey(i, j, k) ;
+
+				// far cells sharing a key must not be visited twice
+				if (std::find(visited, visited + nbVisited, key) != visited + nbVisited)
+					continue ;
+				visited[nbVisited++] = key ;
+
+				typename std::vector< std::pair<KEY, unsigned int> >::const_iterator it =
+					std::lower_bound(m_points.begin(), m_points.end(), std::make_pair(key, 0u)) ;
+				for (; (it != m_points.end()) && (it->first == key); ++it)
+					f(it->second) ;
+			}
+		}
+	}
+}
+
+} // namespace Geom
+
+} // namespace CGoGN
@@ -0,0 +1,99 @@
+/*******************************************************************************
+ * CGoGN: Combinatorial and Geometric modeling with Generic N-dimensional Maps  *
+ * version 0.1                                                                  *
+ * Copyright (C) 2009-2012, IGG Team, LSIIT, University of Strasbourg           *
+ *                                                                              *
+ * This library is free software; you can redistribute it and/or modify it      *
+ * under the terms of the GNU Lesser General Public License as published by the *
+ * Free Software Foundation; either version 2.1 of the License, or (at your     *
+ * option) any later version.                                                   *
+ *                                                                              *
+ * This library is distributed in the hope that it will be useful, but WITHOUT  *
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or        *
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License  *
+ * for more details.                                                            *
+ *                                                                              *
+ * You should have received a copy of the GNU Lesser General Public License     *
+ * along with this library; if not, write to the Free Software Foundation,      *
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301 USA.           *
+ *                                                                              *
+ * Web site: http://cgogn.unistra.fr/                                           *
+ * Contact information: cgogn@unistra.fr                                        *
+ *                                                                              *
+ *******************************************************************************/
+
+
+#ifndef __VECTOR_BATCH_H__
+#define __VECTOR_BATCH_H__
+
+#include "Geometry/vector_gen.h"
+#include "Geometry/matrix.h"
+
+namespace CGoGN
+{
+
+namespace Geom
+{
+
+/*
+ * Batch kernels on contiguous arrays of 3D vectors (e.g. the blocks of an
+ * attribute). The float versions use SSE when the CPU supports it (checked
+ * once at run time), the other types and the remaining elements use the
+ * scalar code. Both paths compute each result with the same operations as
+ * the Vector / transform functions, so the results are identical.
+ */
+
+/**
+ * are the SIMD kernels used (supported by the CPU and not disabled)
+ */
+bool batchSimd() ;
+
+/**
+ * enable or disable the SIMD kernels (the scalar code is used if disabled
+ * or not supported by the CPU)
+ */
+void setBatchSimd(bool enable) ;
+
+/**
+ * res[i] = a[i] * b[i] (dot product)
+ */
+template <typename T>
+void batchDot(const Vector<3,T>* a, const Vector<3,T>* b, T* res, unsigned int nb) ;
+
+/**
+ * res[i] = a[i] ^ b[i] (cross product)
+ */
+template <typename T>
+void batchCross(const Vector<3,T>* a, const Vector<3,T>* b, Vector<3,T>* res, unsigned int nb) ;
+
+/**
+ * normalize the nb vectors of v (null vectors are left unchanged)
+ */
+template <typename T>
+void batchNormalize(Vector<3,T>* v, unsigned int nb) ;
+
+/**
+ * v[i] = transform(v[i], mat) (homogeneous transformation of points)
+ */
+template <typename T>
+void batchTransform(const Matrix<4,4,T>& mat, Vector<3,T>* v, unsigned int nb) ;
+
+/**
+ * rotations r[i] closest to the matrices a[i] (maximizing trace(r^T a), i.e. the
+ * rotation of the polar decomposition, with the smallest singular value of a
+ * negated if det(a) < 0), as used to fit the rotation of a covariance matrix.
+ * q[i] (quaternion x y z w) is the initial guess (e.g. the previous rotation)
+ * and receives the result. Newton iterations on the rotation: the convergence is
+ * quadratic from a close guess, so a few iterations are enough when warm started.
+ * @param nbIterations number of Newton iterations
+ */
+template <typename T>
+void batchFitRotation(const Matrix<3,3,T>* a, Vector<4,T>* q, Matrix<3,3,T>* r, unsigned int nb, unsigned int nbIterations = 3) ;
+
+} // namespace Geom
+
+} // namespace CGoGN
+
+#include "Geometry/vector_batch.hpp"
+
+#endif
@@ -0,0 +1,491 @@
+/*******************************************************************************
+ * CGoGN: Combinatorial and Geometric modeling with Generic N-dimensional Maps  *
+ * version 0.1                                                                  *
+ * Copyright (C) 2009-2012, IGG Team, LSIIT, University of Strasbourg           *
+ *                                                                              *
+ * This library is free software; you can redistribute it and/or modify it      *
+ * under the terms of the GNU Lesser General Public License as published by the *
+ * Free Software Foundation; either version 2.1 of the License, or (at your     *
+ * option) any later version.                                                   *
+ *                                                                              *
+ * This library is distributed in the hope that it will be useful, but WITHOUT  *
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or        *
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License  *
+ * for more details.                                                            *
+ *                                                                              *
+ * You should have received a copy of the GNU Lesser General Public License     *
+ * along with this library; if not, write to the Free Software Foundation,      *
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301 USA.           *
+ *                                                                              *
+ * Web site: http://cgogn.unistra.fr/                                           *
+ * Contact information: cgogn@unistra.fr                                        *
+ *                                                                              *
+ *******************************************************************************/
+
+
+#include "Geometry/transfo.h"
+
+#include <cmath>
+
+#if !defined(CGOGN_NO_SIMD) && (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define CGOGN_BATCH_SSE 1
+#include <emmintrin.h>
+#define CGOGN_BATCH_TARGET __attribute__((target("sse2")))
+#elif !defined(CGOGN_NO_SIMD) && defined(_MSC_VER) && defined(_M_X64)
+#define CGOGN_BATCH_SSE 1
+#include <emmintrin.h>
+#define CGOGN_BATCH_TARGET
+#endif
+
+namespace CGoGN
+{
+
+namespace Geom
+{
+
+namespace BatchImpl
+{
+
+inline bool& simdEnabled()
+{
+#ifdef CGOGN_BATCH_SSE
+#if defined(__GNUC__) || defined(__clang__)
+	static bool enabled = __builtin_cpu_supports("sse2") ;
+#else
+	static bool enabled = true ;
+#endif
+#else
+	static bool enabled = false ;
+#endif
+	return enabled ;
+}
+
+/*
+ * lane operations of the rotation fitting on scalars (the SIMD lanes overload them)
+ */
+template <typename T>
+inline T laneSelect(bool m, T a, T b)
+{
+	return m ? a : b ;
+}
+
+template <typename T>
+inline T laneAbs(T x)
+{
+	return std::fabs(x) ;
+}
+
+template <typename T>
+inline T laneSqrt(T x)
+{
+	return std::sqrt(x) ;
+}
+
+/*
+ * m = rotation matrix (row major) of the unit quaternion (qx, qy, qz, qw)
+ */
+template <typename V>
+inline void quaternionMatrix(V qx, V qy, V qz, V qw, V* m)
+{
+	const V one(1) ;
+	const V two(2) ;
+	m[0] = one - two * (qy * qy + qz * qz) ;
+	m[1] = two * (qx * qy - qw * qz) ;
+	m[2] = two * (qx * qz + qw * qy) ;
+	m[3] = two * (qx * qy + qw * qz) ;
+	m[4] = one - two * (qx * qx + qz * qz) ;
+	m[5] = two * (qy * qz - qw * qx) ;
+	m[6] = two * (qx * qz - qw * qy) ;
+	m[7] = two * (qy * qz + qw * qx) ;
+	m[8] = one - two * (qx * qx + qy * qy) ;
+}
+
+/*
+ * b = m^T a (row major 3x3)
+ */
+template <typename V>
+inline void transposedProduct(const V* m, const V* a, V* b)
+{
+	for (unsigned int i = 0; i < 3; ++i)
+		for (unsigned int j = 0; j < 3; ++j)
+			b[3*i+j] = m[i] * a[j] + m[3+i] * a[3+j] + m[6+i] * a[6+j] ;
+}
+
+/*
+ * rotation fitting of the matrix a (row major) from the quaternion q (x y z w),
+ * r receives the rotation matrix. Written once for the scalar and SIMD lanes
+ * (branches are selections) so both compute the same results.
+ */
+template <typename V>
+void fitRotationLanes(const V* a, V* q, V* r, unsigned int nbIterations)
+{
+	const V zero(0) ;
+	const V half(0.5f) ;
+	const V one(1) ;
+	const V epsilon(1e-9f) ;
+	const V detEpsilon(1e-6f) ;
+
+	V qx = q[0] ;
+	V qy = q[1] ;
+	V qz = q[2] ;
+	V qw = q[3] ;
+	V m[9] ;
+	V b[9] ;
+
+	// start from the best of q and q composed with the half turns around x, y and z
+	// (trace of R^T a), so that the guess is less than 120 degrees from the solution
+	quaternionMatrix(qx, qy, qz, qw, m) ;
+	transposedProduct(m, a, b) ;
+	const V t0 = b[0] + b[4] + b[8] ;
+	const V tx = b[0] - b[4] - b[8] ;
+	const V ty = b[4] - b[0] - b[8] ;
+	const V tz = b[8] - b[0] - b[4] ;
+	const auto flipX = (tx > t0) & (tx >= ty) & (tx >= tz) ;
+	const auto flipY = (ty > t0) & (ty >= tz) ;
+	const auto flipZ = tz > t0 ;
+	const V fx = laneSelect(flipX, qw, laneSelect(flipY, zero - qz, laneSelect(flipZ, qy, qx))) ;
+	const V fy = laneSelect(flipX, qz, laneSelect(flipY, qw, laneSelect(flipZ, zero - qx, qy))) ;
+	const V fz = laneSelect(flipX, zero - qy, laneSelect(flipY, qx, laneSelect(flipZ, qw, qz))) ;
+	const V fw = laneSelect(flipX, zero - qx, laneSelect(flipY, zero - qy, laneSelect(flipZ, zero - qz, qw))) ;
+	qx = fx ;
+	qy = fy ;
+	qz = fz ;
+	qw = fw ;
+
+	for (unsigned int k = 0; k < nbIterations; ++k)
+	{
+		quaternionMatrix(qx, qy, qz, qw, m) ;
+		transposedProduct(m, a, b) ;
+
+		// gradient g and Hessian H of trace(R^T a) for a rotation d of R in its frame:
+		// g = axial vector of b - b^T, H = trace(b) I - sym(b)
+		const V gx = b[7] - b[5] ;
+		const V gy = b[2] - b[6] ;
+		const V gz = b[3] - b[1] ;
+		const V tr = b[0] + b[4] + b[8] ;
+		const V h00 = tr - b[0] ;
+		const V h11 = tr - b[4] ;
+		const V h22 = tr - b[8] ;
+		const V h01 = zero - half * (b[1] + b[3]) ;
+		const V h02 = zero - half * (b[2] + b[6]) ;
+		const V h12 = zero - half * (b[5] + b[7]) ;
+
+		// Newton step d = H^-1 g where H is definite positive,
+		// else gradient step scaled by the trace
+		const V c00 = h11 * h22 - h12 * h12 ;
+		const V c01 = h02 * h12 - h01 * h22 ;
+		const V c02 = h01 * h12 - h02 * h11 ;
+		const V c11 = h00 * h22 - h02 * h02 ;
+		const V c12 = h01 * h02 - h00 * h12 ;
+		const V c22 = h00 * h11 - h01 * h01 ;
+		const V det = h00 * c00 + h01 * c01 + h02 * c02 ;
+		const auto newton = (h00 > zero) & (c22 > zero) & (det > detEpsilon * laneAbs(tr * tr * tr)) ;
+		const V invDet = one / laneSelect(newton, det, one) ;
+		const V invTr = one / (laneAbs(tr) + epsilon) ;
+		const V dx = laneSelect(newton, (c00 * gx + c01 * gy + c02 * gz) * invDet, gx * invTr) ;
+		const V dy = laneSelect(newton, (c01 * gx + c11 * gy + c12 * gz) * invDet, gy * invTr) ;
+		const V dz = laneSelect(newton, (c02 * gx + c12 * gy + c22 * gz) * invDet, gz * invTr) ;
+
+		// q = q * (1, d/2) normalized (rotation of angle 2 atan(|d|/2) around d)
+		const V hx = half * dx ;
+		const V hy = half * dy ;
+		const V hz = half * dz ;
+		const V nw = qw - (qx * hx + qy * hy + qz * hz) ;
+		const V nx = qx + qw * hx + (qy * hz - qz * hy) ;
+		const V ny = qy + qw * hy + (qz * hx - qx * hz) ;
+		const V nz = qz + qw * hz + (qx * hy - qy * hx) ;
+		const V invNorm = one / laneSqrt(nx * nx + ny * ny + nz * nz + nw * nw) ;
+		qx = nx * invNorm ;
+		qy = ny * invNorm ;
+		qz = nz * invNorm ;
+		qw = nw * invNorm ;
+	}
+
+	q[0] = qx ;
+	q[1] = qy ;
+	q[2] = qz ;
+	q[3] = qw ;
+	quaternionMatrix(qx, qy, qz, qw, r) ;
+}
+
+#ifdef CGOGN_BATCH_SSE
+
+/*
+ * 4 packed 3D vectors (12 floats) <-> 3 registers of x, y and z coordinates
+ */
+CGOGN_BATCH_TARGET inline void load4(const float* p, __m128& x, __m128& y, __m128& z)
+{
+	__m128 a0 = _mm_loadu_ps(p) ;		// x0 y0 z0 x1
+	__m128 a1 = _mm_loadu_ps(p + 4) ;	// y1 z1 x2 y2
+	__m128 a2 = _mm_loadu_ps(p + 8) ;	// z2 x3 y3 z3
+	__m128 t = _mm_shuffle_ps(a1, a2, _MM_SHUFFLE(2,1,3,2)) ;	// x2 y2 x3 y3
+	x = _mm_shuffle_ps(a0, t, _MM_SHUFFLE(2,0,3,0)) ;
+	__m128 u = _mm_shuffle_ps(a0, a1, _MM_SHUFFLE(0,0,2,1)) ;	// y0 z0 y1 y1
+	y = _mm_shuffle_ps(u, t, _MM_SHUFFLE(3,1,2,0)) ;
+	__m128 w = _mm_shuffle_ps(a0, a1, _MM_SHUFFLE(1,1,2,2)) ;	// z0 z0 z1 z1
+	z = _mm_shuffle_ps(w, a2, _MM_SHUFFLE(3,0,2,0)) ;
+}
+
+CGOGN_BATCH_TARGET inline void store4(float* p, __m128 x, __m128 y, __m128 z)
+{
+	__m128 xy01 = _mm_unpacklo_ps(x, y) ;	// x0 y0 x1 y1
+	__m128 xy23 = _mm_unpackhi_ps(x, y) ;	// x2 y2 x3 y3
+	__m128 q = _mm_shuffle_ps(z, xy01, _MM_SHUFFLE(2,2,0,0)) ;	// z0 z0 x1 x1
+	_mm_storeu_ps(p, _mm_shuffle_ps(xy01, q, _MM_SHUFFLE(2,0,1,0))) ;
+	__m128 r = _mm_shuffle_ps(xy01, z, _MM_SHUFFLE(1,1,3,3)) ;	// y1 y1 z1 z1
+	_mm_storeu_ps(p + 4, _mm_shuffle_ps(r, xy23, _MM_SHUFFLE(1,0,2,0))) ;
+	__m128 s = _mm_shuffle_ps(z, xy23, _MM_SHUFFLE(3,2,3,2)) ;	// z2 z3 x3 y3
+	_mm_storeu_ps(p + 8, _mm_shuffle_ps(s, s, _MM_SHUFFLE(1,3,2,0))) ;
+}
+
+CGOGN_BATCH_TARGET inline unsigned int dotSSE(const float* a, const float* b, float* res, unsigned int nb)
+{
+	unsigned int i = 0 ;
+	for (; i + 4 <= nb; i += 4, a += 12, b += 12)
+	{
+		__m128 ax, ay, az, bx, by, bz ;
+		load4(a, ax, ay, az) ;
+		load4(b, bx, by, bz) ;
+		__m128 d = _mm_add_ps(_mm_setzero_ps(), _mm_mul_ps(ax, bx)) ;
+		d = _mm_add_ps(d, _mm_mul_ps(ay, by)) ;
+		d = _mm_add_ps(d, _mm_mul_ps(az, bz)) ;
+		_mm_storeu_ps(res + i, d) ;
+	}
+	return i ;
+}
+
+CGOGN_BATCH_TARGET inline unsigned int crossSSE(const float* a, const float* b, float* res, unsigned int nb)
+{
+	unsigned int i = 0 ;
+	for (; i + 4 <= nb; i += 4, a += 12, b += 12, res += 12)
+	{
+		__m128 ax, ay, az, bx, by, bz ;
+		load4(a, ax, ay, az) ;
+		load4(b, bx, by, bz) ;
+		store4(res,
+			_mm_sub_ps(_mm_mul_ps(ay, bz), _mm_mul_ps(az, by)),
+			_mm_sub_ps(_mm_mul_ps(az, bx), _mm_mul_ps(ax, bz)),
+			_mm_sub_ps(_mm_mul_ps(ax, by), _mm_mul_ps(ay, bx))) ;
+	}
+	return i ;
+}
+
+CGOGN_BATCH_TARGET inline unsigned int normalizeSSE(float* v, unsigned int nb)
+{
+	unsigned int i = 0 ;
+	for (; i + 4 <= nb; i += 4, v += 12)
+	{
+		__m128 x, y, z ;
+		load4(v, x, y, z) ;
+		__m128 n = _mm_add_ps(_mm_setzero_ps(), _mm_mul_ps(x, x)) ;
+		n = _mm_add_ps(n, _mm_mul_ps(y, y)) ;
+		n = _mm_add_ps(n, _mm_mul_ps(z, z)) ;
+		n = _mm_sqrt_ps(n) ;
+		// null vectors are not divided: divide them by 1
+		__m128 isNull = _mm_cmpeq_ps(n, _mm_setzero_ps()) ;
+		n = _mm_or_ps(_mm_andnot_ps(isNull, n), _mm_and_ps(isNull, _mm_set1_ps(1.0f))) ;
+		store4(v, _mm_div_ps(x, n), _mm_div_ps(y, n), _mm_div_ps(z, n)) ;
+	}
+	return i ;
+}
+
+CGOGN_BATCH_TARGET inline unsigned int transformSSE(const Matrix<4,4,float>& mat, float* v, unsigned int nb)
+{
+	__m128 m[4][4] ;
+	for (unsigned int r = 0; r < 4; ++r)
+		for (unsigned int c = 0; c < 4; ++c)
+			m[r][c] = _mm_set1_ps(mat(r, c)) ;
+
+	unsigned int i = 0 ;
+	for (; i + 4 <= nb; i += 4, v += 12)
+	{
+		__m128 x, y, z ;
+		load4(v, x, y, z) ;
+		__m128 res[4] ;
+		for (unsigned int r = 0; r < 4; ++r)
+		{
+			__m128 s = _mm_add_ps(_mm_setzero_ps(), _mm_mul_ps(m[r][0], x)) ;
+			s = _mm_add_ps(s, _mm_mul_ps(m[r][1], y)) ;
+			s = _mm_add_ps(s, _mm_mul_ps(m[r][2], z)) ;
+			res[r] = _mm_add_ps(s, m[r][3]) ;
+		}
+		store4(v, _mm_div_ps(res[0], res[3]), _mm_div_ps(res[1], res[3]), _mm_div_ps(res[2], res[3])) ;
+	}
+	return i ;
+}
+
+/*
+ * 4 floats lane of the rotation fitting
+ */
+struct Mask4
+{
+	__m128 v ;
+	CGOGN_BATCH_TARGET Mask4(__m128 x) : v(x) {}
+	CGOGN_BATCH_TARGET Mask4 operator&(Mask4 m) const { return Mask4(_mm_and_ps(v, m.v)) ; }
+} ;
+
+struct Float4
+{
+	__m128 v ;
+	CGOGN_BATCH_TARGET Float4() : v(_mm_setzero_ps()) {}
+	CGOGN_BATCH_TARGET Float4(__m128 x) : v(x) {}
+	CGOGN_BATCH_TARGET Float4(float x) : v(_mm_set1_ps(x)) {}
+	CGOGN_BATCH_TARGET Float4 operator+(Float4 b) const { return Float4(_mm_add_ps(v, b.v)) ; }
+	CGOGN_BATCH_TARGET Float4 operator-(Float4 b) const { return Float4(_mm_sub_ps(v, b.v)) ; }
+	CGOGN_BATCH_TARGET Float4 operator*(Float4 b) const { return Float4(_mm_mul_ps(v, b.v)) ; }
+	CGOGN_BATCH_TARGET Float4 operator/(Float4 b) const { return Float4(_mm_div_ps(v, b.v)) ; }
+	CGOGN_BATCH_TARGET Mask4 operator>(Float4 b) const { return Mask4(_mm_cmpgt_ps(v, b.v)) ; }
+	CGOGN_BATCH_TARGET Mask4 operator>=(Float4 b) const { return Mask4(_mm_cmpge_ps(v, b.v)) ; }
+} ;
+
+CGOGN_BATCH_TARGET inline Float4 laneSelect(Mask4 m, Float4 a, Float4 b)
+{
+	return Float4(_mm_or_ps(_mm_and_ps(m.v, a.v), _mm_andnot_ps(m.v, b.v))) ;
+}
+
+CGOGN_BATCH_TARGET inline Float4 laneAbs(Float4 x)
+{
+	return Float4(_mm_andnot_ps(_mm_set1_ps(-0.0f), x.v)) ;
+}
+
+CGOGN_BATCH_TARGET inline Float4 laneSqrt(Float4 x)
+{
+	return Float4(_mm_sqrt_ps(x.v)) ;
+}
+
+CGOGN_BATCH_TARGET inline unsigned int fitRotationSSE(const float* a, float* q, float* r, unsigned int nb, unsigned int nbIterations)
+{
+	unsigned int i = 0 ;
+	for (; i + 4 <= nb; i += 4, a += 36, q += 16, r += 36)
+	{
+		Float4 la[9] ;
+		for (unsigned int k = 0; k < 9; ++k)
+			la[k] = Float4(_mm_set_ps(a[27+k], a[18+k], a[9+k], a[k])) ;
+		Float4 lq[4] ;
+		for (unsigned int k = 0; k < 4; ++k)
+			lq[k] = Float4(_mm_set_ps(q[12+k], q[8+k], q[4+k], q[k])) ;
+		Float4 lr[9] ;
+
+		fitRotationLanes(la, lq, lr, nbIterations) ;
+
+		float tmp[4] ;
+		for (unsigned int k = 0; k < 4; ++k)
+		{
+			_mm_storeu_ps(tmp, lq[k].v) ;
+			for (unsigned int l = 0; l < 4; ++l)
+				q[4*l+k] = tmp[l] ;
+		}
+		for (unsigned int k = 0; k < 9; ++k)
+		{
+			_mm_storeu_ps(tmp, lr[k].v) ;
+			for (unsigned int l = 0; l < 4; ++l)
+				r[9*l+k] = tmp[l] ;
+		}
+	}
+	return i ;
+}
+
+#endif
+
+} // namespace BatchImpl
+
+inline bool batchSimd()
+{
+	return BatchImpl::simdEnabled() ;
+}
+
+inline void setBatchSimd(bool enable)
+{
+#ifdef CGOGN_BATCH_SSE
+#if defined(__GNUC__) || defined(__clang__)
+	BatchImpl::simdEnabled() = enable && __builtin_cpu_supports("sse2") ;
+#else
+	BatchImpl::simdEnabled() = enable ;
+#endif
+#else
+	(void)enable ;
+#endif
+}
+
+template <typename T>
+void batchDot(const Vector<3,T>* a, const Vector<3,T>* b, T* res, unsigned int nb)
+{
+	for (unsigned int i = 0; i < nb; ++i)
+		res[i] = a[i] * b[i] ;
+}
+
+template <typename T>
+void batchCross(const Vector<3,T>* a, const Vector<3,T>* b, Vector<3,T>* res, unsigned int nb)
+{
+	for (unsigned int i = 0; i < nb; ++i)
+		res[i] = a[i] ^ b[i] ;
+}
+
+template <typename T>
+void batchNormalize(Vector<3,T>* v, unsigned int nb)
+{
+	for (unsigned int i = 0; i < nb; ++i)
+		v[i].normalize() ;
+}
+
+template <typename T>
+void batchTransform(const Matrix<4,4,T>& mat, Vector<3,T>* v, unsigned int nb)
+{
+	for (unsigned int i = 0; i < nb; ++i)
+		v[i] = transform(v[i], mat) ;
+}
+
+template <typename T>
+void batchFitRotation(const Matrix<3,3,T>* a, Vector<4,T>* q, Matrix<3,3,T>* r, unsigned int nb, unsigned int nbIterations)
+{
+	for (unsigned int i = 0; i < nb; ++i)
+		BatchImpl::fitRotationLanes(&a[i](0,0), q[i].data(), &r[i](0,0), nbIterations) ;
+}
+
+#ifdef CGOGN_BATCH_SSE
+
+template <>
+inline void batchDot<float>(const Vector<3,float>* a, const Vector<3,float>* b, float* res, unsigned int nb)
+{
+	unsigned int i = (nb >= 4 && batchSimd()) ? BatchImpl::dotSSE(a->data(), b->data(), res, nb) : 0 ;
+	for (; i < nb; ++i)
+		res[i] = a[i] * b[i] ;
+}
+
+template <>
+inline void batchCross<float>(const Vector<3,float>* a, const Vector<3,float>* b, Vector<3,float>* res, unsigned int nb)
+{
+	unsigned int i = (nb >= 4 && batchSimd()) ? BatchImpl::crossSSE(a->data(), b->data(), res->data(), nb) : 0 ;
+	for (; i < nb; ++i)
+		res[i] = a[i] ^ b[i] ;
+}
+
+template <>
+inline void batchNormalize<float>(Vector<3,float>* v, unsigned int nb)
+{
+	unsigned int i = (nb >= 4 && batchSimd()) ? BatchImpl::normalizeSSE(v->data(), nb) : 0 ;
+	for (; i < nb; ++i)
+		v[i].normalize() ;
+}
+
+template <>
+inline void batchTransform<float>(const Matrix<4,4,float>& mat, Vector<3,float>* v, unsigned int nb)
+{
+	unsigned int i = (nb >= 4 && batchSimd()) ? BatchImpl::transformSSE(mat, v->data(), nb) : 0 ;
+	for (; i < nb; ++i)
+		v[i] = transform(v[i], mat) ;
+}
+
+template <>
+inline void batchFitRotation<float>(const Matrix<3,3,float>* a, Vector<4,float>* q, Matrix<3,3,float>* r, unsigned int nb, unsigned int nbIterations)
+{
+	unsigned int i = (nb >= 4 && batchSimd()) ? BatchImpl::fitRotationSSE(&a[0](0,0), q->data(), &r[0](0,0), nb, nbIterations) : 0 ;
+	for (; i < nb; ++i)
+		BatchImpl::fitRotationLanes(&a[i](0,0), q[i].data(), &r[i](0,0), nbIterations) ;
+}
+
+#endif
+
+} // namespace Geom
+
+} // namespace CGoGN
@@ -265,5 +265,6 @@ typedef Vector<4, unsigned char> Vec4uc ;
 }
 
 #include "Geometry/vector_gen.hpp"
+#include "Geometry/vector_simd.hpp"
 
 #endif
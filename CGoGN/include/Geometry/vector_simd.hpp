@@ -0,0 +1,133 @@
+/*******************************************************************************
+ * CGoGN: Combinatorial and Geometric modeling with Generic N-dimensional Maps  *
+ * version 0.1                                                                  *
+ * Copyright (C) 2009-2012, IGG Team, LSIIT, University of Strasbourg           *
+ *                                                                              *
+ * This library is free software; you can redistribute it and/or modify it      *
+ * under the terms of the GNU Lesser General Public License as published by the *
+ * Free Software Foundation; either version 2.1 of the License, or (at your     *
+ * option) any later version.                                                   *
+ *                                                                              *
+ * This library is distributed in the hope that it will be useful, but WITHOUT  *
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or        *
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License  *
+ * for more details.                                                            *
+ *                                                                              *
+ * You should have received a copy of the GNU Lesser General Public License     *
+ * along with this library; if not, write to the Free Software Foundation,      *
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301 USA.           *
+ *                                                                              *
+ * Web site: http://cgogn.unistra.fr/                                           *
+ * Contact information: cgogn@unistra.fr                                        *
+ *                                                                              *
+ *******************************************************************************/
+
+
+/*
+ * SSE specializations of the component-wise operators of Vector<4,float>
+ * and Vector<4,double>. The layout of the vectors is unchanged (no alignment
+ * constraint, unaligned loads) and each component is computed with the same
+ * operation as the generic code, so the results are identical.
+ * Vector<3,T> keeps the generic code: its packed layout (used by the VBO, the
+ * mapped files, the import/export) does not fit in a SIMD register, the batch
+ * kernels of vector_batch.h are used for the heavy loops instead.
+ * Define CGOGN_NO_SIMD to disable.
+ */
+
+#if defined(__SSE2__) && !defined(CGOGN_NO_SIMD)
+
+#include <emmintrin.h>
+
+namespace CGoGN
+{
+
+namespace Geom
+{
+
+template <>
+inline Vector<4, float>& Vector<4, float>::operator+=(const Vector<4, float>& v)
+{
+	_mm_storeu_ps(m_data, _mm_add_ps(_mm_loadu_ps(m_data), _mm_loadu_ps(v.data()))) ;
+	return *this ;
+}
+
+template <>
+inline Vector<4, float>& Vector<4, float>::operator-=(const Vector<4, float>& v)
+{
+	_mm_storeu_ps(m_data, _mm_sub_ps(_mm_loadu_ps(m_data), _mm_loadu_ps(v.data()))) ;
+	return *this ;
+}
+
+template <>
+inline Vector<4, float> Vector<4, float>::operator+(const Vector<4, float>& v) const
+{
+	Vector<4, float> res ;
+	_mm_storeu_ps(res.data(), _mm_add_ps(_mm_loadu_ps(m_data), _mm_loadu_ps(v.data()))) ;
+	return res ;
+}
+
+template <>
+inline Vector<4, float> Vector<4, float>::operator-(const Vector<4, float>& v) const
+{
+	Vector<4, float> res ;
+	_mm_storeu_ps(res.data(), _mm_sub_ps(_mm_loadu_ps(m_data), _mm_loadu_ps(v.data()))) ;
+	return res ;
+}
+
+template <>
+inline Vector<4, float> Vector<4, float>::operator-() const
+{
+	Vector<4, float> res ;
+	_mm_storeu_ps(res.data(), _mm_xor_ps(_mm_loadu_ps(m_data), _mm_set1_ps(-0.0f))) ;
+	return res ;
+}
+
+template <>
+inline Vector<4, double>& Vector<4, double>::operator+=(const Vector<4, double>& v)
+{
+	_mm_storeu_pd(m_data, _mm_add_pd(_mm_loadu_pd(m_data), _mm_loadu_pd(v.data()))) ;
+	_mm_storeu_pd(m_data + 2, _mm_add_pd(_mm_loadu_pd(m_data + 2), _mm_loadu_pd(v.data() + 2))) ;
+	return *this ;
+}
+
+template <>
+inline Vector<4, double>& Vector<4, double>::operator-=(const Vector<4, double>& v)
+{
+	_mm_storeu_pd(m_data, _mm_sub_pd(_mm_loadu_pd(m_data), _mm_loadu_pd(v.data()))) ;
+	_mm_storeu_pd(m_data + 2, _mm_sub_pd(_mm_loadu_pd(m_data + 2), _mm_loadu_pd(v.data() + 2))) ;
+	return *this ;
+}
+
+template <>
+inline Vector<4, double> Vector<4, double>::operator+(const Vector<4, double>& v) const
+{
+	Vector<4, double> res ;
+	_mm_storeu_pd(res.data(), _mm_add_pd(_mm_loadu_pd(m_data), _mm_loadu_pd(v.data()))) ;
+	_mm_storeu_pd(res.data() + 2, _mm_add_pd(_mm_loadu_pd(m_data + 2), _mm_loadu_pd(v.data() + 2))) ;
+	return res ;
+}
+
+template <>
+inline Vector<4, double> Vector<4, double>::operator-(const Vector<4, double>& v) const
+{
+	Vector<4, double> res ;
+	_mm_storeu_pd(res.data(), _mm_sub_pd(_mm_loadu_pd(m_data), _mm_loadu_pd(v.data()))) ;
+	_mm_storeu_pd(res.data() + 2, _mm_sub_pd(_mm_loadu_pd(m_data + 2), _mm_loadu_pd(v.data() + 2))) ;
+	return res ;
+}
+
+template <>
+inline Vector<4, double> Vector<4, double>::operator-() const
+{
+	Vector<4, double> res ;
+	const __m128d sign = _mm_set1_pd(-0.0) ;
+	_mm_storeu_pd(res.data(), _mm_xor_pd(_mm_loadu_pd(m_data), sign)) ;
+	_mm_storeu_pd(res.data() + 2, _mm_xor_pd(_mm_loadu_pd(m_data + 2), sign)) ;
+	return res ;
+}
+
+} // namespace Geom
+
+} // namespace CGoGN
+
+#endif
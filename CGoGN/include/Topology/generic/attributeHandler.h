@@ -229,6 +229,16 @@ public:
 	 */
 	const T& operator[](unsigned int a) const ;
 
+	/**
+	 * mark the element of cell c as modified (see AttributeMultiVectorGen::getDirtyRanges)
+	 */
+	void setDirty(Cell<ORB> c) ;
+
+	/**
+	 * mark the element of index a as modified
+	 */
+	void setDirty(unsigned int a) ;
+
 	/**
 	 * insert an element (warning we add here a complete line in container)
 	 */
@@ -393,6 +403,11 @@ inline void foreach_attribute(ATTR& attr, FUNC func)
 namespace Parallel
 {
 
+/**
+ * apply function on each element of attribute (in parallel)
+ * func takes the index of the element and the index of the thread (in [0, nbth-2])
+ * Warning attr must also be captured by lambda funct
+ */
 template <typename ATTR, typename FUNC>
 void foreach_attribute(ATTR& attribute, FUNC func, unsigned int nbth = NumberOfThreads);
 
@@ -223,6 +223,20 @@ inline const T& AttributeHandler<T, ORB, MAP>::operator[](unsigned int a) const
 	return m_attrib->operator[](a) ;
 }
 
+template <typename T, unsigned int ORB, typename MAP>
+inline void AttributeHandler<T, ORB, MAP>::setDirty(Cell<ORB> c)
+{
+	assert(this->valid || !"Invalid AttributeHandler") ;
+	m_attrib->setDirty(m_map->getEmbedding(c)) ;
+}
+
+template <typename T, unsigned int ORB, typename MAP>
+inline void AttributeHandler<T, ORB, MAP>::setDirty(unsigned int a)
+{
+	assert(this->valid || !"Invalid AttributeHandler") ;
+	m_attrib->setDirty(a) ;
+}
+
 template <typename T, unsigned int ORB, typename MAP>
 inline unsigned int AttributeHandler<T, ORB, MAP>::insert(const T& elt)
 {
@@ -245,6 +259,7 @@ inline void AttributeHandler<T, ORB, MAP>::setAllValues(const T& v)
 {
 	for(unsigned int i = begin(); i != end(); next(i))
 		m_attrib->operator[](i) = v ;
+	m_attrib->setAllDirty() ;
 }
 
 template <typename T, unsigned int ORB, typename MAP>
@@ -315,6 +330,21 @@ public:
 template <typename ATTR, typename FUNC>
 void foreach_attribute(ATTR& attribute, FUNC func, unsigned int nbthread)
 {
+	const AttributeContainer& cont = attribute.map()->template getAttributeContainer<ATTR::ORBIT>();
+
+	// direct traversal of the blocks of the container
+	if (!cont.hasBrowser())
+	{
+		Utils::ThreadPool& pool = Utils::ThreadPool::shared(nbthread - 1);
+		// one copy of func per worker (as for the threaded version)
+		std::vector<FUNC> funcs(pool.nbWorkers(), func);
+		cont.parallelForeachLine(pool, [&] (unsigned int i, unsigned int w)
+		{
+			funcs[w](i, w);
+		});
+		return;
+	}
+
 	// thread 0 is for attribute traversal
 	unsigned int nbth = nbthread -1;
 
@@ -73,27 +73,33 @@ class CellMarkerBase : public CellMarkerGen
 protected:
 	MAP& m_map ;
 
+	// storage of the marks with epoch stamps (see AttributeMultiVector<MarkerBool>)
+	bool m_epoch ;
+
 public:
 	/**
 	 * constructor
 	 * @param map the map on which we work
+	 * @param epoch use a marker vector with epoch stamps
 	 */
-	CellMarkerBase(MAP& map) :
+	CellMarkerBase(MAP& map, bool epoch = false) :
 		CellMarkerGen(CELL),
-		m_map(map)
+		m_map(map),
+		m_epoch(epoch)
 	{
 		if(!m_map.template isOrbitEmbedded<CELL>())
 			m_map.template addEmbedding<CELL>() ;
-		m_markVector = m_map.template askMarkVector<CELL>();
+		m_markVector = m_map.template askMarkVector<CELL>(m_epoch);
 	}
 
-	CellMarkerBase(const MAP& map) :
+	CellMarkerBase(const MAP& map, bool epoch = false) :
 		CellMarkerGen(CELL),
-		m_map(const_cast<MAP&>(map))
+		m_map(const_cast<MAP&>(map)),
+		m_epoch(epoch)
 	{
 		if(!m_map.template isOrbitEmbedded<CELL>())
 			m_map.template addEmbedding<CELL>() ;
-		m_markVector = m_map.template askMarkVector<CELL>();
+		m_markVector = m_map.template askMarkVector<CELL>(m_epoch);
 	}
 
 	virtual ~CellMarkerBase()
@@ -110,7 +116,7 @@ public:
 	{
 		if(!m_map.template isOrbitEmbedded<CELL>())
 			m_map.template addEmbedding<CELL>() ;
-		m_markVector = m_map.template askMarkVector<CELL>();
+		m_markVector = m_map.template askMarkVector<CELL>(m_epoch);
 	}
 
 
@@ -118,6 +124,7 @@ protected:
 	// protected copy constructor to forbid its usage
 	CellMarkerBase(const CellMarkerBase<MAP, CELL>& cm) :
 		m_map(cm.m_map),
+		m_epoch(cm.m_epoch),
 		CellMarkerGen(CELL)
 	{}
 
@@ -268,6 +275,42 @@ public:
 	}
 };
 
+/**
+ * class that allows the marking of cells
+ * the marks are epoch stamps: unmarkAll (and the unmarking at destruction)
+ * is O(1) whatever the number of cells, for 16 bits per cell instead of 1
+ * \warning no default constructor
+ */
+template <typename MAP, unsigned int CELL>
+class CellMarkerEpoch : public CellMarkerBase<MAP, CELL>
+{
+public:
+	CellMarkerEpoch(MAP& map) :
+		CellMarkerBase<MAP, CELL>(map, true)
+	{}
+
+	CellMarkerEpoch(const MAP& map) :
+		CellMarkerBase<MAP, CELL>(map, true)
+	{}
+
+	virtual ~CellMarkerEpoch()
+	{
+		unmarkAll() ;
+	}
+
+protected:
+	CellMarkerEpoch(const CellMarkerEpoch& cm) :
+		CellMarkerBase<MAP, CELL>(cm)
+	{}
+
+public:
+	inline void unmarkAll()
+	{
+		assert(this->m_markVector != NULL);
+		this->m_markVector->allFalse();
+	}
+};
+
 /**
  * class that allows the marking of cells
  * the marked cells are stored to optimize the unmarking task at destruction
@@ -123,6 +123,9 @@ typedef Cell<VOLUME> Vol;  // not Volume because of the namespace Volume
 namespace Parallel
 {
 const unsigned int SIZE_BUFFER_THREAD = 1024;
+
+/// size of cache lines, used to separate data written by different threads
+const unsigned int CACHE_LINE_SIZE = 64;
 }
 
 }
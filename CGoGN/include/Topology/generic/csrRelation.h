@@ -0,0 +1,86 @@
+/*******************************************************************************
+ * CGoGN: Combinatorial and Geometric modeling with Generic N-dimensional Maps  *
+ * version 0.1                                                                  *
+ * Copyright (C) 2009-2012, IGG Team, LSIIT, University of Strasbourg           *
+ *                                                                              *
+ * This library is free software; you can redistribute it and/or modify it      *
+ * under the terms of the GNU Lesser General Public License as published by the *
+ * Free Software Foundation; either version 2.1 of the License, or (at your     *
+ * option) any later version.                                                   *
+ *                                                                              *
+ * This library is distributed in the hope that it will be useful, but WITHOUT  *
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or        *
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License  *
+ * for more details.                                                            *
+ *                                                                              *
+ * You should have received a copy of the GNU Lesser General Public License     *
+ * along with this library; if not, write to the Free Software Foundation,      *
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301 USA.           *
+ *                                                                              *
+ * Web site: http://cgogn.unistra.fr/                                           *
+ * Contact information: cgogn@unistra.fr                                        *
+ *                                                                              *
+ *******************************************************************************/
+
+
+#ifndef __CSR_RELATION__
+#define __CSR_RELATION__
+
+#include <vector>
+
+#include "Topology/generic/dart.h"
+
+namespace CGoGN
+{
+
+/**
+ * Immutable incidence / adjacency relation stored in compressed sparse rows:
+ * the row of a cell is indexed by its embedding and gives the darts of the
+ * related cells (NIL terminated, as the quick traversal vectors) and their
+ * embeddings (EMBNULL terminated).
+ * Rows are filled by CSRSnapshot, they are no more valid once the topology
+ * or the embeddings of the map change.
+ */
+class CSRRelation
+{
+public:
+	/// first position of the row of each cell (size nbRows()+1)
+	std::vector<unsigned int> m_offsets;
+
+	/// darts of the related cells, each row ends with NIL
+	std::vector<Dart> m_darts;
+
+	/// embeddings of the related cells, each row ends with EMBNULL
+	std::vector<unsigned int> m_indices;
+
+	inline unsigned int nbRows() const { return m_offsets.empty() ? 0 : (unsigned int)(m_offsets.size() - 1); }
+
+	/// NIL terminated darts of the cells related to cell of embedding emb
+	inline const Dart* row(unsigned int emb) const { return &m_darts[m_offsets[emb]]; }
+
+	/// number of cells related to cell of embedding emb
+	inline unsigned int degree(unsigned int emb) const { return m_offsets[emb + 1] - m_offsets[emb] - 1; }
+
+	/// embeddings of the cells related to cell of embedding emb: [indicesBegin, indicesEnd)
+	inline const unsigned int* indicesBegin(unsigned int emb) const { return &m_indices[m_offsets[emb]]; }
+
+	inline const unsigned int* indicesEnd(unsigned int emb) const { return &m_indices[m_offsets[emb + 1] - 1]; }
+
+	inline void clear()
+	{
+		std::vector<unsigned int>().swap(m_offsets);
+		std::vector<Dart>().swap(m_darts);
+		std::vector<unsigned int>().swap(m_indices);
+	}
+
+	/// memory used by the relation (in bytes)
+	inline unsigned long long memory() const
+	{
+		return (unsigned long long)(m_offsets.capacity() + m_indices.capacity()) * sizeof(unsigned int)
+			+ (unsigned long long)(m_darts.capacity()) * sizeof(Dart);
+	}
+};
+
+} //namespace CGoGN
+
+#endif
@@ -0,0 +1,130 @@
+/*******************************************************************************
+ * CGoGN: Combinatorial and Geometric modeling with Generic N-dimensional Maps  *
+ * version 0.1                                                                  *
+ * Copyright (C) 2009-2012, IGG Team, LSIIT, University of Strasbourg           *
+ *                                                                              *
+ * This library is free software; you can redistribute it and/or modify it      *
+ * under the terms of the GNU Lesser General Public License as published by the *
+ * Free Software Foundation; either version 2.1 of the License, or (at your     *
+ * option) any later version.                                                   *
+ *                                                                              *
+ * This library is distributed in the hope that it will be useful, but WITHOUT  *
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or        *
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License  *
+ * for more details.                                                            *
+ *                                                                              *
+ * You should have received a copy of the GNU Lesser General Public License     *
+ * along with this library; if not, write to the Free Software Foundation,      *
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301 USA.           *
+ *                                                                              *
+ * Web site: http://cgogn.unistra.fr/                                           *
+ * Contact information: cgogn@unistra.fr                                        *
+ *                                                                              *
+ *******************************************************************************/
+
+
+#ifndef __CSR_SNAPSHOT__
+#define __CSR_SNAPSHOT__
+
+#include <algorithm>
+
+#include "Topology/generic/csrRelation.h"
+#include "Topology/generic/traversor/traversorFactory.h"
+#include "Topology/generic/traversor/traversorCell.h"
+#include "Utils/threadPool.h"
+#include "Algo/Topo/basic.h"
+
+namespace CGoGN
+{
+
+/**
+ * fill csr with the rows of the cells of orbit ORBIT (incident cells of orbit REL,
+ * or adjacent cells through REL if adjacent is true)
+ * The orbit ORBIT (and REL for an incidence relation) is embedded if needed,
+ * the indices of an adjacency relation are embeddings of orbit ORBIT. Cells are processed in parallel
+ * when nbth > 1, each worker uses its own buffer, the rows are then copied at
+ * their final place.
+ * @param map the map (must not be modified while the relation is used)
+ * @param csr the relation to fill
+ * @param adjacent adjacency or incidence relation
+ * @param nbth number of threads
+ */
+template <unsigned int ORBIT, unsigned int REL, typename MAP>
+void buildCSRRelation(MAP& map, CSRRelation& csr, bool adjacent, unsigned int nbth = 1);
+
+/**
+ * Read only snapshot of the main incidence / adjacency relations of a map
+ * (vertex-vertex through edges, vertex-face, face-vertex and edge-face) stored
+ * in compressed sparse rows indexed by the cell embeddings.
+ * Once attached, the Traversor2XY / Traversor3XY of these relations read the
+ * rows instead of turning around the cells. The snapshot is no more valid
+ * after any change of the topology or of the embeddings of the map
+ * (compaction, reordering and the creation or removal of darts and cells
+ * detach it, build() attaches it again).
+ */
+template <typename MAP>
+class CSRSnapshot
+{
+protected:
+	MAP& m_map;
+
+	CSRRelation m_vertexVertices;
+	CSRRelation m_vertexFaces;
+	CSRRelation m_faceVertices;
+	CSRRelation m_edgeFaces;
+
+	bool m_attached;
+
+	// protected copy constructor to prevent the copy of snapshot
+	CSRSnapshot(const CSRSnapshot<MAP>& s) : m_map(s.m_map) {}
+
+public:
+	CSRSnapshot(MAP& map);
+
+	~CSRSnapshot();
+
+	/**
+	 * (re)build the relations from the current state of the map
+	 * (the snapshot is detached during the build and attached again if it was)
+	 * @param nbth number of threads
+	 */
+	void build(unsigned int nbth = 1);
+
+	/**
+	 * use the relations in the traversors of the map
+	 */
+	void attach();
+
+	/**
+	 * restore the usual traversals
+	 */
+	void detach();
+
+	/**
+	 * attach() was called (the map may have detached the relations since, build() attaches them again)
+	 */
+	inline bool isAttached() const { return m_attached; }
+
+	/// vertices adjacent to each vertex through an edge
+	inline const CSRRelation& vertexVertices() const { return m_vertexVertices; }
+
+	/// faces incident to each vertex
+	inline const CSRRelation& vertexFaces() const { return m_vertexFaces; }
+
+	/// vertices incident to each face
+	inline const CSRRelation& faceVertices() const { return m_faceVertices; }
+
+	/// faces incident to each edge
+	inline const CSRRelation& edgeFaces() const { return m_edgeFaces; }
+
+	/// memory used by the snapshot (in bytes)
+	unsigned long long memory() const;
+
+	void clear();
+};
+
+} //namespace CGoGN
+
+#include "Topology/generic/csrSnapshot.hpp"
+
+#endif
@@ -0,0 +1,219 @@
+/*******************************************************************************
+ * CGoGN: Combinatorial and Geometric modeling with Generic N-dimensional Maps  *
+ * version 0.1                                                                  *
+ * Copyright (C) 2009-2012, IGG Team, LSIIT, University of Strasbourg           *
+ *                                                                              *
+ * This library is free software; you can redistribute it and/or modify it      *
+ * under the terms of the GNU Lesser General Public License as published by the *
+ * Free Software Foundation; either version 2.1 of the License, or (at your     *
+ * option) any later version.                                                   *
+ *                                                                              *
+ * This library is distributed in the hope that it will be useful, but WITHOUT  *
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or        *
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License  *
+ * for more details.                                                            *
+ *                                                                              *
+ * You should have received a copy of the GNU Lesser General Public License     *
+ * along with this library; if not, write to the Free Software Foundation,      *
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301 USA.           *
+ *                                                                              *
+ * Web site: http://cgogn.unistra.fr/                                           *
+ * Contact information: cgogn@unistra.fr                                        *
+ *                                                                              *
+ *******************************************************************************/
+
+
+namespace CGoGN
+{
+
+template <unsigned int ORBIT, unsigned int REL, typename MAP>
+void buildCSRRelation(MAP& map, CSRRelation& csr, bool adjacent, unsigned int nbth)
+{
+	if (!map.template isOrbitEmbedded<ORBIT>())
+		Algo::Topo::initAllOrbitsEmbedding<ORBIT>(map);
+	// the rows of an adjacency relation give cells of orbit ORBIT
+	if (!adjacent && !map.template isOrbitEmbedded<REL>())
+		Algo::Topo::initAllOrbitsEmbedding<REL>(map);
+
+	// the rows of this relation must not be read by the traversors while they are rebuilt
+	const CSRRelation* attached = adjacent ? map.template getCSRAdjacentTraversal<ORBIT, REL>() : map.template getCSRIncidentTraversal<ORBIT, REL>();
+	if (attached == &csr)
+	{
+		if (adjacent)
+			map.template setCSRAdjacentTraversal<ORBIT, REL>(NULL);
+		else
+			map.template setCSRIncidentTraversal<ORBIT, REL>(NULL);
+	}
+
+	// one dart per cell, gathered by the calling thread
+	const AttributeContainer& cont = map.template getAttributeContainer<ORBIT>();
+	std::vector<Dart> cells;
+	cells.reserve(cont.size());
+	foreach_cell<ORBIT>(map, [&] (Cell<ORBIT> c) { cells.push_back(c.dart); });
+
+	const unsigned int nbCells = (unsigned int)(cells.size());
+	const unsigned int CHUNK = 1024;
+	const unsigned int nbChunks = (nbCells + CHUNK - 1) / CHUNK;
+
+	std::vector<std::vector<Dart> > chunkDarts(nbChunks);
+	std::vector<unsigned int> cellEmb(nbCells);
+	std::vector<unsigned int> cellSize(nbCells);
+
+	Utils::ThreadPool* pool = (nbth > 1) ? &Utils::ThreadPool::shared(nbth - 1) : NULL;
+	unsigned int nbw = pool ? pool->nbWorkers() : 0;
+	for (unsigned int i = 0; i < nbw; ++i)
+		map.addEmptyThreadId() = pool->threadId(i);
+
+	auto run = [&] (const Utils::ThreadPool::RangeFunction& f)
+	{
+		if (pool)
+			pool->parallelFor(nbChunks, 1, f);
+		else
+			f(0, nbChunks, 0);
+	};
+
+	// traverse the cells, the darts of each chunk are stored in its own buffer
+	run([&] (unsigned int cb, unsigned int ce, unsigned int)
+	{
+		for (unsigned int c = cb; c < ce; ++c)
+		{
+			std::vector<Dart>& buffer = chunkDarts[c];
+			unsigned int end = std::min(nbCells, (c + 1) * CHUNK);
+			for (unsigned int i = c * CHUNK; i < end; ++i)
+			{
+				unsigned int first = (unsigned int)(buffer.size());
+				Traversor* tra = adjacent ?
+					TraversorFactory<MAP>::createAdjacent(map, cells[i], map.dimension(), ORBIT, REL) :
+					TraversorFactory<MAP>::createIncident(map, cells[i], map.dimension(), ORBIT, REL);
+				for (Dart d = tra->begin(); d != tra->end(); d = tra->next())
+					buffer.push_back(d);
+				delete tra;
+				buffer.push_back(NIL);
+				cellEmb[i] = map.template getEmbedding<ORBIT>(cells[i]);
+				cellSize[i] = (unsigned int)(buffer.size()) - first;
+			}
+		}
+	});
+
+	// rows of the unused lines of the container are empty (only NIL)
+	const unsigned int nbRows = cont.end();
+	std::vector<unsigned int>& offsets = csr.m_offsets;
+	offsets.assign(nbRows + 1, 1);
+	for (unsigned int i = 0; i < nbCells; ++i)
+		offsets[cellEmb[i]] = cellSize[i];
+	unsigned int total = 0;
+	for (unsigned int e = 0; e <= nbRows; ++e)
+	{
+		unsigned int s = offsets[e];
+		offsets[e] = total;
+		total += s;
+	}
+
+	csr.m_darts.assign(total, NIL);
+	csr.m_indices.assign(total, EMBNULL);
+
+	// copy the rows at their place and compute the embeddings of the related cells
+	run([&] (unsigned int cb, unsigned int ce, unsigned int)
+	{
+		for (unsigned int c = cb; c < ce; ++c)
+		{
+			const Dart* src = chunkDarts[c].empty() ? NULL : &chunkDarts[c][0];
+			unsigned int end = std::min(nbCells, (c + 1) * CHUNK);
+			for (unsigned int i = c * CHUNK; i < end; ++i)
+			{
+				unsigned int o = offsets[cellEmb[i]];
+				for (unsigned int k = 0; k + 1 < cellSize[i]; ++k)
+				{
+					csr.m_darts[o + k] = src[k];
+					csr.m_indices[o + k] = adjacent ? map.template getEmbedding<ORBIT>(src[k]) : map.template getEmbedding<REL>(src[k]);
+				}
+				src += cellSize[i];
+			}
+			std::vector<Dart>().swap(chunkDarts[c]);
+		}
+	});
+
+	for (unsigned int i = 0; i < nbw; ++i)
+		map.removeThreadId(pool->threadId(i));
+
+	if (attached == &csr)
+	{
+		if (adjacent)
+			map.template setCSRAdjacentTraversal<ORBIT, REL>(&csr);
+		else
+			map.template setCSRIncidentTraversal<ORBIT, REL>(&csr);
+	}
+}
+
+template <typename MAP>
+CSRSnapshot<MAP>::CSRSnapshot(MAP& map) :
+	m_map(map),
+	m_attached(false)
+{}
+
+template <typename MAP>
+CSRSnapshot<MAP>::~CSRSnapshot()
+{
+	detach();
+}
+
+template <typename MAP>
+void CSRSnapshot<MAP>::build(unsigned int nbth)
+{
+	bool wasAttached = m_attached;
+	detach();
+
+	buildCSRRelation<VERTEX, EDGE>(m_map, m_vertexVertices, true, nbth);
+	buildCSRRelation<VERTEX, FACE>(m_map, m_vertexFaces, false, nbth);
+	buildCSRRelation<FACE, VERTEX>(m_map, m_faceVertices, false, nbth);
+	buildCSRRelation<EDGE, FACE>(m_map, m_edgeFaces, false, nbth);
+
+	if (wasAttached)
+		attach();
+}
+
+template <typename MAP>
+void CSRSnapshot<MAP>::attach()
+{
+	if (m_vertexVertices.nbRows() == 0)
+		return;
+
+	m_map.template setCSRAdjacentTraversal<VERTEX, EDGE>(&m_vertexVertices);
+	m_map.template setCSRIncidentTraversal<VERTEX, FACE>(&m_vertexFaces);
+	m_map.template setCSRIncidentTraversal<FACE, VERTEX>(&m_faceVertices);
+	m_map.template setCSRIncidentTraversal<EDGE, FACE>(&m_edgeFaces);
+	m_attached = true;
+}
+
+template <typename MAP>
+void CSRSnapshot<MAP>::detach()
+{
+	// the map may have dropped the relations itself (compaction, reordering)
+	if (m_map.template getCSRAdjacentTraversal<VERTEX, EDGE>() == &m_vertexVertices)
+		m_map.template setCSRAdjacentTraversal<VERTEX, EDGE>(NULL);
+	if (m_map.template getCSRIncidentTraversal<VERTEX, FACE>() == &m_vertexFaces)
+		m_map.template setCSRIncidentTraversal<VERTEX, FACE>(NULL);
+	if (m_map.template getCSRIncidentTraversal<FACE, VERTEX>() == &m_faceVertices)
+		m_map.template setCSRIncidentTraversal<FACE, VERTEX>(NULL);
+	if (m_map.template getCSRIncidentTraversal<EDGE, FACE>() == &m_edgeFaces)
+		m_map.template setCSRIncidentTraversal<EDGE, FACE>(NULL);
+	m_attached = false;
+}
+
+template <typename MAP>
+unsigned long long CSRSnapshot<MAP>::memory() const
+{
+	return m_vertexVertices.memory() + m_vertexFaces.memory() + m_faceVertices.memory() + m_edgeFaces.memory();
+}
+
+template <typename MAP>
+void CSRSnapshot<MAP>::clear()
+{
+	detach();
+	m_vertexVertices.clear();
+	m_vertexFaces.clear();
+	m_faceVertices.clear();
+	m_edgeFaces.clear();
+}
+
+} //namespace CGoGN
@@ -44,6 +44,8 @@
 
 #include <thread>
 #include <mutex>
+#include <atomic>
+#include <deque>
 
 #include "Topology/dll.h"
 
@@ -87,6 +89,7 @@ class AttributeHandlerGen ;
 class DartMarkerGen ;
 class CellMarkerGen ;
 class MapManipulator;
+class CSRRelation;
 
 class CGoGN_TOPO_API GenericMap
 {
@@ -104,12 +107,60 @@ protected:
 	// protected copy constructor to prevent the copy of map
 	GenericMap(const GenericMap& ) {}
 
+	/**
+	 * @brief ThreadResources
+	 * resources owned by a registered thread: free Dart and uint buffers
+	 * and free mark vectors (bits and epochs) of each orbit
+	 */
+	struct ThreadResources
+	{
+		std::vector< std::vector<Dart>* > dartsBuffers;
+		std::vector< std::vector<unsigned int>* > intsBuffers;
+		std::vector< AttributeMultiVector<MarkerBool>* > markVectorsFree[NB_ORBITS];
+		std::vector< AttributeMultiVector<MarkerBool>* > epochMarkVectorsFree[NB_ORBITS];
+
+		inline ThreadResources();
+		inline ~ThreadResources();
+	};
+
+	/**
+	 * @brief ThreadSlotCache
+	 * entry of the per-thread cache of slot lookups, valid as long as
+	 * the stamp of the map has not changed
+	 */
+	struct ThreadSlotCache
+	{
+		unsigned long long stamp;
+		unsigned int index;
+		ThreadResources* resources;
+	};
+
+	static const unsigned int THREAD_SLOT_CACHE_SIZE = 8;
+
 	/**
 	 * @brief m_thread_ids
-	 * vector of known thread ids, i.e. threads for which a mark vector,
+	 * known thread ids, i.e. threads for which a mark vector,
 	 * a Dart buffer or a uint buffer will be given when asked
+	 * (a deque so that references given by addEmptyThreadId stay valid)
 	 */
-	mutable std::vector<std::thread::id> m_thread_ids;
+	mutable std::deque<std::thread::id> m_thread_ids;
+
+	/**
+	 * @brief m_thread_resources
+	 * resources of the thread of same index in m_thread_ids, entries
+	 * beyond m_thread_ids.size() are kept for reuse by the next registered threads
+	 */
+	mutable std::vector<ThreadResources*> m_thread_resources;
+
+	/**
+	 * @brief m_thread_stamp
+	 * globally unique value renewed each time the table of threads changes,
+	 * used as key in the thread local cache of slot lookups
+	 */
+	mutable std::atomic<unsigned long long> m_thread_stamp;
+
+	/// protect the table of threads
+	mutable std::mutex m_thread_ids_mutex;
 
 	/**
 	 * @brief m_authorizeExternalThreads
@@ -117,6 +168,18 @@ protected:
 	 */
 	bool m_authorizeExternalThreads;
 
+	/// renew the stamp of the table of threads (invalidate cached lookups)
+	void renewThreadStamp() const;
+
+	/// slow path of thread lookup: scan (and register external thread), then fill the cache entry
+	void lookupCurrentThread(ThreadSlotCache& entry) const;
+
+	/// get the cache entry of the current thread for this map (O(1))
+	inline const ThreadSlotCache& getCurrentThreadSlot() const;
+
+	/// get the resources of the current thread
+	inline ThreadResources* getCurrentThreadResources() const;
+
 public:
 	/// compute thread index in the table of thread
 	inline unsigned int getCurrentThreadIndex() const;
@@ -125,21 +188,24 @@ public:
 //	inline void addThreadId(const std::thread::id id);
 
 	/// unregister the given thread to access resources on this map
-	inline void removeThreadId(const std::thread::id id);
+	void removeThreadId(const std::thread::id id);
 
 	/// add room for a new thread ID (will be set on thread start)
-	inline std::thread::id& addEmptyThreadId();
+	std::thread::id& addEmptyThreadId();
 
 	/// get a threadId based on its index
 	inline std::thread::id getThreadId(unsigned int index) const;
 
+	/// number of threads registered on the map
+	inline unsigned int getNbThreadIds() const;
+
 	/**
 	 * @brief setExternalThreadsAuthorization
 	 * @param b
 	 * if true, threads that did not created the map will be able to traverse it
 	 * if false, traversal of the map by other threads will fail
 	 */
-	inline void setExternalThreadsAuthorization(bool b);
+	void setExternalThreadsAuthorization(bool b);
 
 protected:
 	/**
@@ -149,10 +215,6 @@ protected:
 
 	static std::map<std::string, RegisteredBaseAttribute*>* m_attributes_registry_map;
 
-	/// buffer for less memory allocation
-	mutable std::vector< std::vector<Dart>* > s_vdartsBuffers[NB_THREADS];
-	mutable std::vector< std::vector<unsigned int>* > s_vintsBuffers[NB_THREADS];
-
 public:
 	/// table of instancied maps for Dart/CellMarker release
 	static std::vector<GenericMap*>* s_instances;
@@ -172,7 +234,15 @@ protected:
 	AttributeMultiVector<NoTypeNameAttribute<std::vector<Dart> > >* m_quickLocalIncidentTraversal[NB_ORBITS][NB_ORBITS] ;
 	AttributeMultiVector<NoTypeNameAttribute<std::vector<Dart> > >* m_quickLocalAdjacentTraversal[NB_ORBITS][NB_ORBITS] ;
 
-	std::vector< AttributeMultiVector<MarkerBool>* > m_markVectors_free[NB_ORBITS][NB_THREADS] ;
+	/**
+	 * Compact rows of local traversals used instead of the quick traversal attributes
+	 * (attached by CSRSnapshot, not owned by the map)
+	 */
+	const CSRRelation* m_csrIncidentTraversal[NB_ORBITS][NB_ORBITS] ;
+	const CSRRelation* m_csrAdjacentTraversal[NB_ORBITS][NB_ORBITS] ;
+	// number of attached relations (the creation or removal of a dart or a cell detaches them)
+	unsigned int m_nbCSRTraversals ;
+
 	std::mutex m_MarkerStorageMutex[NB_ORBITS];
 
 	unsigned int m_nextMarkerId;
@@ -375,9 +445,11 @@ public:
 
 	/**
 	 * @brief ask for a marker attribute
+	 * @param epoch storage with epoch stamps (unmark all in O(1), 16 bits per element)
+	 * instead of bits (unmark all clears the whole vector)
 	 */
 	template <unsigned int ORBIT>
-	AttributeMultiVector<MarkerBool>* askMarkVector() ;
+	AttributeMultiVector<MarkerBool>* askMarkVector(bool epoch = false) ;
 
 	/**
 	 * @brief release allocated marker attribute
@@ -489,7 +561,21 @@ protected:
 	 */
 	virtual void compactTopo() = 0 ;
 
+	/**
+	 * move the darts of a compact map and update the topo relations
+	 * @param newOfOld newOfOld[i] is the new index of dart i
+	 * @return false if not handled by the map implementation
+	 */
+	virtual bool permuteTopo(const std::vector<unsigned int>& newOfOld) = 0 ;
+
 public:
+	/**
+	 * detach all the compact (CSR) traversal rows from the map
+	 * (done by compaction, reordering, moveData and the creation or removal
+	 * of darts and cells as the rows become invalid)
+	 */
+	void detachCSRTraversals() ;
+
 	/**
 	 * compact the map
 	 * @warning the quickTraversals needs to be updated
@@ -513,6 +599,27 @@ public:
 	 */
 	void compactIfNeeded(float frag, bool topoOnly = false) ;
 
+	/**
+	 * reorder the darts and the cells for the memory locality of the traversals
+	 * The darts are moved as given, the containers of the embedded orbits are
+	 * compacted then each cell is moved at the rank of its first dart.
+	 * The quick traversals are updated, the CSR traversals are detached, the
+	 * user attributes that store darts or cell indices are not (as for compact).
+	 * @param newOfOld newOfOld[i] is the new index of dart i (permutation
+	 * of [0,nbDarts), the dart container must be compact)
+	 * @return false if the dart container is not compact or newOfOld has a wrong size
+	 */
+	bool reorder(const std::vector<unsigned int>& newOfOld) ;
+
+	/**
+	 * allocate the attributes of all the containers (markers excepted) in the
+	 * blocks of a pager, for maps larger than RAM (see Utils::BlockPager).
+	 * Reordering the map (Algo::Topo::reorderHilbert) before processing it by
+	 * chunks of blocks keeps the working set small.
+	 * @param pager the pager (referenced by the map), NULL brings the blocks back on the heap
+	 */
+	void setPager(Utils::BlockPager* pager) ;
+
 	/**
 	 * test if containers are fragmented
 	 *  ~1.0 (full filled) no need to compact
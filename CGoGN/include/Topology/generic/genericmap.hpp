@@ -31,24 +31,43 @@ namespace CGoGN
  *         THREAD ID MANAGEMENT         *
  ****************************************/
 
+inline GenericMap::ThreadResources::ThreadResources()
+{
+	dartsBuffers.reserve(8);
+	intsBuffers.reserve(8);
+}
+
+inline GenericMap::ThreadResources::~ThreadResources()
+{
+	for (auto it = dartsBuffers.begin(); it != dartsBuffers.end(); ++it)
+		delete *it;
+	for (auto it = intsBuffers.begin(); it != intsBuffers.end(); ++it)
+		delete *it;
+}
+
+inline const GenericMap::ThreadSlotCache& GenericMap::getCurrentThreadSlot() const
+{
+	// small direct-mapped cache, stamps are unique over all maps and all
+	// changes of their table of threads, so a hit is always a valid slot
+	static thread_local ThreadSlotCache cache[THREAD_SLOT_CACHE_SIZE] = {};
+
+	unsigned long long stamp = m_thread_stamp.load(std::memory_order_acquire);
+	ThreadSlotCache& entry = cache[stamp % THREAD_SLOT_CACHE_SIZE];
+	if (entry.stamp != stamp)
+		lookupCurrentThread(entry);
+	return entry;
+}
+
+inline GenericMap::ThreadResources* GenericMap::getCurrentThreadResources() const
+{
+	ThreadResources* res = getCurrentThreadSlot().resources;
+	assert(res != NULL || !"Thread not registered on this map (see setExternalThreadsAuthorization)");
+	return res;
+}
+
 inline unsigned int GenericMap::getCurrentThreadIndex() const
 {
-	std::thread::id id = std::this_thread::get_id();
-	for (unsigned int i = 0; i < m_thread_ids.size(); ++i)
-	{
-		if (id == m_thread_ids[i])
-			return i;
-	}
-	assert(m_thread_ids.size() < NB_THREADS + 1);
-	if (m_authorizeExternalThreads)
-	{
-		m_thread_ids.push_back(id);
-		return m_thread_ids.size() - 1;
-	}
-	else
-	{
-		return -1;
-	}
+	return getCurrentThreadSlot().index;
 }
 
 //inline void GenericMap::addThreadId(const std::thread::id id)
@@ -58,47 +77,19 @@ inline unsigned int GenericMap::getCurrentThreadIndex() const
 //		if (m_thread_ids[i] == id)
 //			return;
 //	}
-//	assert(m_thread_ids.size() < NB_THREADS + 1);
 //	if (m_authorizeExternalThreads)
 //		m_thread_ids.push_back(id);
 //}
 
-inline void GenericMap::removeThreadId(const std::thread::id id)
-{
-	for (unsigned int i = 0; i < m_thread_ids.size(); ++i)
-	{
-		if (m_thread_ids[i] == id)
-		{
-			m_thread_ids[i] = m_thread_ids.back();
-			m_thread_ids.pop_back();
-			break;
-		}
-	}
-}
-
-inline std::thread::id& GenericMap::addEmptyThreadId()
-{
-	assert(m_thread_ids.size() < NB_THREADS + 1);
-	unsigned int size = uint32(m_thread_ids.size());
-	m_thread_ids.resize(size + 1);
-	return m_thread_ids.back();
-}
-
 inline std::thread::id GenericMap::getThreadId(unsigned int index) const
 {
 	assert(index < m_thread_ids.size());
 	return m_thread_ids[index];
 }
 
-inline void GenericMap::setExternalThreadsAuthorization(bool b)
+inline unsigned int GenericMap::getNbThreadIds() const
 {
-	m_authorizeExternalThreads = b;
-	if (!m_authorizeExternalThreads)
-	{
-		// keep only the thread that created the map
-		while (m_thread_ids.size() > 1)
-			m_thread_ids.pop_back();
-	}
+	return uint32(m_thread_ids.size());
 }
 
 
@@ -108,24 +99,22 @@ inline void GenericMap::setExternalThreadsAuthorization(bool b)
 
 inline std::vector<Dart>* GenericMap::askDartBuffer() const
 {
-	unsigned int thread = getCurrentThreadIndex();
+	std::vector< std::vector<Dart>* >& buffers = getCurrentThreadResources()->dartsBuffers;
 
-	if (s_vdartsBuffers[thread].empty())
+	if (buffers.empty())
 	{
 		std::vector<Dart>* vd = new std::vector<Dart>;
 		vd->reserve(128);
 		return vd;
 	}
 
-	std::vector<Dart>* vd = s_vdartsBuffers[thread].back();
-	s_vdartsBuffers[thread].pop_back();
+	std::vector<Dart>* vd = buffers.back();
+	buffers.pop_back();
 	return vd;
 }
 
 inline void GenericMap::releaseDartBuffer(std::vector<Dart>* vd) const
 {
-	unsigned int thread = getCurrentThreadIndex();
-
 	if (vd->capacity() > 1024)
 	{
 		std::vector<Dart> v;
@@ -133,29 +122,27 @@ inline void GenericMap::releaseDartBuffer(std::vector<Dart>* vd) const
 		vd->reserve(128);
 	}
 	vd->clear();
-	s_vdartsBuffers[thread].push_back(vd);
+	getCurrentThreadResources()->dartsBuffers.push_back(vd);
 }
 
 inline std::vector<unsigned int>* GenericMap::askUIntBuffer() const
 {
-	unsigned int thread = getCurrentThreadIndex();
+	std::vector< std::vector<unsigned int>* >& buffers = getCurrentThreadResources()->intsBuffers;
 
-	if (s_vintsBuffers[thread].empty())
+	if (buffers.empty())
 	{
 		std::vector<unsigned int>* vui = new std::vector<unsigned int>;
 		vui->reserve(128);
 		return vui;
 	}
 
-	std::vector<unsigned int>* vui = s_vintsBuffers[thread].back();
-	s_vintsBuffers[thread].pop_back();
+	std::vector<unsigned int>* vui = buffers.back();
+	buffers.pop_back();
 	return vui;
 }
 
 inline void GenericMap::releaseUIntBuffer(std::vector<unsigned int>* vui) const
 {
-	unsigned int thread = getCurrentThreadIndex();
-
 	if (vui->capacity() > 1024)
 	{
 		std::vector<unsigned int> v;
@@ -163,7 +150,7 @@ inline void GenericMap::releaseUIntBuffer(std::vector<unsigned int>* vui) const
 		vui->reserve(128);
 	}
 	vui->clear();
-	s_vintsBuffers[thread].push_back(vui);
+	getCurrentThreadResources()->intsBuffers.push_back(vui);
 }
 
 
@@ -173,6 +160,9 @@ inline void GenericMap::releaseUIntBuffer(std::vector<unsigned int>* vui) const
 
 inline Dart GenericMap::newDart()
 {
+	if (m_nbCSRTraversals > 0)
+		detachCSRTraversals() ;
+
 	unsigned int di = m_attribs[DART].insertLine();		// insert a new dart line
 	m_attribs[DART].initMarkersOfLine(di);
 	for(unsigned int i = 0; i < NB_ORBITS; ++i)
@@ -186,6 +176,9 @@ inline Dart GenericMap::newDart()
 
 inline void GenericMap::deleteDartLine(unsigned int index)
 {
+	if (m_nbCSRTraversals > 0)
+		detachCSRTraversals() ;
+
 	m_attribs[DART].removeLine(index) ;	// free the dart line
 
 	for(unsigned int orbit = 0; orbit < NB_ORBITS; ++orbit)
@@ -240,6 +233,9 @@ inline unsigned int GenericMap::newCell()
 {
 	assert(isOrbitEmbedded<ORBIT>() || !"Invalid parameter: orbit not embedded");
 
+	if (m_nbCSRTraversals > 0)
+		detachCSRTraversals() ;
+
 	unsigned int c = m_attribs[ORBIT].insertLine();
 	m_attribs[ORBIT].initMarkersOfLine(c);
 	return c;
@@ -297,17 +293,18 @@ inline AttributeMultiVectorGen* GenericMap::getAttributeVectorGen(unsigned int o
 
 
 template <unsigned int ORBIT>
-AttributeMultiVector<MarkerBool>* GenericMap::askMarkVector()
+AttributeMultiVector<MarkerBool>* GenericMap::askMarkVector(bool epoch)
 {
 	assert(isOrbitEmbedded<ORBIT>() || !"Invalid parameter: orbit not embedded") ;
 
-	// get current thread index for table of markers
-	unsigned int thread = getCurrentThreadIndex();
+	// get free markers of current thread
+	ThreadResources* res = getCurrentThreadResources();
+	std::vector< AttributeMultiVector<MarkerBool>* >& freeMV = epoch ? res->epochMarkVectorsFree[ORBIT] : res->markVectorsFree[ORBIT];
 
-	if (!m_markVectors_free[ORBIT][thread].empty())
+	if (!freeMV.empty())
 	{
-		AttributeMultiVector<MarkerBool>* amv = m_markVectors_free[ORBIT][thread].back();
-		m_markVectors_free[ORBIT][thread].pop_back();
+		AttributeMultiVector<MarkerBool>* amv = freeMV.back();
+		freeMV.pop_back();
 		return amv;
 	}
 	else
@@ -322,7 +319,7 @@ AttributeMultiVector<MarkerBool>* GenericMap::askMarkVector()
 		x = x/10;
 		number[0] = '0'+x%10;
 
-		AttributeMultiVector<MarkerBool>* amv = m_attribs[ORBIT].addMarkerAttribute("marker_" + orbitName(ORBIT) + number);
+		AttributeMultiVector<MarkerBool>* amv = m_attribs[ORBIT].addMarkerAttribute("marker_" + orbitName(ORBIT) + number, epoch);
 		return amv;
 	}
 }
@@ -332,8 +329,11 @@ inline void GenericMap::releaseMarkVector(AttributeMultiVector<MarkerBool>* amv)
 {
 	assert(isOrbitEmbedded<ORBIT>() || !"Invalid parameter: orbit not embedded") ;
 
-	unsigned int thread = getCurrentThreadIndex();
-	m_markVectors_free[ORBIT][thread].push_back(amv);
+	ThreadResources* res = getCurrentThreadResources();
+	if (amv->isEpochMode())
+		res->epochMarkVectorsFree[ORBIT].push_back(amv);
+	else
+		res->markVectorsFree[ORBIT].push_back(amv);
 }
 
 
@@ -27,6 +27,7 @@
 
 #include "Topology/generic/attributeHandler.h"
 #include "Topology/generic/cells.h"
+#include "Topology/generic/csrRelation.h"
 
 namespace CGoGN
 {
@@ -242,6 +243,37 @@ public:
 
 	template <unsigned int ORBIT, unsigned int ADJ>
 	void disableQuickAdjacentTraversal();
+
+	/**
+	 * attach compact rows used by the incident traversors (NULL to detach)
+	 * the relation is not owned by the map and must be indexed by the embeddings of ORBIT
+	 */
+	template <unsigned int ORBIT, unsigned int INCI>
+	void setCSRIncidentTraversal(const CSRRelation* csr);
+
+	template <unsigned int ORBIT, unsigned int INCI>
+	const CSRRelation* getCSRIncidentTraversal() const;
+
+	template <unsigned int ORBIT, unsigned int ADJ>
+	void setCSRAdjacentTraversal(const CSRRelation* csr);
+
+	template <unsigned int ORBIT, unsigned int ADJ>
+	const CSRRelation* getCSRAdjacentTraversal() const;
+
+	/**
+	 * NIL terminated darts of the cells incident to c, taken from the attached
+	 * CSR relation or from the quick traversal attribute
+	 * @return NULL if none of them is available
+	 */
+	template <unsigned int ORBIT, unsigned int INCI>
+	const Dart* getQuickIncidentRow(Cell<ORBIT> c) const;
+
+	/**
+	 * NIL terminated darts of the cells adjacent to c through ADJ
+	 * @return NULL if neither CSR relation nor quick traversal is available
+	 */
+	template <unsigned int ORBIT, unsigned int ADJ>
+	const Dart* getQuickAdjacentRow(Cell<ORBIT> c) const;
 };
 
 } //namespace CGoGN
@@ -449,4 +449,78 @@ inline void MapCommon<MAP_IMPL>::disableQuickAdjacentTraversal()
 	}
 }
 
+template <typename MAP_IMPL>
+template <unsigned int ORBIT, unsigned int INCI>
+inline void MapCommon<MAP_IMPL>::setCSRIncidentTraversal(const CSRRelation* csr)
+{
+	const CSRRelation*& attached = this->m_csrIncidentTraversal[ORBIT][INCI] ;
+	if ((attached == NULL) && (csr != NULL))
+		++this->m_nbCSRTraversals ;
+	else if ((attached != NULL) && (csr == NULL))
+		--this->m_nbCSRTraversals ;
+	attached = csr ;
+}
+
+template <typename MAP_IMPL>
+template <unsigned int ORBIT, unsigned int INCI>
+inline const CSRRelation* MapCommon<MAP_IMPL>::getCSRIncidentTraversal() const
+{
+	return this->m_csrIncidentTraversal[ORBIT][INCI] ;
+}
+
+template <typename MAP_IMPL>
+template <unsigned int ORBIT, unsigned int ADJ>
+inline void MapCommon<MAP_IMPL>::setCSRAdjacentTraversal(const CSRRelation* csr)
+{
+	const CSRRelation*& attached = this->m_csrAdjacentTraversal[ORBIT][ADJ] ;
+	if ((attached == NULL) && (csr != NULL))
+		++this->m_nbCSRTraversals ;
+	else if ((attached != NULL) && (csr == NULL))
+		--this->m_nbCSRTraversals ;
+	attached = csr ;
+}
+
+template <typename MAP_IMPL>
+template <unsigned int ORBIT, unsigned int ADJ>
+inline const CSRRelation* MapCommon<MAP_IMPL>::getCSRAdjacentTraversal() const
+{
+	return this->m_csrAdjacentTraversal[ORBIT][ADJ] ;
+}
+
+template <typename MAP_IMPL>
+template <unsigned int ORBIT, unsigned int INCI>
+inline const Dart* MapCommon<MAP_IMPL>::getQuickIncidentRow(Cell<ORBIT> c) const
+{
+	const CSRRelation* csr = this->m_csrIncidentTraversal[ORBIT][INCI] ;
+	if (csr != NULL)
+	{
+		assert(getEmbedding(c) < csr->nbRows() || !"CSR relation of an older state of the map") ;
+		return csr->row(getEmbedding(c)) ;
+	}
+
+	const AttributeMultiVector<NoTypeNameAttribute<std::vector<Dart> > >* quickTraversal = this->m_quickLocalIncidentTraversal[ORBIT][INCI] ;
+	if (quickTraversal != NULL)
+		return &(quickTraversal->operator[](getEmbedding(c)))[0] ;
+
+	return NULL ;
+}
+
+template <typename MAP_IMPL>
+template <unsigned int ORBIT, unsigned int ADJ>
+inline const Dart* MapCommon<MAP_IMPL>::getQuickAdjacentRow(Cell<ORBIT> c) const
+{
+	const CSRRelation* csr = this->m_csrAdjacentTraversal[ORBIT][ADJ] ;
+	if (csr != NULL)
+	{
+		assert(getEmbedding(c) < csr->nbRows() || !"CSR relation of an older state of the map") ;
+		return csr->row(getEmbedding(c)) ;
+	}
+
+	const AttributeMultiVector<NoTypeNameAttribute<std::vector<Dart> > >* quickTraversal = this->m_quickLocalAdjacentTraversal[ORBIT][ADJ] ;
+	if (quickTraversal != NULL)
+		return &(quickTraversal->operator[](getEmbedding(c)))[0] ;
+
+	return NULL ;
+}
+
 } // namespace CGoGN
@@ -108,6 +108,8 @@ protected:
 
 	virtual void compactTopo();
 
+	virtual bool permuteTopo(const std::vector<unsigned int>& newOfOld);
+
 	/****************************************
 	 *           DARTS TRAVERSALS           *
 	 ****************************************/
@@ -149,6 +151,24 @@ public:
 
 	bool loadMapBin(const std::string& filename);
 
+	/**
+	 * Save map in a mappable binary file: not compressed, data blocks are
+	 * page aligned so that loadMapMapped adopts them without any copy
+	 * @param filename the file name
+	 * @return true if OK
+	 */
+	bool saveMapMappable(const std::string& filename) const;
+
+	/**
+	 * Load map from a mappable binary file by mapping it in memory
+	 * (loadMapBin also detects these files and maps them copy-on-write)
+	 * @param filename the file name
+	 * @param readOnly if true the data must not be modified, else the
+	 * written pages are privately copied (the file is never modified)
+	 * @return true if OK
+	 */
+	bool loadMapMapped(const std::string& filename, bool readOnly = false);
+
 	bool copyFrom(const GenericMap& map);
 
 	void restore_topo_shortcuts();
@@ -171,6 +171,8 @@ protected:
 
 	virtual void compactTopo();
 
+	virtual bool permuteTopo(const std::vector<unsigned int>& newOfOld);
+
 	/****************************************
 	 *      MR CONTAINER MANAGEMENT         *
 	 ****************************************/
@@ -34,11 +34,7 @@ namespace CGoGN
 template <typename MAP>
 Traversor2VE<MAP>::Traversor2VE(const MAP& map, Vertex v) : m(map), start(v),m_QLT(NULL)
 {
-	const AttributeMultiVector<NoTypeNameAttribute<std::vector<Dart> > >* quickTraversal = map.template getQuickIncidentTraversal<VERTEX,EDGE>() ;
-	if (quickTraversal != NULL)
-	{
-		m_QLT = &(quickTraversal->operator[](map.getEmbedding(v)));
-	}
+	m_QLT = map.template getQuickIncidentRow<VERTEX,EDGE>(v) ;
 }
 
 template <typename MAP>
@@ -46,7 +42,7 @@ Edge Traversor2VE<MAP>::begin()
 {
 	if(m_QLT != NULL)
 	{
-		m_ItDarts = m_QLT->begin();
+		m_ItDarts = m_QLT;
 		return Edge(*m_ItDarts++);
 	}
 
@@ -83,12 +79,8 @@ Edge Traversor2VE<MAP>::next()
 template <typename MAP>
 Traversor2VF<MAP>::Traversor2VF(const MAP& map, Vertex v) : m(map), start(v),m_QLT(NULL)
 {
-	const AttributeMultiVector<NoTypeNameAttribute<std::vector<Dart> > >* quickTraversal = map.template getQuickIncidentTraversal<VERTEX,FACE>() ;
-	if (quickTraversal != NULL)
-	{
-		m_QLT = &(quickTraversal->operator[](map.getEmbedding(v)));
-	}
-	else
+	m_QLT = map.template getQuickIncidentRow<VERTEX,FACE>(v) ;
+	if (m_QLT == NULL)
 	{
 		if(m.template isBoundaryMarked<2>(start)) // jump over a boundary face
 			start = m.phi2(m.phi_1(start)) ;
@@ -100,7 +92,7 @@ Face Traversor2VF<MAP>::begin()
 {
 	if(m_QLT != NULL)
 	{
-		m_ItDarts = m_QLT->begin();
+		m_ItDarts = m_QLT;
 		return Face(*m_ItDarts++);
 	}
 
@@ -137,12 +129,8 @@ Face Traversor2VF<MAP>::next()
 template <typename MAP>
 Traversor2VVaE<MAP>::Traversor2VVaE(const MAP& map, Vertex v) : m(map), m_QLT(NULL)
 {
-	const AttributeMultiVector<NoTypeNameAttribute<std::vector<Dart> > >* quickTraversal = map.template getQuickAdjacentTraversal<VERTEX,EDGE>() ;
-	if (quickTraversal != NULL)
-	{
-		m_QLT = &(quickTraversal->operator[](map.getEmbedding(v)));
-	}
-	else
+	m_QLT = map.template getQuickAdjacentRow<VERTEX,EDGE>(v) ;
+	if (m_QLT == NULL)
 	{
 		start = m.phi2(v.dart) ;
 	}
@@ -153,7 +141,7 @@ Vertex Traversor2VVaE<MAP>::begin()
 {
 	if(m_QLT != NULL)
 	{
-		m_ItDarts = m_QLT->begin();
+		m_ItDarts = m_QLT;
 		return *m_ItDarts++;
 	}
 
@@ -188,12 +176,8 @@ Vertex Traversor2VVaE<MAP>::next()
 template <typename MAP>
 Traversor2VVaF<MAP>::Traversor2VVaF(const MAP& map, Vertex v) : m(map), m_QLT(NULL)
 {
-	const AttributeMultiVector<NoTypeNameAttribute<std::vector<Dart> > >* quickTraversal = map.template getQuickAdjacentTraversal<VERTEX,FACE>() ;
-	if (quickTraversal != NULL)
-	{
-		m_QLT = &(quickTraversal->operator[](map.getEmbedding(v)));
-	}
-	else
+	m_QLT = map.template getQuickAdjacentRow<VERTEX,FACE>(v) ;
+	if (m_QLT == NULL)
 	{
 		if(m.template isBoundaryMarked<2>(v.dart))
 			v.dart = m.phi2(m.phi_1(v.dart)) ;
@@ -209,7 +193,7 @@ Vertex Traversor2VVaF<MAP>::begin()
 {
 	if(m_QLT != NULL)
 	{
-		m_ItDarts = m_QLT->begin();
+		m_ItDarts = m_QLT;
 		return Vertex(*m_ItDarts++);
 	}
 
@@ -262,11 +246,7 @@ Vertex Traversor2VVaF<MAP>::next()
 template <typename MAP>
 Traversor2EV<MAP>::Traversor2EV(const MAP& map, Edge e) : m(map), start(e), m_QLT(NULL)
 {
-	const AttributeMultiVector<NoTypeNameAttribute<std::vector<Dart> > >* quickTraversal = map.template getQuickIncidentTraversal<EDGE,VERTEX>() ;
-	if (quickTraversal != NULL)
-	{
-		m_QLT = &(quickTraversal->operator[](map.getEmbedding(e)));
-	}
+	m_QLT = map.template getQuickIncidentRow<EDGE,VERTEX>(e) ;
 }
 
 template <typename MAP>
@@ -274,7 +254,7 @@ Vertex Traversor2EV<MAP>::begin()
 {
 	if(m_QLT != NULL)
 	{
-		m_ItDarts = m_QLT->begin();
+		m_ItDarts = m_QLT;
 		return *m_ItDarts++;
 	}
 
@@ -309,12 +289,8 @@ Vertex Traversor2EV<MAP>::next()
 template <typename MAP>
 Traversor2EF<MAP>::Traversor2EF(const MAP& map, Edge e) : m(map), start(e),m_QLT(NULL)
 {
-	const AttributeMultiVector<NoTypeNameAttribute<std::vector<Dart> > >* quickTraversal = map.template getQuickIncidentTraversal<EDGE,FACE>() ;
-	if (quickTraversal != NULL)
-	{
-		m_QLT = &(quickTraversal->operator[](map.getEmbedding(e)));
-	}
-	else
+	m_QLT = map.template getQuickIncidentRow<EDGE,FACE>(e) ;
+	if (m_QLT == NULL)
 	{
 		if(m.template isBoundaryMarked<2>(start.dart))
 			start = m.phi2(start.dart) ;
@@ -326,7 +302,7 @@ Face Traversor2EF<MAP>::begin()
 {
 	if(m_QLT != NULL)
 	{
-		m_ItDarts = m_QLT->begin();
+		m_ItDarts = m_QLT;
 		return *m_ItDarts++;
 	}
 
@@ -361,12 +337,8 @@ Face Traversor2EF<MAP>::next()
 template <typename MAP>
 Traversor2EEaV<MAP>::Traversor2EEaV(const MAP& map, Edge e) : m(map), m_QLT(NULL)
 {
-	const AttributeMultiVector<NoTypeNameAttribute<std::vector<Dart> > >* quickTraversal = map.template getQuickAdjacentTraversal<EDGE,VERTEX>() ;
-	if (quickTraversal != NULL)
-	{
-		m_QLT = &(quickTraversal->operator[](map.getEmbedding(e)));
-	}
-	else
+	m_QLT = map.template getQuickAdjacentRow<EDGE,VERTEX>(e) ;
+	if (m_QLT == NULL)
 	{
 		start = m.phi2(m.phi_1(e.dart)) ;
 		stop1 = e ;
@@ -379,7 +351,7 @@ Edge Traversor2EEaV<MAP>::begin()
 {
 	if(m_QLT != NULL)
 	{
-		m_ItDarts = m_QLT->begin();
+		m_ItDarts = m_QLT;
 		return *m_ItDarts++;
 	}
 
@@ -416,12 +388,8 @@ Edge Traversor2EEaV<MAP>::next()
 template <typename MAP>
 Traversor2EEaF<MAP>::Traversor2EEaF(const MAP& map, Edge e) : m(map), m_QLT(NULL)
 {
-	const AttributeMultiVector<NoTypeNameAttribute<std::vector<Dart> > >* quickTraversal = map.template getQuickAdjacentTraversal<EDGE,FACE>() ;
-	if (quickTraversal != NULL)
-	{
-		m_QLT = &(quickTraversal->operator[](map.getEmbedding(e)));
-	}
-	else
+	m_QLT = map.template getQuickAdjacentRow<EDGE,FACE>(e) ;
+	if (m_QLT == NULL)
 	{
 		if (m.template isBoundaryMarked<2>(e.dart))
 			stop1 = m.phi2(e.dart);
@@ -437,7 +405,7 @@ Edge Traversor2EEaF<MAP>::begin()
 {
 	if(m_QLT != NULL)
 	{
-		m_ItDarts = m_QLT->begin();
+		m_ItDarts = m_QLT;
 		return *m_ItDarts++;
 	}
 
@@ -483,11 +451,7 @@ Edge Traversor2EEaF<MAP>::next()
 template <typename MAP>
 Traversor2FV<MAP>::Traversor2FV(const MAP& map, Face f) : m(map), start(f), m_QLT(NULL)
 {
-	const AttributeMultiVector<NoTypeNameAttribute<std::vector<Dart> > >* quickTraversal = map.template getQuickIncidentTraversal<FACE,VERTEX>() ;
-	if (quickTraversal != NULL)
-	{
-		m_QLT = &(quickTraversal->operator[](map.getEmbedding(f)));
-	}
+	m_QLT = map.template getQuickIncidentRow<FACE,VERTEX>(f) ;
 }
 
 template <typename MAP>
@@ -495,7 +459,7 @@ Vertex Traversor2FV<MAP>::begin()
 {
 	if(m_QLT != NULL)
 	{
-		m_ItDarts = m_QLT->begin();
+		m_ItDarts = m_QLT;
 		return *m_ItDarts++;
 	}
 
@@ -530,11 +494,7 @@ Vertex Traversor2FV<MAP>::next()
 template <typename MAP>
 Traversor2FE<MAP>::Traversor2FE(const MAP& map, Face f) : m(map), start(f), m_QLT(NULL)
 {
-	const AttributeMultiVector<NoTypeNameAttribute<std::vector<Dart> > >* quickTraversal = map.template getQuickIncidentTraversal<FACE,VERTEX>() ;
-	if (quickTraversal != NULL)
-	{
-		m_QLT = &(quickTraversal->operator[](map.getEmbedding(f)));
-	}
+	m_QLT = map.template getQuickIncidentRow<FACE,VERTEX>(f) ;
 }
 
 template <typename MAP>
@@ -542,7 +502,7 @@ Edge Traversor2FE<MAP>::begin()
 {
 	if(m_QLT != NULL)
 	{
-		m_ItDarts = m_QLT->begin();
+		m_ItDarts = m_QLT;
 		return *m_ItDarts++;
 	}
 
@@ -577,12 +537,8 @@ Edge Traversor2FE<MAP>::next()
 template <typename MAP>
 Traversor2FFaV<MAP>::Traversor2FFaV(const MAP& map, Face f) : m(map), m_QLT(NULL)
 {
-	const AttributeMultiVector<NoTypeNameAttribute<std::vector<Dart> > >* quickTraversal = map.template getQuickAdjacentTraversal<FACE,VERTEX>() ;
-	if (quickTraversal != NULL)
-	{
-		m_QLT = &(quickTraversal->operator[](map.getEmbedding(f)));
-	}
-	else
+	m_QLT = map.template getQuickAdjacentRow<FACE,VERTEX>(f) ;
+	if (m_QLT == NULL)
 	{
 		start = m.phi2(m.phi_1(m.phi2(m.phi_1(f.dart)))) ;
 		while (start.dart == f.dart)
@@ -602,7 +558,7 @@ Face Traversor2FFaV<MAP>::begin()
 {
 	if(m_QLT != NULL)
 	{
-		m_ItDarts = m_QLT->begin();
+		m_ItDarts = m_QLT;
 		return *m_ItDarts++;
 	}
 
@@ -653,12 +609,8 @@ Face Traversor2FFaV<MAP>::next()
 template <typename MAP>
 Traversor2FFaE<MAP>::Traversor2FFaE(const MAP& map, Face f) : m(map), m_QLT(NULL)
 {
-	const AttributeMultiVector<NoTypeNameAttribute<std::vector<Dart> > >* quickTraversal = map.template getQuickAdjacentTraversal<FACE,EDGE>() ;
-	if (quickTraversal != NULL)
-	{
-		m_QLT = &(quickTraversal->operator[](map.getEmbedding(f)));
-	}
-	else
+	m_QLT = map.template getQuickAdjacentRow<FACE,EDGE>(f) ;
+	if (m_QLT == NULL)
 	{
 		start = m.phi2(f.dart) ;
 		while(start.dart != NIL && m.template isBoundaryMarked<2>(start))
@@ -675,7 +627,7 @@ Face Traversor2FFaE<MAP>::begin()
 {
 	if(m_QLT != NULL)
 	{
-		m_ItDarts = m_QLT->begin();
+		m_ItDarts = m_QLT;
 		return *m_ItDarts++;
 	}
 
@@ -34,11 +34,7 @@ namespace CGoGN
 template <typename MAP>
 VTraversor2VE<MAP>::VTraversor2VE(const MAP& map, Dart dart) : m(map), start(dart),m_QLT(NULL)
 {
-	const AttributeMultiVector<NoTypeNameAttribute<std::vector<Dart> > >* quickTraversal = map.template getQuickIncidentTraversal<VERTEX,EDGE>() ;
-	if (quickTraversal != NULL)
-	{
-		m_QLT  = &(quickTraversal->operator[](map.template getEmbedding<VERTEX>(dart)));
-	}
+	m_QLT = map.template getQuickIncidentRow<VERTEX,EDGE>(dart) ;
 }
 
 template <typename MAP>
@@ -46,7 +42,7 @@ Dart VTraversor2VE<MAP>::begin()
 {
 	if(m_QLT != NULL)
 	{
-		m_ItDarts = m_QLT->begin();
+		m_ItDarts = m_QLT;
 		return *m_ItDarts++;
 	}
 
@@ -83,12 +79,8 @@ Dart VTraversor2VE<MAP>::next()
 template <typename MAP>
 VTraversor2VF<MAP>::VTraversor2VF(const MAP& map, Dart dart) : m(map), start(dart),m_QLT(NULL)
 {
-	const AttributeMultiVector<NoTypeNameAttribute<std::vector<Dart> > >* quickTraversal = map.template getQuickIncidentTraversal<VERTEX,FACE>() ;
-	if (quickTraversal != NULL)
-	{
-		m_QLT  = &(quickTraversal->operator[](map.template getEmbedding<VERTEX>(dart)));
-	}
-	else
+	m_QLT = map.template getQuickIncidentRow<VERTEX,FACE>(dart) ;
+	if (m_QLT == NULL)
 	{
 		if(m.template isBoundaryMarked<2>(start)) // jump over a boundary face
 			start = m.phi2(m.phi_1(start)) ;
@@ -100,7 +92,7 @@ Dart VTraversor2VF<MAP>::begin()
 {
 	if(m_QLT != NULL)
 	{
-		m_ItDarts = m_QLT->begin();
+		m_ItDarts = m_QLT;
 		return *m_ItDarts++;
 	}
 
@@ -137,12 +129,8 @@ Dart VTraversor2VF<MAP>::next()
 template <typename MAP>
 VTraversor2VVaE<MAP>::VTraversor2VVaE(const MAP& map, Dart dart) : m(map),m_QLT(NULL)
 {
-	const AttributeMultiVector<NoTypeNameAttribute<std::vector<Dart> > >* quickTraversal = map.template getQuickAdjacentTraversal<VERTEX,EDGE>() ;
-	if (quickTraversal != NULL)
-	{
-		m_QLT  = &(quickTraversal->operator[](map.template getEmbedding<VERTEX>(dart)));
-	}
-	else
+	m_QLT = map.template getQuickAdjacentRow<VERTEX,EDGE>(dart) ;
+	if (m_QLT == NULL)
 	{
 		start = m.phi2(dart) ;
 	}
@@ -153,7 +141,7 @@ Dart VTraversor2VVaE<MAP>::begin()
 {
 	if(m_QLT != NULL)
 	{
-		m_ItDarts = m_QLT->begin();
+		m_ItDarts = m_QLT;
 		return *m_ItDarts++;
 	}
 
@@ -188,12 +176,8 @@ Dart VTraversor2VVaE<MAP>::next()
 template <typename MAP>
 VTraversor2VVaF<MAP>::VTraversor2VVaF(const MAP& map, Dart dart) : m(map),m_QLT(NULL)
 {
-	const AttributeMultiVector<NoTypeNameAttribute<std::vector<Dart> > >* quickTraversal = map.template getQuickAdjacentTraversal<VERTEX,FACE>() ;
-	if (quickTraversal != NULL)
-	{
-		m_QLT  = &(quickTraversal->operator[](map.template getEmbedding<VERTEX>(dart)));
-	}
-	else
+	m_QLT = map.template getQuickAdjacentRow<VERTEX,FACE>(dart) ;
+	if (m_QLT == NULL)
 	{
 		if(m.template isBoundaryMarked<2>(dart))
 			dart = m.phi2(m.phi_1(dart)) ;
@@ -209,7 +193,7 @@ Dart VTraversor2VVaF<MAP>::begin()
 {
 	if(m_QLT != NULL)
 	{
-		m_ItDarts = m_QLT->begin();
+		m_ItDarts = m_QLT;
 		return *m_ItDarts++;
 	}
 
@@ -262,11 +246,7 @@ Dart VTraversor2VVaF<MAP>::next()
 template <typename MAP>
 VTraversor2EV<MAP>::VTraversor2EV(const MAP& map, Dart dart) : m(map), start(dart),m_QLT(NULL)
 {
-	const AttributeMultiVector<NoTypeNameAttribute<std::vector<Dart> > >* quickTraversal = map.template getQuickIncidentTraversal<EDGE,VERTEX>() ;
-	if (quickTraversal != NULL)
-	{
-		m_QLT  = &(quickTraversal->operator[](map.template getEmbedding<EDGE>(dart)));
-	}
+	m_QLT = map.template getQuickIncidentRow<EDGE,VERTEX>(dart) ;
 }
 
 template <typename MAP>
@@ -274,7 +254,7 @@ Dart VTraversor2EV<MAP>::begin()
 {
 	if(m_QLT != NULL)
 	{
-		m_ItDarts = m_QLT->begin();
+		m_ItDarts = m_QLT;
 		return *m_ItDarts++;
 	}
 
@@ -309,12 +289,8 @@ Dart VTraversor2EV<MAP>::next()
 template <typename MAP>
 VTraversor2EF<MAP>::VTraversor2EF(const MAP& map, Dart dart) : m(map), start(dart),m_QLT(NULL)
 {
-	const AttributeMultiVector<NoTypeNameAttribute<std::vector<Dart> > >* quickTraversal = map.template getQuickIncidentTraversal<EDGE,FACE>() ;
-	if (quickTraversal != NULL)
-	{
-		m_QLT  = &(quickTraversal->operator[](map.template getEmbedding<EDGE>(dart)));
-	}
-	else
+	m_QLT = map.template getQuickIncidentRow<EDGE,FACE>(dart) ;
+	if (m_QLT == NULL)
 	{
 		if(m.template isBoundaryMarked<2>(start))
 			start = m.phi2(start) ;
@@ -326,7 +302,7 @@ Dart VTraversor2EF<MAP>::begin()
 {
 	if(m_QLT != NULL)
 	{
-		m_ItDarts = m_QLT->begin();
+		m_ItDarts = m_QLT;
 		return *m_ItDarts++;
 	}
 
@@ -361,12 +337,8 @@ Dart VTraversor2EF<MAP>::next()
 template <typename MAP>
 VTraversor2EEaV<MAP>::VTraversor2EEaV(const MAP& map, Dart dart) : m(map),m_QLT(NULL)
 {
-	const AttributeMultiVector<NoTypeNameAttribute<std::vector<Dart> > >* quickTraversal = map.template getQuickAdjacentTraversal<EDGE,VERTEX>() ;
-	if (quickTraversal != NULL)
-	{
-		m_QLT  = &(quickTraversal->operator[](map.template getEmbedding<EDGE>(dart)));
-	}
-	else
+	m_QLT = map.template getQuickAdjacentRow<EDGE,VERTEX>(dart) ;
+	if (m_QLT == NULL)
 	{
 		start = m.phi2(m.phi_1(dart)) ;
 		stop1 = dart ;
@@ -379,7 +351,7 @@ Dart VTraversor2EEaV<MAP>::begin()
 {
 	if(m_QLT != NULL)
 	{
-		m_ItDarts = m_QLT->begin();
+		m_ItDarts = m_QLT;
 		return *m_ItDarts++;
 	}
 
@@ -416,12 +388,8 @@ Dart VTraversor2EEaV<MAP>::next()
 template <typename MAP>
 VTraversor2EEaF<MAP>::VTraversor2EEaF(const MAP& map, Dart dart) : m(map),m_QLT(NULL)
 {
-	const AttributeMultiVector<NoTypeNameAttribute<std::vector<Dart> > >* quickTraversal = map.template getQuickAdjacentTraversal<EDGE,FACE>() ;
-	if (quickTraversal != NULL)
-	{
-		m_QLT  = &(quickTraversal->operator[](map.template getEmbedding<EDGE>(dart)));
-	}
-	else
+	m_QLT = map.template getQuickAdjacentRow<EDGE,FACE>(dart) ;
+	if (m_QLT == NULL)
 	{
 		if (m.template isBoundaryMarked<2>(dart))
 			stop1 = m.phi2(dart);
@@ -437,7 +405,7 @@ Dart VTraversor2EEaF<MAP>::begin()
 {
 	if(m_QLT != NULL)
 	{
-		m_ItDarts = m_QLT->begin();
+		m_ItDarts = m_QLT;
 		return *m_ItDarts++;
 	}
 
@@ -483,11 +451,7 @@ Dart VTraversor2EEaF<MAP>::next()
 template <typename MAP>
 VTraversor2FV<MAP>::VTraversor2FV(const MAP& map, Dart dart) : m(map), start(dart),m_QLT(NULL)
 {
-	const AttributeMultiVector<NoTypeNameAttribute<std::vector<Dart> > >* quickTraversal = map.template getQuickIncidentTraversal<FACE,VERTEX>() ;
-	if (quickTraversal != NULL)
-	{
-		m_QLT  = &(quickTraversal->operator[](map.template getEmbedding<FACE>(dart)));
-	}
+	m_QLT = map.template getQuickIncidentRow<FACE,VERTEX>(dart) ;
 }
 
 template <typename MAP>
@@ -495,7 +459,7 @@ Dart VTraversor2FV<MAP>::begin()
 {
 	if(m_QLT != NULL)
 	{
-		m_ItDarts = m_QLT->begin();
+		m_ItDarts = m_QLT;
 		return *m_ItDarts++;
 	}
 
@@ -530,12 +494,8 @@ Dart VTraversor2FV<MAP>::next()
 template <typename MAP>
 VTraversor2FFaV<MAP>::VTraversor2FFaV(const MAP& map, Dart dart) : m(map),m_QLT(NULL)
 {
-	const AttributeMultiVector<NoTypeNameAttribute<std::vector<Dart> > >* quickTraversal = map.template getQuickAdjacentTraversal<FACE,VERTEX>() ;
-	if (quickTraversal != NULL)
-	{
-		m_QLT  = &(quickTraversal->operator[](map.template getEmbedding<FACE>(dart)));
-	}
-	else
+	m_QLT = map.template getQuickAdjacentRow<FACE,VERTEX>(dart) ;
+	if (m_QLT == NULL)
 	{
 		start = m.phi2(m.phi_1(m.phi2(m.phi_1(dart)))) ;
 		while (start == dart)
@@ -555,7 +515,7 @@ Dart VTraversor2FFaV<MAP>::begin()
 {
 	if(m_QLT != NULL)
 	{
-		m_ItDarts = m_QLT->begin();
+		m_ItDarts = m_QLT;
 		return *m_ItDarts++;
 	}
 
@@ -604,12 +564,8 @@ Dart VTraversor2FFaV<MAP>::next()
 template <typename MAP>
 VTraversor2FFaE<MAP>::VTraversor2FFaE(const MAP& map, Dart dart) : m(map),m_QLT(NULL)
 {
-	const AttributeMultiVector<NoTypeNameAttribute<std::vector<Dart> > >* quickTraversal = map.template getQuickAdjacentTraversal<FACE,EDGE>() ;
-	if (quickTraversal != NULL)
-	{
-		m_QLT  = &(quickTraversal->operator[](map.template getEmbedding<FACE>(dart)));
-	}
-	else
+	m_QLT = map.template getQuickAdjacentRow<FACE,EDGE>(dart) ;
+	if (m_QLT == NULL)
 	{
 		start = m.phi2(dart) ;
 		while(start != NIL && m.template isBoundaryMarked<2>(start))
@@ -626,7 +582,7 @@ Dart VTraversor2FFaE<MAP>::begin()
 {
 	if(m_QLT != NULL)
 	{
-		m_ItDarts = m_QLT->begin();
+		m_ItDarts = m_QLT;
 		return *m_ItDarts++;
 	}
 
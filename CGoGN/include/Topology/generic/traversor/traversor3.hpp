@@ -105,12 +105,8 @@ Traversor3XY<MAP, ORBX, ORBY>::Traversor3XY(const MAP& map, Cell<ORBX> c, bool f
 	m_allocated(true),
 	m_first(true)
 {
-	const AttributeMultiVector<NoTypeNameAttribute<std::vector<Dart> > >* quickTraversal = map.template getQuickIncidentTraversal<ORBX,ORBY>() ;
-	if (quickTraversal != NULL)
-	{
-		m_QLT = &(quickTraversal->operator[](map.getEmbedding(c)));
-	}
-	else
+	m_QLT = map.template getQuickIncidentRow<ORBX,ORBY>(c) ;
+	if (m_QLT == NULL)
 	{
 		if(!forceDartMarker && map.isOrbitEmbedded(ORBY))
 			m_cmark = new CellMarkerStore<MAP, ORBY>(map) ;
@@ -148,7 +144,7 @@ Cell<ORBY> Traversor3XY<MAP, ORBX, ORBY>::begin()
 {
 	if(m_QLT != NULL)
 	{
-		m_ItDarts = m_QLT->begin();
+		m_ItDarts = m_QLT;
 		return *m_ItDarts++;
 	}
 
@@ -259,12 +255,8 @@ Traversor3XXaY<MAP, ORBX, ORBY>::Traversor3XXaY(const MAP& map, Cell<ORBX> c, bo
 	m_map(map),
 	m_QLT(NULL)
 {
-	const AttributeMultiVector<NoTypeNameAttribute<std::vector<Dart> > >* quickTraversal =  map.template getQuickAdjacentTraversal<ORBX,ORBY>() ;
-	if (quickTraversal != NULL)
-	{
-		m_QLT  = &(quickTraversal->operator[](map.getEmbedding(c)));
-	}
-	else
+	m_QLT = map.template getQuickAdjacentRow<ORBX,ORBY>(c) ;
+	if (m_QLT == NULL)
 	{
 		MarkerForTraversor<MAP, ORBX> mk(map, forceDartMarker);
 		mk.mark(c.dart);
@@ -285,7 +277,7 @@ Cell<ORBX> Traversor3XXaY<MAP, ORBX, ORBY>::begin()
 {
 	if(m_QLT != NULL)
 	{
-		m_ItDarts = m_QLT->begin();
+		m_ItDarts = m_QLT;
 		return *m_ItDarts++;
 	}
 
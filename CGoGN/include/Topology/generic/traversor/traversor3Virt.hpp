@@ -105,12 +105,8 @@ VTraversor3XY<MAP, ORBX, ORBY>::VTraversor3XY(MAP& map, Dart dart, bool forceDar
 	m_allocated(true),
 	m_first(true)
 {
-	const AttributeMultiVector<NoTypeNameAttribute<std::vector<Dart> > >* quickTraversal = map.template getQuickIncidentTraversal<ORBX,ORBY>() ;
-	if (quickTraversal != NULL)
-	{
-		m_QLT  = &(quickTraversal->operator[](map.template getEmbedding<ORBX>(dart)));
-	}
-	else
+	m_QLT = map.template getQuickIncidentRow<ORBX,ORBY>(dart) ;
+	if (m_QLT == NULL)
 	{
 		if(!forceDartMarker && map.isOrbitEmbedded(ORBY))
 			m_cmark = new CellMarkerStore<MAP, ORBY>(map) ;
@@ -148,7 +144,7 @@ Dart VTraversor3XY<MAP, ORBX, ORBY>::begin()
 {
 	if(m_QLT != NULL)
 	{
-		m_ItDarts = m_QLT->begin();
+		m_ItDarts = m_QLT;
 		return *m_ItDarts++;
 	}
 
@@ -258,12 +254,8 @@ template <typename MAP, unsigned int ORBX, unsigned int ORBY>
 VTraversor3XXaY<MAP, ORBX, ORBY>::VTraversor3XXaY(MAP& map, Dart dart, bool forceDartMarker):
 	m_map(map),m_QLT(NULL)
 {
-	const AttributeMultiVector<NoTypeNameAttribute<std::vector<Dart> > >* quickTraversal = map.template getQuickAdjacentTraversal<ORBX,ORBY>() ;
-	if (quickTraversal != NULL)
-	{
-		m_QLT  = &(quickTraversal->operator[](map.template getEmbedding<ORBX>(dart)));
-	}
-	else
+	m_QLT = map.template getQuickAdjacentRow<ORBX,ORBY>(dart) ;
+	if (m_QLT == NULL)
 	{
 		VMarkerForTraversor<MAP, ORBX> mk(map, forceDartMarker);
 		mk.mark(dart);
@@ -284,7 +276,7 @@ Dart VTraversor3XXaY<MAP, ORBX, ORBY>::begin()
 {
 	if(m_QLT != NULL)
 	{
-		m_ItDarts = m_QLT->begin();
+		m_ItDarts = m_QLT;
 		return *m_ItDarts++;
 	}
 
@@ -31,6 +31,8 @@
 #include "Topology/generic/cellmarker.h"
 #include "Topology/generic/traversor/traversorGen.h"
 
+#include "Utils/threadPool.h"
+
 #include <functional>
 
 namespace CGoGN
@@ -130,6 +132,8 @@ namespace Parallel
 
 /**
  * @brief foreach_cell
+ * Uses the shared pool of nbth-1 threads when the map can be traversed by chunks
+ * (see foreach_cell with pool), the serial traversal/buffer version otherwise
  * @param map
  * @param func function to apply on cells
  * @param needMarkers func need markers ?
@@ -139,6 +143,45 @@ namespace Parallel
 template <unsigned int ORBIT, typename MAP, typename FUNC>
 void foreach_cell(MAP& map, FUNC func, TraversalOptim opt = AUTO, unsigned int nbth = NumberOfThreads);
 
+/**
+ * @brief foreach_cell using a persistent pool of threads
+ * The cells are not given by a serial traversal but by chunks of the index range
+ * of the quick traversal table or of the dart container, dealt to the work-stealing
+ * queues of the workers. Each cell is given by the same dart than in the serial traversal.
+ * @param map
+ * @param func function to apply on cells (cell, thread index in [1,nbWorkers])
+ * @param pool pool of threads that executes func
+ * @param opt optimization param of traversal
+*/
+template <unsigned int ORBIT, typename MAP, typename FUNC>
+void foreach_cell(MAP& map, FUNC func, Utils::ThreadPool& pool, TraversalOptim opt = AUTO);
+
+/**
+ * @brief reduce_cell computes combine_fn(...combine_fn(combine_fn(init, map_fn(c0)), map_fn(c1))..., map_fn(cn))
+ * over all the cells of the map, in parallel. The partial results are combined in an order
+ * that only depends on the map (not on the threads), so the result is reproducible.
+ * @param map
+ * @param init initial value, must be neutral for combine_fn (0 for a sum, empty box, ...)
+ * @param map_fn function that computes the value of a cell (cell -> T)
+ * @param combine_fn associative function that combines two values ((T,T) -> T)
+ * @param opt optimization param of traversal
+ * @param nbth number of used thread (1 for the pool of [1,nbth-1] workers)
+ * @return the reduced value
+*/
+template <unsigned int ORBIT, typename T, typename MAP, typename MAPFUNC, typename COMBINE>
+T reduce_cell(MAP& map, const T& init, MAPFUNC map_fn, COMBINE combine_fn, TraversalOptim opt = AUTO, unsigned int nbth = NumberOfThreads);
+
+/**
+ * @brief foreach_dart applies func on each dart of the map (boundary darts included) in parallel.
+ * When the darts are the lines of the dart container (MapMono), the blocks of the container
+ * are directly shared by the threads (empty blocks skipped, holes only searched in partial blocks).
+ * @param map
+ * @param func function to apply on darts (dart, thread index in [1,nbth-1])
+ * @param nbth number of used thread (1 for the pool of [1,nbth-1] workers)
+*/
+template <typename MAP, typename FUNC>
+void foreach_dart(MAP& map, FUNC func, unsigned int nbth = NumberOfThreads);
+
 } // namespace Parallel
 
 
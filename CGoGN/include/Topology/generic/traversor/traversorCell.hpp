@@ -24,10 +24,16 @@
 
 #include "Utils/threadbarrier.h"
 #include <vector>
+#include <atomic>
+#include <algorithm>
+#include <type_traits>
 
 namespace CGoGN
 {
 
+// forward
+class MapMono;
+
 template <typename MAP, unsigned int ORBIT, TraversalOptim OPT>
 TraversorCell<MAP, ORBIT, OPT>::TraversorCell(const MAP& map, bool forceDartMarker) :
 	m(map),
@@ -768,6 +774,251 @@ void foreach_cell_tmpl(MAP& map, FUNC func, unsigned int nbth)
 	delete[] tempo;
 }
 
+/// can the cells of map be given by chunks of the index range of its containers ?
+template <unsigned int ORBIT, typename MAP>
+bool traversableByChunks(const MAP& map, TraversalOptim opt)
+{
+	// containers browsers restrict the traversal to a subset of darts / cells
+	if (map.template getAttributeContainer<DART>().hasBrowser() || map.template getAttributeContainer<ORBIT>().hasBrowser())
+		return false;
+
+	if ((opt == AUTO || opt == FORCE_QUICK_TRAVERSAL) && (map.template getQuickTraversal<ORBIT>() != NULL))
+		return true;
+
+	// darts must be all the lines of the dart container (not the case of MapMulti or IHM)
+	return std::is_same<decltype(&MAP::next), void (MapMono::*)(Dart&) const>::value;
+}
+
+template <unsigned int ORBIT, typename MAP, typename FUNC>
+void foreach_cell_chunks(MAP& map, FUNC func, Utils::ThreadPool& pool, TraversalOptim opt, unsigned int chunkSize)
+{
+	unsigned int nbw = pool.nbWorkers();
+
+	// threads of the pool need markers & buffers of the map
+	for (unsigned int i = 0; i < nbw; ++i)
+		map.addEmptyThreadId() = pool.threadId(i);
+
+	const AttributeContainer& dartCont = map.template getAttributeContainer<DART>();
+	const AttributeContainer& cellCont = map.template getAttributeContainer<ORBIT>();
+	const unsigned int dim = map.dimension();
+
+	const AttributeMultiVector<Dart>* quickTraversal = NULL;
+	if (opt == AUTO || opt == FORCE_QUICK_TRAVERSAL)
+		quickTraversal = map.template getQuickTraversal<ORBIT>();
+
+	if (quickTraversal != NULL)
+	{
+		pool.parallelFor(cellCont.realEnd(), chunkSize, [&] (unsigned int b, unsigned int e, unsigned int w)
+		{
+			for (unsigned int i = b; i < e; ++i)
+			{
+				if (cellCont.used(i))
+					func(Cell<ORBIT>((*quickTraversal)[i]), w, b / chunkSize);
+			}
+		});
+	}
+	else if (ORBIT == DART)
+	{
+		pool.parallelFor(dartCont.realEnd(), chunkSize, [&] (unsigned int b, unsigned int e, unsigned int w)
+		{
+			for (unsigned int i = b; i < e; ++i)
+			{
+				Dart d = Dart::create(i);
+				if (dartCont.used(i) && !map.isBoundaryMarked(dim, d))
+					func(Cell<ORBIT>(d), w, b / chunkSize);
+			}
+		});
+	}
+	else if (opt != FORCE_DART_MARKING && map.template isOrbitEmbedded<ORBIT>())
+	{
+		// first pass on darts: each cell keeps its smallest (non boundary) dart
+		unsigned int nbLines = cellCont.realEnd();
+		std::atomic<unsigned int>* firstDart = new std::atomic<unsigned int>[nbLines];
+
+		pool.parallelFor(nbLines, chunkSize, [&] (unsigned int b, unsigned int e, unsigned int)
+		{
+			for (unsigned int i = b; i < e; ++i)
+				firstDart[i].store(EMBNULL, std::memory_order_relaxed);
+		});
+
+		dartCont.parallelForeachLine(pool, [&] (unsigned int i, unsigned int)
+		{
+			Dart d = Dart::create(i);
+			if (map.isBoundaryMarked(dim, d))
+				return;
+			unsigned int emb = map.getEmbedding(Cell<ORBIT>(d));
+			if (emb == EMBNULL)
+				return;
+			unsigned int current = firstDart[emb].load(std::memory_order_relaxed);
+			while (i < current && !firstDart[emb].compare_exchange_weak(current, i, std::memory_order_relaxed)) {}
+		});
+
+		// second pass on cells
+		pool.parallelFor(nbLines, chunkSize, [&] (unsigned int b, unsigned int e, unsigned int w)
+		{
+			for (unsigned int i = b; i < e; ++i)
+			{
+				unsigned int d = firstDart[i].load(std::memory_order_relaxed);
+				if (d != EMBNULL)
+					func(Cell<ORBIT>(Dart::create(d)), w, b / chunkSize);
+			}
+		});
+
+		delete[] firstDart;
+	}
+	else
+	{
+		// no embedding: the first dart that reaches an orbit writes the smallest (non boundary)
+		// dart of the orbit in all its darts, the others skip it (each orbit is walked once,
+		// or a few times when reached by several threads at the same time)
+		const unsigned int nbDarts = dartCont.realEnd();
+		std::atomic<unsigned int>* smallest = new std::atomic<unsigned int>[nbDarts];
+		pool.parallelFor(nbDarts, chunkSize, [&] (unsigned int b, unsigned int e, unsigned int)
+		{
+			for (unsigned int i = b; i < e; ++i)
+				smallest[i].store(EMBNULL, std::memory_order_relaxed);
+		});
+
+		pool.parallelFor(nbDarts, chunkSize, [&] (unsigned int b, unsigned int e, unsigned int)
+		{
+			for (unsigned int i = b; i < e; ++i)
+			{
+				Dart d = Dart::create(i);
+				if (!dartCont.used(i) || map.isBoundaryMarked(dim, d) || smallest[i].load(std::memory_order_relaxed) != EMBNULL)
+					continue;
+				unsigned int m = i;
+				map.foreach_dart_of_orbit(Cell<ORBIT>(d), [&] (Dart dd)
+				{
+					if (dd.index < m && !map.isBoundaryMarked(dim, dd))
+						m = dd.index;
+				});
+				map.foreach_dart_of_orbit(Cell<ORBIT>(d), [&] (Dart dd)
+				{
+					smallest[dd.index].store(m, std::memory_order_relaxed);
+				});
+			}
+		});
+
+		// second pass on darts: a dart gives its cell if it is the smallest one
+		pool.parallelFor(nbDarts, chunkSize, [&] (unsigned int b, unsigned int e, unsigned int w)
+		{
+			for (unsigned int i = b; i < e; ++i)
+			{
+				if (smallest[i].load(std::memory_order_relaxed) == i)
+					func(Cell<ORBIT>(Dart::create(i)), w, b / chunkSize);
+			}
+		});
+
+		delete[] smallest;
+	}
+
+	for (unsigned int i = 0; i < nbw; ++i)
+		map.removeThreadId(pool.threadId(i));
+}
+
+template <unsigned int ORBIT, typename MAP, typename FUNC>
+void foreach_cell(MAP& map, FUNC func, Utils::ThreadPool& pool, TraversalOptim opt)
+{
+	unsigned int nbw = pool.nbWorkers();
+
+	if (!traversableByChunks<ORBIT>(map, opt))
+	{
+		foreach_cell<ORBIT>(map, func, opt, nbw + 1);
+		return;
+	}
+
+	// one copy of func per worker (as for the serial traversal version)
+	std::vector<FUNC> funcs(nbw, func);
+
+	unsigned int nbLines = std::max(map.template getAttributeContainer<DART>().realEnd(), map.template getAttributeContainer<ORBIT>().realEnd());
+	foreach_cell_chunks<ORBIT>(map, [&] (Cell<ORBIT> c, unsigned int w, unsigned int)
+	{
+		funcs[w](c, w + 1);
+	}, pool, opt, pool.defaultChunkSize(nbLines));
+}
+
+template <unsigned int ORBIT, typename T, typename MAP, typename MAPFUNC, typename COMBINE>
+T reduce_cell(MAP& map, const T& init, MAPFUNC map_fn, COMBINE combine_fn, TraversalOptim opt, unsigned int nbth)
+{
+	if (nbth < 2 || !traversableByChunks<ORBIT>(map, opt))
+	{
+		T result(init);
+		CGoGN::foreach_cell<ORBIT>(map, [&] (Cell<ORBIT> c)
+		{
+			result = combine_fn(result, map_fn(c));
+		}, opt);
+		return result;
+	}
+
+	// one partial result per chunk, each one alone in its cache line:
+	// the combine order does not depend on the number of threads nor on the stealing
+	struct Partial
+	{
+		T value;
+		char padding[CACHE_LINE_SIZE];
+		Partial(const T& v) : value(v) {}
+	};
+
+	unsigned int nbLines = std::max(map.template getAttributeContainer<DART>().realEnd(), map.template getAttributeContainer<ORBIT>().realEnd());
+	unsigned int nbChunks = (nbLines + SIZE_BUFFER_THREAD - 1) / SIZE_BUFFER_THREAD;
+	std::vector<Partial> partials(nbChunks, Partial(init));
+
+	foreach_cell_chunks<ORBIT>(map, [&] (Cell<ORBIT> c, unsigned int, unsigned int chunk)
+	{
+		partials[chunk].value = combine_fn(partials[chunk].value, map_fn(c));
+	}, Utils::ThreadPool::shared(nbth - 1), opt, SIZE_BUFFER_THREAD);
+
+	T result(init);
+	for (unsigned int i = 0; i < nbChunks; ++i)
+		result = combine_fn(result, partials[i].value);
+	return result;
+}
+
+template <typename MAP, typename FUNC>
+void foreach_dart(MAP& map, FUNC func, unsigned int nbth)
+{
+	if (nbth < 2)
+	{
+		map.foreach_dart([&] (Dart d) { func(d, 1); });
+		return;
+	}
+
+	Utils::ThreadPool& pool = Utils::ThreadPool::shared(nbth - 1);
+	unsigned int nbw = pool.nbWorkers();
+
+	for (unsigned int i = 0; i < nbw; ++i)
+		map.addEmptyThreadId() = pool.threadId(i);
+
+	// one copy of func per worker (as for the serial traversal version)
+	std::vector<FUNC> funcs(nbw, func);
+
+	const AttributeContainer& dartCont = map.template getAttributeContainer<DART>();
+	if (!dartCont.hasBrowser() && std::is_same<decltype(&MAP::next), void (MapMono::*)(Dart&) const>::value)
+	{
+		dartCont.parallelForeachLine(pool, [&] (unsigned int i, unsigned int w)
+		{
+			funcs[w](Dart::create(i), w + 1);
+		});
+	}
+	else
+	{
+		// darts given by the map (MapMulti, IHM, browser): store them first
+		std::vector<Dart> darts;
+		darts.reserve(map.getNbDarts());
+		for (Dart d = map.begin(); d != map.end(); map.next(d))
+			darts.push_back(d);
+
+		pool.parallelFor((unsigned int)(darts.size()), [&] (unsigned int b, unsigned int e, unsigned int w)
+		{
+			for (unsigned int i = b; i < e; ++i)
+				funcs[w](darts[i], w + 1);
+		});
+	}
+
+	for (unsigned int i = 0; i < nbw; ++i)
+		map.removeThreadId(pool.threadId(i));
+}
+
 template <unsigned int ORBIT, typename MAP, typename FUNC>
 void foreach_cell(MAP& map, FUNC func, TraversalOptim opt, unsigned int nbth)
 {
@@ -776,6 +1027,13 @@ void foreach_cell(MAP& map, FUNC func, TraversalOptim opt, unsigned int nbth)
 		CGoGNerr << "Warning number of threads must be > 1 for //" << CGoGNendl;
 		nbth = 2;
 	}
+
+	if (traversableByChunks<ORBIT>(map, opt))
+	{
+		foreach_cell<ORBIT>(map, func, Utils::ThreadPool::shared(nbth - 1), opt);
+		return;
+	}
+
 	switch(opt)
 	{
 		case FORCE_DART_MARKING:
@@ -0,0 +1,130 @@
+/*******************************************************************************
+ * CGoGN: Combinatorial and Geometric modeling with Generic N-dimensional Maps  *
+ * version 0.1                                                                  *
+ * Copyright (C) 2009-2012, IGG Team, LSIIT, University of Strasbourg           *
+ *                                                                              *
+ * This library is free software; you can redistribute it and/or modify it      *
+ * under the terms of the GNU Lesser General Public License as published by the *
+ * Free Software Foundation; either version 2.1 of the License, or (at your     *
+ * option) any later version.                                                   *
+ *                                                                              *
+ * This library is distributed in the hope that it will be useful, but WITHOUT  *
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or        *
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License  *
+ * for more details.                                                            *
+ *                                                                              *
+ * You should have received a copy of the GNU Lesser General Public License     *
+ * along with this library; if not, write to the Free Software Foundation,      *
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301 USA.           *
+ *                                                                              *
+ * Web site: http://cgogn.unistra.fr/                                           *
+ * Contact information: cgogn@unistra.fr                                        *
+ *                                                                              *
+ *******************************************************************************/
+
+
+#ifndef __BENCHMARK_H__
+#define __BENCHMARK_H__
+
+#include <string>
+#include <vector>
+#include <ostream>
+
+#include "Utils/dll.h"
+
+namespace CGoGN
+{
+
+namespace Utils
+{
+
+/**
+* Repeatable measure of a set of functions.
+* Each function is run nbWarmups times (not measured) then nbIterations times;
+* the min / median / 90th percentile / max / mean times (in ms) are kept and can
+* be written in JSON or CSV to track the regressions.
+*/
+class CGoGN_UTILS_API Benchmark
+{
+public:
+	struct Result
+	{
+		std::string name;
+		unsigned int nbIterations;
+		double min;
+		double median;
+		double p90;
+		double max;
+		double mean;
+		// number of processed elements per iteration (0 if not relevant)
+		double nbItems;
+	};
+
+protected:
+	std::string m_suite;
+	unsigned int m_nbWarmups;
+	unsigned int m_nbIterations;
+	bool m_verbose;
+	std::vector<Result> m_results;
+
+	const Result& addResult(const std::string& name, std::vector<double>& times, double nbItems);
+
+public:
+	/**
+	* @param suite name of the set of benchmarks
+	* @param nbWarmups number of runs before measuring
+	* @param nbIterations number of measured runs
+	*/
+	Benchmark(const std::string& suite, unsigned int nbWarmups = 1, unsigned int nbIterations = 5);
+
+	inline void setNbWarmups(unsigned int nb) { m_nbWarmups = nb; }
+
+	inline void setNbIterations(unsigned int nb) { m_nbIterations = (nb > 0) ? nb : 1; }
+
+	/**
+	* print each result on CGoGNout when measured (default true)
+	*/
+	inline void setVerbose(bool b) { m_verbose = b; }
+
+	/**
+	* measure f()
+	* @param nbItems number of elements processed by f (used for the throughput)
+	*/
+	template <typename FUNC>
+	const Result& run(const std::string& name, FUNC f, double nbItems = 0.0);
+
+	/**
+	* measure f(), setup() is called (not measured) before each run of f
+	* (for functions that modify their input, e.g. copy the mesh to decimate)
+	*/
+	template <typename SETUP, typename FUNC>
+	const Result& runWithSetup(const std::string& name, SETUP setup, FUNC f, double nbItems = 0.0);
+
+	inline const std::vector<Result>& results() const { return m_results; }
+
+	inline void clear() { m_results.clear(); }
+
+	/**
+	* current time in ms (high resolution, arbitrary origin)
+	*/
+	static double now();
+
+	void print(std::ostream& out, const Result& r) const;
+
+	void writeJSON(std::ostream& out) const;
+
+	void writeCSV(std::ostream& out) const;
+
+	/**
+	* save the results, in CSV if filename ends with .csv else in JSON
+	*/
+	bool save(const std::string& filename) const;
+};
+
+} // namespace Utils
+
+} // namespace CGoGN
+
+#include "Utils/benchmark.hpp"
+
+#endif
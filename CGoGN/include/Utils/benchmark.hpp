@@ -0,0 +1,62 @@
+/*******************************************************************************
+ * CGoGN: Combinatorial and Geometric modeling with Generic N-dimensional Maps  *
+ * version 0.1                                                                  *
+ * Copyright (C) 2009-2012, IGG Team, LSIIT, University of Strasbourg           *
+ *                                                                              *
+ * This library is free software; you can redistribute it and/or modify it      *
+ * under the terms of the GNU Lesser General Public License as published by the *
+ * Free Software Foundation; either version 2.1 of the License, or (at your     *
+ * option) any later version.                                                   *
+ *                                                                              *
+ * This library is distributed in the hope that it will be useful, but WITHOUT  *
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or        *
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License  *
+ * for more details.                                                            *
+ *                                                                              *
+ * You should have received a copy of the GNU Lesser General Public License     *
+ * along with this library; if not, write to the Free Software Foundation,      *
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301 USA.           *
+ *                                                                              *
+ * Web site: http://cgogn.unistra.fr/                                           *
+ * Contact information: cgogn@unistra.fr                                        *
+ *                                                                              *
+ *******************************************************************************/
+
+
+namespace CGoGN
+{
+
+namespace Utils
+{
+
+template <typename FUNC>
+const Benchmark::Result& Benchmark::run(const std::string& name, FUNC f, double nbItems)
+{
+	return runWithSetup(name, [] () {}, f, nbItems);
+}
+
+template <typename SETUP, typename FUNC>
+const Benchmark::Result& Benchmark::runWithSetup(const std::string& name, SETUP setup, FUNC f, double nbItems)
+{
+	for (unsigned int i = 0; i < m_nbWarmups; ++i)
+	{
+		setup();
+		f();
+	}
+
+	std::vector<double> times;
+	times.reserve(m_nbIterations);
+	for (unsigned int i = 0; i < m_nbIterations; ++i)
+	{
+		setup();
+		double t = now();
+		f();
+		times.push_back(now() - t);
+	}
+
+	return addResult(name, times, nbItems);
+}
+
+} // namespace Utils
+
+} // namespace CGoGN
@@ -0,0 +1,180 @@
+/*******************************************************************************
+ * CGoGN: Combinatorial and Geometric modeling with Generic N-dimensional Maps  *
+ * version 0.1                                                                  *
+ * Copyright (C) 2009-2012, IGG Team, LSIIT, University of Strasbourg           *
+ *                                                                              *
+ * This library is free software; you can redistribute it and/or modify it      *
+ * under the terms of the GNU Lesser General Public License as published by the *
+ * Free Software Foundation; either version 2.1 of the License, or (at your     *
+ * option) any later version.                                                   *
+ *                                                                              *
+ * This library is distributed in the hope that it will be useful, but WITHOUT  *
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or        *
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License  *
+ * for more details.                                                            *
+ *                                                                              *
+ * You should have received a copy of the GNU Lesser General Public License     *
+ * along with this library; if not, write to the Free Software Foundation,      *
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301 USA.           *
+ *                                                                              *
+ * Web site: http://cgogn.unistra.fr/                                           *
+ * Contact information: cgogn@unistra.fr                                        *
+ *                                                                              *
+ *******************************************************************************/
+
+#ifndef __BLOCK_PAGER__
+#define __BLOCK_PAGER__
+
+#include <string>
+#include <vector>
+#include <list>
+#include <map>
+#include <mutex>
+#include <cstddef>
+
+#include "Utils/dll.h"
+
+namespace CGoGN
+{
+
+namespace Utils
+{
+
+/**
+* Allocator of attribute blocks in a spill file, for maps larger than RAM.
+* The file is mapped in memory by large segments (MAP_SHARED), so the blocks
+* are ordinary memory for the attributes: pages not accessed for a while are
+* written back to the file and dropped by the system when RAM is needed.
+* On top of that the pager keeps a LRU list of the touched blocks: when the
+* touched blocks exceed the budget, the least recently touched ones are
+* written back and released explicitly, so the resident size stays bounded
+* when the map is processed chunk by chunk (see Algo::Topo::foreachDartChunk).
+* The spill file is removed when created and disappears when the pager is
+* destroyed. The pager is shared by reference counting between attributes.
+*/
+class CGoGN_UTILS_API BlockPager
+{
+protected:
+	struct Block
+	{
+		std::size_t size;
+		std::size_t offset;
+		bool free;
+		bool resident;
+		std::list<char*>::iterator lru;
+	};
+
+	int m_fd;
+	std::size_t m_pageSize;
+	std::size_t m_fileSize;
+	std::size_t m_segmentSize;
+	std::size_t m_budget;
+	std::size_t m_resident;
+	std::size_t m_nbEvictions;
+	unsigned int m_nbRefs;
+
+	// mapped segments of the file
+	std::vector<std::pair<char*, std::size_t> > m_segments;
+
+	// blocks by address (allocated and free)
+	std::map<char*, Block> m_blocks;
+
+	// free blocks by size
+	std::map<std::size_t, std::vector<char*> > m_free;
+
+	// resident blocks, most recently touched first
+	std::list<char*> m_lru;
+
+	// size used in the last segment
+	std::size_t m_used;
+
+	mutable std::mutex m_protect;
+
+	BlockPager();
+
+	~BlockPager();
+
+	// protected copy constructor to prevent the copy of pager
+	BlockPager(const BlockPager&) {}
+
+	bool addSegment(std::size_t minSize);
+
+	std::map<char*, Block>::iterator find(const void* ptr);
+
+	std::map<char*, Block>::const_iterator find(const void* ptr) const;
+
+	void setRecent(std::map<char*, Block>::iterator it);
+
+	void evict(std::map<char*, Block>::iterator it);
+
+	void evictOverBudget();
+
+public:
+	/**
+	* create a pager
+	* @param filename name of the spill file (created, then removed from the directory)
+	* @param budget size in bytes of the touched blocks kept in memory
+	* @param segmentSize size in bytes of the file segments mapped at once
+	* @return the pager (with one reference) or NULL if failed
+	*/
+	static BlockPager* create(const std::string& filename, std::size_t budget, std::size_t segmentSize = std::size_t(1) << 28);
+
+	/**
+	* add a reference on the pager
+	*/
+	inline void ref() { std::lock_guard<std::mutex> lock(m_protect); ++m_nbRefs; }
+
+	/**
+	* remove a reference, the pager is destroyed when no more referenced
+	*/
+	void unref();
+
+	/**
+	* allocate a block (zeroed when new, not when reused), it becomes the most recently touched
+	*/
+	void* allocate(std::size_t size);
+
+	/**
+	* give back a block allocated by this pager
+	*/
+	void release(void* ptr);
+
+	/**
+	* is ptr a block (or inside a block) of this pager
+	*/
+	bool contains(const void* ptr) const;
+
+	/**
+	* the block becomes the most recently touched; blocks are evicted if over budget
+	*/
+	void touch(const void* ptr);
+
+	/**
+	* write back a block and release its memory (data is kept in the file)
+	*/
+	void evict(const void* ptr);
+
+	/**
+	* write back and release all blocks
+	*/
+	void evictAll();
+
+	inline std::size_t budget() const { return m_budget; }
+
+	void setBudget(std::size_t budget);
+
+	/**
+	* size in bytes of the touched blocks still in memory
+	*/
+	inline std::size_t residentSize() const { return m_resident; }
+
+	inline std::size_t fileSize() const { return m_fileSize; }
+
+	inline std::size_t nbEvictions() const { return m_nbEvictions; }
+};
+
+} // namespace Utils
+
+} // namespace CGoGN
+
+#endif
@@ -0,0 +1,160 @@
+/*******************************************************************************
+ * CGoGN: Combinatorial and Geometric modeling with Generic N-dimensional Maps  *
+ * version 0.1                                                                  *
+ * Copyright (C) 2009-2012, IGG Team, LSIIT, University of Strasbourg           *
+ *                                                                              *
+ * This library is free software; you can redistribute it and/or modify it      *
+ * under the terms of the GNU Lesser General Public License as published by the *
+ * Free Software Foundation; either version 2.1 of the License, or (at your     *
+ * option) any later version.                                                   *
+ *                                                                              *
+ * This library is distributed in the hope that it will be useful, but WITHOUT  *
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or        *
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License  *
+ * for more details.                                                            *
+ *                                                                              *
+ * You should have received a copy of the GNU Lesser General Public License     *
+ * along with this library; if not, write to the Free Software Foundation,      *
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301 USA.           *
+ *                                                                              *
+ * Web site: http://cgogn.unistra.fr/                                           *
+ * Contact information: cgogn@unistra.fr                                        *
+ *                                                                              *
+ *******************************************************************************/
+
+
+#ifndef __INDEXED_HEAP__
+#define __INDEXED_HEAP__
+
+#include <vector>
+#include <cassert>
+
+namespace CGoGN
+{
+
+namespace Utils
+{
+
+/**
+* Addressable d-ary min-heap stored in a contiguous vector (binary by default;
+* ARITY = 4 keeps the children of a node in one or two cache lines, which gives
+* a lower tree and fewer cache misses for the pop).
+* Each inserted element gets a handle that stays valid until the element is
+* erased (or popped): it allows to erase the element or to change its key
+* in O(log n) without any allocation (handles of erased elements are reused).
+* After setNbIds(nb), the heap is id-addressed: the handles are dense ids in
+* [0,nb) given by the caller with insertId (e.g. indices or embeddings of vertices),
+* so that no handle has to be stored.
+* Elements with equal keys come out in their insertion order (as in a std::multimap).
+*/
+template <typename KEY, typename T, unsigned int ARITY = 2>
+class IndexedHeap
+{
+public:
+	typedef unsigned int Handle ;
+
+	static const Handle NIL = 0xffffffff ;
+
+	IndexedHeap() : m_seq(0), m_ids(false) {}
+
+	/**
+	 * remove all the elements (in O(size()) in the id-addressed mode)
+	 */
+	void clear() ;
+
+	void reserve(unsigned int nb) ;
+
+	/**
+	 * switch to the id-addressed mode: ids must be in [0, nb)
+	 */
+	void setNbIds(unsigned int nb) ;
+
+	unsigned int nbIds() const { return m_ids ? (unsigned int)(m_positions.size()) : 0 ; }
+
+	bool empty() const { return m_nodes.empty() ; }
+
+	unsigned int size() const { return (unsigned int)(m_nodes.size()) ; }
+
+	/**
+	 * insert an element
+	 * @return the handle of the element
+	 */
+	Handle insert(const KEY& key, const T& value) ;
+
+	/**
+	 * insert the element of handle id (that must not be in the heap) in the id-addressed mode
+	 */
+	void insertId(Handle id, const KEY& key, const T& value = T()) ;
+
+	/**
+	 * remove the element of handle h (that must be in the heap)
+	 */
+	void erase(Handle h) ;
+
+	/**
+	 * change the key of the element of handle h (increase or decrease); the element
+	 * comes after the elements of equal key (as an erase followed by an insert)
+	 */
+	void update(Handle h, const KEY& key) ;
+
+	/**
+	 * is the element of handle h in the heap
+	 */
+	bool contains(Handle h) const { return h < m_positions.size() && m_positions[h] != NIL ; }
+
+	/**
+	 * element of minimal key
+	 */
+	const T& top() const { assert(!empty()) ; return m_nodes[0].value ; }
+
+	const KEY& topKey() const { assert(!empty()) ; return m_nodes[0].key ; }
+
+	Handle topHandle() const { assert(!empty()) ; return m_nodes[0].handle ; }
+
+	/**
+	 * remove the element of minimal key
+	 */
+	void pop() { erase(topHandle()) ; }
+
+	const KEY& key(Handle h) const { assert(contains(h)) ; return m_nodes[m_positions[h]].key ; }
+
+	const T& value(Handle h) const { assert(contains(h)) ; return m_nodes[m_positions[h]].value ; }
+
+private:
+	struct Node
+	{
+		KEY key ;
+		unsigned long long seq ;
+		T value ;
+		Handle handle ;
+
+		bool operator<(const Node& n) const
+		{
+			return (key < n.key) || (!(n.key < key) && seq < n.seq) ;
+		}
+	} ;
+
+	void push(Handle h, const KEY& key, const T& value) ;
+
+	void place(unsigned int pos, const Node& n) ;
+
+	void siftUp(unsigned int pos) ;
+
+	void siftDown(unsigned int pos) ;
+
+	std::vector<Node> m_nodes ;
+	// position in m_nodes of each handle (NIL if free)
+	std::vector<unsigned int> m_positions ;
+	std::vector<Handle> m_freeHandles ;
+	unsigned long long m_seq ;
+	// id-addressed mode
+	bool m_ids ;
+} ;
+
+} // namespace Utils
+
+} // namespace CGoGN
+
+#include "Utils/indexedHeap.hpp"
+
+#endif
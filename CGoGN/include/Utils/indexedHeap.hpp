@@ -0,0 +1,203 @@
+/*******************************************************************************
+ * CGoGN: Combinatorial and Geometric modeling with Generic N-dimensional Maps  *
+ * version 0.1                                                                  *
+ * Copyright (C) 2009-2012, IGG Team, LSIIT, University of Strasbourg           *
+ *                                                                              *
+ * This library is free software; you can redistribute it and/or modify it      *
+ * under the terms of the GNU Lesser General Public License as published by the *
+ * Free Software Foundation; either version 2.1 of the License, or (at your     *
+ * option) any later version.                                                   *
+ *                                                                              *
+ * This library is distributed in the hope that it will be useful, but WITHOUT  *
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or        *
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License  *
+ * for more details.                                                            *
+ *                                                                              *
+ * You should have received a copy of the GNU Lesser General Public License     *
+ * along with this library; if not, write to the Free Software Foundation,      *
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301 USA.           *
+ *                                                                              *
+ * Web site: http://cgogn.unistra.fr/                                           *
+ * Contact information: cgogn@unistra.fr                                        *
+ *                                                                              *
+ *******************************************************************************/
+
+
+namespace CGoGN
+{
+
+namespace Utils
+{
+
+template <typename KEY, typename T, unsigned int ARITY>
+const typename IndexedHeap<KEY, T, ARITY>::Handle IndexedHeap<KEY, T, ARITY>::NIL ;
+
+template <typename KEY, typename T, unsigned int ARITY>
+void IndexedHeap<KEY, T, ARITY>::clear()
+{
+	if (m_ids)
+	{
+		for (unsigned int i = 0; i < m_nodes.size(); ++i)
+			m_positions[m_nodes[i].handle] = NIL ;
+	}
+	else
+	{
+		m_positions.clear() ;
+		m_freeHandles.clear() ;
+	}
+	m_nodes.clear() ;
+	m_seq = 0 ;
+}
+
+template <typename KEY, typename T, unsigned int ARITY>
+void IndexedHeap<KEY, T, ARITY>::reserve(unsigned int nb)
+{
+	m_nodes.reserve(nb) ;
+	m_positions.reserve(nb) ;
+}
+
+template <typename KEY, typename T, unsigned int ARITY>
+void IndexedHeap<KEY, T, ARITY>::setNbIds(unsigned int nb)
+{
+	assert((m_ids || empty()) || !"IndexedHeap: switch to ids while handles are in use") ;
+	assert((nb >= m_positions.size() || empty()) || !"IndexedHeap: ids removed while in use") ;
+	m_ids = true ;
+	m_freeHandles.clear() ;
+	m_positions.resize(nb, NIL) ;
+}
+
+template <typename KEY, typename T, unsigned int ARITY>
+typename IndexedHeap<KEY, T, ARITY>::Handle IndexedHeap<KEY, T, ARITY>::insert(const KEY& key, const T& value)
+{
+	assert(!m_ids || !"IndexedHeap: insert without id in the id-addressed mode") ;
+
+	Handle h ;
+	if (m_freeHandles.empty())
+	{
+		h = (Handle)(m_positions.size()) ;
+		m_positions.push_back(NIL) ;
+	}
+	else
+	{
+		h = m_freeHandles.back() ;
+		m_freeHandles.pop_back() ;
+	}
+
+	push(h, key, value) ;
+	return h ;
+}
+
+template <typename KEY, typename T, unsigned int ARITY>
+void IndexedHeap<KEY, T, ARITY>::insertId(Handle id, const KEY& key, const T& value)
+{
+	assert(m_ids || !"IndexedHeap: insertId needs setNbIds") ;
+	assert(id < m_positions.size() || !"IndexedHeap: id out of range") ;
+	assert(!contains(id) || !"IndexedHeap: insert of an element already in the heap") ;
+
+	push(id, key, value) ;
+}
+
+template <typename KEY, typename T, unsigned int ARITY>
+void IndexedHeap<KEY, T, ARITY>::erase(Handle h)
+{
+	assert(contains(h) || !"IndexedHeap: erase of an element that is not in the heap") ;
+
+	unsigned int pos = m_positions[h] ;
+	m_positions[h] = NIL ;
+	if (!m_ids)
+		m_freeHandles.push_back(h) ;
+
+	unsigned int last = (unsigned int)(m_nodes.size() - 1) ;
+	if (pos != last)
+	{
+		// the last element takes the place of the erased one
+		Node n = m_nodes[last] ;
+		m_nodes.pop_back() ;
+		bool up = n < m_nodes[pos] ;
+		place(pos, n) ;
+		if (up)
+			siftUp(pos) ;
+		else
+			siftDown(pos) ;
+	}
+	else
+		m_nodes.pop_back() ;
+}
+
+template <typename KEY, typename T, unsigned int ARITY>
+void IndexedHeap<KEY, T, ARITY>::update(Handle h, const KEY& key)
+{
+	assert(contains(h)) ;
+
+	unsigned int pos = m_positions[h] ;
+	Node& n = m_nodes[pos] ;
+	bool up = key < n.key ;
+	n.key = key ;
+	n.seq = m_seq++ ;
+	if (up)
+		siftUp(pos) ;
+	else
+		siftDown(pos) ;
+}
+
+template <typename KEY, typename T, unsigned int ARITY>
+void IndexedHeap<KEY, T, ARITY>::push(Handle h, const KEY& key, const T& value)
+{
+	Node n ;
+	n.key = key ;
+	n.seq = m_seq++ ;
+	n.value = value ;
+	n.handle = h ;
+
+	m_nodes.push_back(n) ;
+	siftUp((unsigned int)(m_nodes.size() - 1)) ;
+}
+
+template <typename KEY, typename T, unsigned int ARITY>
+inline void IndexedHeap<KEY, T, ARITY>::place(unsigned int pos, const Node& n)
+{
+	m_nodes[pos] = n ;
+	m_positions[n.handle] = pos ;
+}
+
+template <typename KEY, typename T, unsigned int ARITY>
+void IndexedHeap<KEY, T, ARITY>::siftUp(unsigned int pos)
+{
+	Node n = m_nodes[pos] ;
+	while (pos > 0)
+	{
+		unsigned int parent = (pos - 1) / ARITY ;
+		if (!(n < m_nodes[parent]))
+			break ;
+		place(pos, m_nodes[parent]) ;
+		pos = parent ;
+	}
+	place(pos, n) ;
+}
+
+template <typename KEY, typename T, unsigned int ARITY>
+void IndexedHeap<KEY, T, ARITY>::siftDown(unsigned int pos)
+{
+	const unsigned int size = (unsigned int)(m_nodes.size()) ;
+	Node n = m_nodes[pos] ;
+	while (true)
+	{
+		unsigned int first = ARITY * pos + 1 ;
+		if (first >= size)
+			break ;
+		unsigned int end = (first + ARITY < size) ? first + ARITY : size ;
+		unsigned int child = first ;
+		for (unsigned int c = first + 1; c < end; ++c)
+			if (m_nodes[c] < m_nodes[child])
+				child = c ;
+		if (!(m_nodes[child] < n))
+			break ;
+		place(pos, m_nodes[child]) ;
+		pos = child ;
+	}
+	place(pos, n) ;
+}
+
+} // namespace Utils
+
+} // namespace CGoGN
@@ -0,0 +1,132 @@
+/*******************************************************************************
+ * CGoGN: Combinatorial and Geometric modeling with Generic N-dimensional Maps  *
+ * version 0.1                                                                  *
+ * Copyright (C) 2009-2012, IGG Team, LSIIT, University of Strasbourg           *
+ *                                                                              *
+ * This library is free software; you can redistribute it and/or modify it      *
+ * under the terms of the GNU Lesser General Public License as published by the *
+ * Free Software Foundation; either version 2.1 of the License, or (at your     *
+ * option) any later version.                                                   *
+ *                                                                              *
+ * This library is distributed in the hope that it will be useful, but WITHOUT  *
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or        *
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License  *
+ * for more details.                                                            *
+ *                                                                              *
+ * You should have received a copy of the GNU Lesser General Public License     *
+ * along with this library; if not, write to the Free Software Foundation,      *
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301 USA.           *
+ *                                                                              *
+ * Web site: http://cgogn.unistra.fr/                                           *
+ * Contact information: cgogn@unistra.fr                                        *
+ *                                                                              *
+ *******************************************************************************/
+
+
+#ifndef __MAPPED_FILE__
+#define __MAPPED_FILE__
+
+#include <string>
+#include <ostream>
+#include <cstddef>
+
+#include "Utils/dll.h"
+
+namespace CGoGN
+{
+
+namespace Utils
+{
+
+/**
+* File mapped in memory, used to load maps without parsing.
+* The mapping is either read-only or copy-on-write (the pages that are
+* written are privately copied, the file is never modified).
+* It is shared by reference counting between all the attributes that
+* adopted some of its blocks, and unmapped when the last one releases it.
+*/
+class CGoGN_UTILS_API MappedFile
+{
+protected:
+	char* m_data;
+	std::size_t m_size;
+	bool m_readOnly;
+	unsigned int m_nbRefs;
+
+	MappedFile();
+
+	~MappedFile();
+
+	// protected copy constructor to prevent the copy of mapping
+	MappedFile(const MappedFile&) {}
+
+public:
+	/**
+	* alignment (in bytes) of the data blocks in mappable files
+	*/
+	static const std::size_t ALIGNMENT = 4096;
+
+	/**
+	* map a file in memory
+	* @param filename name of the file
+	* @param readOnly if false the mapping is copy-on-write
+	* @return the mapping (with one reference) or NULL if failed
+	*/
+	static MappedFile* open(const std::string& filename, bool readOnly);
+
+	/**
+	* add a reference on the mapping
+	*/
+	inline void ref() { ++m_nbRefs; }
+
+	/**
+	* remove a reference, the file is unmapped when no more referenced
+	*/
+	void unref();
+
+	inline const char* data() const { return m_data; }
+
+	inline std::size_t size() const { return m_size; }
+
+	inline bool readOnly() const { return m_readOnly; }
+
+	/**
+	* is ptr inside the mapped memory
+	*/
+	inline bool contains(const void* ptr) const
+	{
+		const char* p = reinterpret_cast<const char*>(ptr);
+		return (p >= m_data) && (p < m_data + m_size);
+	}
+
+	/**
+	* get a pointer on nb bytes at offset and move offset after them
+	* @return NULL if out of the file
+	*/
+	char* get(std::size_t& offset, std::size_t nb) const;
+
+	/**
+	* copy nb bytes at offset in dst and move offset after them
+	* @return false if out of the file
+	*/
+	bool read(std::size_t& offset, void* dst, std::size_t nb) const;
+
+	/**
+	* first aligned offset after offset
+	*/
+	static inline std::size_t align(std::size_t offset)
+	{
+		return (offset + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+	}
+
+	/**
+	* write zeros in fs up to the next aligned position
+	*/
+	static void pad(std::ostream& fs);
+};
+
+} // namespace Utils
+
+} // namespace CGoGN
+
+#endif
@@ -0,0 +1,152 @@
+/*******************************************************************************
+* CGoGN: Combinatorial and Geometric modeling with Generic N-dimensional Maps  *
+* version 0.1                                                                  *
+* Copyright (C) 2009-2012, IGG Team, LSIIT, University of Strasbourg           *
+*                                                                              *
+* This library is free software; you can redistribute it and/or modify it      *
+* under the terms of the GNU Lesser General Public License as published by the *
+* Free Software Foundation; either version 2.1 of the License, or (at your     *
+* option) any later version.                                                   *
+*                                                                              *
+* This library is distributed in the hope that it will be useful, but WITHOUT  *
+* ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or        *
+* FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License  *
+* for more details.                                                            *
+*                                                                              *
+* You should have received a copy of the GNU Lesser General Public License     *
+* along with this library; if not, write to the Free Software Foundation,      *
+* Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301 USA.           *
+*                                                                              *
+* Web site: http://cgogn.unistra.fr/                                           *
+* Contact information: cgogn@unistra.fr                                        *
+*                                                                              *
+*******************************************************************************/
+
+#ifndef __THREAD_POOL__
+#define __THREAD_POOL__
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <functional>
+#include <deque>
+#include <vector>
+
+#include "Utils/dll.h"
+
+namespace CGoGN
+{
+
+namespace Utils
+{
+
+/**
+* Persistent pool of worker threads for data-parallel loops.
+* A job is an index range [0,n) cut in chunks. Chunks are dealt to the
+* queues of the workers (contiguous chunks to the same worker); each worker
+* consumes the front of its own queue and, once empty, steals the back of
+* the queues of the other workers.
+* Threads are created once, so their ids are stable for the life of the pool
+* (they can be registered in the maps they traverse).
+*/
+class CGoGN_UTILS_API ThreadPool
+{
+public:
+	/**
+	 * function applied on a chunk: (begin, end, worker index)
+	 */
+	typedef std::function<void (unsigned int, unsigned int, unsigned int)> RangeFunction;
+
+protected:
+	typedef std::pair<unsigned int, unsigned int> Chunk;
+
+	struct WorkQueue
+	{
+		std::mutex m_protect;
+		std::deque<Chunk> m_chunks;
+	};
+
+	std::vector<std::thread*> m_threads;
+	std::vector<WorkQueue*> m_queues;
+
+	const RangeFunction* m_job;
+	std::atomic<unsigned int> m_remaining;
+	unsigned int m_generation;
+	bool m_stop;
+
+	std::mutex m_protect;
+	std::condition_variable m_condStart;
+	std::condition_variable m_condDone;
+
+	std::mutex m_jobProtect;
+
+	void workerLoop(unsigned int w);
+
+	/**
+	* run the chunks of a job issued from a task of a pool in the calling thread
+	*/
+	void runInline(unsigned int nb, unsigned int chunkSize, const RangeFunction& f);
+
+	bool popChunk(unsigned int w, Chunk& c);
+
+	// protected copy constructor to prevent the copy of pool
+	ThreadPool(const ThreadPool&) {}
+
+public:
+	/**
+	* constructor
+	* @param nbWorkers number of worker threads launched (at least 1)
+	*/
+	ThreadPool(unsigned int nbWorkers);
+
+	~ThreadPool();
+
+	/**
+	* number of worker threads
+	*/
+	inline unsigned int nbWorkers() const { return (unsigned int)(m_threads.size()); }
+
+	/**
+	* id of worker thread w
+	*/
+	inline std::thread::id threadId(unsigned int w) const { return m_threads[w]->get_id(); }
+
+	/**
+	* apply f on all the chunks of [0,nb) and wait for the end of the job
+	* When called from a task running in a pool, the chunks are processed in the
+	* calling thread (worker index: the one of the calling task modulo nbWorkers())
+	* @param nb size of the index range
+	* @param chunkSize number of indices of each chunk
+	* @param f function called with (begin, end, worker index)
+	*/
+	void parallelFor(unsigned int nb, unsigned int chunkSize, const RangeFunction& f);
+
+	/**
+	* same with a chunk size computed from nb and the number of workers
+	*/
+	void parallelFor(unsigned int nb, const RangeFunction& f);
+
+	/**
+	* compute a chunk size that gives some chunks to steal to each worker
+	*/
+	unsigned int defaultChunkSize(unsigned int nb) const;
+
+	/**
+	* is the calling thread running a task of a pool
+	*/
+	static bool inTask();
+
+	/**
+	* get the pool of nbWorkers workers shared by the whole application
+	* There is one pool per number of workers, created at the first call and never
+	* destroyed: the returned reference stays valid whatever the other calls.
+	* @param nbWorkers number of worker threads
+	*/
+	static ThreadPool& shared(unsigned int nbWorkers);
+};
+
+}
+}
+
+#endif
@@ -42,6 +42,7 @@ void VBO::updateData(std::vector<T>& data)
 
 	m_data_size = sizeof(T) / sizeof(float);
 	m_nbElts = uint32(data.size());
+	m_syncAttrib = NULL;
 
 	glBindBuffer(GL_ARRAY_BUFFER, *m_id);
 	glBufferData(GL_ARRAY_BUFFER, m_nbElts * sizeof(T), &(data[0]), GL_STREAM_DRAW);
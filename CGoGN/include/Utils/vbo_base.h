@@ -70,6 +70,28 @@ protected:
 	/// type name of the last attribute used to fill the VBO
 	std::string m_typeName;
 
+	/// attribute of the last update (only compared, NULL if the data has been set otherwise)
+	const AttributeMultiVectorGen* m_syncAttrib;
+
+	/// number of blocks of m_syncAttrib at the last update
+	unsigned int m_syncNbBlocks;
+
+	/// version of m_syncAttrib at the last update (see AttributeMultiVectorGen::getDirtyRanges)
+	unsigned int m_syncVersion;
+
+	/**
+	 * get the ranges of blocks [first, second[ to upload and synchronize with the attribute:
+	 * all the blocks if not dirtyOnly or if the attribute or its number of blocks changed
+	 * since the last update, only the modified ones otherwise
+	 * @return true if all the blocks are uploaded
+	 */
+	bool blocksToUpload(const AttributeMultiVectorGen* attrib, unsigned int nbb, bool dirtyOnly, std::vector<std::pair<unsigned int, unsigned int> >& blocks);
+
+	/**
+	 * update data from attribute multivector, only the modified blocks if dirtyOnly
+	 */
+	void updateData(const AttributeMultiVectorGen* attrib, bool dirtyOnly);
+
 public:
 	/**
 	 * constructor: allocate the OGL VBO
@@ -139,6 +161,22 @@ public:
 		updateData(attrib.getDataVectorGen()) ;
 	}
 
+	/**
+	 * update the vbo with the blocks of the attribute modified since the last update
+	 * (all the blocks if the last update was not done from this attribute or if its size changed)
+	 * The modifications must be notified to the attribute (setDirty), container
+	 * operations (insertion, copy, compact) are notified automatically.
+	 */
+	void updateDirtyData(const AttributeMultiVectorGen* attrib);
+
+	/**
+	 * update the vbo with the modified blocks of the attribute handler
+	 */
+	inline void updateDirtyData(const AttributeHandlerGen& attrib)
+	{
+		updateDirtyData(attrib.getDataVectorGen()) ;
+	}
+
 	/**
 	 * update data from given data vector
 	 * @warning use only with include vbo.h (not vbo_base.h)
@@ -169,6 +207,7 @@ public:
 	{
 		const AttributeMultiVectorGen* attrib = attribHG.getDataVectorGen();
 		updateDataConversion<T_IN,Geom::Vector<NB_COMPONENTS,float>,NB_COMPONENTS,CONVFUNC>(attrib,conv);
+		m_syncAttrib = NULL;	// the conversion is not known by updateDirtyData
 	}
 
 	/**
@@ -183,6 +222,7 @@ public:
 	{
 		const AttributeMultiVectorGen* attrib = attribHG.getDataVectorGen();
 		updateDataConversion<T_IN,float,1,CONVFUNC>(attrib,conv);
+		m_syncAttrib = NULL;	// the conversion is not known by updateDirtyData
 	}
 
 
@@ -196,43 +236,51 @@ protected:
 	 * @param conv lambda function that take a const T_IN& and return a Vector<NB_COMPONENTS,float>
 	 */
 	template <typename T_IN, typename T_OUT, unsigned int NB_COMPONENTS, typename CONVFUNC>
-	void updateDataConversion(const AttributeMultiVectorGen* attrib, CONVFUNC conv)
+	void updateDataConversion(const AttributeMultiVectorGen* attrib, CONVFUNC conv, bool dirtyOnly = false)
 	{
 		unsigned int old_nbb =  sizeof(float) * m_data_size * m_nbElts;
 		m_name = attrib->getName();
 		m_typeName = attrib->getTypeName();
 		m_data_size = NB_COMPONENTS;
 
-		// alloue la memoire pour le buffer et initialise le conv
-		T_OUT* typedBuffer = new T_OUT[_BLOCKSIZE_];
-
 		std::vector<void*> addr;
 		unsigned int byteTableSize;
 		unsigned int nbb = attrib->getBlocksPointers(addr, byteTableSize);
 
+		std::vector<std::pair<unsigned int, unsigned int> > blocks;
+		bool all = blocksToUpload(attrib, nbb, dirtyOnly, blocks);
+		if (!all && blocks.empty())
+			return;
+
+		// alloue la memoire pour le buffer et initialise le conv
+		T_OUT* typedBuffer = new T_OUT[_BLOCKSIZE_];
+
 		m_nbElts = nbb * _BLOCKSIZE_/(sizeof(T_OUT));
 
-		unsigned int offset = 0;
 		unsigned int szb = _BLOCKSIZE_*sizeof(T_OUT);
 
 		// bind buffer to update
 		glBindBuffer(GL_ARRAY_BUFFER, *m_id);
-		if (nbb!=old_nbb)
+		if (all && nbb!=old_nbb)
 			glBufferData(GL_ARRAY_BUFFER, nbb * szb, 0, GL_STREAM_DRAW);
 
-		for (unsigned int i = 0; i < nbb; ++i)
+		for (std::vector<std::pair<unsigned int, unsigned int> >::const_iterator it = blocks.begin(); it != blocks.end(); ++it)
 		{
-			// convertit les donnees dans le buffer de conv
-			const T_IN* typedIn = reinterpret_cast<const T_IN*>(addr[i]);
-			T_OUT* typedOut = typedBuffer;
-			// compute conversion
-			for (unsigned int j = 0; j < _BLOCKSIZE_; ++j)
-				*typedOut++ = conv(*typedIn++);
-
-			// update sub-vbo
-			glBufferSubData(GL_ARRAY_BUFFER, offset, szb, reinterpret_cast<void*>(typedBuffer));
-			// block suivant
-			offset += szb;
+			unsigned int offset = it->first * szb;
+			for (unsigned int i = it->first; i < it->second; ++i)
+			{
+				// convertit les donnees dans le buffer de conv
+				const T_IN* typedIn = reinterpret_cast<const T_IN*>(addr[i]);
+				T_OUT* typedOut = typedBuffer;
+				// compute conversion
+				for (unsigned int j = 0; j < _BLOCKSIZE_; ++j)
+					*typedOut++ = conv(*typedIn++);
+
+				// update sub-vbo
+				glBufferSubData(GL_ARRAY_BUFFER, offset, szb, reinterpret_cast<void*>(typedBuffer));
+				// block suivant
+				offset += szb;
+			}
 		}
 
 		// libere la memoire de la conversion
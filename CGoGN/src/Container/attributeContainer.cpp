@@ -43,7 +43,8 @@ namespace CGoGN
 	m_size(0),
 	m_maxSize(0),
 	m_lineCost(0),
-	m_attributes_registry_map(NULL)
+	m_attributes_registry_map(NULL),
+	m_pager(NULL)
 {
 	m_holesBlocks.reserve(512);
 }
@@ -62,6 +63,8 @@ namespace CGoGN
 			delete m_holesBlocks[index];
 	}
 
+	if (m_pager != NULL)
+		m_pager->unref();
 }
 
 /**************************************
@@ -134,6 +137,7 @@ namespace CGoGN
 	m_holesBlocks.swap(cont.m_holesBlocks);
 	m_tableBlocksWithFree.swap(cont.m_tableBlocksWithFree);
 	m_tableBlocksEmpty.swap(cont.m_tableBlocksEmpty);
+	std::swap(m_pager, cont.m_pager);
 
 	unsigned int temp = m_nbAttributes;
 	m_nbAttributes = cont.m_nbAttributes;
@@ -156,6 +160,24 @@ namespace CGoGN
 	cont.m_lineCost = temp;
 }
 
+ void AttributeContainer::setPager(Utils::BlockPager* pager)
+{
+	if (pager == m_pager)
+		return;
+
+	for (std::vector<AttributeMultiVectorGen*>::iterator it = m_tableAttribs.begin(); it != m_tableAttribs.end(); ++it)
+	{
+		if (*it != NULL)
+			(*it)->setPager(pager);
+	}
+
+	if (pager != NULL)
+		pager->ref();
+	if (m_pager != NULL)
+		m_pager->unref();
+	m_pager = pager;
+}
+
  void AttributeContainer::clear(bool removeAttrib)
 {
 	m_size = 0;
@@ -180,6 +202,13 @@ namespace CGoGN
 			(*it)->clear();
 	}
 
+	// and the marker blocks (else new lines would get the old marks)
+	for (std::vector<AttributeMultiVector<MarkerBool>*>::iterator it = m_tableMarkerAttribs.begin(); it != m_tableMarkerAttribs.end(); ++it)
+	{
+		if ((*it) != NULL)
+			(*it)->clear();
+	}
+
 	// on enleve les attributs ?
 	if (removeAttrib)
 	{
@@ -298,6 +327,31 @@ namespace CGoGN
 }
 
 
+void AttributeContainer::permute(const std::vector<unsigned int>& newOfOld)
+{
+	assert(m_size == m_maxSize || !"permute: the container must be compact");
+	assert(newOfOld.size() == m_size);
+
+	// follow the cycles of the permutation: line s always stores the element
+	// that comes from cur, swapping it with the destination places one element
+	std::vector<bool> done(m_size, false);
+	for (unsigned int s = 0; s < m_size; ++s)
+	{
+		if (done[s])
+			continue;
+		done[s] = true;
+		unsigned int cur = s;
+		unsigned int nxt = newOfOld[cur];
+		while (nxt != s)
+		{
+			swapLine(s, nxt);
+			done[nxt] = true;
+			cur = nxt;
+			nxt = newOfOld[cur];
+		}
+	}
+}
+
 /**************************************
  *          LINES MANAGEMENT          *
  **************************************/
@@ -409,6 +463,13 @@ namespace CGoGN
 	if (block->full())
 		m_tableBlocksWithFree.pop_back();
 
+	// the values of the new line are going to be set
+	for(unsigned int i = 0; i < m_tableAttribs.size(); ++i)
+	{
+		if (m_tableAttribs[i] != NULL)
+			m_tableAttribs[i]->setDirty(index);
+	}
+
 	++m_size;
 	return index;
 }
@@ -592,6 +653,136 @@ namespace CGoGN
 	return true;
 }
 
+ void AttributeContainer::saveMappable(std::ostream& fs, unsigned int id) const
+{
+	std::vector<AttributeMultiVectorGen*> bufferamv;
+	bufferamv.reserve(m_tableAttribs.size());
+	for(std::vector<AttributeMultiVectorGen*>::const_iterator it = m_tableAttribs.begin(); it != m_tableAttribs.end(); ++it)
+	{
+		if (*it != NULL)
+			bufferamv.push_back(*it);
+	}
+
+	std::vector<unsigned int> bufferui;
+	bufferui.reserve(10);
+
+	bufferui.push_back(id);
+	bufferui.push_back(_BLOCKSIZE_);
+	bufferui.push_back(uint32(m_holesBlocks.size()));
+	bufferui.push_back(uint32(m_tableBlocksWithFree.size()));
+	bufferui.push_back(uint32(bufferamv.size()));
+	bufferui.push_back(m_size);
+	bufferui.push_back(m_maxSize);
+	bufferui.push_back(m_orbit);
+	bufferui.push_back(m_nbUnknown);
+
+	for(std::vector<AttributeMultiVector<MarkerBool>*>::const_iterator it = m_tableMarkerAttribs.begin(); it != m_tableMarkerAttribs.end(); ++it)
+	{
+		const std::string& attName = (*it)->getName();
+		if (attName[0] == 'B') // for BoundaryMark0/1
+			bufferui[4]++;
+	}
+
+	fs.write(reinterpret_cast<const char*>(&bufferui[0]), bufferui.size()*sizeof(unsigned int));
+
+	unsigned int i = 0;
+
+	for(std::vector<AttributeMultiVector<MarkerBool>*>::const_iterator it = m_tableMarkerAttribs.begin(); it != m_tableMarkerAttribs.end(); ++it)
+	{
+		const std::string& attName = (*it)->getName();
+		if (attName[0] == 'B') // for BoundaryMark0/1
+			(*it)->saveMappable(fs, i++);
+	}
+
+	for(std::vector<AttributeMultiVectorGen*>::const_iterator it = bufferamv.begin(); it != bufferamv.end(); ++it)
+		(*it)->saveMappable(fs, i++);
+
+	for (std::vector<HoleBlockRef*>::const_iterator it = m_holesBlocks.begin(); it != m_holesBlocks.end(); ++it)
+		(*it)->saveMappable(fs);
+
+	if (!m_tableBlocksWithFree.empty())
+		fs.write(reinterpret_cast<const char*>(&m_tableBlocksWithFree[0]), m_tableBlocksWithFree.size() * sizeof(unsigned int));
+}
+
+ bool AttributeContainer::loadMappedId(const Utils::MappedFile& mf, std::size_t& offset, unsigned int& id)
+{
+	return mf.read(offset, &id, sizeof(unsigned int));
+}
+
+ bool AttributeContainer::loadMapped(Utils::MappedFile& mf, std::size_t& offset)
+{
+	if (m_attributes_registry_map == NULL)
+	{
+		CGoGNerr << "Attribute Registry non initialized"<< CGoGNendl;
+		return false;
+	}
+
+	unsigned int bufferui[8];
+	if (!mf.read(offset, bufferui, 8*sizeof(unsigned int)))
+		return false;
+
+	unsigned int bs = bufferui[0];
+	unsigned int szHB = bufferui[1];
+	unsigned int szBWF = bufferui[2];
+	unsigned int nbAtt = bufferui[3];
+	m_size = bufferui[4];
+	m_maxSize = bufferui[5];
+	m_orbit = bufferui[6];
+	m_nbUnknown = bufferui[7];
+
+	if (bs != _BLOCKSIZE_)
+	{
+		CGoGNerr << "Loading unavailable, different block sizes: "<<_BLOCKSIZE_<<" / " << bs << CGoGNendl;
+		return false;
+	}
+
+	for (unsigned int j = 0; j < nbAtt; ++j)
+	{
+		std::string nameAtt;
+		std::string typeAtt;
+		if (!AttributeMultiVectorGen::loadMappedInfos(mf, offset, nameAtt, typeAtt))
+			return false;
+
+		bool ok;
+		std::map<std::string, RegisteredBaseAttribute*>::iterator itAtt = m_attributes_registry_map->find(typeAtt);
+		if (itAtt == m_attributes_registry_map->end())
+		{
+			CGoGNout << "Skipping non registred attribute of type name"<< typeAtt <<CGoGNendl;
+			ok = AttributeMultiVectorGen::skipLoadMapped(mf, offset);
+		}
+		else if (typeAtt == "MarkerBool")
+		{
+			assert(j<m_tableMarkerAttribs.size());
+			ok = m_tableMarkerAttribs[j]->loadMapped(mf, offset); // use j because BM are saved first
+		}
+		else
+		{
+			RegisteredBaseAttribute* ra = itAtt->second;
+			AttributeMultiVectorGen* amvg = ra->addAttribute(*this, nameAtt);
+			ok = amvg->loadMapped(mf, offset);
+		}
+		if (!ok)
+		{
+			CGoGNerr << "Error loading attribute " << nameAtt << CGoGNendl;
+			return false;
+		}
+	}
+
+	m_holesBlocks.resize(szHB);
+	for (unsigned int i = 0; i < szHB; ++i)
+	{
+		m_holesBlocks[i] = new HoleBlockRef;
+		if (!m_holesBlocks[i]->loadMapped(mf, offset))
+		{
+			m_holesBlocks.resize(i+1);
+			return false;
+		}
+	}
+
+	m_tableBlocksWithFree.resize(szBWF);
+	return (szBWF == 0) || mf.read(offset, &(m_tableBlocksWithFree[0]), szBWF*sizeof(unsigned int));
+}
+
  void  AttributeContainer::copyFrom(const AttributeContainer& cont)
 {
 // 	clear is done from the map
@@ -638,6 +829,7 @@ namespace CGoGN
 			ptr->setName(cont.m_tableAttribs[i]->getName());
 			ptr->setOrbit(cont.m_tableAttribs[i]->getOrbit());
 			ptr->setIndex(uint32(m_tableAttribs.size()));
+			ptr->setPager(m_pager);
 			ptr->setNbBlocks(cont.m_tableAttribs[i]->getNbBlocks());
 			ptr->copy(cont.m_tableAttribs[i]);
 			m_tableAttribs.push_back(ptr);
@@ -651,6 +843,7 @@ namespace CGoGN
 		ptr->setName(cont.m_tableMarkerAttribs[i]->getName());
 		ptr->setOrbit(cont.m_tableMarkerAttribs[i]->getOrbit());
 		ptr->setIndex(uint32(m_tableMarkerAttribs.size()));
+		ptr->setEpochMode(cont.m_tableMarkerAttribs[i]->isEpochMode());
 		ptr->setNbBlocks(cont.m_tableMarkerAttribs[i]->getNbBlocks());
 		ptr->copy(cont.m_tableMarkerAttribs[i]);
 		m_tableMarkerAttribs.push_back(ptr);
@@ -781,7 +974,7 @@ namespace CGoGN
 }
 
 
- AttributeMultiVector<MarkerBool>* AttributeContainer::addMarkerAttribute(const std::string& attribName)
+ AttributeMultiVector<MarkerBool>* AttributeContainer::addMarkerAttribute(const std::string& attribName, bool epoch)
 {
 	// first check if attribute already exist
 	unsigned int index ;
@@ -803,6 +996,7 @@ namespace CGoGN
 
 	amv->setOrbit(m_orbit) ;
 	amv->setIndex(index) ;
+	amv->setEpochMode(epoch) ;
 
 	// resize the new attribute so that it has the same size than others
 	amv->setNbBlocks(uint32(m_holesBlocks.size())) ;
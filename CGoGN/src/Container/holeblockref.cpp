@@ -183,4 +183,28 @@ bool HoleBlockRef::loadBin(CGoGNistream& fs)
 	return true;
 }
 
+void HoleBlockRef::saveMappable(std::ostream& fs)
+{
+	unsigned int numbers[3];
+	numbers[0] = m_nb;
+	numbers[1] = m_nbref;
+	numbers[2] = m_nbfree;
+	fs.write(reinterpret_cast<const char*>(numbers), 3*sizeof(unsigned int) );
+	fs.write(reinterpret_cast<const char*>(m_refCount), _BLOCKSIZE_*sizeof(unsigned int));
+	fs.write(reinterpret_cast<const char*>(m_tableFree), m_nbfree*sizeof(unsigned int));
+}
+
+bool HoleBlockRef::loadMapped(const Utils::MappedFile& mf, std::size_t& offset)
+{
+	unsigned int numbers[3];
+	if (!mf.read(offset, numbers, 3*sizeof(unsigned int)) || (numbers[2] > _BLOCKSIZE_))
+		return false;
+	m_nb = numbers[0];
+	m_nbref = numbers[1];
+	m_nbfree = numbers[2];
+
+	return mf.read(offset, m_refCount, _BLOCKSIZE_*sizeof(unsigned int))
+		&& mf.read(offset, m_tableFree, m_nbfree*sizeof(unsigned int));
+}
+
 } // namespace CGoGN
@@ -49,6 +49,9 @@ std::map<std::string, RegisteredBaseAttribute*>* GenericMap::m_attributes_regist
 
 std::vector<GenericMap*>*  GenericMap::s_instances = NULL;
 
+// source of unique stamps for the tables of threads of all maps (0 is never given)
+static std::atomic<unsigned long long> s_threadStampCounter(0);
+
 GenericMap::GenericMap():
 	m_nextMarkerId(0),
 	m_authorizeExternalThreads(false),
@@ -59,8 +62,9 @@ GenericMap::GenericMap():
 
 	s_instances->push_back(this);
 
-	m_thread_ids.reserve(NB_THREADS + 1);
 	m_thread_ids.push_back(std::this_thread::get_id());
+	m_thread_resources.push_back(new ThreadResources());
+	renewThreadStamp();
 
 	for(unsigned int i = 0; i < NB_ORBITS; ++i)
 	{
@@ -68,16 +72,90 @@ GenericMap::GenericMap():
 		m_attribs[i].setRegistry(m_attributes_registry_map) ;
 	}
 
-	for(unsigned int i = 0; i < NB_THREADS; ++i)
+	init();
+}
+
+/****************************************
+ *         THREAD ID MANAGEMENT         *
+ ****************************************/
+
+void GenericMap::renewThreadStamp() const
+{
+	m_thread_stamp.store(++s_threadStampCounter, std::memory_order_release);
+}
+
+void GenericMap::lookupCurrentThread(ThreadSlotCache& entry) const
+{
+	std::lock_guard<std::mutex> lock(m_thread_ids_mutex);
+
+	std::thread::id id = std::this_thread::get_id();
+	unsigned int nb = uint32(m_thread_ids.size());
+	unsigned int index = 0;
+	while (index < nb && m_thread_ids[index] != id)
+		++index;
+
+	if (index == nb)
 	{
-		s_vdartsBuffers[i].reserve(8);
-		s_vintsBuffers[i].reserve(8);
+		if (!m_authorizeExternalThreads)
+		{
+			entry.stamp = m_thread_stamp.load(std::memory_order_relaxed);
+			entry.index = -1;
+			entry.resources = NULL;
+			return;
+		}
+		m_thread_ids.push_back(id);
+		if (m_thread_resources.size() < m_thread_ids.size())
+			m_thread_resources.push_back(new ThreadResources());
+		renewThreadStamp();
+	}
+
+	entry.stamp = m_thread_stamp.load(std::memory_order_relaxed);
+	entry.index = index;
+	entry.resources = m_thread_resources[index];
+}
 
-//		for(unsigned int j = 0; j < NB_ORBITS; ++j)
-//			m_markVectors_free[i][j].reserve(8);
+void GenericMap::removeThreadId(const std::thread::id id)
+{
+	std::lock_guard<std::mutex> lock(m_thread_ids_mutex);
+
+	for (unsigned int i = 0; i < m_thread_ids.size(); ++i)
+	{
+		if (m_thread_ids[i] == id)
+		{
+			// resources of the removed thread stay after the last registered one for later reuse
+			unsigned int last = uint32(m_thread_ids.size()) - 1;
+			m_thread_ids[i] = m_thread_ids[last];
+			std::swap(m_thread_resources[i], m_thread_resources[last]);
+			m_thread_ids.pop_back();
+			renewThreadStamp();
+			break;
+		}
 	}
+}
 
-	init();
+std::thread::id& GenericMap::addEmptyThreadId()
+{
+	std::lock_guard<std::mutex> lock(m_thread_ids_mutex);
+
+	m_thread_ids.push_back(std::thread::id());
+	if (m_thread_resources.size() < m_thread_ids.size())
+		m_thread_resources.push_back(new ThreadResources());
+	renewThreadStamp();
+	return m_thread_ids.back();
+}
+
+void GenericMap::setExternalThreadsAuthorization(bool b)
+{
+	std::lock_guard<std::mutex> lock(m_thread_ids_mutex);
+
+	m_authorizeExternalThreads = b;
+	if (!m_authorizeExternalThreads)
+	{
+		// keep only the thread that created the map
+		while (m_thread_ids.size() > 1)
+			m_thread_ids.pop_back();
+	}
+	renewThreadStamp();
 }
 
 void GenericMap::copyAllStatics(const StaticPointers& sp)
@@ -153,6 +231,10 @@ GenericMap::~GenericMap()
 	*it = s_instances->back();
 	s_instances->pop_back();
 
+	for (auto itr = m_thread_resources.begin(); itr != m_thread_resources.end(); ++itr)
+		delete *itr;
+	m_thread_resources.clear();
+
 	// clean type registry if necessary
 
 //	if (s_instances->size() == 0)
@@ -162,14 +244,6 @@ GenericMap::~GenericMap()
 
 //		delete m_attributes_registry_map;
 //		m_attributes_registry_map = NULL;
-
-//		for(unsigned int i = 0; i < NB_THREADS; ++i)
-//		{
-//			for (auto it =s_vdartsBuffers[i].begin(); it != s_vdartsBuffers[i].end(); ++it)
-//				delete *it;
-//			for (auto it =s_vintsBuffers[i].begin(); it != s_vintsBuffers[i].end(); ++it)
-//				delete *it;
-//		}
 //	}
 }
 
@@ -214,11 +288,17 @@ void GenericMap::init(bool addBoundaryMarkers)
 		{
 			m_quickLocalIncidentTraversal[i][j] = NULL ;
 			m_quickLocalAdjacentTraversal[i][j] = NULL ;
+			m_csrIncidentTraversal[i][j] = NULL ;
+			m_csrAdjacentTraversal[i][j] = NULL ;
 		}
 
-		for(unsigned int j = 0; j < NB_THREADS; ++j)
-			m_markVectors_free[i][j].clear();
+		for (auto it = m_thread_resources.begin(); it != m_thread_resources.end(); ++it)
+		{
+			(*it)->markVectorsFree[i].clear();
+			(*it)->epochMarkVectorsFree[i].clear();
+		}
 	}
+	m_nbCSRTraversals = 0 ;
 
 	if (addBoundaryMarkers)
 	{
@@ -244,6 +324,7 @@ void GenericMap::clear(bool removeAttrib)
 	}
 	else
 	{
+		detachCSRTraversals() ;
 		for(unsigned int i = 0; i < NB_ORBITS; ++i)
 			m_attribs[i].clear(false) ;
 	}
@@ -465,8 +546,22 @@ void GenericMap::dumpAttributesAndMarkers()
 }
 
 
+void GenericMap::detachCSRTraversals()
+{
+	for (unsigned int i = 0; i < NB_ORBITS; ++i)
+	{
+		for (unsigned int j = 0; j < NB_ORBITS; ++j)
+		{
+			m_csrIncidentTraversal[i][j] = NULL ;
+			m_csrAdjacentTraversal[i][j] = NULL ;
+		}
+	}
+	m_nbCSRTraversals = 0 ;
+}
+
 void GenericMap::compact(bool topoOnly)
 {
+	detachCSRTraversals();
 	compactTopo();
 
 	if (topoOnly)
@@ -492,6 +587,7 @@ void GenericMap::compact(bool topoOnly)
 
 void GenericMap::compactOrbitContainer(unsigned int orbit, float frag)
 {
+	detachCSRTraversals();
 	std::vector<unsigned int> oldnew;
 
 	if (isOrbitEmbedded(orbit) && (fragmentation(orbit)< frag))
@@ -510,6 +606,7 @@ void GenericMap::compactOrbitContainer(unsigned int orbit, float frag)
 
 void GenericMap::compactIfNeeded(float frag, bool topoOnly)
 {
+	detachCSRTraversals();
 	if (fragmentation(DART)< frag)
 		compactTopo();
 
@@ -534,6 +631,94 @@ void GenericMap::compactIfNeeded(float frag, bool topoOnly)
 	}
 }
 
+bool GenericMap::reorder(const std::vector<unsigned int>& newOfOld)
+{
+	AttributeContainer& dartCont = m_attribs[DART];
+	if ((dartCont.size() != dartCont.realEnd()) || (newOfOld.size() != dartCont.size()))
+	{
+		CGoGNerr << "reorder: the dart container must be compact and fully permuted" << CGoGNendl;
+		return false;
+	}
+
+	if (!permuteTopo(newOfOld))
+		return false;
+
+	detachCSRTraversals();
+
+	// update the darts stored by the quick traversals
+	for (unsigned int orbit = 0; orbit < NB_ORBITS; ++orbit)
+	{
+		AttributeContainer& cont = m_attribs[orbit];
+		if (m_quickTraversal[orbit] != NULL)
+		{
+			AttributeMultiVector<Dart>& qt = *m_quickTraversal[orbit];
+			for (unsigned int i = cont.begin(); i != cont.end(); cont.next(i))
+				qt[i] = Dart(newOfOld[qt[i].index]);
+		}
+		for (unsigned int j = 0; j < NB_ORBITS; ++j)
+		{
+			AttributeMultiVector<NoTypeNameAttribute<std::vector<Dart> > >* tables[2] = {
+				m_quickLocalIncidentTraversal[orbit][j],
+				m_quickLocalAdjacentTraversal[orbit][j]
+			};
+			for (unsigned int k = 0; k < 2; ++k)
+			{
+				if (tables[k] == NULL)
+					continue;
+				for (unsigned int i = cont.begin(); i != cont.end(); cont.next(i))
+				{
+					std::vector<Dart>& vd = (*tables[k])[i];
+					for (std::vector<Dart>::iterator it = vd.begin(); it != vd.end(); ++it)
+						*it = Dart(newOfOld[it->index]);
+				}
+			}
+		}
+	}
+
+	// each cell is moved at the rank of its first dart
+	std::vector<unsigned int> cellNewOfOld;
+	for (unsigned int orbit = 0; orbit < NB_ORBITS; ++orbit)
+	{
+		if ((orbit == DART) || !isOrbitEmbedded(orbit))
+			continue;
+
+		compactOrbitContainer(orbit);
+
+		AttributeContainer& cont = m_attribs[orbit];
+		AttributeMultiVector<unsigned int>& emb = *m_embeddings[orbit];
+		cellNewOfOld.assign(cont.size(), EMBNULL);
+		unsigned int rank = 0;
+		for (unsigned int d = dartCont.begin(); d != dartCont.end(); dartCont.next(d))
+		{
+			unsigned int e = emb[d];
+			if ((e != EMBNULL) && (cellNewOfOld[e] == EMBNULL))
+				cellNewOfOld[e] = rank++;
+		}
+		// cells of no dart at the end
+		for (unsigned int e = 0; e < cont.size(); ++e)
+		{
+			if (cellNewOfOld[e] == EMBNULL)
+				cellNewOfOld[e] = rank++;
+		}
+
+		cont.permute(cellNewOfOld);
+		for (unsigned int d = dartCont.begin(); d != dartCont.end(); dartCont.next(d))
+		{
+			unsigned int& e = emb[d];
+			if (e != EMBNULL)
+				e = cellNewOfOld[e];
+		}
+	}
+
+	return true;
+}
+
+void GenericMap::setPager(Utils::BlockPager* pager)
+{
+	for (unsigned int orbit = 0; orbit < NB_ORBITS; ++orbit)
+		m_attribs[orbit].setPager(pager);
+}
+
 
 void GenericMap::dumpCSV() const
 {
@@ -549,6 +734,7 @@ void GenericMap::dumpCSV() const
 void GenericMap::moveData(GenericMap &mapf)
 {
 	GenericMap::init(false);
+	mapf.detachCSRTraversals();
 
 	for (unsigned int i = 0; i < NB_ORBITS; ++i)
 	{
@@ -565,16 +751,22 @@ void GenericMap::moveData(GenericMap &mapf)
 			mapf.m_quickLocalIncidentTraversal[i][j] = NULL ;
 			mapf.m_quickLocalAdjacentTraversal[i][j] = NULL ;
 		}
-
-		for (unsigned int j = 0; j < NB_THREADS; ++j)
-			this->m_markVectors_free[i][j].swap(mapf.m_markVectors_free[i][j]);
 	}
 
-	for (unsigned int i = 0; i < NB_THREADS; ++i)
+	// free markers and buffers follow the data, each map keeps one resource per registered thread
 	{
-		this->s_vdartsBuffers[i].swap(mapf.s_vdartsBuffers[i]);
-		this->s_vintsBuffers[i].swap(mapf.s_vintsBuffers[i]);
+		std::lock(m_thread_ids_mutex, mapf.m_thread_ids_mutex);
+		std::lock_guard<std::mutex> lockThis(m_thread_ids_mutex, std::adopt_lock);
+		std::lock_guard<std::mutex> lockOther(mapf.m_thread_ids_mutex, std::adopt_lock);
+
+		this->m_thread_resources.swap(mapf.m_thread_resources);
+		while (this->m_thread_resources.size() < this->m_thread_ids.size())
+			this->m_thread_resources.push_back(new ThreadResources());
+		while (mapf.m_thread_resources.size() < mapf.m_thread_ids.size())
+			mapf.m_thread_resources.push_back(new ThreadResources());
 	}
+	this->renewThreadStamp();
+	mapf.renewThreadStamp();
 
 	this->m_boundaryMarkers[0] = mapf.m_boundaryMarkers[0];
 	this->m_boundaryMarkers[1] = mapf.m_boundaryMarkers[1];
@@ -607,7 +799,10 @@ void GenericMap::garbageMarkVectors()
 					maxId = id;
 
 				amv->allFalse();
-				m_markVectors_free[orbit][0].push_back(amv);
+				if (amv->isEpochMode())
+					m_thread_resources[0]->epochMarkVectorsFree[orbit].push_back(amv);
+				else
+					m_thread_resources[0]->markVectorsFree[orbit].push_back(amv);
 			}
 		}
 	}
@@ -25,10 +25,14 @@
 #define CGoGN_TOPO_DLL_EXPORT 1
 
 #include "Topology/generic/mapImpl/mapMono.h"
+#include "Utils/mappedFile.h"
 
 namespace CGoGN
 {
 
+// version of the layout of mappable files
+static const unsigned int MAPPABLE_FORMAT_VERSION = 1;
+
 /****************************************
  *             SAVE & LOAD              *
  ****************************************/
@@ -80,6 +84,13 @@ bool MapMono::loadMapBin(const std::string& filename)
 	fs.read(reinterpret_cast<char*>(buff), 256);
 
 	std::string buff_str(buff);
+	// mappable files are not parsed but mapped
+	if (buff_str == "CGoGN_MapMM")
+	{
+		delete[] buff;
+		fs.close();
+		return loadMapMapped(filename);
+	}
 	// Check file type
 	if (buff_str == "CGoGN_MRMap")
 	{
@@ -128,6 +139,98 @@ bool MapMono::loadMapBin(const std::string& filename)
 	return true;
 }
 
+bool MapMono::saveMapMappable(const std::string& filename) const
+{
+	std::ofstream fs(filename.c_str(), std::ios::out|std::ios::binary);
+	if (!fs)
+	{
+		CGoGNerr << "Unable to open file for writing: " << filename << CGoGNendl;
+		return false;
+	}
+
+	// header
+	char buff[256];
+	for (int i = 0; i < 256; ++i)
+		buff[i] = char(255);
+
+	memcpy(buff, "CGoGN_MapMM", 12);
+
+	std::string mt = mapTypeName();
+	memcpy(buff+32, mt.c_str(), mt.size()+1);
+	unsigned int* buffi = reinterpret_cast<unsigned int*>(buff + 64);
+	buffi[0] = NB_ORBITS;
+	buffi[1] = MAPPABLE_FORMAT_VERSION;
+	buffi[2] = (unsigned int)(Utils::MappedFile::ALIGNMENT);
+	buffi[3] = _BLOCKSIZE_;
+	fs.write(buff, 256);
+
+	// save all attribs
+	for (unsigned int i = 0; i < NB_ORBITS; ++i)
+		m_attribs[i].saveMappable(fs, i);
+
+	return fs.good();
+}
+
+bool MapMono::loadMapMapped(const std::string& filename, bool readOnly)
+{
+	Utils::MappedFile* mf = Utils::MappedFile::open(filename, readOnly);
+	if (mf == NULL)
+		return false;
+
+	GenericMap::clear(true);
+
+	// check header
+	std::size_t offset = 0;
+	const char* buff = mf->get(offset, 256);
+	if ((buff == NULL) || (std::string(buff, 12) != std::string("CGoGN_MapMM", 12)))
+	{
+		CGoGNerr << "Wrong mappable binary file format" << CGoGNendl;
+		mf->unref();
+		return false;
+	}
+
+	std::string fileType(buff + 32);
+	std::string localType = this->mapTypeName();
+	if (fileType != localType)
+	{
+		CGoGNerr << "Not possible to load "<< fileType << " into " << localType << " object" << CGoGNendl;
+		mf->unref();
+		return false;
+	}
+
+	unsigned int buffi[4];
+	memcpy(buffi, buff + 64, 4*sizeof(unsigned int));
+	if ((buffi[0] != NB_ORBITS) || (buffi[1] != MAPPABLE_FORMAT_VERSION) ||
+		(buffi[2] != Utils::MappedFile::ALIGNMENT) || (buffi[3] != _BLOCKSIZE_))
+	{
+		CGoGNerr << "Incompatible mappable binary file (orbits / version / alignment / block size)" << CGoGNendl;
+		mf->unref();
+		return false;
+	}
+
+	// load attrib containers (the attributes take their own references on mf)
+	bool ok = true;
+	for (unsigned int i = 0; (i < NB_ORBITS) && ok; ++i)
+	{
+		unsigned int id;
+		ok = AttributeContainer::loadMappedId(*mf, offset, id) && (id < NB_ORBITS) && m_attribs[id].loadMapped(*mf, offset);
+	}
+	mf->unref();
+
+	if (!ok)
+	{
+		CGoGNerr << "Corrupted mappable binary file: " << filename << CGoGNendl;
+		GenericMap::clear(true);
+		return false;
+	}
+
+	// restore shortcuts
+	GenericMap::restore_shortcuts();
+	restore_topo_shortcuts();
+
+	return true;
+}
+
 bool MapMono::copyFrom(const GenericMap& map)
 {
 
@@ -225,5 +328,30 @@ void MapMono::compactTopo()
 }
 
 
+bool MapMono::permuteTopo(const std::vector<unsigned int>& newOfOld)
+{
+	m_attribs[DART].permute(newOfOld);
+
+	for (unsigned int i = m_attribs[DART].begin(); i != m_attribs[DART].end(); m_attribs[DART].next(i))
+	{
+		for (unsigned int j = 0; j < m_permutation.size(); ++j)
+		{
+			Dart& d = (*m_permutation[j])[i];
+			d = Dart(newOfOld[d.index]);
+		}
+		for (unsigned int j = 0; j < m_permutation_inv.size(); ++j)
+		{
+			Dart& d = (*m_permutation_inv[j])[i];
+			d = Dart(newOfOld[d.index]);
+		}
+		for (unsigned int j = 0; j < m_involution.size(); ++j)
+		{
+			Dart& d = (*m_involution[j])[i];
+			d = Dart(newOfOld[d.index]);
+		}
+	}
+
+	return true;
+}
 
 } //namespace CGoGN
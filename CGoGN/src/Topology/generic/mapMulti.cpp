@@ -530,6 +530,13 @@ void MapMulti::compactTopo()
 	}
 }
 
+bool MapMulti::permuteTopo(const std::vector<unsigned int>& /*newOfOld*/)
+{
+	// the darts of the levels would have to be permuted with the MR indices
+	CGoGNerr << "MapMulti: reordering of the darts is not handled" << CGoGNendl;
+	return false;
+}
+
 
 void MapMulti::dumpCSV() const
 {
@@ -0,0 +1,209 @@
+/*******************************************************************************
+ * CGoGN: Combinatorial and Geometric modeling with Generic N-dimensional Maps  *
+ * version 0.1                                                                  *
+ * Copyright (C) 2009-2012, IGG Team, LSIIT, University of Strasbourg           *
+ *                                                                              *
+ * This library is free software; you can redistribute it and/or modify it      *
+ * under the terms of the GNU Lesser General Public License as published by the *
+ * Free Software Foundation; either version 2.1 of the License, or (at your     *
+ * option) any later version.                                                   *
+ *                                                                              *
+ * This library is distributed in the hope that it will be useful, but WITHOUT  *
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or        *
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License  *
+ * for more details.                                                            *
+ *                                                                              *
+ * You should have received a copy of the GNU Lesser General Public License     *
+ * along with this library; if not, write to the Free Software Foundation,      *
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301 USA.           *
+ *                                                                              *
+ * Web site: http://cgogn.unistra.fr/                                           *
+ * Contact information: cgogn@unistra.fr                                        *
+ *                                                                              *
+ *******************************************************************************/
+
+#define CGoGN_UTILS_DLL_EXPORT 1
+#include "Utils/benchmark.h"
+#include "Utils/cgognStream.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+namespace CGoGN
+{
+
+namespace Utils
+{
+
+Benchmark::Benchmark(const std::string& suite, unsigned int nbWarmups, unsigned int nbIterations) :
+	m_suite(suite),
+	m_nbWarmups(nbWarmups),
+	m_nbIterations((nbIterations > 0) ? nbIterations : 1),
+	m_verbose(true)
+{}
+
+double Benchmark::now()
+{
+	typedef std::chrono::steady_clock clock;
+	return std::chrono::duration<double, std::milli>(clock::now().time_since_epoch()).count();
+}
+
+const Benchmark::Result& Benchmark::addResult(const std::string& name, std::vector<double>& times, double nbItems)
+{
+	std::sort(times.begin(), times.end());
+	unsigned int nb = (unsigned int)(times.size());
+
+	Result r;
+	r.name = name;
+	r.nbIterations = nb;
+	r.min = times.front();
+	r.max = times.back();
+	r.median = (nb % 2 == 1) ? times[nb / 2] : 0.5 * (times[nb / 2 - 1] + times[nb / 2]);
+	// nearest rank percentile
+	unsigned int rank = (unsigned int)(std::ceil(0.9 * nb));
+	r.p90 = times[(rank > 0) ? rank - 1 : 0];
+	double sum = 0.0;
+	for (unsigned int i = 0; i < nb; ++i)
+		sum += times[i];
+	r.mean = sum / nb;
+	r.nbItems = nbItems;
+
+	m_results.push_back(r);
+	if (m_verbose)
+	{
+		std::stringstream ss;
+		print(ss, r);
+		CGoGNout << ss.str() << CGoGNendl;
+	}
+	return m_results.back();
+}
+
+void Benchmark::print(std::ostream& out, const Result& r) const
+{
+	std::ios::fmtflags flags = out.flags();
+	std::streamsize prec = out.precision();
+	out << std::fixed << std::setprecision(3);
+	out << std::left << std::setw(40) << r.name << std::right
+		<< " median " << std::setw(10) << r.median << " ms"
+		<< "  p90 " << std::setw(10) << r.p90 << " ms"
+		<< "  min " << std::setw(10) << r.min << " ms";
+	if ((r.nbItems > 0.0) && (r.median > 0.0))
+		out << "  " << std::setprecision(1) << (r.nbItems / r.median * 1000.0) << " items/s";
+	out.flags(flags);
+	out.precision(prec);
+}
+
+// escape the characters of a string for JSON
+static std::string jsonString(const std::string& s)
+{
+	std::string res("\"");
+	for (std::size_t i = 0; i < s.size(); ++i)
+	{
+		char c = s[i];
+		if ((c == '"') || (c == '\\'))
+			res += '\\';
+		if ((unsigned char)(c) < 0x20)
+			res += ' ';
+		else
+			res += c;
+	}
+	res += '"';
+	return res;
+}
+
+// quote a field for CSV (embedded quotes are doubled, one line per result)
+static std::string csvString(const std::string& s)
+{
+	std::string res("\"");
+	for (std::size_t i = 0; i < s.size(); ++i)
+	{
+		char c = s[i];
+		if (c == '"')
+			res += '"';
+		if ((unsigned char)(c) < 0x20)
+			res += ' ';
+		else
+			res += c;
+	}
+	res += '"';
+	return res;
+}
+
+void Benchmark::writeJSON(std::ostream& out) const
+{
+	std::ios::fmtflags flags = out.flags();
+	std::streamsize prec = out.precision();
+	out << std::fixed << std::setprecision(6);
+
+	out << "{" << std::endl;
+	out << "  \"suite\": " << jsonString(m_suite) << "," << std::endl;
+	out << "  \"warmups\": " << m_nbWarmups << "," << std::endl;
+	out << "  \"iterations\": " << m_nbIterations << "," << std::endl;
+	out << "  \"unit\": \"ms\"," << std::endl;
+	out << "  \"results\": [" << std::endl;
+	for (std::size_t i = 0; i < m_results.size(); ++i)
+	{
+		const Result& r = m_results[i];
+		out << "    { \"name\": " << jsonString(r.name)
+			<< ", \"iterations\": " << r.nbIterations
+			<< ", \"min\": " << r.min
+			<< ", \"median\": " << r.median
+			<< ", \"p90\": " << r.p90
+			<< ", \"max\": " << r.max
+			<< ", \"mean\": " << r.mean
+			<< ", \"items\": " << r.nbItems << " }";
+		if (i + 1 < m_results.size())
+			out << ",";
+		out << std::endl;
+	}
+	out << "  ]" << std::endl;
+	out << "}" << std::endl;
+
+	out.flags(flags);
+	out.precision(prec);
+}
+
+void Benchmark::writeCSV(std::ostream& out) const
+{
+	std::ios::fmtflags flags = out.flags();
+	std::streamsize prec = out.precision();
+	out << std::fixed << std::setprecision(6);
+
+	out << "suite,name,iterations,min_ms,median_ms,p90_ms,max_ms,mean_ms,items" << std::endl;
+	for (std::size_t i = 0; i < m_results.size(); ++i)
+	{
+		const Result& r = m_results[i];
+		out << csvString(m_suite) << "," << csvString(r.name) << "," << r.nbIterations << ","
+			<< r.min << "," << r.median << "," << r.p90 << ","
+			<< r.max << "," << r.mean << "," << r.nbItems << std::endl;
+	}
+
+	out.flags(flags);
+	out.precision(prec);
+}
+
+bool Benchmark::save(const std::string& filename) const
+{
+	std::ofstream out(filename.c_str());
+	if (!out.good())
+	{
+		CGoGNerr << "Unable to open file " << filename << CGoGNendl;
+		return false;
+	}
+
+	std::size_t n = filename.size();
+	if ((n > 4) && (filename.compare(n - 4, 4, ".csv") == 0))
+		writeCSV(out);
+	else
+		writeJSON(out);
+
+	return out.good();
+}
+
+} // namespace Utils
+
+} // namespace CGoGN
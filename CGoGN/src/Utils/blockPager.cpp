@@ -0,0 +1,287 @@
+/*******************************************************************************
+ * CGoGN: Combinatorial and Geometric modeling with Generic N-dimensional Maps  *
+ * version 0.1                                                                  *
+ * Copyright (C) 2009-2012, IGG Team, LSIIT, University of Strasbourg           *
+ *                                                                              *
+ * This library is free software; you can redistribute it and/or modify it      *
+ * under the terms of the GNU Lesser General Public License as published by the *
+ * Free Software Foundation; either version 2.1 of the License, or (at your     *
+ * option) any later version.                                                   *
+ *                                                                              *
+ * This library is distributed in the hope that it will be useful, but WITHOUT  *
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or        *
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License  *
+ * for more details.                                                            *
+ *                                                                              *
+ * You should have received a copy of the GNU Lesser General Public License     *
+ * along with this library; if not, write to the Free Software Foundation,      *
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301 USA.           *
+ *                                                                              *
+ * Web site: http://cgogn.unistra.fr/                                           *
+ * Contact information: cgogn@unistra.fr                                        *
+ *                                                                              *
+ *******************************************************************************/
+
+#define CGoGN_UTILS_DLL_EXPORT 1
+#include "Utils/blockPager.h"
+#include "Utils/cgognStream.h"
+
+#ifndef WIN32
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace CGoGN
+{
+
+namespace Utils
+{
+
+BlockPager::BlockPager():
+	m_fd(-1),
+	m_pageSize(4096),
+	m_fileSize(0),
+	m_segmentSize(0),
+	m_budget(0),
+	m_resident(0),
+	m_nbEvictions(0),
+	m_nbRefs(1),
+	m_used(0)
+{}
+
+BlockPager::~BlockPager()
+{
+#ifndef WIN32
+	for (std::vector<std::pair<char*, std::size_t> >::iterator it = m_segments.begin(); it != m_segments.end(); ++it)
+		munmap(it->first, it->second);
+	if (m_fd >= 0)
+		::close(m_fd);
+#endif
+}
+
+BlockPager* BlockPager::create(const std::string& filename, std::size_t budget, std::size_t segmentSize)
+{
+#ifdef WIN32
+	CGoGNerr << "Block paging is not available on this system" << CGoGNendl;
+	return NULL;
+#else
+	int fd = ::open(filename.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0600);
+	if (fd < 0)
+	{
+		CGoGNerr << "Unable to create spill file " << filename << CGoGNendl;
+		return NULL;
+	}
+	// the file is only reachable through fd and removed when closed
+	unlink(filename.c_str());
+
+	BlockPager* bp = new BlockPager;
+	bp->m_fd = fd;
+	bp->m_pageSize = std::size_t(sysconf(_SC_PAGESIZE));
+	bp->m_budget = budget;
+	bp->m_segmentSize = (segmentSize + bp->m_pageSize - 1) / bp->m_pageSize * bp->m_pageSize;
+	return bp;
+#endif
+}
+
+void BlockPager::unref()
+{
+	unsigned int nb;
+	{
+		std::lock_guard<std::mutex> lock(m_protect);
+		nb = --m_nbRefs;
+	}
+	if (nb == 0)
+		delete this;
+}
+
+bool BlockPager::addSegment(std::size_t minSize)
+{
+#ifdef WIN32
+	return false;
+#else
+	std::size_t size = (minSize > m_segmentSize) ? minSize : m_segmentSize;
+	if (ftruncate(m_fd, off_t(m_fileSize + size)) != 0)
+	{
+		CGoGNerr << "Unable to grow spill file" << CGoGNendl;
+		return false;
+	}
+	void* ptr = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, off_t(m_fileSize));
+	if (ptr == MAP_FAILED)
+	{
+		CGoGNerr << "Unable to map spill file" << CGoGNendl;
+		return false;
+	}
+	m_segments.push_back(std::make_pair(reinterpret_cast<char*>(ptr), size));
+	m_fileSize += size;
+	m_used = 0;
+	return true;
+#endif
+}
+
+std::map<char*, BlockPager::Block>::iterator BlockPager::find(const void* ptr)
+{
+	char* p = const_cast<char*>(reinterpret_cast<const char*>(ptr));
+	std::map<char*, Block>::iterator it = m_blocks.upper_bound(p);
+	if (it == m_blocks.begin())
+		return m_blocks.end();
+	--it;
+	if (p >= it->first + it->second.size)
+		return m_blocks.end();
+	return it;
+}
+
+std::map<char*, BlockPager::Block>::const_iterator BlockPager::find(const void* ptr) const
+{
+	char* p = const_cast<char*>(reinterpret_cast<const char*>(ptr));
+	std::map<char*, Block>::const_iterator it = m_blocks.upper_bound(p);
+	if (it == m_blocks.begin())
+		return m_blocks.end();
+	--it;
+	if (p >= it->first + it->second.size)
+		return m_blocks.end();
+	return it;
+}
+
+void BlockPager::setRecent(std::map<char*, Block>::iterator it)
+{
+	Block& b = it->second;
+	if (b.resident)
+		m_lru.splice(m_lru.begin(), m_lru, b.lru);
+	else
+	{
+		m_lru.push_front(it->first);
+		b.lru = m_lru.begin();
+		b.resident = true;
+		m_resident += b.size;
+	}
+}
+
+void BlockPager::evict(std::map<char*, Block>::iterator it)
+{
+	Block& b = it->second;
+#ifndef WIN32
+	// write back, then drop the pages of the mapping and of the file cache
+	msync(it->first, b.size, MS_SYNC);
+	madvise(it->first, b.size, MADV_DONTNEED);
+	posix_fadvise(m_fd, off_t(b.offset), off_t(b.size), POSIX_FADV_DONTNEED);
+#endif
+	m_lru.erase(b.lru);
+	b.resident = false;
+	m_resident -= b.size;
+	++m_nbEvictions;
+}
+
+void BlockPager::evictOverBudget()
+{
+	while ((m_resident > m_budget) && (m_lru.size() > 1))
+		evict(m_blocks.find(m_lru.back()));
+}
+
+void* BlockPager::allocate(std::size_t size)
+{
+	std::lock_guard<std::mutex> lock(m_protect);
+
+	size = (size + m_pageSize - 1) / m_pageSize * m_pageSize;
+
+	char* ptr;
+	std::vector<char*>& fl = m_free[size];
+	if (!fl.empty())
+	{
+		ptr = fl.back();
+		fl.pop_back();
+		m_blocks[ptr].free = false;
+	}
+	else
+	{
+		if (m_segments.empty() || (m_used + size > m_segments.back().second))
+		{
+			if (!addSegment(size))
+				return NULL;
+		}
+		ptr = m_segments.back().first + m_used;
+		Block b;
+		b.size = size;
+		b.offset = m_fileSize - m_segments.back().second + m_used;
+		b.free = false;
+		b.resident = false;
+		m_blocks[ptr] = b;
+		m_used += size;
+	}
+
+	setRecent(m_blocks.find(ptr));
+	evictOverBudget();
+	return ptr;
+}
+
+void BlockPager::release(void* ptr)
+{
+	std::lock_guard<std::mutex> lock(m_protect);
+
+	std::map<char*, Block>::iterator it = m_blocks.find(reinterpret_cast<char*>(ptr));
+	if ((it == m_blocks.end()) || it->second.free)
+	{
+		CGoGNerr << "BlockPager: releasing a block not allocated by the pager" << CGoGNendl;
+		return;
+	}
+
+	Block& b = it->second;
+	if (b.resident)
+	{
+		m_lru.erase(b.lru);
+		b.resident = false;
+		m_resident -= b.size;
+	}
+#if !defined(WIN32) && defined(FALLOC_FL_PUNCH_HOLE)
+	// data is dropped without being written back
+	fallocate(m_fd, FALLOC_FL_PUNCH_HOLE | FALLOC_FL_KEEP_SIZE, off_t(b.offset), off_t(b.size));
+#endif
+	b.free = true;
+	m_free[b.size].push_back(it->first);
+}
+
+bool BlockPager::contains(const void* ptr) const
+{
+	std::lock_guard<std::mutex> lock(m_protect);
+	return find(ptr) != m_blocks.end();
+}
+
+void BlockPager::touch(const void* ptr)
+{
+	std::lock_guard<std::mutex> lock(m_protect);
+
+	std::map<char*, Block>::iterator it = find(ptr);
+	if ((it == m_blocks.end()) || it->second.free)
+		return;
+	setRecent(it);
+	evictOverBudget();
+}
+
+void BlockPager::evict(const void* ptr)
+{
+	std::lock_guard<std::mutex> lock(m_protect);
+
+	std::map<char*, Block>::iterator it = find(ptr);
+	if ((it != m_blocks.end()) && it->second.resident)
+		evict(it);
+}
+
+void BlockPager::evictAll()
+{
+	std::lock_guard<std::mutex> lock(m_protect);
+
+	while (!m_lru.empty())
+		evict(m_blocks.find(m_lru.back()));
+}
+
+void BlockPager::setBudget(std::size_t budget)
+{
+	std::lock_guard<std::mutex> lock(m_protect);
+
+	m_budget = budget;
+	evictOverBudget();
+}
+
+} // namespace Utils
+
+} // namespace CGoGN
@@ -0,0 +1,139 @@
+/*******************************************************************************
+ * CGoGN: Combinatorial and Geometric modeling with Generic N-dimensional Maps  *
+ * version 0.1                                                                  *
+ * Copyright (C) 2009-2012, IGG Team, LSIIT, University of Strasbourg           *
+ *                                                                              *
+ * This library is free software; you can redistribute it and/or modify it      *
+ * under the terms of the GNU Lesser General Public License as published by the *
+ * Free Software Foundation; either version 2.1 of the License, or (at your     *
+ * option) any later version.                                                   *
+ *                                                                              *
+ * This library is distributed in the hope that it will be useful, but WITHOUT  *
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or        *
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License  *
+ * for more details.                                                            *
+ *                                                                              *
+ * You should have received a copy of the GNU Lesser General Public License     *
+ * along with this library; if not, write to the Free Software Foundation,      *
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301 USA.           *
+ *                                                                              *
+ * Web site: http://cgogn.unistra.fr/                                           *
+ * Contact information: cgogn@unistra.fr                                        *
+ *                                                                              *
+ *******************************************************************************/
+
+
+#define CGoGN_UTILS_DLL_EXPORT 1
+#include "Utils/mappedFile.h"
+#include "Utils/cgognStream.h"
+
+#include <cstring>
+
+#ifndef WIN32
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace CGoGN
+{
+
+namespace Utils
+{
+
+const std::size_t MappedFile::ALIGNMENT;
+
+MappedFile::MappedFile():
+	m_data(NULL),
+	m_size(0),
+	m_readOnly(true),
+	m_nbRefs(1)
+{}
+
+MappedFile::~MappedFile()
+{
+#ifndef WIN32
+	if (m_data != NULL)
+		munmap(m_data, m_size);
+#endif
+}
+
+MappedFile* MappedFile::open(const std::string& filename, bool readOnly)
+{
+#ifdef WIN32
+	CGoGNerr << "Memory mapped files are not available on this system" << CGoGNendl;
+	return NULL;
+#else
+	int fd = ::open(filename.c_str(), O_RDONLY);
+	if (fd < 0)
+	{
+		CGoGNerr << "Unable to open file " << filename << CGoGNendl;
+		return NULL;
+	}
+
+	struct stat st;
+	if ((fstat(fd, &st) != 0) || (st.st_size == 0))
+	{
+		CGoGNerr << "Unable to get size of file " << filename << CGoGNendl;
+		::close(fd);
+		return NULL;
+	}
+
+	// private mapping: written pages are copied, never written back
+	int prot = readOnly ? PROT_READ : (PROT_READ | PROT_WRITE);
+	void* ptr = mmap(NULL, std::size_t(st.st_size), prot, MAP_PRIVATE, fd, 0);
+	::close(fd);
+	if (ptr == MAP_FAILED)
+	{
+		CGoGNerr << "Unable to map file " << filename << CGoGNendl;
+		return NULL;
+	}
+
+	MappedFile* mf = new MappedFile;
+	mf->m_data = reinterpret_cast<char*>(ptr);
+	mf->m_size = std::size_t(st.st_size);
+	mf->m_readOnly = readOnly;
+	return mf;
+#endif
+}
+
+void MappedFile::unref()
+{
+	if (--m_nbRefs == 0)
+		delete this;
+}
+
+char* MappedFile::get(std::size_t& offset, std::size_t nb) const
+{
+	if ((offset > m_size) || (nb > m_size - offset))
+		return NULL;
+	char* ptr = m_data + offset;
+	offset += nb;
+	return ptr;
+}
+
+bool MappedFile::read(std::size_t& offset, void* dst, std::size_t nb) const
+{
+	const char* ptr = get(offset, nb);
+	if (ptr == NULL)
+		return false;
+	memcpy(dst, ptr, nb);
+	return true;
+}
+
+void MappedFile::pad(std::ostream& fs)
+{
+	std::size_t pos = std::size_t(fs.tellp());
+	std::size_t nb = align(pos) - pos;
+	if (nb > 0)
+	{
+		char zeros[ALIGNMENT];
+		memset(zeros, 0, nb);
+		fs.write(zeros, nb);
+	}
+}
+
+} // namespace Utils
+
+} // namespace CGoGN
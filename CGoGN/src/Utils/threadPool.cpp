@@ -0,0 +1,232 @@
+/*******************************************************************************
+ * CGoGN: Combinatorial and Geometric modeling with Generic N-dimensional Maps  *
+ * version 0.1                                                                  *
+ * Copyright (C) 2009-2012, IGG Team, LSIIT, University of Strasbourg           *
+ *                                                                              *
+ * This library is free software; you can redistribute it and/or modify it      *
+ * under the terms of the GNU Lesser General Public License as published by the *
+ * Free Software Foundation; either version 2.1 of the License, or (at your     *
+ * option) any later version.                                                   *
+ *                                                                              *
+ * This library is distributed in the hope that it will be useful, but WITHOUT  *
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or        *
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License  *
+ * for more details.                                                            *
+ *                                                                              *
+ * You should have received a copy of the GNU Lesser General Public License     *
+ * along with this library; if not, write to the Free Software Foundation,      *
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301 USA.           *
+ *                                                                              *
+ * Web site: http://cgogn.unistra.fr/                                           *
+ * Contact information: cgogn@unistra.fr                                        *
+ *                                                                              *
+ *******************************************************************************/
+
+#define CGoGN_UTILS_DLL_EXPORT 1
+#include "Utils/threadPool.h"
+
+#include <map>
+
+namespace CGoGN
+{
+
+namespace Utils
+{
+
+namespace
+{
+// pool and worker index of the task run by the current thread (NULL outside of the tasks)
+thread_local const ThreadPool* t_taskPool = NULL;
+thread_local unsigned int t_taskWorker = 0;
+}
+
+ThreadPool::ThreadPool(unsigned int nbWorkers):
+	m_job(NULL),
+	m_remaining(0),
+	m_generation(0),
+	m_stop(false)
+{
+	if (nbWorkers == 0)
+		nbWorkers = 1;
+
+	m_queues.reserve(nbWorkers);
+	for (unsigned int i = 0; i < nbWorkers; ++i)
+		m_queues.push_back(new WorkQueue());
+
+	m_threads.reserve(nbWorkers);
+	for (unsigned int i = 0; i < nbWorkers; ++i)
+		m_threads.push_back(new std::thread(&ThreadPool::workerLoop, this, i));
+}
+
+ThreadPool::~ThreadPool()
+{
+	{
+		std::unique_lock<std::mutex> lock(m_protect);
+		m_stop = true;
+		m_condStart.notify_all();
+	}
+
+	// a worker may still look into the queues of the others: join all of them first
+	for (unsigned int i = 0; i < m_threads.size(); ++i)
+	{
+		m_threads[i]->join();
+		delete m_threads[i];
+	}
+
+	for (unsigned int i = 0; i < m_queues.size(); ++i)
+		delete m_queues[i];
+}
+
+bool ThreadPool::popChunk(unsigned int w, Chunk& c)
+{
+	// first in own queue (front: keep the order of the indices)
+	{
+		WorkQueue& q = *(m_queues[w]);
+		std::unique_lock<std::mutex> lock(q.m_protect);
+		if (!q.m_chunks.empty())
+		{
+			c = q.m_chunks.front();
+			q.m_chunks.pop_front();
+			return true;
+		}
+	}
+
+	// then steal from the others (back: far from what the owner is working on)
+	unsigned int nbw = nbWorkers();
+	for (unsigned int i = 1; i < nbw; ++i)
+	{
+		WorkQueue& q = *(m_queues[(w + i) % nbw]);
+		std::unique_lock<std::mutex> lock(q.m_protect);
+		if (!q.m_chunks.empty())
+		{
+			c = q.m_chunks.back();
+			q.m_chunks.pop_back();
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void ThreadPool::workerLoop(unsigned int w)
+{
+	unsigned int generation = 0;
+
+	while (true)
+	{
+		{
+			std::unique_lock<std::mutex> lock(m_protect);
+			while (!m_stop && (generation == m_generation))
+				m_condStart.wait(lock);
+			if (m_stop)
+				return;
+			generation = m_generation;
+		}
+
+		Chunk c;
+		while (popChunk(w, c))
+		{
+			t_taskPool = this;
+			t_taskWorker = w;
+			(*m_job)(c.first, c.second, w);
+			t_taskPool = NULL;
+			if (--m_remaining == 0)
+			{
+				std::unique_lock<std::mutex> lock(m_protect);
+				m_condDone.notify_all();
+			}
+		}
+	}
+}
+
+unsigned int ThreadPool::defaultChunkSize(unsigned int nb) const
+{
+	// around 8 chunks per worker, but not too small nor too large
+	unsigned int cs = nb / (8 * nbWorkers());
+	if (cs < 64)
+		cs = 64;
+	if (cs > 4096)
+		cs = 4096;
+	return cs;
+}
+
+void ThreadPool::parallelFor(unsigned int nb, const RangeFunction& f)
+{
+	parallelFor(nb, defaultChunkSize(nb), f);
+}
+
+void ThreadPool::parallelFor(unsigned int nb, unsigned int chunkSize, const RangeFunction& f)
+{
+	if (nb == 0)
+		return;
+	if (chunkSize == 0)
+		chunkSize = 1;
+
+	// a task waiting for a job of a pool would deadlock (the pool is busy or may be)
+	if (t_taskPool != NULL)
+	{
+		runInline(nb, chunkSize, f);
+		return;
+	}
+
+	// only one job at a time in the pool
+	std::unique_lock<std::mutex> jobLock(m_jobProtect);
+
+	unsigned int nbChunks = (nb + chunkSize - 1) / chunkSize;
+	unsigned int nbw = nbWorkers();
+	unsigned int perWorker = (nbChunks + nbw - 1) / nbw;
+
+	m_job = &f;
+	m_remaining = nbChunks;
+
+	// deal contiguous chunks to each worker
+	for (unsigned int i = 0; i < nbChunks; ++i)
+	{
+		unsigned int b = i * chunkSize;
+		unsigned int e = (nb - b > chunkSize) ? b + chunkSize : nb;
+		WorkQueue& q = *(m_queues[i / perWorker]);
+		std::unique_lock<std::mutex> lock(q.m_protect);
+		q.m_chunks.push_back(Chunk(b, e));
+	}
+
+	std::unique_lock<std::mutex> lock(m_protect);
+	++m_generation;
+	m_condStart.notify_all();
+	while (m_remaining != 0)
+		m_condDone.wait(lock);
+
+	m_job = NULL;
+}
+
+void ThreadPool::runInline(unsigned int nb, unsigned int chunkSize, const RangeFunction& f)
+{
+	const unsigned int w = (t_taskPool == this) ? t_taskWorker : t_taskWorker % nbWorkers();
+	for (unsigned int b = 0; b < nb; b += chunkSize)
+	{
+		unsigned int e = (nb - b > chunkSize) ? b + chunkSize : nb;
+		f(b, e, w);
+	}
+}
+
+bool ThreadPool::inTask()
+{
+	return t_taskPool != NULL;
+}
+
+ThreadPool& ThreadPool::shared(unsigned int nbWorkers)
+{
+	static std::mutex protect;
+	// the pools are never destroyed: users keep references on them
+	static std::map<unsigned int, ThreadPool*>* pools = new std::map<unsigned int, ThreadPool*>();
+
+	std::unique_lock<std::mutex> lock(protect);
+	if (nbWorkers == 0)
+		nbWorkers = 1;
+	ThreadPool*& pool = (*pools)[nbWorkers];
+	if (pool == NULL)
+		pool = new ThreadPool(nbWorkers);
+	return *pool;
+}
+
+}
+}
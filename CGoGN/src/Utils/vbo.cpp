@@ -34,7 +34,8 @@ namespace CGoGN
 namespace Utils
 {
 
-VBO::VBO(const std::string& name) : m_data_size(0), m_nbElts(0), m_lock(false), m_name(name)/*, m_conv(NULL)*/
+VBO::VBO(const std::string& name) : m_data_size(0), m_nbElts(0), m_lock(false), m_name(name),
+	m_syncAttrib(NULL), m_syncNbBlocks(0), m_syncVersion(0)/*, m_conv(NULL)*/
 {
 	glGenBuffers(1, &(*m_id));
 	m_refs.reserve(4);
@@ -44,7 +45,10 @@ VBO::VBO(const std::string& name) : m_data_size(0), m_nbElts(0), m_lock(false),
 VBO::VBO(const VBO& vbo) :
 	m_data_size(vbo.m_data_size),
 	m_nbElts(vbo.m_nbElts),
-	m_lock(false)
+	m_lock(false),
+	m_syncAttrib(NULL),
+	m_syncNbBlocks(0),
+	m_syncVersion(0)
 {
 	glGenBuffers(1, &(*m_id));
 
@@ -74,12 +78,47 @@ void VBO::sameAllocSameBufferSize(const VBO& vbo)
 {
 	m_data_size = vbo.m_data_size;
 	m_nbElts = vbo.m_nbElts;
+	m_syncAttrib = NULL;
 	unsigned int nbbytes =  sizeof(float) * m_data_size * m_nbElts;
 	bind();
 	glBufferData(GL_ARRAY_BUFFER, nbbytes, NULL, GL_STREAM_DRAW);
 }
 
+bool VBO::blocksToUpload(const AttributeMultiVectorGen* attrib, unsigned int nbb, bool dirtyOnly, std::vector<std::pair<unsigned int, unsigned int> >& blocks)
+{
+	blocks.clear();
+	bool all = !dirtyOnly || attrib != m_syncAttrib || nbb != m_syncNbBlocks;
+	if (all)
+	{
+		m_syncVersion = attrib->synchronize();
+		if (nbb > 0)
+			blocks.push_back(std::make_pair(0u, nbb));
+	}
+	else
+	{
+		m_syncVersion = attrib->getDirtyRanges(m_syncVersion, blocks);
+		for (std::vector<std::pair<unsigned int, unsigned int> >::iterator it = blocks.begin(); it != blocks.end(); ++it)
+		{
+			it->first /= _BLOCKSIZE_;
+			it->second /= _BLOCKSIZE_;
+		}
+	}
+	m_syncAttrib = attrib;
+	m_syncNbBlocks = nbb;
+	return all;
+}
+
 void VBO::updateData(const AttributeMultiVectorGen* attrib)
+{
+	updateData(attrib, false);
+}
+
+void VBO::updateDirtyData(const AttributeMultiVectorGen* attrib)
+{
+	updateData(attrib, true);
+}
+
+void VBO::updateData(const AttributeMultiVectorGen* attrib, bool dirtyOnly)
 {
 
 	if (m_lock)
@@ -93,14 +132,14 @@ void VBO::updateData(const AttributeMultiVectorGen* attrib)
 	const AttributeMultiVector<Geom::Vec3d>* amv3 = dynamic_cast<const AttributeMultiVector<Geom::Vec3d>*>(attrib);
 	if (amv3 != NULL)
 	{
-		updateDataConversion<Geom::Vec3d,Geom::Vec3f,3>(attrib,DataConversion::funcVecXdToVecXf<3>);
+		updateDataConversion<Geom::Vec3d,Geom::Vec3f,3>(attrib,DataConversion::funcVecXdToVecXf<3>,dirtyOnly);
 		return;
 	}
 
 	const AttributeMultiVector<Geom::Vec2d>* amv2 = dynamic_cast<const AttributeMultiVector<Geom::Vec2d>*>(attrib);
 	if (amv2 != NULL)
 	{
-		updateDataConversion<Geom::Vec2d,Geom::Vec2f,2>(attrib,DataConversion::funcVecXdToVecXf<2>);
+		updateDataConversion<Geom::Vec2d,Geom::Vec2f,2>(attrib,DataConversion::funcVecXdToVecXf<2>,dirtyOnly);
 
 		return;
 	}
@@ -108,7 +147,7 @@ void VBO::updateData(const AttributeMultiVectorGen* attrib)
 	const AttributeMultiVector<Geom::Vec4d>* amv4 = dynamic_cast<const AttributeMultiVector<Geom::Vec4d>*>(attrib);
 	if (amv4 != NULL)
 	{
-		updateDataConversion<Geom::Vec4d,Geom::Vec4f,4>(attrib,DataConversion::funcVecXdToVecXf<4>);
+		updateDataConversion<Geom::Vec4d,Geom::Vec4f,4>(attrib,DataConversion::funcVecXdToVecXf<4>,dirtyOnly);
 
 		return;
 	}
@@ -116,7 +155,7 @@ void VBO::updateData(const AttributeMultiVectorGen* attrib)
 	const AttributeMultiVector<double>* amv1 = dynamic_cast<const AttributeMultiVector<double>*>(attrib);
 	if (amv1 != NULL)
 	{
-		updateDataConversion<double,float,1>(attrib,DataConversion::funcToFloat<double>);
+		updateDataConversion<double,float,1>(attrib,DataConversion::funcToFloat<double>,dirtyOnly);
 		return;
 	}
 
@@ -129,20 +168,26 @@ void VBO::updateData(const AttributeMultiVectorGen* attrib)
 	unsigned int byteTableSize;
 	unsigned int nbb = attrib->getBlocksPointers(addr, byteTableSize);
 
+	std::vector<std::pair<unsigned int, unsigned int> > blocks;
+	bool all = blocksToUpload(attrib, nbb, dirtyOnly, blocks);
+	if (!all && blocks.empty())
+		return;
 
 	glBindBuffer(GL_ARRAY_BUFFER, *m_id);
 
-	if (nbb!=old_nbb)
+	if (all && nbb!=old_nbb)
 		glBufferData(GL_ARRAY_BUFFER, nbb * byteTableSize, 0, GL_STREAM_DRAW);
 
 	m_nbElts = nbb * byteTableSize / attrib->getSizeOfType();
 
-	unsigned int offset = 0;
-
-	for (unsigned int i = 0; i < nbb; ++i)
+	for (std::vector<std::pair<unsigned int, unsigned int> >::const_iterator it = blocks.begin(); it != blocks.end(); ++it)
 	{
-		glBufferSubData(GL_ARRAY_BUFFER, offset, byteTableSize, addr[i]);
-		offset += byteTableSize;
+		unsigned int offset = it->first * byteTableSize;
+		for (unsigned int i = it->first; i < it->second; ++i)
+		{
+			glBufferSubData(GL_ARRAY_BUFFER, offset, byteTableSize, addr[i]);
+			offset += byteTableSize;
+		}
 	}
 
 }
@@ -157,6 +202,7 @@ void* VBO::lockPtr()
 	}
 
 	m_lock = true;
+	m_syncAttrib = NULL;
 	glBindBuffer(GL_ARRAY_BUFFER, *m_id);
 	return glMapBuffer(GL_ARRAY_BUFFER, GL_READ_WRITE);
 }
@@ -190,6 +236,7 @@ void VBO::copyData(void *ptr) const
 void VBO::allocate(unsigned int nbElts)
 {
 	m_nbElts = nbElts;
+	m_syncAttrib = NULL;
 
 	if (m_data_size ==0)
 	{
@@ -6,11 +6,7 @@
 
 #include "mapHandler.h"
 
-#include "Container/fakeAttribute.h"
-
-#include "NL/nl.h"
-#include "Algo/LinearSolving/basic.h"
-#include "Eigen/Dense"
+#include "Algo/Deformation/asRigidAsPossible.h"
 
 namespace CGoGN
 {
@@ -18,8 +14,6 @@ namespace CGoGN
 namespace SCHNApps
 {
 
-typedef NoTypeNameAttribute<Eigen::Matrix3f> Eigen_Matrix3f;
-
 struct MapParameters
 {
 	MapParameters();
@@ -36,14 +30,8 @@ struct MapParameters
 	bool initialized;
 
 	VertexAttribute<PFP2::VEC3, PFP2::MAP> positionInit;
-	VertexAttribute<PFP2::VEC3, PFP2::MAP> diffCoord;
-	VertexAttribute<Eigen_Matrix3f, PFP2::MAP> vertexRotationMatrix;
-	VertexAttribute<PFP2::VEC3, PFP2::MAP> rotatedDiffCoord;
-
-	VertexAttribute<unsigned int, PFP2::MAP> vIndex;
-	unsigned int nb_vertices;
 
-	NLContext nlContext;
+	Algo::Surface::Deformation::AsRigidAsPossible<PFP2>* arap;
 };
 
 class Surface_Deformation_Plugin : public PluginInteraction
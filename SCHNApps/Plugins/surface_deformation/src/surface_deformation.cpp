@@ -1,10 +1,6 @@
 #include "surface_deformation.h"
 
 #include "Algo/Geometry/normal.h"
-#include "Algo/Geometry/laplacian.h"
-#include "Algo/LinearSolving/basic.h"
-
-#include "Algo/Topo/basic.h"
 
 #include "camera.h"
 
@@ -21,13 +17,13 @@ MapParameters::MapParameters() :
 	handleSelector(NULL),
 	freeSelector(NULL),
 	initialized(false),
-	nlContext(NULL)
+	arap(NULL)
 {}
 
 MapParameters::~MapParameters()
 {
-	if(nlContext)
-		nlDeleteContext(nlContext);
+	if(arap)
+		delete arap;
 }
 
 void MapParameters::start(MapHandlerGen* mhg)
@@ -42,39 +38,13 @@ void MapParameters::start(MapHandlerGen* mhg)
 			if(!positionInit.isValid())
 				positionInit = mh->addAttribute<PFP2::VEC3, VERTEX>("positionInit");
 
-			diffCoord = mh->getAttribute<PFP2::VEC3, VERTEX>("diffCoord");
-			if(!diffCoord.isValid())
-				diffCoord = mh->addAttribute<PFP2::VEC3, VERTEX>("diffCoord");
-
-			vertexRotationMatrix = mh->getAttribute<Eigen_Matrix3f, VERTEX>("vertexRotationMatrix");
-			if(!vertexRotationMatrix.isValid())
-				vertexRotationMatrix = mh->addAttribute<Eigen_Matrix3f, VERTEX>("vertexRotationMatrix");
-
-			rotatedDiffCoord = mh->getAttribute<PFP2::VEC3, VERTEX>("rotatedDiffCoord");
-			if(!rotatedDiffCoord.isValid())
-				rotatedDiffCoord = mh->addAttribute<PFP2::VEC3, VERTEX>("rotatedDiffCoord");
-
-			vIndex = mh->getAttribute<unsigned int, VERTEX>("vIndex");
-			if(!vIndex.isValid())
-				vIndex = mh->addAttribute<unsigned int, VERTEX>("vIndex");
-
 			PFP2::MAP* map = static_cast<MapHandler<PFP2>*>(mh)->getMap();
 
 			map->copyAttribute(positionInit, positionAttribute);
 
-			Algo::Surface::Geometry::computeLaplacianTopoVertices<PFP2>(*map, positionAttribute, diffCoord);
-
-			for(unsigned int i = vertexRotationMatrix.begin(); i != vertexRotationMatrix.end(); vertexRotationMatrix.next(i))
-				vertexRotationMatrix[i] = Eigen::Matrix3f::Identity();
-
-			nb_vertices = Algo::Topo::computeIndexCells<VERTEX>(*map, vIndex);
-
-			if(nlContext)
-				nlDeleteContext(nlContext);
-			nlContext = nlNewContext();
-			nlSolverParameteri(NL_NB_VARIABLES, nb_vertices);
-			nlSolverParameteri(NL_LEAST_SQUARES, NL_TRUE);
-			nlSolverParameteri(NL_SOLVER, NL_CHOLMOD_EXT);
+			if(arap)
+				delete arap;
+			arap = new Algo::Surface::Deformation::AsRigidAsPossible<PFP2>(*map, positionAttribute, positionInit);
 
 			initialized = true;
 		}
@@ -88,20 +58,11 @@ void MapParameters::stop(MapHandlerGen* mh)
 //		if(positionInit.isValid())
 //			mh->removeAttribute(positionInit);
 
-//		if(diffCoord.isValid())
-//			mh->removeAttribute(diffCoord);
-
-//		if(vertexRotationMatrix.isValid())
-//			mh->removeAttribute(vertexRotationMatrix);
-
-//		if(rotatedDiffCoord.isValid())
-//			mh->removeAttribute(rotatedDiffCoord);
-
-//		if(vIndex.isValid())
-//			mh->removeAttribute(vIndex);
-
-		if(nlContext)
-			nlDeleteContext(nlContext);
+		if(arap)
+		{
+			delete arap;
+			arap = NULL;
+		}
 
 		initialized = false;
 	}
@@ -178,7 +139,7 @@ void Surface_Deformation_Plugin::keyPress(View* view, QKeyEvent* event)
 				if(p.initialized)
 				{
 					asRigidAsPossible(mh);
-					mh->notifyAttributeModification(p.positionAttribute);
+					mh->notifyAttributeModification(p.positionAttribute, true);
 					view->updateGL();
 				}
 			}
@@ -220,7 +181,10 @@ void Surface_Deformation_Plugin::mouseMove(View* view, QMouseEvent* event)
 			qglviewer::Vec vec = qq - m_dragPrevious;
 			PFP2::VEC3 t(vec.x, vec.y, vec.z);
 			for (std::vector<Vertex>::const_iterator it = handle.begin(); it != handle.end(); ++it)
+			{
 				p.positionAttribute[*it] += t;
+				p.positionAttribute.setDirty(*it);
+			}
 
 			m_dragPrevious = qq;
 
@@ -228,7 +192,7 @@ void Surface_Deformation_Plugin::mouseMove(View* view, QMouseEvent* event)
 			if (p.initialized)
 			{
 				asRigidAsPossible(mh);
-				mh->notifyAttributeModification(p.positionAttribute);
+				mh->notifyAttributeModification(p.positionAttribute, true);
 			}
 		}
 
@@ -315,8 +279,7 @@ void Surface_Deformation_Plugin::selectedCellsChanged(CellSelectorGen* cs)
 	MapParameters& p = h_parameterSet[map];
 	if(p.initialized && (p.handleSelector == cs || p.freeSelector == cs))
 	{
-		nlMakeCurrent(p.nlContext) ;
-		nlReset(NL_FALSE) ;
+		p.arap->resetConstraints();
 	}
 }
 
@@ -398,154 +361,28 @@ void Surface_Deformation_Plugin::toggleMapDeformation(MapHandlerGen* map)
 
 void Surface_Deformation_Plugin::matchDiffCoord(MapHandlerGen* mh)
 {
-	PFP2::MAP* map = static_cast<MapHandler<PFP2>*>(mh)->getMap();
 	MapParameters& p = h_parameterSet[mh];
 
-	nlMakeCurrent(p.nlContext);
-	if (nlGetCurrentState() == NL_STATE_INITIAL)
-		nlBegin(NL_SYSTEM) ;
-	for (int coord = 0; coord < 3; ++coord)
-	{
-		Algo::LinearSolving::setupVariables<PFP2>(*map, p.vIndex, p.freeSelector->getMarker(), p.positionAttribute, coord);
-		nlBegin(NL_MATRIX);
-		Algo::LinearSolving::addRowsRHS_Laplacian_Topo<PFP2>(*map, p.vIndex, p.diffCoord, coord);
-		nlEnd(NL_MATRIX);
-		nlEnd(NL_SYSTEM);
-		nlSolve();
-		Algo::LinearSolving::getResult<PFP2>(*map, p.vIndex, p.positionAttribute, coord);
-		nlReset(NL_TRUE);
-	}
+	// the factorization is kept until the selections change
+	if (!p.arap->isFactorized())
+		p.arap->setConstraints(p.freeSelector->getMarker());
+	p.arap->matchDiffCoord();
 }
 
 void Surface_Deformation_Plugin::asRigidAsPossible(MapHandlerGen* mh)
 {
-	PFP2::MAP* map = static_cast<MapHandler<PFP2>*>(mh)->getMap();
 	MapParameters& p = h_parameterSet[mh];
 
 	if (p.initialized)
 	{
-		CellMarkerNoUnmark<PFP2::MAP, VERTEX> m(*map) ;
-
-		for (Dart d = map->begin(); d != map->end(); map->next(d))
-		{
-			if (!m.isMarked(d))
-			{
-				m.mark(d) ;
-
-				Eigen::Matrix3f cov = Eigen::Matrix3f::Zero() ;
-				PFP2::VEC3 pp = p.positionAttribute[d] ;
-				PFP2::VEC3 ppInit = p.positionInit[d] ;
-	//			PFP2::REAL area = p.vertexArea[d] ;
-				Dart it = d ;
-				do
-				{
-					Dart neigh = map->phi1(it) ;
-					PFP2::VEC3 v = p.positionAttribute[neigh] - pp ;
-					PFP2::VEC3 vv = p.positionInit[neigh] - ppInit ;
-					for (unsigned int i = 0; i < 3; ++i)
-						for (unsigned int j = 0; j < 3; ++j)
-							cov(i,j) += v[i] * vv[j];// * perMap->edgeWeight[it] / area ;
-					Dart dboundary = map->phi_1(it) ;
-					if (map->phi2(dboundary) == dboundary)
-					{
-						v = p.positionAttribute[dboundary] - pp ;
-						vv = p.positionInit[dboundary] - pp ;
-						for(unsigned int i = 0; i < 3; ++i)
-							for(unsigned int j = 0; j < 3; ++j)
-								cov(i,j) += v[i] * vv[j];// * perMap->edgeWeight[dboundary] / area ;
-					}
-					it = map->alpha1(it) ;
-				} while (it != d) ;
-
-				Eigen::JacobiSVD<Eigen::Matrix3f> svd(cov, Eigen::ComputeFullU | Eigen::ComputeFullV) ;
-				Eigen::Matrix3f R = svd.matrixU() * svd.matrixV().transpose() ;
-
-				if (R.determinant() < 0)
-				{
-					Eigen::Matrix3f U = svd.matrixU() ;
-					for (unsigned int i = 0; i < 3; ++i)
-						U(i,2) *= -1 ;
-					R = U * svd.matrixV().transpose() ;
-				}
-
-				p.vertexRotationMatrix[d] = R ;
-			}
-		}
-
-		for (Dart d = map->begin(); d != map->end(); map->next(d))
-		{
-			if (m.isMarked(d))
-			{
-				m.unmark(d) ;
-
-				unsigned int degree = 0 ;
-				Eigen::Matrix3f r = Eigen::Matrix3f::Zero() ;
-				Dart it = d ;
-				do
-				{
-					r += p.vertexRotationMatrix[map->phi1(it)] ;
-					++degree ;
-					Dart dboundary = map->phi_1(it) ;
-					if(map->phi2(dboundary) == dboundary)
-					{
-						r += p.vertexRotationMatrix[dboundary] ;
-						++degree ;
-					}
-					it = map->alpha1(it) ;
-				} while (it != d) ;
-				r += p.vertexRotationMatrix[d] ;
-				r /= degree + 1 ;
-				PFP2::VEC3& dc = p.diffCoord[d] ;
-				Eigen::Vector3f rdc(dc[0], dc[1], dc[2]) ;
-				rdc = r * rdc ;
-				p.rotatedDiffCoord[d] = PFP2::VEC3(rdc[0], rdc[1], rdc[2]) ;
-
-	//			Eigen::Vector3f rdc = Eigen::Vector3f::Zero() ;
-	//			Dart it = d ;
-	//			PFP::REAL vArea = p.vertexArea[d] ;
-	//			Eigen::Matrix3f& rotM = p.vertexRotationMatrix[d] ;
-	//			PFP::REAL val = 0 ;
-	//			do
-	//			{
-	//				Dart ddn = map->phi1(it) ;
-	//				PFP::REAL w = p.edgeWeight[it] / vArea ;
-	//				PFP::VEC3 vv = (p.positionInit[ddn] - p.positionInit[it]) * w ;
-	//				val += w ;
-	//				Eigen::Matrix3f r = 0.5f * (p.vertexRotationMatrix[ddn] + rotM) ;
-	//				Eigen::Vector3f vvr = r * Eigen::Vector3f(vv[0], vv[1], vv[2]) ;
-	//				rdc += vvr ;
-	//				Dart dboundary = map->phi_1(it) ;
-	//				if(map->phi2(dboundary) == dboundary)
-	//				{
-	//					w = p.edgeWeight[dboundary] / vArea ;
-	//					vv = (p.positionInit[dboundary] - p.positionInit[it]) * w ;
-	//					val += w ;
-	//					r = 0.5f * (p.vertexRotationMatrix[dboundary] + rotM) ;
-	//					vvr = r * Eigen::Vector3f(vv[0], vv[1], vv[2]) ;
-	//					rdc += vvr ;
-	//				}
-	//				it = map->alpha1(it) ;
-	//			} while(it != d) ;
-	//			rdc /= val ;
-	//			p.rotatedDiffCoord[d] = PFP::VEC3(rdc[0], rdc[1], rdc[2]) ;
-			}
-		}
-
-		nlMakeCurrent(p.nlContext);
-		if (nlGetCurrentState() == NL_STATE_INITIAL)
-			nlBegin(NL_SYSTEM);
-		for (int coord = 0; coord < 3; ++coord)
-		{
-			Algo::LinearSolving::setupVariables<PFP2>(*map, p.vIndex, p.freeSelector->getMarker(), p.positionAttribute, coord);
-			nlBegin(NL_MATRIX);
-	//		LinearSolving::addRowsRHS_Laplacian_Cotan<PFP2>(*map, p.vIndex, p.edgeWeight, p.vertexArea, p.rotatedDiffCoord, coord);
-			Algo::LinearSolving::addRowsRHS_Laplacian_Topo<PFP2>(*map, p.vIndex, p.rotatedDiffCoord, coord);
-			nlEnd(NL_MATRIX);
-			nlEnd(NL_SYSTEM);
-			nlSolve();
-			Algo::LinearSolving::getResult<PFP2>(*map, p.vIndex, p.positionAttribute, coord);
-			nlReset(NL_TRUE);
-		}
+		if (!p.arap->isFactorized())
+			p.arap->setConstraints(p.freeSelector->getMarker());
+		p.arap->iterate();
+
+		// only the free vertices have moved: the vbo is updated with their blocks
+		const std::vector<Vertex>& freeVertices = p.freeSelector->getSelectedCells();
+		for (std::vector<Vertex>::const_iterator it = freeVertices.begin(); it != freeVertices.end(); ++it)
+			p.positionAttribute.setDirty(*it);
 	}
 }
 #if CGOGN_QT_DESIRED_VERSION == 5
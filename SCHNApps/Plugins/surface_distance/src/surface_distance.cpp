@@ -2,7 +2,7 @@
 
 #include "mapHandler.h"
 
-#include "Algo/Geometry/distances.h"
+#include "Algo/Geometry/hausdorff.h"
 
 namespace CGoGN
 {
@@ -122,12 +122,10 @@ void Surface_Distance_Plugin::computeDistance(
 	PFP2::MAP* map1 = mh1->getMap();
 	PFP2::MAP* map2 = mh2->getMap();
 
-	// compute distance between map1 and map2 here
-	//   distance from map1 to map2 can be stored in map1 vertex attribute distance1
-	//   distance from map2 to map1 can be stored in map2 vertex attribute distance2
-
-	// Algo::Geometry::computeDistance<PFP2>(map1, position1, distance1, map2, position2);
-	// Algo::Geometry::computeDistance<PFP2>(map2, position2, distance2, map1, position1);
+	// distance from map1 to map2 stored in map1 vertex attribute distance1
+	// distance from map2 to map1 stored in map2 vertex attribute distance2
+	Algo::Geometry::MeshDistance<PFP2::REAL> md = Algo::Geometry::hausdorffDistance<PFP2>(*map1, position1, distance1, *map2, position2, distance2);
+	CGoGNout << "Hausdorff distance: " << md.max << " / mean: " << md.mean << " / RMS: " << md.rms << CGoGNendl;
 
 	this->pythonRecording("computeDistance", "", mapName1, positionAttributeName1, distanceAttributeName1, 
 							mapName2, positionAttributeName2, distanceAttributeName2);
@@ -192,7 +192,8 @@ public:
 	const AttributeSet& getAttributeSet(unsigned int orbit) const { return m_attribs[orbit]; }
 
 	/// do necessary updates and send signals when an attribute has been modified
-	void notifyAttributeModification(const AttributeHandlerGen& attr);
+	/// (if dirtyOnly, the VBO only gets the blocks marked as modified with setDirty)
+	void notifyAttributeModification(const AttributeHandlerGen& attr, bool dirtyOnly = false);
 
 	/// do necessary updates and send signals when the topology of the map has been modified
 	void notifyConnectivityModification();
@@ -159,12 +159,17 @@ Utils::Drawer* MapHandlerGen::getBBDrawer() const
  * MANAGE ATTRIBUTES
  *********************************************************/
 
-void MapHandlerGen::notifyAttributeModification(const AttributeHandlerGen& attr)
+void MapHandlerGen::notifyAttributeModification(const AttributeHandlerGen& attr, bool dirtyOnly)
 {
 	QString nameAttr = QString::fromStdString(attr.name());
 
 	if (m_vbo.contains(nameAttr))
-		m_vbo[nameAttr]->updateData(attr);
+	{
+		if (dirtyOnly)
+			m_vbo[nameAttr]->updateDirtyData(attr);
+		else
+			m_vbo[nameAttr]->updateData(attr);
+	}
 
 	if (m_bbVertexAttribute && m_bbVertexAttribute->getName() == attr.name())
 		updateBB();